@@ -51,6 +51,9 @@
 #include <ctype.h>
 #include <fcntl.h>
 #include <locale.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
 
 /*
  * chkentry - check JSON files in an IOCCC submission
@@ -76,7 +79,7 @@ static bool quiet = false;		    /* true ==> quiet mode */
  * Use the usage() function to print the usage_msg([0-9]?)+ strings.
  */
 static const char * const usage_msg =
-    "usage: %s [-h] [-v level] [-J level] [-V] [-q] [-b] [-I path] ... [-P] [-s] [-S] [-w] dir\n"
+    "usage: %s [-h] [-v level] [-J level] [-V] [-q] [-b] [-I path] ... [-P] [-s] [-S] [-w] [-j threads] dir ...\n"
     "\n"
     "\t-h\t\tprint help message and exit\n"
     "\t-v level\tset verbosity level (def level: %d)\n"
@@ -94,6 +97,9 @@ static const char * const usage_msg =
     "\t\t\t    NOTE: -S conflicts with -I path, -P, -s, and -w\n"
     "\t-w\t\tIOCCC judge use only: winning entry checks\n"
     "\t\t\t    NOTE: -w conflicts with -s\n"
+    "\t-j threads\tcheck each dir at the same time on threads worker threads, 0 ==> one per CPU\n"
+    "\t\t\t    NOTE: without -j, only one dir may be given\n"
+    "\t\t\t    NOTE: -j writes ok or fail for each dir, in order, on stdout\n"
     "\n"
     "\tdir\tthe directory to be checked (entry directory if -w, submission directory otherwise)\n"
     "\n"
@@ -113,6 +119,12 @@ static const char * const usage_msg =
  * functions
  */
 static bool chk_json(FILE *err, char const *submission_dir, char const *filename, struct json_sem *sem);
+static bool chk_perms(struct walk_stat *wstat_p);
+static bool chk_dir(FILE *stream, char const *dir, struct walk_set const *wset_p, char const *context,
+		    bool winning_entry_mode, char * const *ignore, int ignore_count);
+static void *chk_worker(void *arg);
+static int chk_dirs_parallel(char * const *dir, int count, int threads, struct walk_set const *wset_p,
+			     char const *context, bool winning_entry_mode, char * const *ignore, int ignore_count);
 static void usage(int exitcode, char const *prog, char const *str) __attribute__((noreturn));
 
 
@@ -137,25 +149,36 @@ main(int argc, char *argv[])
     bool json_ok = true;		/* true ==> no JSON errors found, false ==> some JSON errors found */
     bool walk_ok = true;		/* true ==> no walk errors found, false ==> some walk errors found */
     /**/
-    struct item *i_p;			/* pointer to an element in the dynamic array */
-    intmax_t len;			/* number of elements in the dynamic array */
-    /**/
-    bool cap_I_seen = false;		/* The -I path was seen on the command line */
+    char **ignore = NULL;		/* -I paths in command line order */
+    int ignore_count = 0;		/* number of -I paths */
     bool skip_add_ret = false;		/* return from skip_add() */
     /**/
+    int threads = -1;			/* -j threads, 0 ==> one per CPU, < 0 ==> -j not used */
+    intmax_t num = 0;			/* -j threads as converted */
+    int exit_code = 0;			/* -j exit code */
+    /**/
     int cd_ret = -1;			/* chdir(2) return */
     /**/
     int i;
-    intmax_t j;
 
     /* IOCCC requires use of C locale */
     set_ioccc_locale();
 
+    /*
+     * room for every -I path
+     */
+    errno = 0;	/* pre-clear errno for errp() */
+    ignore = calloc((size_t)argc + 1, sizeof(char *));
+    if (ignore == NULL) {
+	errp(15, __func__, "calloc of %d -I paths failed", argc);
+	not_reached();
+    }
+
     /*
      * parse args
      */
     program = argv[0];
-    while ((i = getopt(argc, argv, ":hv:J:VqbI:PwsS")) != -1) {
+    while ((i = getopt(argc, argv, ":hv:J:VqbI:PwsSj:")) != -1) {
 	switch (i) {
 	case 'h':		/* -h - print help to stderr and exit 0 */
 	    usage(2, program, "");	/*ooo*/
@@ -197,7 +220,7 @@ main(int argc, char *argv[])
 	    msg("This is the option that goes \aBING!!!");
 	    exit(0); /*ooo*/
 	case 'I':
-	    cap_I_seen = true;
+	    ignore[ignore_count++] = optarg;
 	    break;
         case 'P':		/* -P - ignore permissions of paths */
             ignore_permissions = true;
@@ -211,6 +234,13 @@ main(int argc, char *argv[])
         case 'S':
             submission_mode = true;
             break;
+	case 'j':		/* -j threads */
+	    if (!string_to_intmax(optarg, &num) || num < 0 || num > CHKENTRY_MAX_THREADS) {
+		usage(3, program, "invalid -j threads"); /*ooo*/
+		not_reached();
+	    }
+	    threads = (int)num;
+	    break;
 	case ':':   /* option requires an argument */
 	case '?':   /* illegal option */
 	default:    /* anything else but should not actually happen */
@@ -225,8 +255,15 @@ main(int argc, char *argv[])
 	}
     }
     submit_dir = argv[optind]; /* IMPORTANT! */
-    switch (argc-optind) {
+    switch ((threads >= 0 && argc-optind >= 1) ? 1 : argc-optind) {
     case 1:
+	/*
+	 * -j checks each dir in its own worker thread
+	 */
+	if (threads >= 0) {
+	    break;
+	}
+
         /*
          * get absolute path of submission dir
          */
@@ -339,10 +376,22 @@ main(int argc, char *argv[])
 	    not_reached();
 	}
     }
-    dbg(DBG_LOW, "submission_dir: %s", submission_dir);
     dbg(DBG_LOW, "will use context: %s name: %s",
 		 context, (wset_p == NULL || wset_p->name == NULL) ? "((NULL))" : wset_p->name);
 
+    /*
+     * case: -j - check each dir at the same time on a pool of worker threads
+     */
+    if (threads >= 0) {
+	exit_code = chk_dirs_parallel(argv+optind, argc-optind, threads, wset_p, context, winning_entry_mode,
+				      ignore, ignore_count);
+	free(ignore);
+	ignore = NULL;
+	exit(exit_code); /*ooo*/
+	not_reached();
+    }
+    dbg(DBG_LOW, "submission_dir: %s", submission_dir);
+
     /*
      * init_walk_stat - initialize a walk_stat
      */
@@ -350,56 +399,27 @@ main(int argc, char *argv[])
 	init_walk_stat(&wstat,
 		       submission_dir, wset_p, context,
 		       0, 0, 0,
-		       false);
+		       false, false);
     } else {
 	init_walk_stat(&wstat,
 		       submission_dir, wset_p, context,
 		       MAX_PATH_LEN, MAX_FILENAME_LEN, MAX_PATH_DEPTH,
-		       false);
-    }
-
-    /*
-     * if we had -I path, rescan the command line looking for and processing -I path options
-     */
-    if (cap_I_seen) {
-
-	optind = 1;	/* reset getopt(3) processing */
-	while ((i = getopt(argc, argv, ":hv:J:VqI:PwsSb")) != -1) {
-	    switch (i) {
-	    case 'h':		/* -h - print help to stderr and exit 0 */
-	    case 'v':		/* -v verbosity */
-	    case 'J':		/* -J json_verbosity */
-	    case 'V':		/* -V - print version and exit */
-	    case 'q':
-	    case 'P':		/* -P - ignore permissions of paths */
-	    case 'w':
-	    case 's':
-	    case 'S':
-	    case 'b':
-		/* already processed, nothing to do now */
-		break;
-	    case 'I':
-		skip_add_ret = skip_add(&wstat, optarg);
-		if (skip_add_ret) {
-		    dbg(DBG_LOW, "context will ignore, when canonicalized: %s", optarg);
-		} else {
-		    dbg(DBG_MED, "path: %s is already marked for skipping", optarg);
-		}
-		break;
-	    case ':':   /* option requires an argument */
-	    case '?':   /* illegal option */
-	    default:    /* anything else but should not actually happen */
-		opt_error = fchk_inval_opt(stderr, program, i, optopt);
-		if (opt_error) {
-		    usage(3, program, ""); /*ooo*/
-		    not_reached();
-		} else {
-		    fwarn(stderr, __func__, "getopt() 2nd return: %c optopt: %c", (char)i, (char)optopt);
-		}
-		break;
-	    }
+		       false, false);
+    }
+
+    /*
+     * ignore each -I path
+     */
+    for (i=0; i < ignore_count; ++i) {
+	skip_add_ret = skip_add(&wstat, ignore[i]);
+	if (skip_add_ret) {
+	    dbg(DBG_LOW, "context will ignore, when canonicalized: %s", ignore[i]);
+	} else {
+	    dbg(DBG_MED, "path: %s is already marked for skipping", ignore[i]);
 	}
     }
+    free(ignore);
+    ignore = NULL;
 
     /*
      * walk a file system tree, recording steps
@@ -432,88 +452,19 @@ main(int argc, char *argv[])
     /*
      * check permissions unless ignore_permissions
      */
-    if (!ignore_permissions) {
-
-	/*
-	 * scan files for permissions
-	 */
-	len = dyn_array_tell(wstat.file);
-	for (j=0; j < len; ++j) {
-
-	    /*
-	     * obtain file permission
-	     */
-	    i_p = dyn_array_value(wstat.file, struct item *, j);
-	    if (i_p == NULL) {
-		err(10, CHKENTRY_BASENAME, "wstat.file[%jd] is NULL\n", j); /*coo*/
-		not_reached();
-	    } else if (i_p->fts_path == NULL) {
-		err(11, CHKENTRY_BASENAME, "wstat.file[%jd].fts_path is NULL\n", j);
-		not_reached();
-	    } else if (i_p->fts_name == NULL) {
-		err(12, CHKENTRY_BASENAME, "wstat.file[%jd].fts_name is NULL\n", j);
-		not_reached();
-	    }
-
-	    /*
-	     * case: file ends in .sh in any case
-	     */
-	    if (i_p->fts_namelen >= LITLEN(".sh") &&
-		strcasecmp(i_p->fts_name + i_p->fts_namelen - LITLEN(".sh"), ".sh") == 0) {
-
-		/*
-		 * verify mode 0555
-		 */
-		if (ITEM_PERM(i_p->st_mode) != ITEM_PERM_0555) {
-		    dbg(DBG_LOW, "shell file: %s permission: %03o != %03o",
-				  i_p->fts_path, ITEM_PERM(i_p->st_mode), ITEM_PERM_0555);
-		    walk_ok = false;
-		}
-
-	    /*
-	     * case: file does NOT end in .sh
-	     */
-	    } else {
-
-		/*
-		 * verify mode 0444
-		 */
-		if (ITEM_PERM(i_p->st_mode) != ITEM_PERM_0444) {
-		    dbg(DBG_LOW, "non-shell file: %s permission: %03o != %03o",
-				  i_p->fts_path, ITEM_PERM(i_p->st_mode), ITEM_PERM_0444);
-		    walk_ok = false;
-		}
-	    }
-	}
-
-	/*
-	 * scan directories for permissions
-	 */
-	len = dyn_array_tell(wstat.dir);
-	for (j=0; j < len; ++j) {
+    if (!ignore_permissions && !chk_perms(&wstat)) {
+	walk_ok = false;
+    }
 
-	    /*
-	     * obtain file permission
-	     */
-	    i_p = dyn_array_value(wstat.dir, struct item *, j);
-	    if (i_p == NULL) {
-		err(13, CHKENTRY_BASENAME, "wstat.dir[%jd] is NULL\n", j);
-		not_reached();
-	    } else if (i_p->fts_path == NULL) {
-		err(14, CHKENTRY_BASENAME, "wstat.dir[%jd].fts_path is NULL\n", j);
-		not_reached();
-	    }
+    /*
+     * JSON numbers are converted to C values only when a semantic check needs them
+     */
+    json_number_lazy = true;
 
-	    /*
-	     * verify mode 0755
-	     */
-	    if (ITEM_PERM(i_p->st_mode) != ITEM_PERM_0755) {
-		dbg(DBG_LOW, "directory: %s permission: %03o != %03o",
-			      i_p->fts_path, ITEM_PERM(i_p->st_mode), ITEM_PERM_0755);
-		walk_ok = false;
-	    }
-	}
-    }
+    /*
+     * each JSON parse tree is allocated from, and freed as, a single arena
+     */
+    json_tree_arena = true;
 
     /*
      * cd to the submission directory for any final JSON file verification
@@ -660,7 +611,7 @@ usage(int exitcode, char const *prog, char const *str)
 static bool
 chk_json(FILE *err, char const *submission_dir, char const *filename, struct json_sem *sem)
 {
-    FILE *stream = NULL;				/* file stream for the JSON file or NULL */
+    char *path = NULL;					/* path of the JSON file under submission_dir */
     struct json *tree = NULL;				/* JSON parse tree or NULL ==> not parsed or invalid JSON */
     bool json_valid = false;				/* true ==> JSON is valid, false ==> JSON is invalid */
     struct dyn_array *count_err = NULL;			/* JSON semantic count errors */
@@ -690,18 +641,22 @@ chk_json(FILE *err, char const *submission_dir, char const *filename, struct jso
     }
 
     /*
-     * open the JSON file under submission_dir
+     * form the path of the JSON file under submission_dir
      */
-    stream = open_dir_file(submission_dir, filename);
-    if (stream == NULL) {
+    path = calloc_path(submission_dir, filename);
+    if (! is_read(path)) {
 	fwarn(err, __func__, "failed to open: %s", filename);
+	free(path);
+	path = NULL;
 	return false;
     }
 
     /*
-     * parse the JSON file and check for valid JSON syntax
+     * parse the JSON file, in place, and check for valid JSON syntax
      */
-    tree = parse_json_stream(stream, filename, &json_valid);
+    tree = parse_json_mmap(path, &json_valid);
+    free(path);
+    path = NULL;
     if (json_valid == false || tree == NULL) {
 	fwarn(err, __func__, "file contains invalid JSON: %s", filename);
 	return false;
@@ -713,9 +668,12 @@ chk_json(FILE *err, char const *submission_dir, char const *filename, struct jso
     if (sem != NULL) {
 
 	/*
-	 * perform JSON semantic analysis on the .auth.json JSON parse tree
+	 * perform JSON semantic analysis on the JSON parse tree
+	 *
+	 * NOTE: submission_dir is passed as the semantic table data so that
+	 *	 chk_manifest() looks for the manifest files under submission_dir.
 	 */
-	all_err_count = json_sem_check(tree, JSON_DEFAULT_MAX_DEPTH, sem, &count_err, &val_err, NULL);
+	all_err_count = json_sem_check(tree, JSON_DEFAULT_MAX_DEPTH, sem, &count_err, &val_err, (void *)submission_dir);
 
 	/*
 	 * firewall for semantic analysis
@@ -836,3 +794,481 @@ chk_json(FILE *err, char const *submission_dir, char const *filename, struct jso
     dbg(DBG_LOW, "JSON file is OK: %s", filename);
     return true;
 }
+
+
+/*
+ * chk_perms - check the permissions of the files and directories of a walk
+ *
+ * Files that end in .sh (in any case) must be mode 0555, other files must be
+ * mode 0444, and directories must be mode 0755.
+ *
+ * given:
+ *	wstat_p		pointer to a walk_stat that has been walked
+ *
+ * returns:
+ *	true ==> all permissions are OK
+ *	false ==> some permission is wrong
+ *
+ * NOTE: This function does not return on an internal error.
+ */
+static bool
+chk_perms(struct walk_stat *wstat_p)
+{
+    struct item *i_p;			/* pointer to an element in the dynamic array */
+    intmax_t len;			/* number of elements in the dynamic array */
+    bool ok = true;			/* true ==> no permission errors found */
+    intmax_t j;
+
+    /*
+     * firewall
+     */
+    if (wstat_p == NULL) {
+	err(16, __func__, "wstat_p is NULL");
+	not_reached();
+    }
+
+    /*
+     * scan files for permissions
+     */
+    len = dyn_array_tell(walk_view(wstat_p, WALK_CAT_FILE));
+    for (j=0; j < len; ++j) {
+
+	/*
+	 * obtain file permission
+	 */
+	i_p = dyn_array_value(walk_view(wstat_p, WALK_CAT_FILE), struct item *, j);
+	if (i_p == NULL) {
+	    err(10, CHKENTRY_BASENAME, "wstat.file[%jd] is NULL\n", j); /*coo*/
+	    not_reached();
+	} else if (i_p->fts_path == NULL) {
+	    err(11, CHKENTRY_BASENAME, "wstat.file[%jd].fts_path is NULL\n", j);
+	    not_reached();
+	} else if (i_p->fts_name == NULL) {
+	    err(12, CHKENTRY_BASENAME, "wstat.file[%jd].fts_name is NULL\n", j);
+	    not_reached();
+	}
+
+	/*
+	 * case: file ends in .sh in any case
+	 */
+	if (i_p->fts_namelen >= LITLEN(".sh") &&
+	    strcasecmp(i_p->fts_name + i_p->fts_namelen - LITLEN(".sh"), ".sh") == 0) {
+
+	    /*
+	     * verify mode 0555
+	     */
+	    if (ITEM_PERM(i_p->st_mode) != ITEM_PERM_0555) {
+		dbg(DBG_LOW, "shell file: %s permission: %03o != %03o",
+			      i_p->fts_path, ITEM_PERM(i_p->st_mode), ITEM_PERM_0555);
+		ok = false;
+	    }
+
+	/*
+	 * case: file does NOT end in .sh
+	 */
+	} else {
+
+	    /*
+	     * verify mode 0444
+	     */
+	    if (ITEM_PERM(i_p->st_mode) != ITEM_PERM_0444) {
+		dbg(DBG_LOW, "non-shell file: %s permission: %03o != %03o",
+			      i_p->fts_path, ITEM_PERM(i_p->st_mode), ITEM_PERM_0444);
+		ok = false;
+	    }
+	}
+    }
+
+    /*
+     * scan directories for permissions
+     */
+    len = dyn_array_tell(walk_view(wstat_p, WALK_CAT_DIR));
+    for (j=0; j < len; ++j) {
+
+	/*
+	 * obtain file permission
+	 */
+	i_p = dyn_array_value(walk_view(wstat_p, WALK_CAT_DIR), struct item *, j);
+	if (i_p == NULL) {
+	    err(13, CHKENTRY_BASENAME, "wstat.dir[%jd] is NULL\n", j);
+	    not_reached();
+	} else if (i_p->fts_path == NULL) {
+	    err(14, CHKENTRY_BASENAME, "wstat.dir[%jd].fts_path is NULL\n", j);
+	    not_reached();
+	}
+
+	/*
+	 * verify mode 0755
+	 */
+	if (ITEM_PERM(i_p->st_mode) != ITEM_PERM_0755) {
+	    dbg(DBG_LOW, "directory: %s permission: %03o != %03o",
+			  i_p->fts_path, ITEM_PERM(i_p->st_mode), ITEM_PERM_0755);
+	    ok = false;
+	}
+    }
+    return ok;
+}
+
+
+/*
+ * chk_dir - check a submission (or with -w, an entry) directory
+ *
+ * This performs the same checks as chkentry does on a single dir, but without
+ * changing the current directory, and with its own copies of the walk_set and
+ * JSON semantic tables, so that more than one thread may check a directory at
+ * the same time.
+ *
+ * given:
+ *	stream		    stream on which to report errors
+ *	dir		    directory to check
+ *	wset_p		    walk_set to copy for the walk of dir
+ *	context		    string describing the context (tool and options)
+ *	winning_entry_mode  true ==> check .entry.json, false ==> check .auth.json and .info.json
+ *	ignore		    -I paths to ignore under dir
+ *	ignore_count	    number of -I paths
+ *
+ * returns:
+ *	true ==> all is OK
+ *	false ==> some check failed
+ *
+ * NOTE: This function does not return on an internal error.
+ */
+static bool
+chk_dir(FILE *stream, char const *dir, struct walk_set const *wset_p, char const *context,
+	bool winning_entry_mode, char * const *ignore, int ignore_count)
+{
+    char *abs_dir = NULL;			/* absolute path of dir */
+    struct walk_set *set = NULL;		/* this walk's copy of wset_p */
+    struct walk_stat wstat;			/* walk_stat being processed */
+    struct json_sem auth[SEM_AUTH_LEN+1];	/* this check's copy of sem_auth */
+    struct json_sem info[SEM_INFO_LEN+1];	/* this check's copy of sem_info */
+    bool ok = true;				/* true ==> no errors found */
+    int i;
+
+    /*
+     * firewall
+     */
+    if (stream == NULL || dir == NULL || wset_p == NULL || context == NULL || (ignore_count > 0 && ignore == NULL)) {
+	err(17, __func__, "called with NULL arg(s)");
+	not_reached();
+    }
+
+    /*
+     * get absolute path of dir
+     */
+    errno = 0;	/* pre-clear errno for fwarnp() */
+    abs_dir = realpath(dir, NULL);
+    if (abs_dir == NULL) {
+	fwarnp(stream, __func__, "failed to get absolute path for: %s", dir);
+	return false;
+    }
+
+    /*
+     * walk a file system tree, recording steps
+     */
+    set = dup_walk_set(wset_p);
+    if (ignore_permissions) {
+	init_walk_stat(&wstat,
+		       abs_dir, set, context,
+		       0, 0, 0,
+		       false, false);
+    } else {
+	init_walk_stat(&wstat,
+		       abs_dir, set, context,
+		       MAX_PATH_LEN, MAX_FILENAME_LEN, MAX_PATH_DEPTH,
+		       false, false);
+    }
+    for (i=0; i < ignore_count; ++i) {
+	(void) skip_add(&wstat, ignore[i]);
+    }
+    if (! fts_walk(&wstat)) {
+	fwarn(stream, CHKENTRY_BASENAME, "failed to scan: %s", abs_dir);
+	ok = false;
+    } else {
+
+	/*
+	 * sort walk_stat arrays by canonicalized path in a case independent way
+	 */
+	sort_walk_istat(&wstat);
+
+	/*
+	 * end walk and check if the walk was successful
+	 */
+	if (winning_entry_mode) {
+	    ok = chk_walk(&wstat, stream, ANY_COUNT, ANY_COUNT, NO_COUNT, NO_COUNT, true);
+	} else {
+	    ok = chk_walk(&wstat, stream, MAX_EXTRA_FILE_COUNT, MAX_EXTRA_DIR_COUNT, NO_COUNT, NO_COUNT, true);
+	}
+
+	/*
+	 * check permissions unless ignore_permissions
+	 */
+	if (!ignore_permissions && !chk_perms(&wstat)) {
+	    ok = false;
+	}
+
+	/*
+	 * check the JSON files
+	 *
+	 * TODO: until we have a struct json_sem for .entry.json, we pass NULL
+	 */
+	if (winning_entry_mode) {
+	    if (! chk_json(stream, abs_dir, ".entry.json", NULL)) {
+		ok = false;
+	    }
+	} else {
+	    memcpy(auth, sem_auth, sizeof(auth));
+	    if (! chk_json(stream, abs_dir, ".auth.json", auth)) {
+		ok = false;
+	    }
+	    memcpy(info, sem_info, sizeof(info));
+	    if (! chk_json(stream, abs_dir, ".info.json", info)) {
+		ok = false;
+	    }
+	}
+    }
+
+    /*
+     * free storage
+     */
+    free_walk_stat(&wstat);
+    free_dup_walk_set(set);
+    set = NULL;
+    free(abs_dir);
+    abs_dir = NULL;
+    return ok;
+}
+
+
+/*
+ * chk_worker - check directories from a pool until there are none left
+ *
+ * The reports of each directory are collected in memory so that they can be
+ * written in command line order.  A JSON string that cannot be decoded makes
+ * only its own directory invalid instead of ending the process.
+ *
+ * given:
+ *	arg	pointer to the shared struct chkentry_pool
+ *
+ * returns:
+ *	NULL
+ */
+static void *
+chk_worker(void *arg)
+{
+    struct chkentry_pool *pool = arg;	/* directories shared by the worker threads */
+    struct chkentry_dir *cur;		/* directory being checked */
+    FILE *stream;			/* where the reports of cur are collected */
+    int i;
+
+    json_string_err_invalid = true;
+    for (;;) {
+	/*
+	 * claim the next directory
+	 */
+	(void) pthread_mutex_lock(&pool->lock);
+	i = pool->next;
+	if (i < pool->count) {
+	    ++pool->next;
+	}
+	(void) pthread_mutex_unlock(&pool->lock);
+	if (i >= pool->count) {
+	    break;
+	}
+	cur = &pool->dir[i];
+
+	/*
+	 * check the directory, collecting its reports
+	 */
+	errno = 0;		/* pre-clear errno for warnp() */
+	stream = open_memstream(&cur->errors, &cur->errors_len);
+	if (stream == NULL) {
+	    warnp(__func__, "open_memstream failed: reporting errors of %s on stderr", cur->dir);
+	}
+	jparse_err_stream = stream;
+	cur->ok = chk_dir((stream != NULL) ? stream : stderr, cur->dir, pool->wset_p, pool->context,
+			  pool->winning_entry_mode, pool->ignore, pool->ignore_count);
+	jparse_err_stream = NULL;
+	if (stream != NULL) {
+	    (void) fclose(stream);
+	    stream = NULL;
+	}
+
+	/*
+	 * hand the result back to the main thread
+	 */
+	(void) pthread_mutex_lock(&pool->lock);
+	cur->done = true;
+	(void) pthread_cond_broadcast(&pool->done);
+	(void) pthread_mutex_unlock(&pool->lock);
+    }
+    return NULL;
+}
+
+
+/*
+ * chk_dirs_parallel - check directories at the same time on a pool of worker threads
+ *
+ * For each directory, in command line order and as soon as it and all of the
+ * directories before it are done, its reports are written to stderr and
+ * whether it passed is written to stdout.  The number of directories checked,
+ * and how long it took, is then written to stderr.
+ *
+ * given:
+ *	dir		    array of directories
+ *	count		    number of directories
+ *	threads		    number of worker threads, 0 ==> one per online CPU
+ *	wset_p		    walk_set each worker thread copies
+ *	context		    string describing the context (tool and options)
+ *	winning_entry_mode  true ==> check .entry.json, false ==> check .auth.json and .info.json
+ *	ignore		    -I paths to ignore under each directory
+ *	ignore_count	    number of -I paths
+ *
+ * returns:
+ *	0 ==> all directories passed
+ *	1 ==> one or more directories failed a check
+ *
+ * NOTE: This function does not return on error.
+ */
+static int
+chk_dirs_parallel(char * const *dir, int count, int threads, struct walk_set const *wset_p,
+		  char const *context, bool winning_entry_mode, char * const *ignore, int ignore_count)
+{
+    struct chkentry_pool pool;		/* directories shared by the worker threads */
+    pthread_t *tid = NULL;		/* worker threads */
+    struct timespec start;		/* when the first worker thread was started */
+    struct timespec stop;		/* when the last worker thread was joined */
+    double secs;			/* seconds between start and stop */
+    int failed = 0;			/* number of directories that failed a check */
+    int started;			/* number of worker threads started */
+    int ret;				/* pthread_create() return */
+    int i;
+
+    /*
+     * firewall
+     */
+    if (dir == NULL || wset_p == NULL || context == NULL) {
+	err(18, __func__, "called with NULL arg(s)");
+	not_reached();
+    }
+
+    /*
+     * size the thread pool
+     */
+    if (threads <= 0) {
+	long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+	threads = (cpus > 0) ? (int)((cpus > CHKENTRY_MAX_THREADS) ? CHKENTRY_MAX_THREADS : cpus) : 1;
+    }
+    if (threads > count) {
+	threads = (count > 0) ? count : 1;
+    }
+
+    /*
+     * set up the shared directories
+     */
+    memset(&pool, 0, sizeof(pool));
+    pool.count = count;
+    pool.wset_p = wset_p;
+    pool.context = context;
+    pool.winning_entry_mode = winning_entry_mode;
+    pool.ignore = ignore;
+    pool.ignore_count = ignore_count;
+    errno = 0;			/* pre-clear errno for errp() */
+    pool.dir = calloc((size_t)((count > 0) ? count : 1), sizeof(*pool.dir));
+    if (pool.dir == NULL) {
+	errp(19, __func__, "calloc of %d directories failed", count);
+	not_reached();
+    }
+    for (i = 0; i < count; ++i) {
+	pool.dir[i].dir = dir[i];
+    }
+    errno = 0;			/* pre-clear errno for errp() */
+    tid = calloc((size_t)threads, sizeof(*tid));
+    if (tid == NULL) {
+	errp(20, __func__, "calloc of %d threads failed", threads);
+	not_reached();
+    }
+    if (pthread_mutex_init(&pool.lock, NULL) != 0 || pthread_cond_init(&pool.done, NULL) != 0) {
+	err(21, __func__, "cannot initialize -j mutex or condition");
+	not_reached();
+    }
+
+    /*
+     * JSON numbers are converted to C values only when a semantic check needs them
+     */
+    json_number_lazy = true;
+
+    /*
+     * each JSON parse tree is allocated from, and freed as, a single arena
+     */
+    json_tree_arena = true;
+
+    /*
+     * start the worker threads, making do with fewer if we must
+     */
+    (void) clock_gettime(CLOCK_MONOTONIC, &start);
+    for (started = 0; started < threads; ++started) {
+	ret = pthread_create(&tid[started], NULL, chk_worker, &pool);
+	if (ret != 0) {
+	    if (started == 0) {
+		err(22, __func__, "pthread_create failed: %s", strerror(ret));
+		not_reached();
+	    }
+	    dbg(DBG_LOW, "pthread_create failed: %s: using %d threads", strerror(ret), started);
+	    break;
+	}
+    }
+
+    /*
+     * report results in command line order while the worker threads keep going
+     */
+    for (i = 0; i < count; ++i) {
+	(void) pthread_mutex_lock(&pool.lock);
+	while (!pool.dir[i].done) {
+	    (void) pthread_cond_wait(&pool.done, &pool.lock);
+	}
+	(void) pthread_mutex_unlock(&pool.lock);
+
+	if (pool.dir[i].errors != NULL) {
+	    if (pool.dir[i].errors_len > 0) {
+		(void) fwrite(pool.dir[i].errors, 1, pool.dir[i].errors_len, stderr);
+	    }
+	    free(pool.dir[i].errors);
+	    pool.dir[i].errors = NULL;
+	}
+	if (!pool.dir[i].ok) {
+	    warn(CHKENTRY_BASENAME, "check failed for: %s", pool.dir[i].dir);
+	    ++failed;
+	}
+	print("%s: %s\n", pool.dir[i].ok ? "ok" : "fail", pool.dir[i].dir);
+	(void) fflush(stdout);	/* keep stdout in order with stderr */
+    }
+    for (i = 0; i < started; ++i) {
+	(void) pthread_join(tid[i], NULL);
+    }
+    (void) clock_gettime(CLOCK_MONOTONIC, &stop);
+    (void) fflush(stdout);
+
+    /*
+     * aggregate timing
+     */
+    secs = (double)(stop.tv_sec - start.tv_sec) + (double)(stop.tv_nsec - start.tv_nsec) / 1e9;
+    if (secs <= 0.0) {
+	secs = 1e-9;
+    }
+    fprint(stderr, "%s: dirs: %d ok: %d failed: %d threads: %d seconds: %.3f dirs/s: %.1f\n",
+	   CHKENTRY_BASENAME, count, count - failed, failed, started, secs, (double)count / secs);
+
+    /*
+     * free storage
+     */
+    (void) pthread_cond_destroy(&pool.done);
+    (void) pthread_mutex_destroy(&pool.lock);
+    free(tid);
+    tid = NULL;
+    free(pool.dir);
+    pool.dir = NULL;
+
+    return (failed > 0) ? 1 : 0;
+}
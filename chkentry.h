@@ -45,6 +45,9 @@
 #    define  INCLUDE_CHKENTRY_H
 
 
+#include <pthread.h>
+
+
 /*
  * dbg - info, debug, warning, error, and usage message facility
  */
@@ -89,6 +92,40 @@
  */
 #define CHKENTRY_BASENAME "chkentry"
 
+/*
+ * -j threads
+ */
+#define CHKENTRY_MAX_THREADS (256)	/* maximum number of -j worker threads */
+
+/*
+ * chkentry_dir - a directory checked by a -j worker thread
+ */
+struct chkentry_dir
+{
+    char const *dir;		/* directory to check */
+    bool ok;			/* true ==> all checks passed */
+    char *errors;		/* malloced check reports of the directory, or NULL */
+    size_t errors_len;		/* length of errors */
+    bool done;			/* true ==> a worker thread has finished with this directory */
+};
+
+/*
+ * chkentry_pool - directories shared by the -j worker threads
+ */
+struct chkentry_pool
+{
+    struct chkentry_dir *dir;	/* directories to check, in command line order */
+    int count;			/* number of directories */
+    int next;			/* index of the next directory to hand to a worker thread */
+    struct walk_set const *wset_p; /* walk_set each worker thread copies */
+    char const *context;	/* string describing the context (tool and options) */
+    bool winning_entry_mode;	/* true ==> -w used, check .entry.json */
+    char * const *ignore;	/* -I paths to ignore under each directory */
+    int ignore_count;		/* number of -I paths */
+    pthread_mutex_t lock;	/* guards next and each done */
+    pthread_cond_t done;	/* signalled each time a directory is done */
+};
+
 /*
  * externals
  */
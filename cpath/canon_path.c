@@ -87,6 +87,27 @@
     }
 
 
+/*
+ * report a path canonicalization error - used by canon_path_r()
+ *
+ * Set *sanity_p to path_err if sanity_p is non-NULL
+ * Set *len_p to path_len if path_len is non-NULL
+ * Set *depth_p to deep if path_len is non-NULL
+ */
+#define report_canon_r_err(path_err, sanity_p, len_p, depth_p) \
+    { \
+	if ((sanity_p) != NULL) { \
+	    *(enum path_sanity *)(sanity_p) = (enum path_sanity)(path_err); \
+	} \
+	if ((len_p) != NULL) { \
+	    *(size_t *)(len_p) = path_len; \
+	} \
+	if ((depth_p) != NULL) { \
+	    *(int_least32_t *)(depth_p) = deep; \
+	} \
+    }
+
+
 #define PATH_INITIAL_SIZE (16)	/* initially allocate this many pointers */
 #define PATH_CHUNK_SIZE (8)	/* grow dynamic array by this many pointers at a time */
 
@@ -224,6 +245,9 @@ path_sanity_name(enum path_sanity sanity)
         case PATH_ERR_WRONG_LEN:
             str = "PATH_ERR_WRONG_LEN";
             break;
+        case PATH_ERR_BUF_TOO_SMALL:
+            str = "PATH_ERR_BUF_TOO_SMALL";
+            break;
         default:
             str = "unknown_sanity_valud";
             break;
@@ -285,6 +309,9 @@ path_sanity_error(enum path_sanity sanity)
         case PATH_ERR_WRONG_LEN:
             str = "constructed canonical path has the wrong length (internal error)";
             break;
+        case PATH_ERR_BUF_TOO_SMALL:
+            str = "caller supplied buffer is too small for the path (internal error)";
+            break;
         default:
             str = "invalid path_sanity value";
             break;
@@ -571,6 +598,7 @@ canon_path(char const *orig_path,
     bool relative = true;		/* true ==> path is relative to "." (dot), false ==> path is absolute */
     struct dyn_array *array = NULL;	/* dynamic array of pointers to strings - path component stack */
     char *p = NULL;		/* path component */
+    char *last = NULL;		/* strtok_r(3) state */
     char **q = NULL;		/* address of a dynamic array string element */
     int_least32_t deep = 0;	/* path depth (see note above this function) */
     bool test = true;		/* true ==> passed test, false == failed test */
@@ -648,10 +676,11 @@ canon_path(char const *orig_path,
     /*
      * process each path component
      *
-     * The strtok(3) function will skip over 1 or more "/" (slash)'s and turn the
-     * next path component into a NUL byte terminated string.
+     * The strtok_r(3) function will skip over 1 or more "/" (slash)'s and turn the
+     * next path component into a NUL byte terminated string.  We use strtok_r(3)
+     * instead of strtok(3) so that more than one thread may canonicalize paths.
      */
-    for (i=0, p=strtok(path, "/"); p != NULL; p=strtok(NULL, "/"), ++i) {
+    for (i=0, p=strtok_r(path, "/", &last); p != NULL; p=strtok_r(NULL, "/", &last), ++i) {
 
 	/*
 	 * check for "." (dot)
@@ -948,7 +977,7 @@ canon_path(char const *orig_path,
 		 * and converting to lower case means that beforehand, ANY case is OK.
 		 *
 		 * We will set slash_ok to false because this is a path component
-		 * and strtok(3) should never let "/" (slash) be present.
+		 * and strtok_r(3) should never let "/" (slash) be present.
 		 */
 		test = safe_path_str(*q, true, false);
 		if (! test) {
@@ -1175,3 +1204,451 @@ canon_path(char const *orig_path,
      */
     return ret_path;
 }
+
+
+/*
+ * canon_path_r - canonicalize a path into a caller supplied buffer
+ *
+ * This function canonicalizes orig_path exactly as canon_path() does, with the
+ * same arguments, the same enum path_sanity results, and the same *len_p and
+ * *depth_p values, but without any heap allocation: the canonicalized path is
+ * formed in buf.
+ *
+ * Instead of a strdup(3)ed copy of orig_path split by strtok_r(3) into a
+ * dynamic array of components, the path components are scanned in place and
+ * appended to buf.  The canonicalized path being built in buf is itself the
+ * path component stack: a .. (dot-dot) pops the stack by backing up to the
+ * previous "/" (slash) in buf.
+ *
+ * Because canonicalization never lengthens a path, a buf of strlen(orig_path)+1
+ * bytes is always large enough.
+ *
+ * given:
+ *	orig_path	    - path to canonicalize
+ *	buf		    - buffer in which to form the canonicalized path
+ *	bufsiz		    - size of buf in bytes, must be > strlen(orig_path)
+ *      max_path_len        - max canonicalized path length, 0 ==> no limit
+ *	max_filename_len    - max length of each component of path, 0 ==> no limit
+ *      max_depth           - max depth of subdirectory path, 0 ==> no limit, <0 ==> reserved for future use
+ *      sanity_p	    - NULL ==> don't save canon_path path_sanity error, or PATH_OK
+ *			      != NULL ==> save enum path_sanity in *sanity_p
+ *      len_p		    - NULL ==> don't save canonical path length,
+ *		              != NULL ==> save canonical path length in *len_p
+ *      depth_p		    - NULL ==> don't save canonical depth,
+ *			      != NULL ==> record canonical depth in *depth_p
+ *      rel_only	    - true ==> path from "/" (slash) NOT allowed, path depth counted from implied "." (dot)
+ *			      false ==> path from "/" (slash) allowed, path depth counted from /
+ *	lower_case	    - true ==> convert UPPER CASE to lower case during canonicalization
+ *			      false ==> don't change path case
+ *	safe_chk	    - true ==> test each canonical path component for safety
+ *			      false ==> do not perform path safety tests on the path
+ *	dotdot_err	    - true ==> return PATH_ERR_DOTDOT_OVER_TOPDIR if .. (dot-dot) moves before start of path
+ *			      false ==> keep .. (dot_dot) in canonicalized path when it moves before start of path
+ *	preg		    - NULL ==> safe component check via safe_path_str() for ^[0-9A-Za-z._][0-9A-Za-z._+-]*$
+ *			      != NULL ==> safe component check via regcomp(3) compiled regular expression
+ *
+ * returns:
+ *	NULL ==> invalid path, buf is NULL or too small, or NULL pointer used
+ *	!= NULL ==> buf, holding the NUL terminated canonicalized path
+ *
+ * NOTE: When NULL is returned, the contents of buf are undefined, and:
+ *
+ *          if sanity_p is non-NULL, then
+ *              *sanity_p will be set some value that is != PATH_OK
+ *
+ *	 If buf is NULL or bufsiz is too small, *sanity_p is set to PATH_ERR_BUF_TOO_SMALL.
+ */
+char *
+canon_path_r(char const *orig_path, char *buf, size_t bufsiz,
+	     size_t max_path_len, size_t max_filename_len, int_least32_t max_depth,
+	     enum path_sanity *sanity_p, size_t *len_p, int_least32_t *depth_p,
+	     bool rel_only, bool lower_case, bool safe_chk, bool dotdot_err,
+	     const regex_t *restrict preg)
+{
+    size_t path_len = 0;	/* full path length */
+    size_t orig_len = 0;	/* length of orig_path */
+    size_t used = 0;		/* bytes of buf holding the path component stack */
+    size_t top = 0;		/* offset in buf of the top path component */
+    size_t comp_len = 0;	/* path component length */
+    size_t i = 0;		/* offset in orig_path */
+    size_t j = 0;		/* offset in buf */
+    char const *p = NULL;	/* path component in orig_path */
+    char save = '\0';		/* byte of buf replaced by a NUL while checking a component */
+    bool relative = true;	/* true ==> path is relative to "." (dot), false ==> path is absolute */
+    int_least32_t deep = 0;	/* path depth (see note above the canon_path() function) */
+    bool test = true;		/* true ==> passed test, false == failed test */
+    int regexec_ret = 0;	/* regexec(3) return code */
+
+    /*
+     * firewall
+     */
+    if (orig_path == NULL) {
+
+	/* orig_path is NULL error */
+	dbg(DBG_V2_HIGH, "%s: error #0: orig_path is NULL", __func__);
+	report_canon_r_err(PATH_ERR_PATH_IS_NULL, sanity_p, len_p, depth_p);
+	return NULL;
+    }
+
+    /*
+     * case: empty path
+     */
+    if (orig_path[0] == '\0') {
+
+	/* orig_path is an empty string error */
+	dbg(DBG_V2_HIGH, "%s: error #1: orig_path is empty", __func__);
+	report_canon_r_err(PATH_ERR_PATH_EMPTY, sanity_p, len_p, depth_p);
+	return NULL;
+
+    /*
+     * case: orig_path is absolute
+     */
+    } else if (orig_path[0] == '/') {
+	if (rel_only) {
+
+	    /* orig_path is absolute, but rel_only is true */
+	    dbg(DBG_V2_HIGH, "%s: error #2: orig_path is not relative: %s", __func__, orig_path);
+	    report_canon_r_err(PATH_ERR_NOT_RELATIVE, sanity_p, len_p, depth_p);
+	    return NULL;
+
+	} else {
+
+	    /* orig_path is absolute and allowed to be absolute */
+	    relative = false;
+	}
+    }
+
+    /*
+     * the canonicalized path is never longer than orig_path, or "." (dot) or "/" (slash)
+     */
+    orig_len = strlen(orig_path);
+    if (buf == NULL || bufsiz <= orig_len) {
+
+	/* caller supplied buffer is NULL or too small */
+	dbg(DBG_V2_HIGH, "%s: error #3: buf is NULL or bufsiz: %zu <= path length: %zu", __func__, bufsiz, orig_len);
+	report_canon_r_err(PATH_ERR_BUF_TOO_SMALL, sanity_p, len_p, depth_p);
+	return NULL;
+    }
+
+    /*
+     * process each path component
+     *
+     * Like strtok_r(3) as used by canon_path(), 1 or more "/" (slash)'s separate
+     * path components, and leading and trailing "/" (slash)'s are ignored.
+     */
+    for (i=0; i < orig_len; i += comp_len) {
+
+	/*
+	 * skip over "/" (slash)
+	 */
+	if (orig_path[i] == '/') {
+	    comp_len = 1;
+	    continue;
+	}
+
+	/*
+	 * find the end of this path component
+	 */
+	p = orig_path + i;
+	for (comp_len = 1; i+comp_len < orig_len && p[comp_len] != '/'; ++comp_len) {
+	    ;
+	}
+
+	/*
+	 * ignore "." (dot)
+	 */
+	if (comp_len == 1 && p[0] == '.') {
+	    continue;
+	}
+
+	/*
+	 * if .. (dot-dot), attempt to pop the path component stack
+	 */
+	if (comp_len == 2 && p[0] == '.' && p[1] == '.') {
+
+	    /*
+	     * find the top of a non-empty component stack
+	     */
+	    if (deep > 0) {
+		for (top = used; top > 0 && buf[top-1] != '/'; --top) {
+		    ;
+		}
+
+		/*
+		 * case: top (i.e., the previous path) the component stack is NOT .. (dot-dot)
+		 *
+		 * We let the component .. (dot-dot) to pop the previous path component from the stack
+		 */
+		if (used-top != 2 || buf[top] != '.' || buf[top+1] != '.') {
+		    used = (top > 0) ? top-1 : 0;
+		    --deep;
+		    continue;
+		}
+
+	    /*
+	     * case: return PATH_ERR_DOTDOT_OVER_TOPDIR if .. (dot-dot) moves above topdir
+	     */
+	    } else if (dotdot_err) {
+
+		/* path component stack underflow */
+		dbg(DBG_V2_HIGH, "%s: error #4: path component stack underflow: %s", __func__, orig_path);
+		report_canon_r_err(PATH_ERR_DOTDOT_OVER_TOPDIR, sanity_p, len_p, depth_p);
+		return NULL;
+
+	    /*
+	     * case: For an absolute path that is now at /, we simply toss this .. (dot-dot).
+	     *	 This is because at the / (slash) root, .. (dot-dot) is linked to the / (slash) root.
+	     */
+	    } else if (! relative) {
+		continue;
+	    }
+
+	    /*
+	     * fall thru to push .. (dot-dot) onto an empty relative path stack, or onto a .. (dot-dot)
+	     */
+	}
+
+	/*
+	 * be sure that the path component is not too long if max_filename_len > 0
+	 */
+	if (max_filename_len > 0 && comp_len > max_filename_len) {
+
+	    /* path component too long */
+	    dbg(DBG_V2_HIGH, "%s: error #5: path component length: %zu > max_filename_len: %zu",
+		__func__, comp_len, max_filename_len);
+	    report_canon_r_err(PATH_ERR_NAME_TOO_LONG, sanity_p, len_p, depth_p);
+	    return NULL;
+	}
+
+	/*
+	 * push component onto the path stack, converting to lower case if lower_case
+	 */
+	if (deep > 0 || ! relative) {
+	    buf[used++] = '/';
+	}
+	if (lower_case) {
+	    for (j=0; j < comp_len; ++j) {
+		buf[used+j] = (char)tolower((unsigned char)p[j]);
+	    }
+	} else {
+	    memcpy(buf+used, p, comp_len);
+	}
+	used += comp_len;
+	++deep;
+    }
+
+    /*
+     * check depth if max_depth > 0
+     */
+    if (max_depth > 0 && deep > max_depth) {
+
+	/* path component too deep */
+	dbg(DBG_V2_HIGH, "%s: error #6: path depth: %d max_depth: %d", __func__, deep, max_depth);
+	report_canon_r_err(PATH_ERR_PATH_TOO_DEEP, sanity_p, len_p, depth_p);
+	return NULL;
+    }
+
+    /*
+     * test each canonical path component is safe
+     *
+     * Like canon_path(), path_len counts each "/" (slash) first, then the length of each
+     * component that passed, so that a PATH_ERR_NOT_SAFE reports the same *len_p.
+     */
+    path_len = (relative) ? (deep>0 ? deep-1 : 0) : deep;
+    if (safe_chk) {
+	for (top = (relative ? 0 : 1); top < used; top = j+1) {
+
+	    /*
+	     * temporarily NUL terminate the component in buf
+	     */
+	    for (j = top; j < used && buf[j] != '/'; ++j) {
+		;
+	    }
+	    save = buf[j];
+	    buf[j] = '\0';
+
+	    /*
+	     * case: preg is NULL
+	     *
+	     * Use safe_path_str(component, true, false) to check the canonical path component for:
+	     *
+	     *	    ^[0-9A-Za-z._][0-9A-Za-z._+-]*$
+	     */
+	    if (preg == NULL) {
+		test = safe_path_str(buf+top, true, false);
+
+	    /*
+	     * case: use the compiled regular expression preg
+	     */
+	    } else {
+		regexec_ret = regexec(preg, buf+top, 0, NULL, 0);
+		test = (regexec_ret == 0);
+		if (regexec_ret != 0 && regexec_ret != REG_NOMATCH && dbg_allowed(DBG_V2_HIGH)) {
+
+		    char errbuf[BUFSIZ+1];	    /* regerror() message buffer */
+
+		    memset(errbuf, 0, sizeof(errbuf));
+		    (void) regerror(regexec_ret, preg, errbuf, BUFSIZ);
+		    dbg(DBG_V2_HIGH, "%s: regexec error: %s", __func__, errbuf);
+		}
+	    }
+	    if (! test) {
+
+		/* path component is unsafe */
+		dbg(DBG_V2_HIGH, "%s: error #7: path component is not safe: %s", __func__, buf+top);
+		report_canon_r_err(PATH_ERR_NOT_SAFE, sanity_p, len_p, depth_p);
+		return NULL;
+	    }
+	    buf[j] = save;
+
+	    /* sum component length */
+	    path_len += j-top;
+	}
+    } else {
+	path_len = used;
+    }
+
+    /*
+     * check canonicalized path length if max_path_len > 0
+     */
+    if (max_path_len > 0 && path_len > max_path_len) {
+
+	/* path too long */
+	dbg(DBG_V2_HIGH, "%s: error #8: path length: %zu > max_path_len: %zu", __func__, path_len, max_path_len);
+	report_canon_r_err(PATH_ERR_PATH_TOO_LONG, sanity_p, len_p, depth_p);
+	return NULL;
+    }
+
+    /*
+     * special case: path is "." (dot) or "/" (slash)
+     *
+     * If we have no components on the path stack, then we have just the topdir,
+     * which will be "/" (slash) is path is absolute, or "." (dot) otherwise.
+     */
+    if (deep <= 0) {
+	buf[0] = (relative) ? '.' : '/';
+	used = 1;
+    }
+    buf[used] = '\0';
+
+    /*
+     * fill in return stats as required
+     */
+    if (sanity_p != NULL) {
+	*sanity_p = PATH_OK;
+    }
+    if (len_p != NULL) {
+	*len_p = used;
+    }
+    if (depth_p != NULL) {
+	*depth_p = deep;
+    }
+
+    /*
+     * return the canonical path in buf
+     */
+    return buf;
+}
+
+
+/*
+ * canon_path_batch - canonicalize many paths into a caller supplied buffer
+ *
+ * Canonicalize orig_path[0] thru orig_path[count-1] by canon_path_r(), packing the
+ * NUL terminated canonicalized paths one after another into buf.  All paths are
+ * canonicalized with the same limits and flags.
+ *
+ * Canonicalization stops early, before a path that does not fit into what remains
+ * of buf.  The caller may then use the results, and call again with the
+ * remaining paths.  For example:
+ *
+ *	for (i=0; i < count; i += done) {
+ *	    done = canon_path_batch(path+i, count-i, buf, sizeof(buf), cpath+i, ...,
+ *				    sanity+i, NULL, NULL, true, false, true, true, NULL);
+ *	    ... use cpath[i] thru cpath[i+done-1] before buf is reused ...
+ *	}
+ *
+ * A path that would not fit even into an empty buf is not a reason to stop: it is
+ * given a PATH_ERR_BUF_TOO_SMALL error, and the batch continues.
+ *
+ * given:
+ *	orig_path	    - array of count paths to canonicalize
+ *	count		    - number of paths in orig_path
+ *	buf		    - buffer in which to form the canonicalized paths
+ *	bufsiz		    - size of buf in bytes
+ *	cpath		    - NULL ==> don't save the canonicalized paths
+ *			      != NULL ==> array of count pointers, set to the canonical path in buf, or NULL
+ *      max_path_len        - max canonicalized path length, 0 ==> no limit
+ *	max_filename_len    - max length of each component of path, 0 ==> no limit
+ *      max_depth           - max depth of subdirectory path, 0 ==> no limit, <0 ==> reserved for future use
+ *      sanity		    - NULL ==> don't save canon_path path_sanity errors
+ *			      != NULL ==> array of count enum path_sanity values
+ *      len		    - NULL ==> don't save canonical path lengths
+ *			      != NULL ==> array of count canonical path lengths
+ *      depth		    - NULL ==> don't save canonical depths
+ *			      != NULL ==> array of count canonical depths
+ *      rel_only, lower_case, safe_chk, dotdot_err, preg - as for canon_path()
+ *
+ * returns:
+ *	number of paths processed, from 0 to count
+ *
+ * NOTE: 0 is returned only if count is 0, orig_path is NULL, or buf is NULL.
+ */
+size_t
+canon_path_batch(char const * const *orig_path, size_t count, char *buf, size_t bufsiz,
+		 char **cpath, size_t max_path_len, size_t max_filename_len, int_least32_t max_depth,
+		 enum path_sanity *sanity, size_t *len, int_least32_t *depth,
+		 bool rel_only, bool lower_case, bool safe_chk, bool dotdot_err,
+		 const regex_t *restrict preg)
+{
+    enum path_sanity ret_sanity = PATH_ERR_UNSET;	/* canon_path_r() error code, or PATH_OK */
+    size_t ret_len = 0;		/* canon_path_r() canonical path length */
+    size_t need = 0;		/* buf space needed by a path */
+    size_t off = 0;		/* offset in buf of the next canonical path */
+    char *ret = NULL;		/* canon_path_r() return */
+    size_t i;
+
+    /*
+     * firewall
+     */
+    if (orig_path == NULL || buf == NULL) {
+	dbg(DBG_V2_HIGH, "%s: orig_path or buf is NULL", __func__);
+	return 0;
+    }
+
+    /*
+     * canonicalize each path that fits
+     */
+    for (i=0; i < count; ++i) {
+
+	/*
+	 * stop before a path that does not fit into the rest of buf, but would fit into buf
+	 */
+	if (orig_path[i] != NULL) {
+	    need = strlen(orig_path[i]) + 1;
+	    if (need > bufsiz-off && need <= bufsiz) {
+		break;
+	    }
+	}
+
+	/*
+	 * canonicalize this path
+	 */
+	ret = canon_path_r(orig_path[i], buf+off, bufsiz-off, max_path_len, max_filename_len, max_depth,
+			   &ret_sanity, &ret_len, depth == NULL ? NULL : depth+i,
+			   rel_only, lower_case, safe_chk, dotdot_err, preg);
+	if (cpath != NULL) {
+	    cpath[i] = ret;
+	}
+	if (sanity != NULL) {
+	    sanity[i] = ret_sanity;
+	}
+	if (len != NULL) {
+	    len[i] = ret_len;
+	}
+	if (ret != NULL) {
+	    off += ret_len + 1;
+	}
+    }
+    return i;
+}
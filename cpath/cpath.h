@@ -87,7 +87,7 @@
 /*
  * official cpath version
  */
-#define CPATH_VERSION "2.0.0 2025-10-16" /* format: major.minor YYYY-MM-DD */
+#define CPATH_VERSION "2.1.0 2026-10-18" /* format: major.minor YYYY-MM-DD */
 
 
 /*
@@ -112,6 +112,7 @@ enum path_sanity
     PATH_ERR_MALLOC,			/* malloc related failure during path processing (internal error) */
     PATH_ERR_NULL_COMPONENT,		/* component on path stack is NULL (internal error) */
     PATH_ERR_WRONG_LEN,			/* constructed canonical path has the wrong length (internal error) */
+    PATH_ERR_BUF_TOO_SMALL,		/* caller supplied buffer is too small for the path (internal error) */
 };
 
 
@@ -133,5 +134,15 @@ extern char *canon_path(char const *orig_path,
 			enum path_sanity *sanity_p, size_t *len_p, int_least32_t *depth_p,
 			bool rel_only, bool lower_case, bool safe_chk, bool dotdot_err,
 			const regex_t *restrict preg);
+extern char *canon_path_r(char const *orig_path, char *buf, size_t bufsiz,
+			  size_t max_path_len, size_t max_filename_len, int_least32_t max_depth,
+			  enum path_sanity *sanity_p, size_t *len_p, int_least32_t *depth_p,
+			  bool rel_only, bool lower_case, bool safe_chk, bool dotdot_err,
+			  const regex_t *restrict preg);
+extern size_t canon_path_batch(char const * const *orig_path, size_t count, char *buf, size_t bufsiz,
+			       char **cpath, size_t max_path_len, size_t max_filename_len, int_least32_t max_depth,
+			       enum path_sanity *sanity, size_t *len, int_least32_t *depth,
+			       bool rel_only, bool lower_case, bool safe_chk, bool dotdot_err,
+			       const regex_t *restrict preg);
 
 #endif				/* INCLUDE_CPATH_H */
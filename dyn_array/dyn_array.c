@@ -71,6 +71,7 @@ const char *const dyn_array_version = DYN_ARRAY_VERSION;	/* library version form
  * external allocation functions
  */
 static bool dyn_array_grow(struct dyn_array *array, intmax_t elms_to_allocate);
+static intmax_t dyn_array_grow_size(struct dyn_array *array, intmax_t elms_needed);
 static enum ptr_compare compare_addr(void *a, void *b);
 static enum move_case determine_move_case(void *first_alloc, void *last_alloc, void *first_add, void *last_add);
 static char const *move_case_name(enum move_case mv_case);
@@ -205,6 +206,55 @@ dyn_array_grow(struct dyn_array *array, intmax_t elms_to_allocate)
 }
 
 
+/*
+ * dyn_array_grow_size - determine how many elements to grow a dynamic array by
+ *
+ * given:
+ *      array			pointer to the dynamic array
+ *      elms_needed		minimum number of elements the allocation must grow by
+ *
+ * returns:
+ *	number of elements to pass to dyn_array_grow(), according to array->growth
+ *
+ * The returned number of elements is always a multiple of array->chunk.
+ *
+ * NOTE: This function does not return on error.
+ */
+static intmax_t
+dyn_array_grow_size(struct dyn_array *array, intmax_t elms_needed)
+{
+    intmax_t elms = elms_needed;	/* number of elements to grow by */
+
+    /*
+     * Check preconditions (firewall) - sanity check args
+     */
+    if (array == NULL) {
+	err(159, __func__, "array arg is NULL");
+	not_reached();
+    }
+    if (elms_needed <= 0) {
+	err(160, __func__, "elms_needed arg must be > 0: %jd", elms_needed);
+	not_reached();
+    }
+    if (array->chunk <= 0) {
+	err(161, __func__, "array->chunk in dynamic array must be > 0: %jd", array->chunk);
+	not_reached();
+    }
+
+    /*
+     * geometric growth grows by at least a fraction of the current allocation
+     */
+    if (array->growth == DYN_ARRAY_GROW_GEOMETRIC && elms < array->allocated / DYN_ARRAY_GROWTH_DIVISOR) {
+	elms = array->allocated / DYN_ARRAY_GROWTH_DIVISOR;
+    }
+
+    /*
+     * round up to a multiple of chunk
+     */
+    return array->chunk * ((elms + (array->chunk - 1)) / array->chunk);
+}
+
+
 /*
  * compare_addr - compare two addresses
  *
@@ -685,6 +735,7 @@ dyn_array_create(size_t elm_size, intmax_t chunk, intmax_t start_elm_count, bool
     /* Allocate a number of elements multiple of chunk */
     ret->allocated = chunk * ((start_elm_count + (chunk - 1)) / chunk);
     ret->chunk = chunk;
+    ret->growth = DYN_ARRAY_GROW_CHUNK;
 
     /*
      * determine the size of the allocated area
@@ -899,8 +950,7 @@ dyn_array_append_set(struct dyn_array *array, void *array_to_add_p, intmax_t cou
 	/*
 	 * determine the new allocated data size that as need
 	 */
-	required_elements_to_allocate = array->chunk *
-		((count_of_elements_to_add - available_empty_elements + (array->chunk - 1)) / array->chunk);
+	required_elements_to_allocate = dyn_array_grow_size(array, count_of_elements_to_add - available_empty_elements);
 
 	/*
 	 * expand the allocated data and note of the data moved
@@ -1391,7 +1441,7 @@ dyn_array_seek(struct dyn_array *array, off_t offset, int whence)
     } else {
 
 	/* grow the array */
-	moved = dyn_array_grow(array, setpoint - array->allocated);
+	moved = dyn_array_grow(array, dyn_array_grow_size(array, setpoint - array->allocated));
     }
 
     /* set new in use count */
@@ -1482,6 +1532,112 @@ dyn_array_clear(struct dyn_array *array)
 }
 
 
+/*
+ * dyn_array_set_growth - set how a dynamic array grows
+ *
+ * given:
+ *      array		- pointer to the dynamic array
+ *      growth		- DYN_ARRAY_GROW_CHUNK or DYN_ARRAY_GROW_GEOMETRIC
+ *
+ * A dynamic array from dyn_array_create() grows by DYN_ARRAY_GROW_CHUNK.
+ * Use DYN_ARRAY_GROW_GEOMETRIC when a dynamic array may grow by many
+ * small appends or seeks, relative to its chunk, to a large size.
+ *
+ * NOTE: This function does not return on error.
+ */
+void
+dyn_array_set_growth(struct dyn_array *array, enum dyn_array_growth growth)
+{
+    /*
+     * Check preconditions (firewall) - sanity check args
+     */
+    if (array == NULL) {
+	err(162, __func__, "array arg is NULL");
+	not_reached();
+    }
+    if (growth != DYN_ARRAY_GROW_CHUNK && growth != DYN_ARRAY_GROW_GEOMETRIC) {
+	err(163, __func__, "invalid growth policy: %d", (int)growth);
+	not_reached();
+    }
+
+    array->growth = growth;
+    if (dbg_allowed(DBG_V5_HIGH)) {
+	dbg(DBG_V5_HIGH, "in %s(array, %s)", __func__,
+			 (growth == DYN_ARRAY_GROW_GEOMETRIC ? "DYN_ARRAY_GROW_GEOMETRIC" : "DYN_ARRAY_GROW_CHUNK"));
+    }
+    return;
+}
+
+
+/*
+ * dyn_array_reserve - make room for a number of additional elements
+ *
+ * given:
+ *      array		- pointer to the dynamic array
+ *      elm_count	- number of elements, beyond those in use, to make room for
+ *
+ * returns:
+ *	true ==> address of the array of elements moved during realloc()
+ *	false ==> address of the elements array did not move
+ *
+ * After this call, elm_count elements may be appended to (or seeked forward in)
+ * the dynamic array without a realloc().  The allocation is grown, regardless
+ * of the growth policy, only to the fewest chunks needed.  The number of
+ * elements in use is not changed.
+ *
+ * NOTE: This function does not return on error.
+ */
+bool
+dyn_array_reserve(struct dyn_array *array, intmax_t elm_count)
+{
+    intmax_t elms_needed;	/* number of elements the allocation must grow by */
+    bool moved = false;		/* true ==> location of the elements array moved during realloc() */
+
+    /*
+     * Check preconditions (firewall) - sanity check args
+     */
+    if (array == NULL) {
+	err(164, __func__, "array arg is NULL");
+	not_reached();
+    }
+    if (elm_count < 0) {
+	err(165, __func__, "elm_count arg must be >= 0: %jd", elm_count);
+	not_reached();
+    }
+
+    /*
+     * Check preconditions (firewall) - sanity check array
+     */
+    if (array->data == NULL) {
+	err(166, __func__, "array->data for dynamic array is NULL");
+	not_reached();
+    }
+    if (array->chunk <= 0) {
+	err(167, __func__, "array->chunk in dynamic array must be > 0: %jd", array->chunk);
+	not_reached();
+    }
+    if (array->count > array->allocated) {
+	err(168, __func__, "array->count: %jd in dynamic array must be <= array->allocated: %jd",
+			  array->count, array->allocated);
+	not_reached();
+    }
+
+    /*
+     * grow by the fewest chunks needed, if any
+     */
+    elms_needed = elm_count - dyn_array_avail(array);
+    if (elms_needed > 0) {
+	moved = dyn_array_grow(array, array->chunk * ((elms_needed + (array->chunk - 1)) / array->chunk));
+    }
+    if (dbg_allowed(DBG_V5_HIGH)) {
+	dbg(DBG_V5_HIGH, "in %s(array, %jd): %s: allocated: %jd elements of size: %zu in use: %jd",
+			 __func__, elm_count, (moved == true ? "moved" : "in-place"),
+			 dyn_array_alloced(array), array->elm_size, dyn_array_tell(array));
+    }
+    return moved;
+}
+
+
 /*
  * dyn_array_free - free the contents of a dynamic array
  *
@@ -68,7 +68,7 @@
 /*
  * official version
  */
-#define DYN_ARRAY_VERSION "2.5.3 2024-10-03"	/* format: major.minor YYYY-MM-DD */
+#define DYN_ARRAY_VERSION "2.6.0 2026-10-18"	/* format: major.minor YYYY-MM-DD */
 
 
 /*
@@ -152,6 +152,23 @@
 #define dyn_array_push(array, value_to_push) (dyn_array_append_value((array), ((void *)&(value_to_push))))
 
 
+/*
+ * dyn_array_growth - how a dynamic array grows when it runs out of allocated elements
+ *
+ * DYN_ARRAY_GROW_CHUNK grows by the fewest chunks that hold the new elements.  Appending
+ * N elements one at a time copies O(N^2/chunk) elements as realloc() moves the data.
+ *
+ * DYN_ARRAY_GROW_GEOMETRIC grows by at least 1/DYN_ARRAY_GROWTH_DIVISOR of the current
+ * allocation (rounded up to a multiple of chunk), so that appending N elements costs
+ * O(log N) realloc() calls and copies O(N) elements.
+ */
+enum dyn_array_growth {
+    DYN_ARRAY_GROW_CHUNK = 0,	/* grow by the fewest chunks needed (the default) */
+    DYN_ARRAY_GROW_GEOMETRIC,	/* grow by at least allocated/DYN_ARRAY_GROWTH_DIVISOR elements */
+};
+#define DYN_ARRAY_GROWTH_DIVISOR (2)	/* geometric growth factor is 1 + 1/DYN_ARRAY_GROWTH_DIVISOR */
+
+
 /*
  * dyn_array - a dynamic array of elements of the same type
  *
@@ -164,6 +181,8 @@
  * If zeroize is true, then all allocated elements will be
  * zeroized when first allocated, and zeroized when dyn_array_free()
  * is called.
+ *
+ * The growth policy is DYN_ARRAY_GROW_CHUNK unless changed by dyn_array_set_growth().
  */
 struct dyn_array
 {
@@ -172,6 +191,7 @@ struct dyn_array
     intmax_t count;		/* Number of elements in use */
     intmax_t allocated;		/* Number of elements allocated (>= count) */
     intmax_t chunk;		/* Number of elements to expand by when allocating */
+    enum dyn_array_growth growth; /* how the dynamic array grows when it runs out of allocated elements */
     void *data;			/* allocated dynamic array of identical things or NULL */
 };
 
@@ -191,6 +211,8 @@ extern bool dyn_array_append_set(struct dyn_array *array, void *array_to_add_p,
 extern bool dyn_array_concat_array(struct dyn_array *array, struct dyn_array *other);
 extern bool dyn_array_seek(struct dyn_array *array, off_t offset, int whence);
 extern void dyn_array_clear(struct dyn_array *array);
+extern void dyn_array_set_growth(struct dyn_array *array, enum dyn_array_growth growth);
+extern bool dyn_array_reserve(struct dyn_array *array, intmax_t elm_count);
 extern void dyn_array_free(struct dyn_array *array);
 /**/
 extern void dyn_array_qsort(struct dyn_array *array, int (*compar)(const void *, const void *));
@@ -36,6 +36,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
+#include <time.h>
 
 /*
  * dyn_array_test - test the dynamic array facility
@@ -50,6 +51,9 @@
 #define CHUNK (1024)		/* allocate CHUNK elements at a time */
 #define DEFAULT_SEED (23209)	/* default seed used when calling srandom() */
 #define MAX_RANDOM (0x7fffffff)	/* maximum value returned by random() */
+#define BENCH_COUNT (1000000)	/* number of elements appended by the growth benchmark */
+#define BENCH_CHUNK (64)	/* chunk size of the growth benchmark dynamic arrays */
+#define BENCH_NEIGHBORS (1024)	/* max small allocations made between growth benchmark reallocs */
 
 /*
  * usage message
@@ -57,12 +61,13 @@
  * Use the usage() function to print the usage_msg([0-9]?)+ strings.
  */
 static const char * const usage_msg =
-    "usage: %s [-h] [-v level] [-V] [-s seed]\n"
+    "usage: %s [-h] [-v level] [-V] [-s seed] [-b]\n"
     "\n"
     "\t-h\t\tprint help message and exit\n"
     "\t-v level\tset verbosity level (def level: %d)\n"
     "\t-V\t\tprint version string and exit\n"
     "\t-s seed\t\tset seed for srandom() (def: %u)\n"
+    "\t-b\t\tprint the growth policy benchmark results on stdout\n"
     "\n"
     "\n"
     "Exit codes:\n"
@@ -83,6 +88,7 @@ static int dbl_cmp(const void *pa, const void *pb);
 #if defined(NON_STANDARD_SORT)
 static int thunk_dbl_cmp(void *pthunk, const void *pa, const void *pb);
 #endif /* NON_STANDARD_SORT */
+static bool grow_bench(char const *name, enum dyn_array_growth growth, bool reserve, bool print);
 static void usage(int exitcode, char const *str, char const *prog) __attribute__((noreturn));
 
 
@@ -286,6 +292,126 @@ thunk_dbl_cmp(void *pthunk, const void *pa, const void *pb)
 #endif /* NON_STANDARD_SORT */
 
 
+
+/*
+ * grow_bench - count reallocs and moved bytes while appending to a dynamic array
+ *
+ * Append BENCH_COUNT doubles, one at a time, onto a dynamic array with a chunk
+ * of BENCH_CHUNK elements, counting the appends that reallocated the array and
+ * the bytes realloc() had to copy when the data moved.  A small allocation is
+ * made after each of the first BENCH_NEIGHBORS reallocs, as other heap users
+ * would, so that realloc() cannot simply keep extending the data in place.
+ *
+ * given:
+ *	name	    name of the benchmark case
+ *	growth	    growth policy of the dynamic array
+ *	reserve	    true ==> dyn_array_reserve() BENCH_COUNT elements before appending
+ *	print	    true ==> print the benchmark results on stdout
+ *
+ * returns:
+ *	true ==> values and counts are sane
+ *	false ==> a value was wrong, or a reserved array was reallocated
+ */
+static bool
+grow_bench(char const *name, enum dyn_array_growth growth, bool reserve, bool print)
+{
+    struct dyn_array *array;	/* dynamic array to append to */
+    void *neighbor[BENCH_NEIGHBORS];	/* small allocations made between reallocs */
+    intmax_t reallocs = 0;	/* number of appends that grew the allocation */
+    intmax_t moved_bytes = 0;	/* bytes copied by realloc() moving the data */
+    intmax_t alloced;		/* allocated elements before an append */
+    struct timespec start;	/* time before appending */
+    struct timespec stop;	/* time after appending */
+    double secs;		/* seconds spent appending */
+    bool ok = true;		/* false ==> benchmark found an error */
+    double d;
+    intmax_t i;
+
+    /*
+     * firewall
+     */
+    if (name == NULL) {
+	err(20, __func__, "name is NULL");
+	not_reached();
+    }
+
+    /*
+     * create the dynamic array
+     */
+    array = dyn_array_create(sizeof(double), BENCH_CHUNK, BENCH_CHUNK, false);
+    dyn_array_set_growth(array, growth);
+    if (reserve == true) {
+	(void) dyn_array_reserve(array, BENCH_COUNT);
+    }
+
+    /*
+     * append, counting reallocs and the bytes moved
+     */
+    (void) clock_gettime(CLOCK_MONOTONIC, &start);
+    for (i = 0; i < BENCH_COUNT; ++i) {
+	d = (double)i;
+	alloced = dyn_array_alloced(array);
+	if (dyn_array_append_value(array, &d)) {
+	    moved_bytes += (intmax_t)(dyn_array_tell(array) - 1) * (intmax_t)sizeof(double);
+	}
+	if (dyn_array_alloced(array) != alloced) {
+	    ++reallocs;
+	    /* another heap user, so that the next realloc() cannot always grow in place */
+	    if (reallocs <= BENCH_NEIGHBORS) {
+		errno = 0;		/* pre-clear errno for errp() */
+		neighbor[reallocs-1] = malloc(BENCH_CHUNK);
+		if (neighbor[reallocs-1] == NULL) {
+		    errp(21, __func__, "malloc of neighbor %jd failed", reallocs-1);
+		    not_reached();
+		}
+	    }
+	}
+    }
+    (void) clock_gettime(CLOCK_MONOTONIC, &stop);
+    secs = (double)(stop.tv_sec - start.tv_sec) + (double)(stop.tv_nsec - start.tv_nsec) / 1e9;
+
+    /*
+     * verify values
+     */
+    if (dyn_array_tell(array) != BENCH_COUNT) {
+	warn(__func__, "%s: dyn_array_tell(array): %jd != %d", name, dyn_array_tell(array), BENCH_COUNT);
+	ok = false;
+    }
+    for (i = 0; i < dyn_array_tell(array); ++i) {
+	if ((intmax_t)dyn_array_value(array, double, i) != i) {
+	    warn(__func__, "%s: value mismatch %jd != %f", name, i, dyn_array_value(array, double, i));
+	    ok = false;
+	    break;
+	}
+    }
+    if (reserve == true && reallocs != 0) {
+	warn(__func__, "%s: %jd reallocs after reserving %d elements", name, reallocs, BENCH_COUNT);
+	ok = false;
+    }
+
+    /*
+     * report
+     */
+    dbg(DBG_LOW, "%s: %d appends: reallocs: %jd moved bytes: %jd allocated: %jd secs: %.6f",
+		 name, BENCH_COUNT, reallocs, moved_bytes, dyn_array_alloced(array), secs);
+    if (print == true) {
+	(void) printf("%-10s appends: %d reallocs: %7jd moved bytes: %14jd allocated: %8jd secs: %.6f\n",
+		      name, BENCH_COUNT, reallocs, moved_bytes, dyn_array_alloced(array), secs);
+    }
+
+    /*
+     * free dynamic array
+     */
+    dyn_array_free(array);
+    array = NULL;
+    for (i = 0; i < reallocs && i < BENCH_NEIGHBORS; ++i) {
+	free(neighbor[i]);
+	neighbor[i] = NULL;
+    }
+    return ok;
+}
+
+
 int
 main(int argc, char *argv[])
 {
@@ -300,13 +426,14 @@ main(int argc, char *argv[])
 #endif /* NON_STANDARD_SORT */
     unsigned long seed = DEFAULT_SEED;	/* seed for random(3) */
     bool opt_error = false;	/* fchk_inval_opt() return */
+    bool bflag = false;		/* true ==> -b used, print growth benchmark results */
     int i;
 
     /*
      * parse args
      */
     program = argv[0];
-    while ((i = getopt(argc, argv, ":hv:Vs:")) != -1) {
+    while ((i = getopt(argc, argv, ":hv:Vs:b")) != -1) {
 	switch (i) {
 	case 'h':		/* -h - print help to stderr and exit 0 */
 	    usage(2, program, ""); /*ooo*/
@@ -335,6 +462,9 @@ main(int argc, char *argv[])
 		not_reached();
 	    }
 	    break;
+	case 'b':		/* -b - print growth benchmark results */
+	    bflag = true;
+	    break;
 	case ':':   /* option requires an argument */
 	case '?':   /* illegal option */
 	default:    /* anything else but should not actually happen */
@@ -692,6 +822,20 @@ main(int argc, char *argv[])
 	array = NULL;
     }
 
+    /*
+     * compare the growth policies
+     */
+    dbg(DBG_LOW, "growth policy benchmark");
+    if (grow_bench("chunk", DYN_ARRAY_GROW_CHUNK, false, bflag) == false) {
+	error = true;
+    }
+    if (grow_bench("geometric", DYN_ARRAY_GROW_GEOMETRIC, false, bflag) == false) {
+	error = true;
+    }
+    if (grow_bench("reserve", DYN_ARRAY_GROW_CHUNK, true, bflag) == false) {
+	error = true;
+    }
+
     /*
      * exit based on the test result
      */
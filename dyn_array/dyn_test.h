@@ -43,7 +43,7 @@
 /*
  * official versions
  */
-#define DYN_TEST_VERSION "1.11.2 2025-09-29"	/* format: major.minor YYYY-MM-DD */
+#define DYN_TEST_VERSION "1.12.0 2026-10-18"	/* format: major.minor YYYY-MM-DD */
 
 /*
  * dyn_array - dynamic array facility
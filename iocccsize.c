@@ -10,11 +10,16 @@
  *
  *	usage: iocccsize [-h] [-i] [-v level] [-V] prog.c
  *	usage: iocccsize [-h] [-i] [-v level] [-V] < prog.c
+ *	usage: iocccsize [-h] [-i] [-v level] [-V] -B [-j threads] [-J] [file ...]
  *
  *	-i		ignored for backward compatibility
  *	-h		print usage message in stderr and exit 2
  *	-v level	set debug level (def: none)
  *	-V		print version and exit 3
+ *	-B		batch mode: size each file arg, or each path in a
+ *			NUL-separated list read from stdin if there are no args
+ *	-j threads	batch mode: number of worker threads (def: online CPUs)
+ *	-J		batch mode: write one JSON object per line
  *
  *	Exit codes:
  *		0   source code is within Rule 2a and Rule 2b limits
@@ -22,6 +27,7 @@
  *		2   -h used and help printed
  *		3   -V used and version printed
  *		4   invalid command line
+ *		5   batch mode: one or more files could not be read
  *		6   there is no Rule 6!
  *	    >= 10   some internal error occurred
  *
@@ -31,6 +37,13 @@
  *	If the debug level is > 0, then the Rule 2a, Rule 2b,
  *	and keyword count is written to stdout instead.
  *
+ *	In batch mode, the same counts followed by the path are written
+ *	to stdout, one line per file, in the order the paths were given.
+ *	Per-file warnings are only written if the debug level is > 0.
+ *	Files are sized in parallel by a pool of worker threads.  With -J,
+ *	each line is a JSON object instead.  Aggregate throughput
+ *	statistics are written to stderr at the end.
+ *
  *	The entry's gross size in bytes must be less than equal to the
  *	RULE_2A_SIZE value as defined in soup/limit_ioccc.h.
  *
@@ -61,7 +74,13 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdint.h>
+#include <inttypes.h>
 #include <locale.h>
+#include <errno.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/stat.h>
 
 /*
  * For use in the https://github.com/ioccc-src/mkiocccentry repo
@@ -114,17 +133,23 @@
 static char usage0[] =
 "usage: iocccsize [-h] [-i] [-v level] [-q] [-V] prog.c\n"
 "usage: iocccsize [-h] [-i] [-v level] [-q] [-V] < prog.c\n"
+"usage: iocccsize [-h] [-i] [-v level] [-q] [-V] -B [-j threads] [-J] [file ...]\n"
 "\n"
 "\t-i\t\tignored for backward compatibility\n"
 "\t-h\t\tprint usage message in stderr and exit\n"
 "\t-v level\tset debug level (def: none)\n"
 "\t-q\t\tquiet mode: silence msg(), warn(), warnp() if -v 0 (def: not msg_warn_silent)\n"
 "\t-V\t\tprint version and exit\n"
+"\t-B\t\tbatch mode: size each file arg, or each path in a NUL-separated list on stdin\n"
+"\t-j threads\tbatch mode: number of worker threads (def: online CPUs)\n"
+"\t-J\t\tbatch mode: write one JSON object per line\n"
 "\n";
 static char usage1[] =
 "\tBy default, the Rule 2b count is written to stdout.\n"
 "\tIf the debug level is > 0, then the Rule 2a, Rule 2b,\n"
 "\tand keyword count is written to stdout instead.\n"
+"\tIn batch mode, the path follows the counts, one line per file,\n"
+"\tor follows \"error: reason: \" if the file could not be read.\n"
 "\n"
 "Exit codes:\n"
 "     0   source code is within Rule 2a and Rule 2b limits\n"
@@ -132,16 +157,450 @@ static char usage1[] =
 "     2   -h used and help printed\n"
 "     3   -V used and version printed\n"
 "     4   invalid command line\n"
+"     5   batch mode: one or more files could not be read\n"
 "     6   there is no Rule 6!\n"
 " >= 10   some internal error occurred\n";
 
 
+#define BATCH_MAX_THREADS	256	/* maximum -j threads in batch mode */
+
+/*
+ * batch mode - one file to size
+ */
+typedef struct
+{
+	const char *path;	/* path of the file to size */
+	RuleCount count;	/* rule_count() processing results */
+	int error;		/* 0 ==> counted, else errno of the failure */
+	bool done;		/* true ==> a worker has finished with this file */
+} BatchFile;
+
+/*
+ * batch mode - files shared by the worker threads
+ */
+typedef struct
+{
+	BatchFile *file;	/* files to size, in the order given */
+	size_t count;		/* number of files */
+	size_t next;		/* index of the next file to hand to a worker */
+	pthread_mutex_t lock;	/* guards next and each done */
+	pthread_cond_t done;	/* signalled each time a file is done */
+} Batch;
+
+
+/*
+ * report_warnings - report Rule 13 and Rule 2 problems found by rule_count()
+ *
+ * given:
+ *	name		name of the function to report the warnings as
+ *	prefix		string to put in front of each warning, "" ==> none
+ *	count		rule_count() processing results
+ */
+static void
+report_warnings(const char *name, const char *prefix, RuleCount const *count)
+{
+	if (1 < verbosity_level && 0 < count->char_warning) {
+		iocccsize_warnx_name(name, "%sWarning: character(s) with high bit set found! Be careful you don't violate rule 13!", prefix);
+	}
+        if (1 < verbosity_level && count->nul_warning) {
+		iocccsize_warnx_name(name, "%sWarning: NUL character(s) found! Be careful you don't violate rule 13!", prefix);
+	}
+	if (count->trigraph_warning) {
+		iocccsize_warnx_name(name, "%sWarning: unknown or invalid trigraph(s) found! Is that a bug in, or a feature of your code?", prefix);
+	}
+        if (1 < verbosity_level && 0 < count->wordbuf_warning) {
+		iocccsize_warnx_name(name, "%sWarning: word buffer overflow! Is that a bug in, or a feature of your code?", prefix);
+	}
+	if (count->ungetc_warning) {
+		iocccsize_warnx_name(name, "%sWarning: ungetc error: @SirWumpus goofed. The count on stdout may be invalid under rule 2!", prefix);
+	}
+	if (count->rule_2a_size > RULE_2A_SIZE) {
+		iocccsize_warnx_name(name, "%sWarning: your source under Rule 2a: %zu exceeds Rule 2a limit: %d: Rule 2a violation!\n",
+			        prefix, count->rule_2a_size, RULE_2A_SIZE);
+	}
+	if (count->rule_2b_size > RULE_2B_SIZE) {
+		iocccsize_warnx_name(name, "%sWarning: your source under Rule 2b: %zu exceeds Rule 2b limit: %d: Rule 2b violation!\n",
+				prefix, count->rule_2b_size, RULE_2B_SIZE);
+	}
+}
+
+
+/*
+ * batch_worker - size files from a batch until there are none left
+ *
+ * given:
+ *	arg		pointer to the shared Batch
+ *
+ * returns:
+ *	NULL
+ */
+static void *
+batch_worker(void *arg)
+{
+	Batch *batch = arg;
+	BatchFile *file;
+	FILE *fp;
+	struct stat buf;
+	size_t i;
+
+	for (;;) {
+		/* claim the next file */
+		(void) pthread_mutex_lock(&batch->lock);
+		i = batch->next;
+		if (i < batch->count) {
+			batch->next++;
+		}
+		(void) pthread_mutex_unlock(&batch->lock);
+		if (i >= batch->count) {
+			break;
+		}
+		file = &batch->file[i];
+
+		/* The Count, again and again and again ... */
+		errno = 0;
+		fp = fopen(file->path, "r");
+		if (fp == NULL) {
+			file->error = (errno == 0) ? ENOENT : errno;
+		} else if (fstat(fileno(fp), &buf) == 0 && S_ISDIR(buf.st_mode)) {
+			/* fopen(3) may open a directory, but it cannot be read */
+			file->error = EISDIR;
+			(void) fclose(fp);
+		} else {
+			file->count = rule_count(fp);
+			if (ferror(fp)) {
+				file->error = EIO;
+			}
+			(void) fclose(fp);
+		}
+
+		/* hand the result back to the main thread */
+		(void) pthread_mutex_lock(&batch->lock);
+		file->done = true;
+		(void) pthread_cond_broadcast(&batch->done);
+		(void) pthread_mutex_unlock(&batch->lock);
+	}
+
+	return NULL;
+}
+
+
+/*
+ * batch_read_list - read a NUL-separated list of paths
+ *
+ * given:
+ *	fp		stream to read the list from
+ *	count		where to store the number of paths read
+ *
+ * returns:
+ *	malloced array of malloced paths, empty paths are skipped
+ *
+ * NOTE: This function does not return on error.
+ */
+static char **
+batch_read_list(FILE *fp, size_t *count)
+{
+	char **list = NULL;
+	char **new_list;
+	size_t size = 0;
+	size_t len = 0;
+	char *line = NULL;
+	size_t line_size = 0;
+	ssize_t got;
+
+	while ((got = getdelim(&line, &line_size, '\0', fp)) > 0) {
+		if (line[got-1] == '\0') {
+			--got;
+		}
+		if (got == 0) {
+			continue;
+		}
+		if (len == size) {
+			size = (size == 0) ? 1024 : size * 2;
+			new_list = realloc(list, size * sizeof(*list));
+			if (new_list == NULL) {
+				iocccsize_errx(11, "realloc of %zu paths failed", size);
+				not_reached();
+			}
+			list = new_list;
+		}
+		list[len] = strndup(line, (size_t)got);
+		if (list[len] == NULL) {
+			iocccsize_errx(12, "strndup of path %zu failed", len);
+			not_reached();
+		}
+		++len;
+	}
+	if (ferror(fp)) {
+		iocccsize_errx(13, "error reading the list of paths");
+		not_reached();
+	}
+	free(line);
+
+	*count = len;
+	return list;
+}
+
+
+/*
+ * json_puts - write a string as a JSON string, quotes included
+ *
+ * Bytes with the high bit set are written as-is.
+ *
+ * given:
+ *	str		string to write
+ *	fp		stream to write on
+ */
+static void
+json_puts(const char *str, FILE *fp)
+{
+	const unsigned char *s;
+
+	(void) putc('"', fp);
+	for (s = (const unsigned char *)str; *s != '\0'; ++s) {
+		switch (*s) {
+		case '"':  (void) fputs("\\\"", fp); break;
+		case '\\': (void) fputs("\\\\", fp); break;
+		case '\b': (void) fputs("\\b", fp); break;
+		case '\f': (void) fputs("\\f", fp); break;
+		case '\n': (void) fputs("\\n", fp); break;
+		case '\r': (void) fputs("\\r", fp); break;
+		case '\t': (void) fputs("\\t", fp); break;
+		default:
+			if (*s < 0x20 || *s == 0x7f) {
+				(void) fprintf(fp, "\\u%04x", *s);
+			} else {
+				(void) putc(*s, fp);
+			}
+			break;
+		}
+	}
+	(void) putc('"', fp);
+}
+
+
+/*
+ * batch_print - write the result line for a batch file
+ *
+ * given:
+ *	file		file that a worker is done with
+ *	json		true ==> write a JSON object, false ==> write text
+ */
+static void
+batch_print(BatchFile const *file, bool json)
+{
+	RuleCount const *count = &file->count;
+	char *prefix;
+	size_t len;
+
+	if (json) {
+		(void) fputs("{\"path\":", stdout);
+		json_puts(file->path, stdout);
+		if (file->error != 0) {
+			(void) fputs(",\"error\":", stdout);
+			json_puts(strerror(file->error), stdout);
+			(void) fputs("}\n", stdout);
+			return;
+		}
+		(void) printf(",\"rule_2b_size\":%zu,\"rule_2a_size\":%zu,\"keywords\":%zu",
+			      count->rule_2b_size, count->rule_2a_size, count->keywords);
+		(void) printf(",\"rule_2a_ok\":%s,\"rule_2b_ok\":%s",
+			      (count->rule_2a_size > RULE_2A_SIZE) ? "false" : "true",
+			      (count->rule_2b_size > RULE_2B_SIZE) ? "false" : "true");
+		(void) printf(",\"char_warning\":%s,\"nul_warning\":%s,\"trigraph_warning\":%s"
+			      ",\"wordbuf_warning\":%s,\"ungetc_warning\":%s}\n",
+			      count->char_warning ? "true" : "false",
+			      count->nul_warning ? "true" : "false",
+			      count->trigraph_warning ? "true" : "false",
+			      count->wordbuf_warning ? "true" : "false",
+			      count->ungetc_warning ? "true" : "false");
+		return;
+	}
+
+	if (file->error != 0) {
+		(void) printf("error: %s: %s\n", strerror(file->error), file->path);
+		return;
+	}
+	if (verbosity_level == 0) {
+		(void) printf("%zu %s\n", count->rule_2b_size, file->path);
+	} else {
+		(void) printf("%zu %zu %zu %s\n", count->rule_2b_size, count->rule_2a_size, count->keywords, file->path);
+	}
+
+	/*
+	 * per-file warnings only with -v: the exit code and statistics
+	 * already report files that exceed a limit
+	 */
+	if (verbosity_level == 0) {
+		return;
+	}
+	/* warnings go to stderr, so flush our line first to keep them in order */
+	(void) fflush(stdout);
+	len = strlen(file->path) + sizeof(": ");
+	prefix = malloc(len);
+	if (prefix == NULL) {
+		iocccsize_errx(14, "malloc of %zu bytes failed", len);
+		not_reached();
+	}
+	(void) snprintf(prefix, len, "%s: ", file->path);
+	report_warnings("main", prefix, count);
+	free(prefix);
+}
+
+
+/*
+ * batch - size many files using a pool of worker threads
+ *
+ * Results are written in the order of path[], as soon as each file and
+ * all of the files before it are done, followed by throughput statistics
+ * on stderr.
+ *
+ * given:
+ *	path		array of paths to size
+ *	count		number of paths
+ *	threads		number of worker threads, <= 0 ==> number of online CPUs
+ *	json		true ==> write JSON lines, false ==> write text lines
+ *
+ * returns:
+ *	exit code: 0 ==> all files are within limits, 1 ==> one or more
+ *	files exceed a limit, 5 ==> one or more files could not be read
+ *
+ * NOTE: This function does not return on error.
+ */
+static int
+batch(char * const *path, size_t count, int threads, bool json)
+{
+	Batch work;
+	pthread_t *tid;
+	struct timespec start;
+	struct timespec stop;
+	double secs;
+	size_t bytes = 0;
+	size_t failed = 0;
+	size_t too_big = 0;
+	int started;
+	int ret;
+	size_t i;
+	int t;
+
+	/*
+	 * size the thread pool
+	 */
+	if (threads <= 0) {
+		long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+		threads = (cpus > 0) ? (int)((cpus > BATCH_MAX_THREADS) ? BATCH_MAX_THREADS : cpus) : 1;
+	}
+	if ((size_t)threads > count) {
+		threads = (count > 0) ? (int)count : 1;
+	}
+
+	/*
+	 * set up the shared work
+	 */
+	memset(&work, 0, sizeof(work));
+	work.count = count;
+	work.file = calloc((count > 0) ? count : 1, sizeof(*work.file));
+	if (work.file == NULL) {
+		iocccsize_errx(15, "calloc of %zu files failed", count);
+		not_reached();
+	}
+	for (i = 0; i < count; ++i) {
+		work.file[i].path = path[i];
+	}
+	tid = calloc((size_t)threads, sizeof(*tid));
+	if (tid == NULL) {
+		iocccsize_errx(16, "calloc of %d threads failed", threads);
+		not_reached();
+	}
+	if (pthread_mutex_init(&work.lock, NULL) != 0 || pthread_cond_init(&work.done, NULL) != 0) {
+		iocccsize_errx(17, "cannot initialize batch mutex or condition");
+		not_reached();
+	}
+
+	/*
+	 * start the workers, making do with fewer if we must
+	 */
+	(void) clock_gettime(CLOCK_MONOTONIC, &start);
+	for (started = 0; started < threads; ++started) {
+		ret = pthread_create(&tid[started], NULL, batch_worker, &work);
+		if (ret != 0) {
+			if (started == 0) {
+				iocccsize_errx(18, "pthread_create failed: %s", strerror(ret));
+				not_reached();
+			}
+			iocccsize_dbg(1, "pthread_create failed: %s: using %d threads", strerror(ret), started);
+			break;
+		}
+	}
+
+	/*
+	 * report results in the order given while the workers keep going
+	 */
+	for (i = 0; i < count; ++i) {
+		(void) pthread_mutex_lock(&work.lock);
+		while (!work.file[i].done) {
+			(void) pthread_cond_wait(&work.done, &work.lock);
+		}
+		(void) pthread_mutex_unlock(&work.lock);
+
+		batch_print(&work.file[i], json);
+		if (work.file[i].error != 0) {
+			++failed;
+		} else {
+			bytes += work.file[i].count.rule_2a_size;
+			if (work.file[i].count.rule_2a_size > RULE_2A_SIZE ||
+			    work.file[i].count.rule_2b_size > RULE_2B_SIZE) {
+				++too_big;
+			}
+		}
+	}
+	for (t = 0; t < started; ++t) {
+		(void) pthread_join(tid[t], NULL);
+	}
+	(void) clock_gettime(CLOCK_MONOTONIC, &stop);
+	(void) fflush(stdout);
+
+	/*
+	 * throughput statistics
+	 */
+	secs = (double)(stop.tv_sec - start.tv_sec) + (double)(stop.tv_nsec - start.tv_nsec) / 1e9;
+	if (secs <= 0.0) {
+		secs = 1e-9;
+	}
+	(void) fprintf(stderr, "iocccsize: files: %zu too large: %zu unreadable: %zu bytes: %zu threads: %d "
+		       "seconds: %.3f MiB/s: %.2f files/s: %.1f\n",
+		       count, too_big, failed, bytes, started, secs,
+		       (double)bytes / (1024.0 * 1024.0) / secs, (double)count / secs);
+
+	(void) pthread_cond_destroy(&work.done);
+	(void) pthread_mutex_destroy(&work.lock);
+	free(tid);
+	free(work.file);
+
+	if (failed > 0) {
+		return 5;
+	}
+	return (too_big > 0) ? 1 : 0;
+}
+
+
 int
 main(int argc, char **argv)
 {
 	extern char *optarg;		/* option argument */
 	FILE *fp = stdin;		/* stream from which to determine sizes */
 	RuleCount count;		/* rule_count() processing results */
+	bool batch_mode = false;	/* true ==> -B used */
+	bool json = false;		/* true ==> -J used */
+	int threads = 0;		/* -j threads, 0 ==> number of online CPUs */
+	intmax_t num = 0;		/* -j threads as parsed */
+#if !defined(MKIOCCCENTRY_USE)
+	char *end = NULL;		/* first character after the -j threads number */
+#endif /* MKIOCCCENTRY_USE */
+	char **list;			/* NUL-separated list of paths from stdin */
+	size_t list_len;		/* number of paths in list */
+	int ret;
+	size_t i;
 	int ch;
 
 #if defined(MKIOCCCENTRY_USE)
@@ -149,7 +608,7 @@ main(int argc, char **argv)
 	set_ioccc_locale();
 #endif /* MKIOCCCENTRY_USE */
 
-	while ((ch = getopt(argc, argv, "6ihv:aV")) != -1) {
+	while ((ch = getopt(argc, argv, "6ihv:aVBj:J")) != -1) {
 		switch (ch) {
 		case 'i': /* ignored for backward compatibility */
 			break;
@@ -167,6 +626,28 @@ main(int argc, char **argv)
 			msg_warn_silent = true;
 			break;
 
+		case 'B':
+			batch_mode = true;
+			break;
+
+		case 'j':
+#if defined(MKIOCCCENTRY_USE)
+			if (!string_to_intmax(optarg, &num) || num < 1 || num > BATCH_MAX_THREADS) {
+#else /* MKIOCCCENTRY_USE */
+			errno = 0;
+			num = strtoimax(optarg, &end, 10);
+			if (errno != 0 || end == optarg || *end != '\0' || num < 1 || num > BATCH_MAX_THREADS) {
+#endif /* MKIOCCCENTRY_USE */
+			    iocccsize_errx(4, "-j threads must be 1 to %d: %s", BATCH_MAX_THREADS, optarg);
+			    not_reached();
+			}
+			threads = (int)num;
+			break;
+
+		case 'J':
+			json = true;
+			break;
+
 		case 'V':
 			printf("%s\n", iocccsize_version);
 			exit(3); /*ooo*/
@@ -189,6 +670,27 @@ main(int argc, char **argv)
 		}
 	}
 
+	/*
+	 * batch mode: size file args, or a NUL-separated list of paths on stdin
+	 */
+	if (batch_mode) {
+		if (optind < argc) {
+			exit(batch(argv + optind, (size_t)(argc - optind), threads, json)); /*ooo*/
+		}
+		list = batch_read_list(stdin, &list_len);
+		ret = batch(list, list_len, threads, json);
+		for (i = 0; i < list_len; ++i) {
+			free(list[i]);
+		}
+		free(list);
+		exit(ret); /*ooo*/
+	} else if (threads != 0 || json) {
+		/* -j and -J only make sense with -B */
+		fprintf(stderr, "-j and -J require -B\n");
+		fprintf(stderr, "%s%s", usage0, usage1);
+		exit(4); /*ooo*/
+	}
+
 	if (optind + 1 == argc) {
 		/* Redirect stdin to file path argument. */
 		errno = 0;
@@ -217,29 +719,7 @@ main(int argc, char **argv)
 	/*
 	 * issue warnings
 	 */
-	if (1 < verbosity_level && 0 < count.char_warning) {
-		iocccsize_warnx("Warning: character(s) with high bit set found! Be careful you don't violate rule 13!");
-	}
-        if (1 < verbosity_level && count.nul_warning) {
-		iocccsize_warnx("Warning: NUL character(s) found! Be careful you don't violate rule 13!");
-	}
-	if (count.trigraph_warning) {
-		iocccsize_warnx("Warning: unknown or invalid trigraph(s) found! Is that a bug in, or a feature of your code?");
-	}
-        if (1 < verbosity_level && 0 < count.wordbuf_warning) {
-		iocccsize_warnx("Warning: word buffer overflow! Is that a bug in, or a feature of your code?");
-	}
-	if (count.ungetc_warning) {
-		iocccsize_warnx("Warning: ungetc error: @SirWumpus goofed. The count on stdout may be invalid under rule 2!");
-	}
-	if (count.rule_2a_size > RULE_2A_SIZE) {
-		iocccsize_warnx("Warning: your source under Rule 2a: %zu exceeds Rule 2a limit: %d: Rule 2a violation!\n",
-			        count.rule_2a_size, RULE_2A_SIZE);
-	}
-	if (count.rule_2b_size > RULE_2B_SIZE) {
-		iocccsize_warnx("Warning: your source under Rule 2b: %zu exceeds Rule 2b limit: %d: Rule 2b violation!\n",
-				count.rule_2b_size, RULE_2B_SIZE);
-	}
+	report_warnings("main", "", &count);
 
 	/*
 	 * All Done!!! All Done!!! -- Jessica Noll, Age 2
@@ -25,6 +25,15 @@ extern "C" {
 #undef DIGRAPHS	    /* digraphs count a 2 for Rule 2b */
 #undef TRIGRAPHS    /* trigraphs count a 3 for Rule 2b */
 
+/*
+ * rule_count_buf_mode() bulk classifier of runs of plain bytes
+ */
+#define RULE_COUNT_FAST_NONE	0   /* state machine only, one byte at a time */
+#define RULE_COUNT_FAST_SCALAR	1   /* scalar bulk classifier */
+#define RULE_COUNT_FAST_SSE2	2   /* SSE2 bulk classifier, scalar if not available */
+#define RULE_COUNT_FAST_AVX2	3   /* AVX2 bulk classifier if the CPU has AVX2, else SSE2 */
+#define RULE_COUNT_FAST_SIMD	RULE_COUNT_FAST_AVX2	/* fastest bulk classifier for this CPU */
+
 
 /*
  * rule_count() processing results
@@ -46,6 +55,9 @@ typedef struct
  * external functions
  */
 extern RuleCount rule_count(FILE *fp_in);
+extern RuleCount rule_count_buf(const char *buf, size_t len);
+extern RuleCount rule_count_buf_mode(const char *buf, size_t len, int mode);
+extern RuleCount rule_count_stream(FILE *fp_in);
 extern bool is_reserved(const char *string);
 
 /*
@@ -0,0 +1,499 @@
+/*
+ * c_reserved - C reserved words, plus a few #preprocessor tokens
+ *
+ * "You are not expected to understand this" :-)
+ *
+ * Public Domain 1992, 2015, 2018, 2019, 2021 by Anthony Howe.  All rights released.
+ *
+ * This header is shared by the iocccsize(1) rule_count() engine and by
+ * jsemtblgen(8) so that both agree on what is a C reserved word.
+ *
+ * NOTE: For a good list of reserved words in C, see:
+ *
+ *	http://www.bezem.de/pdf/ReservedWordsInC.pdf
+ *
+ * by Johan Bezem of JB Enterprises:
+ *
+ *	See http://www.bezem.de/en/
+ */
+
+
+#if !defined(INCLUDE_C_RESERVED_H)
+#    define  INCLUDE_C_RESERVED_H
+
+
+#include <stddef.h>
+#include <string.h>
+
+/*
+ * NOTE: The includer must have already defined bool, true and false,
+ *	 for example via c_bool.h or iocccsize.h.
+ */
+
+
+/*
+ * C_RESERVED_MAXLEN - length of the longest C reserved word
+ */
+#define C_RESERVED_MAXLEN (14)
+
+
+/*
+ * c_reserved - determine if a word is a C reserved word
+ *
+ * The reserved words are compiled into a perfect, length-bucketed decision
+ * tree: the switch on len selects a bucket and within that bucket a switch
+ * on a byte position that distinguishes the remaining candidate words
+ * leaves at most one candidate.  A single memcmp() against that candidate
+ * decides.  Thus each lookup costs O(len) regardless of how many reserved
+ * words there are.
+ *
+ * To add a reserved word, add it to the bucket of its length, splitting
+ * a case on another byte position when it shares bytes with an existing
+ * word.  Yes Virginia, we left #define off the list on purpose!  K&R
+ *
+ * given:
+ *	string	the word to check (need not be NUL terminated)
+ *	len	length of string in bytes
+ *
+ * returns:
+ *	true ==> string is a reserved word in C
+ *	false ==> string is NOT a reserved word in C or is NULL
+ */
+static inline bool
+c_reserved(char const *string, size_t len)
+{
+    char const *w;	/* the only reserved word candidate */
+
+    /*
+     * firewall
+     */
+    if (string == NULL) {
+	return false;
+    }
+
+    switch (len) {
+    case 2:
+	switch (string[0]) {
+	case 'd':
+	    w = "do";		/* K&R */
+	    break;
+	case 'i':
+	    w = "if";		/* K&R */
+	    break;
+	case 'o':
+	    w = "or";		/* +C89 iso646.h */
+	    break;
+	default:
+	    return false;
+	}
+	break;
+    case 3:
+	switch (string[0]) {
+	case '#':
+	    w = "#if";		/* K&R */
+	    break;
+	case 'a':
+	    w = "and";		/* +C89 iso646.h */
+	    break;
+	case 'f':
+	    w = "for";		/* K&R */
+	    break;
+	case 'i':
+	    w = "int";		/* K&R */
+	    break;
+	case 'n':
+	    w = "not";		/* +C89 iso646.h */
+	    break;
+	case 'x':
+	    w = "xor";		/* +C89 iso646.h */
+	    break;
+	default:
+	    return false;
+	}
+	break;
+    case 4:
+	switch (string[0]) {
+	case 'a':
+	    w = "auto";		/* K&R */
+	    break;
+	case 'b':
+	    w = "bool";		/* +C23 */
+	    break;
+	case 'c':
+	    switch (string[1]) {
+	    case 'a':
+		w = "case";		/* K&R */
+		break;
+	    case 'h':
+		w = "char";		/* K&R */
+		break;
+	    default:
+		return false;
+	    }
+	    break;
+	case 'e':
+	    switch (string[1]) {
+	    case 'l':
+		w = "else";		/* K&R */
+		break;
+	    case 'n':
+		w = "enum";		/* +C89 */
+		break;
+	    default:
+		return false;
+	    }
+	    break;
+	case 'g':
+	    w = "goto";		/* K&R */
+	    break;
+	case 'l':
+	    w = "long";		/* K&R */
+	    break;
+	case 't':
+	    w = "true";		/* +C23 */
+	    break;
+	case 'v':
+	    w = "void";		/* +C89 */
+	    break;
+	default:
+	    return false;
+	}
+	break;
+    case 5:
+	switch (string[1]) {
+	case 'B':
+	    w = "_Bool";		/* +C99 */
+	    break;
+	case 'a':
+	    w = "false";		/* +C23 */
+	    break;
+	case 'e':
+	    switch (string[3]) {
+	    case 'i':
+		w = "#elif";		/* K&R */
+		break;
+	    case 's':
+		w = "#else";		/* K&R */
+		break;
+	    default:
+		return false;
+	    }
+	    break;
+	case 'h':
+	    switch (string[0]) {
+	    case 's':
+		w = "short";		/* K&R */
+		break;
+	    case 'w':
+		w = "while";		/* K&R */
+		break;
+	    default:
+		return false;
+	    }
+	    break;
+	case 'i':
+	    w = "bitor";		/* +C89 iso646.h */
+	    break;
+	case 'l':
+	    switch (string[0]) {
+	    case '#':
+		w = "#line";		/* K*R */
+		break;
+	    case 'f':
+		w = "float";		/* K&R */
+		break;
+	    default:
+		return false;
+	    }
+	    break;
+	case 'n':
+	    w = "union";		/* K&R */
+	    break;
+	case 'o':
+	    switch (string[2]) {
+	    case 'm':
+		w = "compl";		/* +C89 iso646.h */
+		break;
+	    case 'n':
+		w = "const";		/* +C89 */
+		break;
+	    default:
+		return false;
+	    }
+	    break;
+	case 'r':
+	    switch (string[0]) {
+	    case 'b':
+		w = "break";		/* K&R */
+		break;
+	    case 'o':
+		w = "or_eq";		/* +C89 iso646.h */
+		break;
+	    default:
+		return false;
+	    }
+	    break;
+	case 's':
+	    w = "#sccs";		/* gcc */
+	    break;
+	default:
+	    return false;
+	}
+	break;
+    case 6:
+	switch (string[2]) {
+	case 'a':
+	    w = "static";		/* K&R */
+	    break;
+	case 'd':
+	    switch (string[0]) {
+	    case '#':
+		w = "#ident";		/* gcc */
+		break;
+	    case 'a':
+		w = "and_eq";		/* +C89 iso646.h */
+		break;
+	    default:
+		return false;
+	    }
+	    break;
+	case 'f':
+	    w = "#ifdef";		/* K&R */
+	    break;
+	case 'g':
+	    w = "signed";		/* K&R */
+	    break;
+	case 'i':
+	    w = "switch";		/* K&R */
+	    break;
+	case 'l':
+	    w = "inline";		/* +C99 */
+	    break;
+	case 'm':
+	    w = "#embed";		/* +C23 */
+	    break;
+	case 'n':
+	    switch (string[1]) {
+	    case 'e':
+		w = "#endif";		/* K&R */
+		break;
+	    case 'u':
+		w = "#undef";		/* K&R */
+		break;
+	    default:
+		return false;
+	    }
+	    break;
+	case 'p':
+	    w = "typeof";		/* +C23 */
+	    break;
+	case 'r':
+	    switch (string[0]) {
+	    case '#':
+		w = "#error";		/* +C89 */
+		break;
+	    case 's':
+		w = "struct";		/* K&R */
+		break;
+	    case 'x':
+		w = "xor_eq";		/* +C89 iso646.h */
+		break;
+	    default:
+		return false;
+	    }
+	    break;
+	case 't':
+	    switch (string[0]) {
+	    case 'b':
+		w = "bitand";		/* +C89 iso646.h */
+		break;
+	    case 'e':
+		w = "extern";		/* K&R */
+		break;
+	    case 'n':
+		w = "not_eq";		/* +C89 iso646.h */
+		break;
+	    case 'r':
+		w = "return";		/* K&R */
+		break;
+	    default:
+		return false;
+	    }
+	    break;
+	case 'u':
+	    w = "double";		/* K&R */
+	    break;
+	case 'z':
+	    w = "sizeof";		/* K&R */
+	    break;
+	default:
+	    return false;
+	}
+	break;
+    case 7:
+	switch (string[1]) {
+	case 'A':
+	    w = "_Atomic";		/* +C11 */
+	    break;
+	case 'B':
+	    w = "_BitInt";		/* +C23 */
+	    break;
+	case 'P':
+	    w = "_Pragma";		/* +C99 */
+	    break;
+	case 'e':
+	    w = "default";		/* K&R */
+	    break;
+	case 'i':
+	    w = "#ifndef";		/* K&R */
+	    break;
+	case 'l':
+	    switch (string[5]) {
+	    case 'a':
+		w = "alignas";		/* +C23 */
+		break;
+	    case 'o':
+		w = "alignof";		/* +C23 */
+		break;
+	    default:
+		return false;
+	    }
+	    break;
+	case 'p':
+	    w = "#pragma";		/* +C89 */
+	    break;
+	case 'u':
+	    w = "nullptr";		/* +C23 */
+	    break;
+	case 'y':
+	    w = "typedef";		/* K&R */
+	    break;
+	default:
+	    return false;
+	}
+	break;
+    case 8:
+	switch (string[4]) {
+	case 'e':
+	    w = "_Generic";		/* +C11 */
+	    break;
+	case 'f':
+	    w = "#elifdef";		/* +C23 */
+	    break;
+	case 'g':
+	    switch (string[6]) {
+	    case 'a':
+		w = "_Alignas";		/* +C11 */
+		break;
+	    case 'e':
+		w = "unsigned";		/* K&R */
+		break;
+	    case 'o':
+		w = "_Alignof";		/* +C11 */
+		break;
+	    default:
+		return false;
+	    }
+	    break;
+	case 'i':
+	    w = "continue";		/* K&R */
+	    break;
+	case 'l':
+	    w = "#include";		/* K&R */
+	    break;
+	case 'n':
+	    w = "#warning";		/* +C23 */
+	    break;
+	case 'p':
+	    w = "_Complex";		/* +C99 */
+	    break;
+	case 'r':
+	    w = "restrict";		/* +C99 */
+	    break;
+	case 's':
+	    w = "register";		/* K&R */
+	    break;
+	case 't':
+	    switch (string[0]) {
+	    case 'n':
+		w = "noreturn";		/* +C23 */
+		break;
+	    case 'v':
+		w = "volatile";		/* +C89 */
+		break;
+	    default:
+		return false;
+	    }
+	    break;
+	default:
+	    return false;
+	}
+	break;
+    case 9:
+	switch (string[0]) {
+	case '#':
+	    w = "#elifndef";		/* +C23 */
+	    break;
+	case '_':
+	    w = "_Noreturn";		/* +C11 */
+	    break;
+	case 'c':
+	    w = "constexpr";		/* +C23 */
+	    break;
+	default:
+	    return false;
+	}
+	break;
+    case 10:
+	switch (string[8]) {
+	case '3':
+	    w = "_Decimal32";		/* +C23 */
+	    break;
+	case '6':
+	    w = "_Decimal64";		/* +C23 */
+	    break;
+	case 'r':
+	    w = "_Imaginary";		/* +C99 */
+	    break;
+	default:
+	    return false;
+	}
+	break;
+    case 11:
+	w = "_Decimal128";		/* +C23 */
+	break;
+    case 12:
+	w = "thread_local";		/* +C23 */
+	break;
+    case 13:
+	switch (string[0]) {
+	case '_':
+	    w = "_Thread_local";		/* +C11 */
+	    break;
+	case 's':
+	    w = "static_assert";		/* +C23 */
+	    break;
+	default:
+	    return false;
+	}
+	break;
+    case 14:
+	switch (string[0]) {
+	case '_':
+	    w = "_Static_assert";		/* +C11 */
+	    break;
+	case 't':
+	    w = "typeof_unequal";		/* +C23 */
+	    break;
+	default:
+	    return false;
+	}
+	break;
+    default:
+	return false;
+    }
+    return memcmp(string, w, len) == 0;
+}
+
+
+#endif /* INCLUDE_C_RESERVED_H */
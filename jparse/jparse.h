@@ -72,6 +72,16 @@
  */
 #include "json_sem.h"
 
+/*
+ * json_push - incremental push mode JSON parser
+ */
+#include "json_push.h"
+
+/*
+ * json_sax - event driven JSON parser that does not build a JSON parse tree
+ */
+#include "json_sax.h"
+
 
 /*
  * definitions
@@ -103,6 +113,7 @@ extern const char *const jparse_utf8_version;		/* jparse utf8 version format: ma
 extern const char *const jparse_tool_version;		/* jparse version format: major.minor YYYY-MM-DD */
 /* lexer and parser specific variables */
 extern int jparse_debug;
+extern _Thread_local FILE *jparse_err_stream;
 
 struct json_extra
 {
@@ -126,6 +137,10 @@ extern struct json *parse_json(char const *ptr, size_t len, char const *filename
 extern struct json *parse_json_str(char const *ptr, size_t len, bool *is_valid);
 extern struct json *parse_json_stream(FILE *stream, char const *filename, bool *is_valid);
 extern struct json *parse_json_file(char const *name, bool *is_valid);
+extern struct json *parse_json_mmap(char const *filename, bool *is_valid);
+extern bool parse_json_sax(char const *ptr, size_t len, char const *filename, struct json_sax const *sax, void *data,
+			   bool *is_valid);
+extern bool parse_json_sax_file(char const *filename, struct json_sax const *sax, void *data, bool *is_valid);
 
 
 #endif /* INCLUDE_JPARSE_H */
@@ -828,8 +828,9 @@ static const flex_int32_t yy_rule_can_match_eol[16] =
  */
 #include "jparse.h"
 
+#include <sys/mman.h>
+
 extern int jparse_lex(JPARSE_STYPE *yylval_param, JPARSE_LTYPE *yylloc_param, yyscan_t scanner);
-static YY_BUFFER_STATE bs;
 
 /*
  * locations in the file / json block
@@ -877,7 +878,7 @@ static YY_BUFFER_STATE bs;
 				} \
 			    } \
 			}
-#line 826 "jparse.c"
+#line 828 "jparse.c"
 /*
  * Section 1 - Patterns (regular expressions) and actions.
  */
@@ -947,7 +948,7 @@ static YY_BUFFER_STATE bs;
  * JSON_COMMA		","
  */
 /* Actions. */
-#line 896 "jparse.c"
+#line 898 "jparse.c"
 
 #define INITIAL 0
 
@@ -1227,9 +1228,9 @@ YY_DECL
 		}
 
 	{
-#line 214 "./jparse.l"
+#line 215 "./jparse.l"
 
-#line 1178 "jparse.c"
+#line 1180 "jparse.c"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -1300,7 +1301,7 @@ do_action:	/* This label is used only to access EOF actions. */
 
 case 1:
 YY_RULE_SETUP
-#line 215 "./jparse.l"
+#line 216 "./jparse.l"
 {
 			    /*
 			     * Whitespace excluding newlines
@@ -1325,7 +1326,7 @@ YY_RULE_SETUP
 case 2:
 /* rule 2 can match eol */
 YY_RULE_SETUP
-#line 236 "./jparse.l"
+#line 237 "./jparse.l"
 {
                             /*
                              * on newline (JSON_NL) we need to reset the column
@@ -1336,7 +1337,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 3:
 YY_RULE_SETUP
-#line 244 "./jparse.l"
+#line 245 "./jparse.l"
 {
 			    /*
                              * string (JSON_STRING)
@@ -1346,7 +1347,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 4:
 YY_RULE_SETUP
-#line 251 "./jparse.l"
+#line 252 "./jparse.l"
 {
 			    /*
                              * number (JSON_NUMBER)
@@ -1356,7 +1357,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 5:
 YY_RULE_SETUP
-#line 258 "./jparse.l"
+#line 259 "./jparse.l"
 {
 			    /*
                              * null object (JSON_NULL)
@@ -1366,7 +1367,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 6:
 YY_RULE_SETUP
-#line 265 "./jparse.l"
+#line 266 "./jparse.l"
 {
 			    /*
                              * true (JSON_TRUE)
@@ -1376,7 +1377,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 7:
 YY_RULE_SETUP
-#line 271 "./jparse.l"
+#line 272 "./jparse.l"
 {
 			    /*
                              * false (JSON_FALSE)
@@ -1389,7 +1390,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 8:
 YY_RULE_SETUP
-#line 281 "./jparse.l"
+#line 282 "./jparse.l"
 {
 			    /*
                              * start of object - open brace i.e. "{" (JSON_OPEN_BRACE)
@@ -1399,7 +1400,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 9:
 YY_RULE_SETUP
-#line 287 "./jparse.l"
+#line 288 "./jparse.l"
 {
 			    /*
                              * end of object - close brace i.e. "}" (JSON_CLOSE_BRACE)
@@ -1409,7 +1410,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 10:
 YY_RULE_SETUP
-#line 294 "./jparse.l"
+#line 295 "./jparse.l"
 {
 			    /*
                              * start of array - open bracket i.e. "[" (JSON_OPEN_BRACKET)
@@ -1419,7 +1420,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 11:
 YY_RULE_SETUP
-#line 300 "./jparse.l"
+#line 301 "./jparse.l"
 {
 			    /*
                              * end of array - close bracket i.e. "]" (JSON_CLOSE_BRACKET)
@@ -1429,7 +1430,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 12:
 YY_RULE_SETUP
-#line 307 "./jparse.l"
+#line 308 "./jparse.l"
 {
 			    /*
                              * colon or 'equals' (JSON_COLON)
@@ -1439,7 +1440,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 13:
 YY_RULE_SETUP
-#line 314 "./jparse.l"
+#line 315 "./jparse.l"
 {
 			    /*
                              * comma: name/value pair separator (JSON_COMMA)
@@ -1449,7 +1450,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 14:
 YY_RULE_SETUP
-#line 321 "./jparse.l"
+#line 322 "./jparse.l"
 {
 			    /*
                              * invalid token: any other character (regexp ".")
@@ -1488,10 +1489,10 @@ YY_RULE_SETUP
 	YY_BREAK
 case 15:
 YY_RULE_SETUP
-#line 357 "./jparse.l"
+#line 358 "./jparse.l"
 YY_FATAL_ERROR( "flex scanner jammed" );
 	YY_BREAK
-#line 1440 "jparse.c"
+#line 1442 "jparse.c"
 case YY_STATE_EOF(INITIAL):
 	yyterminate();
 
@@ -2653,7 +2654,7 @@ void yyfree (void * ptr , yyscan_t yyscanner)
 
 #define YYTABLES_NAME "yytables"
 
-#line 357 "./jparse.l"
+#line 358 "./jparse.l"
 
 
 /*
@@ -2666,6 +2667,10 @@ void yyfree (void * ptr , yyscan_t yyscanner)
 static bool exists(char const *path);
 static bool is_file(char const *path);
 static bool is_read(char const *path);
+static struct json *parse_json_scan(char const *ptr, size_t len, char const *filename, bool *is_valid, bool in_place);
+static char *map_json_file(char const *filename, size_t *len, size_t *map_len);
+static bool parse_json_sax_scan(char const *ptr, size_t len, char const *filename, struct json_sax const *sax, void *data,
+				bool *is_valid, bool in_place);
 
 
 /*
@@ -2917,10 +2922,43 @@ low_byte_scan(char const *data, size_t len, size_t *low_bytes, size_t *nul_bytes
  */
 struct json *
 parse_json(char const *ptr, size_t len, char const *filename, bool *is_valid)
+{
+    return parse_json_scan(ptr, len, filename, is_valid, false);
+}
+
+
+/*
+ * parse_json_scan - scan and parse a JSON blob of a given length
+ *
+ * This is parse_json(), with the choice of letting the scanner copy the blob
+ * or scanning the blob in place.
+ *
+ * given:
+ *
+ *	ptr	    - pointer to start of JSON blob
+ *	len	    - length of the JSON blob
+ *	filename    - filename, empty string or "-" for stdin or NULL to
+ *	              indicate it is a string
+ *	is_valid    - non-NULL pointer to boolean to set depending on JSON validity
+ *	in_place    - true ==> scan ptr in place: ptr must be writable and have
+ *		      two NUL bytes at ptr[len] and ptr[len+1]
+ *		      false ==> scan a copy of ptr
+ *
+ * return:
+ *	pointer to a JSON parse tree
+ *
+ * NOTE: When in_place is true, the scanner temporarily writes into ptr.
+ *
+ * NOTE: this function only warns on error, except for NULL is_valid, in which
+ *       case it is an error.
+ */
+static struct json *
+parse_json_scan(char const *ptr, size_t len, char const *filename, bool *is_valid, bool in_place)
 {
     struct json *tree = NULL;		/* the JSON parse tree */
     int ret = 0;			/* jparse_parse() return value */
     yyscan_t scanner;			/* scanner instance: is a void * */
+    YY_BUFFER_STATE bs = NULL;		/* buffer state of the blob being scanned */
     struct json_extra extra;
 
     /*
@@ -2978,9 +3016,13 @@ parse_json(char const *ptr, size_t len, char const *filename, bool *is_valid)
     extra.filename = filename;
 
     /*
-     * scan the blob
+     * scan the blob, in place or as a copy
      */
-    bs = yy_scan_bytes(ptr, (int)len, scanner);
+    if (in_place) {
+	bs = yy_scan_buffer((char *)ptr, (yy_size_t)(len + 2), scanner);
+    } else {
+	bs = yy_scan_bytes(ptr, (int)len, scanner);
+    }
     if (bs == NULL) {
 	/*
 	 * if unable to scan the bytes it indicates an internal error and
@@ -3005,7 +3047,8 @@ parse_json(char const *ptr, size_t len, char const *filename, bool *is_valid)
 
     /*
      * we cannot set the column (and probably line number) without first having
-     * a buffer which is why the yy_scan_bytes() is called first (see above).
+     * a buffer which is why the yy_scan_bytes() or yy_scan_buffer() is called
+     * first (see above).
      *
      * For why we set the column to 0 but the line to 1 see the comments with
      * the YY_USER_ACTION macro.
@@ -3025,11 +3068,27 @@ parse_json(char const *ptr, size_t len, char const *filename, bool *is_valid)
 
     /*
      * parse the blob, passing into the parser the node and scanner
+     *
+     * NOTE: json_arena_parse_begin() and json_arena_parse_end() parse into a
+     *	     JSON parse tree arena when json_tree_arena is true.
      */
+    json_arena_parse_begin();
+    json_string_err_found = false;
     ret = jparse_parse(&tree, scanner);
+    tree = json_arena_parse_end(tree);
+
+    /*
+     * a JSON string that could not be decoded makes the JSON invalid
+     *
+     * NOTE: json_string_err_found is only set when json_string_err_invalid is true.
+     */
+    if (ret == 0 && json_string_err_found) {
+	ret = 1;
+    }
 
     /*
-     * free memory associated with bytes scanned by yy_scan_bytes()
+     * free memory associated with bytes scanned by yy_scan_bytes(), or the
+     * buffer state (but not the blob) of yy_scan_buffer()
      */
     yy_delete_buffer(bs, scanner);
     bs = NULL;
@@ -3690,3 +3749,473 @@ parse_json_file(char const *filename, bool *is_valid)
     return tree;
 }
 
+
+/*
+ * map_json_file - map a JSON file so that the scanner can scan it in place
+ *
+ * given:
+ *	filename    - filename of file to map
+ *	len	    - pointer to where to store the length of the file
+ *	map_len	    - pointer to where to store the length of the mapping
+ *
+ * return:
+ *	pointer to the mapping, or NULL ==> filename is not a non-empty regular
+ *	file or cannot be mapped
+ *
+ * Zero filled memory for the file and two NUL bytes, rounded up to a page, is
+ * reserved, and then the file is mapped MAP_PRIVATE over the front of it.  The
+ * caller scans the mapping with yy_scan_buffer() and then calls munmap() with
+ * the *map_len bytes of the mapping.
+ */
+static char *
+map_json_file(char const *filename, size_t *len, size_t *map_len)
+{
+    struct stat buf;			/* filename status */
+    long page_size = 0;			/* system page size */
+    char *map = NULL;			/* padded mapping of the file */
+    void *ret = NULL;			/* mmap() return */
+    int fd = -1;			/* open file descriptor of filename */
+
+    /*
+     * firewall
+     */
+    if (filename == NULL || len == NULL || map_len == NULL) {
+	return NULL;
+    }
+
+    /*
+     * open the file, and refuse anything that is not a non-empty regular file
+     */
+    errno = 0;
+    fd = open(filename, O_RDONLY|O_CLOEXEC);
+    if (fd < 0) {
+	return NULL;
+    }
+    errno = 0;
+    if (fstat(fd, &buf) != 0 || !S_ISREG(buf.st_mode) || buf.st_size <= 0 ||
+	(uintmax_t)buf.st_size > (uintmax_t)(SIZE_MAX / 2)) {
+	(void) close(fd);
+	return NULL;
+    }
+    *len = (size_t)buf.st_size;
+
+    /*
+     * reserve zero filled memory for the file and two NUL bytes, rounded up
+     * to a page, and then map the file over the front of it
+     */
+    page_size = sysconf(_SC_PAGESIZE);
+    if (page_size <= 0) {
+	page_size = 4096;
+    }
+    *map_len = ((*len + 2 + (size_t)page_size - 1) / (size_t)page_size) * (size_t)page_size;
+    errno = 0;
+    ret = mmap(NULL, *map_len, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+    if (ret == MAP_FAILED) {
+	json_dbg(JSON_DBG_MED, __func__, "cannot reserve %zu bytes for: %s: %s", *map_len, filename, strerror(errno));
+	(void) close(fd);
+	return NULL;
+    }
+    map = ret;
+    errno = 0;
+    ret = mmap(map, *len, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_FIXED, fd, 0);
+    if (ret == MAP_FAILED) {
+	json_dbg(JSON_DBG_MED, __func__, "cannot mmap %zu bytes of: %s: %s", *len, filename, strerror(errno));
+	(void) munmap(map, *map_len);
+	(void) close(fd);
+	return NULL;
+    }
+    (void) close(fd);
+    fd = -1;
+
+    /*
+     * the bytes beyond the file may be in the last page of the file mapping
+     */
+    map[*len] = '\0';
+    map[*len+1] = '\0';
+    return map;
+}
+
+
+/*
+ * parse_json_mmap - parse a JSON file in a given filename, scanning it in place
+ *
+ * given:
+ *	filename    - filename of file to parse
+ *	is_valid    - non-NULL pointer to boolean to set depending on json validity
+ *
+ * return:
+ *	pointer to a JSON parse tree
+ *
+ * Unlike parse_json_file(), which reads the file into memory with read_all()
+ * and then has the scanner copy that memory, this function maps a regular file
+ * into memory and scans the mapping in place.  The mapping is MAP_PRIVATE and
+ * is followed by two NUL bytes, as the scanner requires: the scanner
+ * temporarily writes into the mapping, but the file is never modified.
+ *
+ * If filename is "-", or is not a non-empty regular file, or if it cannot be
+ * mapped, this function returns parse_json_file(filename, is_valid).
+ *
+ * NOTE: The reason this is in the scanner and not the parser is because
+ *	 YY_BUFFER_STATE is part of the scanner and not the parser.
+ *
+ * NOTE: This function only warns on error, except for NULL is_valid, in which
+ *	 case it is an error.
+ */
+struct json *
+parse_json_mmap(char const *filename, bool *is_valid)
+{
+    struct json *tree = NULL;		/* the JSON parse tree */
+    size_t len = 0;			/* length of the file */
+    size_t map_len = 0;			/* length of the padded mapping */
+    char *map = NULL;			/* padded mapping of the file */
+    bool low_byte_detected = false;	/* true ==> byte values [\x00-\x08\x0e-\x1f] detected in data */
+    size_t nul_bytes = 0;		/* number of NUL bytes found */
+    size_t low_bytes = 0;		/* number of low bytes that are not NUL found */
+
+    /*
+     * firewall
+     */
+    if (is_valid == NULL) {
+	err(61, __func__, "is_valid == NULL");
+	not_reached();
+    }
+    *is_valid = true;
+
+    /*
+     * let parse_json_file() handle stdin and bogus filenames
+     */
+    if (filename == NULL || *filename == '\0' || strcmp(filename, "-") == 0) {
+	return parse_json_file(filename, is_valid);
+    }
+
+    /*
+     * map the file, and let parse_json_file() handle anything that is not a
+     * non-empty regular file or that cannot be mapped
+     */
+    map = map_json_file(filename, &len, &map_len);
+    if (map == NULL) {
+	return parse_json_file(filename, is_valid);
+    }
+
+    /*
+     * pre-scan data for byte values in range of [\x00-\x08\x0e-\x1f]
+     */
+    low_byte_detected = low_byte_scan(map, len, &low_bytes, &nul_bytes);
+    if (low_byte_detected || low_bytes > 0 || nul_bytes > 0) {
+
+	/*
+         * report invalid bytes
+         */
+	if (low_bytes > 0 && nul_bytes > 0) {
+	    werr(62, __func__, "%zu low byte%s and %zu NUL byte%s detected: data block is NOT valid JSON",
+		    low_bytes, low_bytes > 1 ? "s":"",
+		    nul_bytes, nul_bytes > 1 ? "s":"");
+	} else if (low_bytes > 0) {
+	    werr(63, __func__, "%zu low byte%s detected: data block is NOT valid JSON",
+		    low_bytes, low_bytes > 1 ? "s":"");
+	} else if (nul_bytes > 0) {
+	    werr(64, __func__, "%zu NUL byte%s detected: data block is NOT valid JSON",
+		    nul_bytes, nul_bytes > 1 ? "s":"");
+	}
+
+	/*
+         * flag that we have invalid JSON
+         */
+	*is_valid = false;
+
+	/* unmap the file */
+	(void) munmap(map, map_len);
+	map = NULL;
+
+	/* return a blank JSON tree */
+	tree = json_alloc(JTYPE_UNSET);
+	return tree;
+    }
+
+    /*
+     * if JSON debug level is high enough we will log the call with the length
+     */
+    if (json_dbg_allowed(JSON_DBG_HIGH)) {
+        json_dbg(JSON_DBG_HIGH, __func__, "scanning mapped file in place with length %zu:", len);
+    }
+
+    /*
+     * JSON parse the mapped file in place
+     */
+    tree = parse_json_scan(map, len, filename, is_valid, true);
+
+    /*
+     * unmap the file
+     */
+    errno = 0;
+    if (munmap(map, map_len) != 0) {
+	warnp(__func__, "munmap of %zu bytes for: %s failed", map_len, filename);
+    }
+    map = NULL;
+
+    /*
+     * return the JSON parse tree tree
+     */
+    return tree;
+}
+
+
+/*
+ * parse_json_sax_scan - scan a JSON blob and call the callbacks of an event driven parse
+ *
+ * given:
+ *	ptr	    - pointer to start of JSON blob
+ *	len	    - length of the JSON blob
+ *	filename    - filename or NULL for stdin
+ *	sax	    - callbacks, or NULL ==> only check the JSON
+ *	data	    - data passed to the callbacks
+ *	is_valid    - non-NULL pointer to boolean to set depending on json validity
+ *	in_place    - true ==> scan ptr in place: ptr[len] and ptr[len+1] must
+ *		      be NUL bytes, false ==> scan a copy of ptr
+ *
+ * return:
+ *	true ==> the JSON blob was scanned to its end,
+ *	false ==> a callback stopped the parse, or the blob could not be scanned
+ *
+ * Instead of calling the bison parser, which builds a JSON parse tree, this
+ * function takes the tokens of the scanner one at a time and gives them to
+ * json_sax_token().  Syntax errors are reported by yyerror().
+ */
+static bool
+parse_json_sax_scan(char const *ptr, size_t len, char const *filename, struct json_sax const *sax, void *data,
+		    bool *is_valid, bool in_place)
+{
+    struct json_sax_parser parser;	/* event driven parser state */
+    JPARSE_STYPE lval = NULL;		/* scanner semantic value (unused) */
+    JPARSE_LTYPE lloc;			/* scanner location */
+    YY_BUFFER_STATE sbs = NULL;		/* scanner buffer */
+    yyscan_t scanner;			/* scanner instance: is a void * */
+    struct json_extra extra;
+    char const *msg = NULL;		/* syntax error message or NULL */
+    int token = 0;			/* scanner token */
+    bool done = false;			/* true ==> scanned to the end of the blob */
+    int ret = 0;
+
+    /*
+     * firewall
+     */
+    if (is_valid == NULL) {
+	err(65, __func__, "is_valid == NULL");
+	not_reached();
+    }
+    *is_valid = true;
+    if (filename != NULL && *filename == '-') {
+        filename = "-";
+    }
+    if (ptr == NULL) {
+	werr(66, __func__, "ptr is NULL");
+	*is_valid = false;
+	return false;
+    }
+
+    /*
+     * initialise scanner
+     */
+    errno = 0;
+    ret = jparse_lex_init_extra(&extra, &scanner);
+    if (ret != 0) {
+	werrp(67, __func__, "jparse_lex_init_extra failed");
+        *is_valid = false;
+	return false;
+    }
+    extra.filename = filename;
+    if (in_place) {
+	sbs = yy_scan_buffer((char *)ptr, (yy_size_t)(len + 2), scanner);
+    } else {
+	sbs = yy_scan_bytes(ptr, (int)len, scanner);
+    }
+    if (sbs == NULL) {
+	werr(68, __func__, "unable to scan string");
+	*is_valid = false;
+	jparse_lex_destroy(scanner);
+	return false;
+    }
+    jparse_set_column(0, scanner);
+    jparse_set_lineno(1, scanner);
+    memset(&lloc, 0, sizeof(lloc));
+
+    /*
+     * give the tokens to the event driven parser
+     */
+    json_sax_parser_init(&parser, sax, data);
+    json_string_err_found = false;
+    do {
+	token = jparse_lex(&lval, &lloc, scanner);
+	if (token == 0) {
+	    msg = json_sax_finish(&parser);
+	} else {
+	    msg = json_sax_token(&parser, token, jparse_get_text(scanner), (size_t)jparse_get_leng(scanner));
+	}
+    } while (token != 0 && msg == NULL && parser.stopped == false);
+    if (msg != NULL) {
+	jparse_error(&lloc, NULL, scanner, "%s", msg);
+	*is_valid = false;
+    } else if (json_string_err_found) {
+	/* a JSON string that could not be decoded makes the JSON invalid */
+	*is_valid = false;
+    }
+    done = (parser.stopped == false);
+
+    if (json_dbg_allowed(JSON_DBG_LOW)) {
+	json_dbg(JSON_DBG_LOW, __func__, "%s JSON: %ju events%s", *is_valid ? "valid" : "invalid",
+		 parser.events, done ? "" : ", stopped by a callback");
+    }
+
+    /*
+     * free the parser and the scanner
+     */
+    json_sax_parser_free(&parser);
+    yy_delete_buffer(sbs, scanner);
+    sbs = NULL;
+    jparse_lex_destroy(scanner);
+    return done;
+}
+
+
+/*
+ * parse_json_sax - parse a JSON blob calling callbacks instead of building a tree
+ *
+ * given:
+ *	ptr	    - pointer to start of JSON blob
+ *	len	    - length of the JSON blob
+ *	filename    - filename or NULL for stdin
+ *	sax	    - callbacks, or NULL ==> only check the JSON
+ *	data	    - data passed to the callbacks
+ *	is_valid    - non-NULL pointer to boolean to set depending on json validity
+ *
+ * return:
+ *	true ==> the JSON blob was scanned to its end,
+ *	false ==> a callback stopped the parse, or the blob could not be scanned
+ *
+ * The JSON blob is checked as parse_json() checks it, but no JSON parse tree is
+ * built: see struct json_sax for the callbacks.  If a callback stops the parse,
+ * *is_valid only tells if the JSON before that point was valid.
+ *
+ * NOTE: This function only warns on error, except for NULL is_valid, in which
+ *	 case it is an error.
+ */
+bool
+parse_json_sax(char const *ptr, size_t len, char const *filename, struct json_sax const *sax, void *data, bool *is_valid)
+{
+    return parse_json_sax_scan(ptr, len, filename, sax, data, is_valid, false);
+}
+
+
+/*
+ * parse_json_sax_file - parse a JSON file calling callbacks instead of building a tree
+ *
+ * given:
+ *	filename    - filename of file to parse, "-" ==> stdin
+ *	sax	    - callbacks, or NULL ==> only check the JSON
+ *	data	    - data passed to the callbacks
+ *	is_valid    - non-NULL pointer to boolean to set depending on json validity
+ *
+ * return:
+ *	true ==> the JSON file was scanned to its end,
+ *	false ==> a callback stopped the parse, or the file could not be scanned
+ *
+ * As in parse_json_mmap(), a regular file is mapped and scanned in place, and
+ * anything else is read into memory.  As in parse_json_stream(), a file with
+ * byte values in the range [\x00-\x08\x0e-\x1f] is invalid.
+ *
+ * NOTE: This function only warns on error, except for NULL is_valid, in which
+ *	 case it is an error.
+ */
+bool
+parse_json_sax_file(char const *filename, struct json_sax const *sax, void *data, bool *is_valid)
+{
+    FILE *stream = NULL;		/* stream to read if filename cannot be mapped */
+    char *map = NULL;			/* padded mapping of the file */
+    size_t map_len = 0;			/* length of the padded mapping */
+    char *buf = NULL;			/* JSON file contents */
+    size_t len = 0;			/* length of the JSON file */
+    bool low_byte_detected = false;	/* true ==> byte values [\x00-\x08\x0e-\x1f] detected in data */
+    size_t nul_bytes = 0;		/* number of NUL bytes found */
+    size_t low_bytes = 0;		/* number of low bytes that are not NUL found */
+    bool done = false;			/* true ==> scanned to the end of the file */
+
+    /*
+     * firewall
+     */
+    if (is_valid == NULL) {
+	err(69, __func__, "is_valid == NULL");
+	not_reached();
+    }
+    *is_valid = true;
+    if (filename == NULL || *filename == '\0') {
+	werr(70, __func__, "passed NULL or empty filename");
+	*is_valid = false;
+	return false;
+    }
+
+    /*
+     * map a regular file, or read anything else
+     */
+    if (strcmp(filename, "-") != 0) {
+	map = map_json_file(filename, &len, &map_len);
+    }
+    if (map != NULL) {
+	buf = map;
+    } else {
+	if (strcmp(filename, "-") == 0) {
+	    stream = stdin;
+	} else {
+	    errno = 0;
+	    stream = fopen(filename, "r");
+	    if (stream == NULL) {
+		werrp(71, __func__, "couldn't open file %s, ignoring", filename);
+		*is_valid = false;
+		return false;
+	    }
+	}
+	buf = read_all(stream, &len);
+	clearerr_or_fclose(stream);
+	if (buf == NULL) {
+	    werr(72, __func__, "could not read read stream");
+	    *is_valid = false;
+	    return false;
+	}
+    }
+
+    /*
+     * pre-scan data for byte values in range of [\x00-\x08\x0e-\x1f]
+     */
+    low_byte_detected = low_byte_scan(buf, len, &low_bytes, &nul_bytes);
+    if (low_byte_detected || low_bytes > 0 || nul_bytes > 0) {
+	if (low_bytes > 0 && nul_bytes > 0) {
+	    werr(73, __func__, "%zu low byte%s and %zu NUL byte%s detected: data block is NOT valid JSON",
+		    low_bytes, low_bytes > 1 ? "s":"",
+		    nul_bytes, nul_bytes > 1 ? "s":"");
+	} else if (low_bytes > 0) {
+	    werr(74, __func__, "%zu low byte%s detected: data block is NOT valid JSON",
+		    low_bytes, low_bytes > 1 ? "s":"");
+	} else if (nul_bytes > 0) {
+	    werr(75, __func__, "%zu NUL byte%s detected: data block is NOT valid JSON",
+		    nul_bytes, nul_bytes > 1 ? "s":"");
+	}
+	*is_valid = false;
+    } else {
+	done = parse_json_sax_scan(buf, len, filename, sax, data, is_valid, map != NULL);
+    }
+
+    /*
+     * unmap or free the file contents
+     */
+    if (map != NULL) {
+	errno = 0;
+	if (munmap(map, map_len) != 0) {
+	    warnp(__func__, "munmap of %zu bytes for: %s failed", map_len, filename);
+	}
+	map = NULL;
+    } else {
+	free(buf);
+    }
+    buf = NULL;
+    return done;
+}
+
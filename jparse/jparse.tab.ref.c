@@ -155,6 +155,16 @@
  */
 int jparse_debug = 0;	/* 0 ==> verbose bison debug off, 1 ==> verbose bison debug on */
 
+/*
+ * stream on which this thread reports scanner and parser errors
+ *
+ * NOTE: jparse_debug and json_verbosity_level are only read while parsing, so
+ *	 they may be set once and shared by every thread.  The stream on which
+ *	 errors are reported is per thread so that a thread parsing one of many
+ *	 JSON files may collect the errors of that file.
+ */
+_Thread_local FILE *jparse_err_stream = NULL;	/* NULL ==> report errors on stderr */
+
 /*
  * JSON parser version strings (format: major.minor YYYY-MM-DD)
  */
@@ -164,7 +174,7 @@ const char *const jparse_utf8_version = JPARSE_UTF8_VERSION;	    /* jparse utf8
 const char *const jparse_tool_version = JPARSE_TOOL_VERSION;		    /* jparse tool version */
 
 
-#line 114 "jparse.tab.c"
+#line 124 "jparse.tab.c"
 
 # ifndef YY_CAST
 #  ifdef __cplusplus
@@ -584,9 +594,9 @@ static const yytype_int8 yytranslate[] =
 /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
 static const yytype_int16 yyrline[] =
 {
-       0,   237,   237,   295,   326,   357,   388,   419,   454,   488,
-     524,   555,   585,   619,   658,   694,   725,   755,   789,   827,
-     860,   902
+       0,   247,   247,   305,   336,   367,   398,   429,   464,   498,
+     534,   565,   595,   629,   668,   704,   735,   765,   799,   837,
+     870,   912
 };
 #endif
 
@@ -1549,7 +1559,7 @@ yyreduce:
     switch (yyn)
       {
   case 2: /* json: json_element  */
-#line 238 "./jparse.y"
+#line 248 "./jparse.y"
     {
 	/*
 	 * $$ = $json
@@ -1603,11 +1613,11 @@ yyreduce:
 					      "json: json_element");
 	}
     }
-#line 1553 "jparse.tab.c"
+#line 1563 "jparse.tab.c"
     break;
 
   case 3: /* json_value: json_object  */
-#line 296 "./jparse.y"
+#line 306 "./jparse.y"
     {
 	/*
 	 * $$ = $json_value
@@ -1636,11 +1646,11 @@ yyreduce:
 					       "json_value: json_object");
 	}
     }
-#line 1586 "jparse.tab.c"
+#line 1596 "jparse.tab.c"
     break;
 
   case 4: /* json_value: json_array  */
-#line 327 "./jparse.y"
+#line 337 "./jparse.y"
     {
 	/*
 	 * $$ = $json_value
@@ -1669,11 +1679,11 @@ yyreduce:
 					       "json_value: json_array");
 	}
     }
-#line 1619 "jparse.tab.c"
+#line 1629 "jparse.tab.c"
     break;
 
   case 5: /* json_value: json_string  */
-#line 358 "./jparse.y"
+#line 368 "./jparse.y"
     {
 	/*
 	 * $$ = $json_value
@@ -1702,11 +1712,11 @@ yyreduce:
 					       "json_value: json_string");
 	}
     }
-#line 1652 "jparse.tab.c"
+#line 1662 "jparse.tab.c"
     break;
 
   case 6: /* json_value: json_number  */
-#line 389 "./jparse.y"
+#line 399 "./jparse.y"
     {
 	/*
 	 * $$ = $json_value
@@ -1735,11 +1745,11 @@ yyreduce:
 					       "json_value: json_number");
 	}
     }
-#line 1685 "jparse.tab.c"
+#line 1695 "jparse.tab.c"
     break;
 
   case 7: /* json_value: "true"  */
-#line 420 "./jparse.y"
+#line 430 "./jparse.y"
     {
 	/*
 	 * $$ = $json_value
@@ -1772,11 +1782,11 @@ yyreduce:
 					       "json_value: JSON_TRUE");
 	}
     }
-#line 1722 "jparse.tab.c"
+#line 1732 "jparse.tab.c"
     break;
 
   case 8: /* json_value: "false"  */
-#line 455 "./jparse.y"
+#line 465 "./jparse.y"
     {
 	/*
 	 * $$ = $json_value
@@ -1808,11 +1818,11 @@ yyreduce:
 					     "json_value: JSON_FALSE");
 	}
     }
-#line 1758 "jparse.tab.c"
+#line 1768 "jparse.tab.c"
     break;
 
   case 9: /* json_value: "null"  */
-#line 489 "./jparse.y"
+#line 499 "./jparse.y"
     {
 	/*
 	 * $$ = $json_value
@@ -1844,11 +1854,11 @@ yyreduce:
 					       "json_value: JSON_NULL");
 	}
     }
-#line 1794 "jparse.tab.c"
+#line 1804 "jparse.tab.c"
     break;
 
   case 10: /* json_object: "{" json_members "}"  */
-#line 525 "./jparse.y"
+#line 535 "./jparse.y"
     {
 	/*
 	 * $$ = $json_object
@@ -1877,11 +1887,11 @@ yyreduce:
 					       "json_object: JSON_OPEN_BRACE json_members JSON_CLOSE_BRACE");
 	}
     }
-#line 1827 "jparse.tab.c"
+#line 1837 "jparse.tab.c"
     break;
 
   case 11: /* json_object: "{" "}"  */
-#line 556 "./jparse.y"
+#line 566 "./jparse.y"
     {
 	/*
 	 * $$ = $json_object
@@ -1907,11 +1917,11 @@ yyreduce:
 					       "json_object: JSON_OPEN_BRACE JSON_CLOSE_BRACE");
 	}
     }
-#line 1857 "jparse.tab.c"
+#line 1867 "jparse.tab.c"
     break;
 
   case 12: /* json_members: json_member  */
-#line 586 "./jparse.y"
+#line 596 "./jparse.y"
     {
 	/*
 	 * $$ = $json_members
@@ -1943,11 +1953,11 @@ yyreduce:
 					      "json_members: json_member");
 	}
     }
-#line 1893 "jparse.tab.c"
+#line 1903 "jparse.tab.c"
     break;
 
   case 13: /* json_members: json_members "," json_member  */
-#line 620 "./jparse.y"
+#line 630 "./jparse.y"
     {
 	/*
 	 * $$ = $json_members
@@ -1982,11 +1992,11 @@ yyreduce:
 					       "json_members: json_members JSON_COMMA json_member");
 	}
     }
-#line 1932 "jparse.tab.c"
+#line 1942 "jparse.tab.c"
     break;
 
   case 14: /* json_member: json_string ":" json_element  */
-#line 659 "./jparse.y"
+#line 669 "./jparse.y"
     {
 	/*
 	 * $$ = $json_member
@@ -2018,11 +2028,11 @@ yyreduce:
 					       "json_member: json_string JSON_COLON json_element");
 	}
     }
-#line 1968 "jparse.tab.c"
+#line 1978 "jparse.tab.c"
     break;
 
   case 15: /* json_array: "[" json_elements "]"  */
-#line 695 "./jparse.y"
+#line 705 "./jparse.y"
     {
 	/*
 	 * $$ = $json_array
@@ -2051,11 +2061,11 @@ yyreduce:
 					       "json_array: JSON_OPEN_BRACKET json_elements JSON_CLOSE_BRACKET");
 	}
     }
-#line 2001 "jparse.tab.c"
+#line 2011 "jparse.tab.c"
     break;
 
   case 16: /* json_array: "[" "]"  */
-#line 726 "./jparse.y"
+#line 736 "./jparse.y"
     {
 	/*
 	 * $$ = $json_array
@@ -2081,11 +2091,11 @@ yyreduce:
 					       "json_array: JSON_OPEN_BRACKET JSON_CLOSE_BRACKET");
 	}
     }
-#line 2031 "jparse.tab.c"
+#line 2041 "jparse.tab.c"
     break;
 
   case 17: /* json_elements: json_element  */
-#line 756 "./jparse.y"
+#line 766 "./jparse.y"
     {
 	/*
 	 * $$ = $json_elements
@@ -2117,11 +2127,11 @@ yyreduce:
 					       "json_elements: json_element");
 	}
     }
-#line 2067 "jparse.tab.c"
+#line 2077 "jparse.tab.c"
     break;
 
   case 18: /* json_elements: json_elements "," json_element  */
-#line 790 "./jparse.y"
+#line 800 "./jparse.y"
     {
 	/*
 	 * $$ = $json_elements
@@ -2155,11 +2165,11 @@ yyreduce:
 					       "json_elements: json_elements JSON_COMMA json_element");
 	}
     }
-#line 2105 "jparse.tab.c"
+#line 2115 "jparse.tab.c"
     break;
 
   case 19: /* json_element: json_value  */
-#line 828 "./jparse.y"
+#line 838 "./jparse.y"
     {
 	/*
 	 * $$ = $json_element
@@ -2188,11 +2198,11 @@ yyreduce:
 					       "json_element: json_value");
 	}
     }
-#line 2138 "jparse.tab.c"
+#line 2148 "jparse.tab.c"
     break;
 
   case 20: /* json_string: JSON_STRING  */
-#line 861 "./jparse.y"
+#line 871 "./jparse.y"
     {
 	/*
 	 * $$ = $json_string
@@ -2230,11 +2240,11 @@ yyreduce:
 					       "json_string: JSON_STRING");
 	}
     }
-#line 2180 "jparse.tab.c"
+#line 2190 "jparse.tab.c"
     break;
 
   case 21: /* json_number: JSON_NUMBER  */
-#line 903 "./jparse.y"
+#line 913 "./jparse.y"
     {
 	/*
 	 * $$ = $json_number
@@ -2266,11 +2276,11 @@ yyreduce:
 					       "json_number: JSON_NUMBER");
 	}
     }
-#line 2216 "jparse.tab.c"
+#line 2226 "jparse.tab.c"
     break;
 
 
-#line 2220 "jparse.tab.c"
+#line 2230 "jparse.tab.c"
 
         default: break;
       }
@@ -2477,7 +2487,7 @@ yyreturnlab:
   return yyresult;
 }
 
-#line 937 "./jparse.y"
+#line 947 "./jparse.y"
 
 
 
@@ -2503,6 +2513,7 @@ yyerror(JPARSE_LTYPE *yyltype, struct json **node, yyscan_t scanner, char const
 {
     va_list ap;		/* variable argument list */
     int ret;		/* libc function return value */
+    FILE *stream = (jparse_err_stream != NULL) ? jparse_err_stream : stderr; /* where to report the error */
 
     /*
      * firewall
@@ -2520,34 +2531,34 @@ yyerror(JPARSE_LTYPE *yyltype, struct json **node, yyscan_t scanner, char const
     /*
      * generate an error message for the JSON parser and scanner
      */
-    vfpr(stderr, __func__, format, ap);
+    vfpr(stream, __func__, format, ap);
     if (node != NULL && *node != NULL) {
-	fprint(stderr, " node type %s", json_item_type_name(*node));
+	fprint(stream, " node type %s", json_item_type_name(*node));
     }
     if (yyltype != NULL) {
 	    if (yyltype->filename != NULL && *yyltype->filename != '\0') {
-		fprint(stderr, " in file %s", yyltype->filename);
+		fprint(stream, " in file %s", yyltype->filename);
 	    }
-	    fprint(stderr, " at line %d column %d: ", yyltype->first_line, yyltype->first_column);
+	    fprint(stream, " at line %d column %d: ", yyltype->first_line, yyltype->first_column);
     }
     if (jparse_get_text(scanner) != NULL && *jparse_get_text(scanner) != '\0') {
-	fprint(stderr, "%s\n", jparse_get_text(scanner));
+	fprint(stream, "%s\n", jparse_get_text(scanner));
     } else if (jparse_get_text(scanner) == NULL) {
-	fprstr(stderr, "text == NULL\n");
+	fprstr(stream, "text == NULL\n");
     } else {
-	fprstr(stderr, "empty text\n");
+	fprstr(stream, "empty text\n");
     }
 
     /*
-     * flush stderr
+     * flush the error stream
      */
-    clearerr(stderr);           /* pre-clear ferror() status */
+    clearerr(stream);           /* pre-clear ferror() status */
     errno = 0;                  /* pre-clear errno for warnp() */
-    ret = fflush(stderr);
+    ret = fflush(stream);
     if (ret == EOF) {
-        if (ferror(stderr)) {
+        if (ferror(stream)) {
             warnp(__func__, "called from %s: error flushing stream", __func__);
-        } else if (feof(stderr)) {
+        } else if (feof(stream)) {
             warnp(__func__, "called from %s: EOF while flushing stream", __func__);
         } else {
             warnp(__func__, "called from %s: unexpected fflush error while flushing stream", __func__);
@@ -102,6 +102,16 @@
  */
 int jparse_debug = 0;	/* 0 ==> verbose bison debug off, 1 ==> verbose bison debug on */
 
+/*
+ * stream on which this thread reports scanner and parser errors
+ *
+ * NOTE: jparse_debug and json_verbosity_level are only read while parsing, so
+ *	 they may be set once and shared by every thread.  The stream on which
+ *	 errors are reported is per thread so that a thread parsing one of many
+ *	 JSON files may collect the errors of that file.
+ */
+_Thread_local FILE *jparse_err_stream = NULL;	/* NULL ==> report errors on stderr */
+
 /*
  * JSON parser version strings (format: major.minor YYYY-MM-DD)
  */
@@ -959,6 +969,7 @@ yyerror(JPARSE_LTYPE *yyltype, struct json **node, yyscan_t scanner, char const
 {
     va_list ap;		/* variable argument list */
     int ret;		/* libc function return value */
+    FILE *stream = (jparse_err_stream != NULL) ? jparse_err_stream : stderr; /* where to report the error */
 
     /*
      * firewall
@@ -976,34 +987,34 @@ yyerror(JPARSE_LTYPE *yyltype, struct json **node, yyscan_t scanner, char const
     /*
      * generate an error message for the JSON parser and scanner
      */
-    vfpr(stderr, __func__, format, ap);
+    vfpr(stream, __func__, format, ap);
     if (node != NULL && *node != NULL) {
-	fprint(stderr, " node type %s", json_item_type_name(*node));
+	fprint(stream, " node type %s", json_item_type_name(*node));
     }
     if (yyltype != NULL) {
 	    if (yyltype->filename != NULL && *yyltype->filename != '\0') {
-		fprint(stderr, " in file %s", yyltype->filename);
+		fprint(stream, " in file %s", yyltype->filename);
 	    }
-	    fprint(stderr, " at line %d column %d: ", yyltype->first_line, yyltype->first_column);
+	    fprint(stream, " at line %d column %d: ", yyltype->first_line, yyltype->first_column);
     }
     if (jparse_get_text(scanner) != NULL && *jparse_get_text(scanner) != '\0') {
-	fprint(stderr, "%s\n", jparse_get_text(scanner));
+	fprint(stream, "%s\n", jparse_get_text(scanner));
     } else if (jparse_get_text(scanner) == NULL) {
-	fprstr(stderr, "text == NULL\n");
+	fprstr(stream, "text == NULL\n");
     } else {
-	fprstr(stderr, "empty text\n");
+	fprstr(stream, "empty text\n");
     }
 
     /*
-     * flush stderr
+     * flush the error stream
      */
-    clearerr(stderr);           /* pre-clear ferror() status */
+    clearerr(stream);           /* pre-clear ferror() status */
     errno = 0;                  /* pre-clear errno for warnp() */
-    ret = fflush(stderr);
+    ret = fflush(stream);
     if (ret == EOF) {
-        if (ferror(stderr)) {
+        if (ferror(stream)) {
             warnp(__func__, "called from %s: error flushing stream", __func__);
-        } else if (feof(stderr)) {
+        } else if (feof(stream)) {
             warnp(__func__, "called from %s: EOF while flushing stream", __func__);
         } else {
             warnp(__func__, "called from %s: unexpected fflush error while flushing stream", __func__);
@@ -48,6 +48,9 @@
 #include <stdio.h>
 #include <unistd.h>
 #include <locale.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
 
 /*
  * jparse_main - tool that parses a block of JSON input
@@ -64,7 +67,7 @@
  * usage message
  */
 static const char * const usage_msg =
-    "usage: %s [-h] [-v level] [-J level] [-q] [-V] [-s] arg...\n"
+    "usage: %s [-h] [-v level] [-J level] [-q] [-V] [-s] [-S] [-j threads] arg...\n"
     "\n"
     "\t-h\t\tprint help message and exit\n"
     "\t-v level\tset verbosity level (def level: %d)\n"
@@ -72,6 +75,9 @@ static const char * const usage_msg =
     "\t-q\t\tquiet mode: silence msg(), warn(), warnp() if -v 0 (def: loud :-) )\n"
     "\t-V\t\tprint version strings and exit\n"
     "\t-s\t\targ is a string (def: arg is a filename)\n"
+    "\t-S\t\tstream validate: check the JSON without building a parse tree\n"
+    "\t-j threads\tcheck args at the same time on threads worker threads, 0 ==> one per CPU\n"
+    "\t\t\t    NOTE: -j writes valid or invalid for each arg, in order, on stdout\n"
     "\n"
     "\targ\t\tparse JSON for string (if -s), file (w/o -s), or stdin (if arg is -)\n"
     "\n"
@@ -92,6 +98,11 @@ static const char * const usage_msg =
  * static functions
  */
 static void usage(int exitcode, char const *prog, char const *str) __attribute__((noreturn));
+static bool parse_arg(char const *input, bool string_flag_used, bool sax_flag_used);
+static void warn_invalid(char const *program, char const *input, bool string_flag_used, bool sax_flag_used);
+static void *parse_worker(void *arg);
+static int parse_args_parallel(char const *program, char * const *input, int count, int threads,
+			       bool string_flag_used, bool sax_flag_used);
 
 
 int
@@ -101,10 +112,12 @@ main(int argc, char **argv)
     extern char *optarg;	    /* option argument */
     extern int optind;		    /* argv index of the next arg */
     char *input = NULL;		    /* argument to process */
-    bool string_flag_used = false;  /* true ==> -S string was used */
+    bool string_flag_used = false;  /* true ==> -s string was used */
+    bool sax_flag_used = false;	    /* true ==> -S stream validate was used */
+    int threads = -1;		    /* -j threads, 0 ==> one per CPU, < 0 ==> -j not used */
+    intmax_t num = 0;		    /* -j threads as converted */
     bool valid_json = false;	    /* true ==> JSON parse was valid */
     int exit_code = 0;              /* exit code depends on if any JSON is invalid */
-    struct json *tree = NULL;	    /* JSON parse tree or NULL */
     bool opt_error = false;		/* fchk_inval_opt() return */
     int i;
 
@@ -117,7 +130,7 @@ main(int argc, char **argv)
      * parse args
      */
     program = argv[0];
-    while ((i = getopt(argc, argv, ":hv:qVsJ:")) != -1) {
+    while ((i = getopt(argc, argv, ":hv:qVsSJ:j:")) != -1) {
 	switch (i) {
 	case 'h':		/* -h - print help to stderr and exit 0 */
 	    usage(2, program, ""); /*ooo*/
@@ -157,6 +170,16 @@ main(int argc, char **argv)
 	case 's':
 	    string_flag_used = true;
 	    break;
+	case 'S':
+	    sax_flag_used = true;
+	    break;
+	case 'j':		/* -j threads */
+	    if (!string_to_intmax(optarg, &num) || num < 0 || num > JPARSE_MAX_THREADS) {
+		usage(3, program, "invalid -j threads"); /*ooo*/
+		not_reached();
+	    }
+	    threads = (int)num;
+	    break;
 	case ':':   /* option requires an argument */
 	case '?':   /* illegal option */
 	default:    /* anything else but should not actually happen */
@@ -175,10 +198,26 @@ main(int argc, char **argv)
 	not_reached();
     }
 
+    /*
+     * JSON numbers are converted to C values only if the parse tree is printed
+     */
+    json_number_lazy = true;
+
+    /*
+     * each JSON parse tree is allocated from, and freed as, a single arena
+     */
+    json_tree_arena = true;
+
+    /*
+     * case: -j - check the arguments at the same time on a pool of worker threads
+     */
+    if (threads >= 0) {
+	exit_code = parse_args_parallel(program, argv+optind, argc-optind, threads, string_flag_used, sax_flag_used);
+
     /*
      * case: process arguments on command line
      */
-    if (argc - optind > 0) {
+    } else {
 	/*
 	 * process each argument in order
 	 */
@@ -187,53 +226,13 @@ main(int argc, char **argv)
 	     * obtain argument string
 	     */
 	    input = argv[i];
-            /*
-             * case: process -s arg
-             */
-            if (string_flag_used == true) {
-
-                /* parse arg as a block of json input */
-                dbg(DBG_HIGH, "Calling parse_json_str(%s, %zu, &valid_json):",
-                              input, strlen(input));
-
-                tree = parse_json_str(input, strlen(input), &valid_json);
-                if (tree == NULL || !valid_json) {
-                    warn(program, "JSON parse tree is NULL for string: \"%s\"", input);
-                    exit_code = 1;
-                }
-                /*
-                 * free the JSON parse tree
-                 */
-                else {
-                    json_tree_free(tree, JSON_INFINITE_DEPTH);
-                    free(tree);
-                    tree = NULL;
-                }
-
-            /*
-             * case: process file arg
-             */
-            } else {
-
-                /* parse arg as a json filename */
-                dbg(DBG_HIGH, "Calling parse_json_file(\"%s\", &valid_json):", input);
-
-                tree = parse_json_file(input, &valid_json);
-                if (tree == NULL || !valid_json) {
-                    warn(program, "JSON parse tree is NULL for file: %s", input);
-                    exit_code = 1;
-                }
-                /*
-                 * free the JSON parse tree
-                 */
-                else {
-                    json_tree_free(tree, JSON_INFINITE_DEPTH);
-                    free(tree);
-                    tree = NULL;
-                }
-            }
-
-        }
+
+	    valid_json = parse_arg(input, string_flag_used, sax_flag_used);
+	    if (!valid_json) {
+		warn_invalid(program, input, string_flag_used, sax_flag_used);
+		exit_code = 1;
+	    }
+	}
     }
     /*
      * firewall - JSON parser must have returned a valid JSON parse tree
@@ -295,3 +294,327 @@ usage(int exitcode, char const *prog, char const *str)
     exit(exitcode); /*ooo*/
     not_reached();
 }
+
+
+/*
+ * parse_arg - check if an arg is valid JSON
+ *
+ * given:
+ *	input		    string (if -s), filename or - for stdin
+ *	string_flag_used    true ==> input is a string
+ *	sax_flag_used	    true ==> check without building a JSON parse tree
+ *
+ * returns:
+ *	true ==> JSON is valid
+ *	false ==> JSON is invalid
+ *
+ * NOTE: Scanner and parser errors are reported on jparse_err_stream, so this
+ *	 function may be called by more than one thread at the same time.
+ */
+static bool
+parse_arg(char const *input, bool string_flag_used, bool sax_flag_used)
+{
+    struct json *tree = NULL;	    /* JSON parse tree or NULL */
+    bool valid_json = false;	    /* true ==> JSON parse was valid */
+
+    /*
+     * firewall
+     */
+    if (input == NULL) {
+	err(4, __func__, "input is NULL");
+	not_reached();
+    }
+
+    /*
+     * case: process -S arg without building a JSON parse tree
+     */
+    if (sax_flag_used == true) {
+
+	if (string_flag_used == true) {
+	    dbg(DBG_HIGH, "Calling parse_json_sax(%s, %zu, NULL, NULL, NULL, &valid_json):",
+			  input, strlen(input));
+	    (void) parse_json_sax(input, strlen(input), NULL, NULL, NULL, &valid_json);
+	} else {
+	    dbg(DBG_HIGH, "Calling parse_json_sax_file(\"%s\", NULL, NULL, &valid_json):", input);
+	    (void) parse_json_sax_file(input, NULL, NULL, &valid_json);
+	}
+	return valid_json;
+
+    /*
+     * case: process -s arg
+     */
+    } else if (string_flag_used == true) {
+
+	/* parse arg as a block of json input */
+	dbg(DBG_HIGH, "Calling parse_json_str(%s, %zu, &valid_json):",
+		      input, strlen(input));
+	tree = parse_json_str(input, strlen(input), &valid_json);
+
+    /*
+     * case: process stdin a chunk at a time
+     */
+    } else if (strcmp(input, "-") == 0) {
+
+	/* parse stdin as it is read */
+	dbg(DBG_HIGH, "Calling parse_json_push(stdin, \"-\", &valid_json):");
+	tree = parse_json_push(stdin, "-", &valid_json);
+
+    /*
+     * case: process file arg
+     */
+    } else {
+
+	/* parse arg as a json filename */
+	dbg(DBG_HIGH, "Calling parse_json_mmap(\"%s\", &valid_json):", input);
+	tree = parse_json_mmap(input, &valid_json);
+    }
+
+    /*
+     * free the JSON parse tree
+     */
+    if (tree == NULL) {
+	return false;
+    }
+    json_tree_free(tree, JSON_INFINITE_DEPTH);
+    free(tree);
+    tree = NULL;
+    return valid_json;
+}
+
+
+/*
+ * warn_invalid - warn that an arg is not valid JSON
+ *
+ * given:
+ *	program		    our program name
+ *	input		    string (if -s), filename or - for stdin
+ *	string_flag_used    true ==> input is a string
+ *	sax_flag_used	    true ==> input was checked without building a JSON parse tree
+ */
+static void
+warn_invalid(char const *program, char const *input, bool string_flag_used, bool sax_flag_used)
+{
+    if (sax_flag_used == true) {
+	warn(program, "JSON is invalid for %s: %s", string_flag_used ? "string" : "file", input);
+    } else if (string_flag_used == true) {
+	warn(program, "JSON parse tree is NULL for string: \"%s\"", input);
+    } else {
+	warn(program, "JSON parse tree is NULL for file: %s", input);
+    }
+    return;
+}
+
+
+/*
+ * parse_worker - check args from a pool until there are none left
+ *
+ * The scanner and parser errors of each arg are collected in memory so that
+ * they can be reported in command line order.  A JSON string that cannot be
+ * decoded makes only its own arg invalid instead of ending the process.
+ *
+ * given:
+ *	arg	pointer to the shared struct jparse_pool
+ *
+ * returns:
+ *	NULL
+ */
+static void *
+parse_worker(void *arg)
+{
+    struct jparse_pool *pool = arg;	/* args shared by the worker threads */
+    struct jparse_arg *cur;		/* arg being checked */
+    int i;
+
+    json_string_err_invalid = true;
+    for (;;) {
+	/*
+	 * claim the next arg
+	 */
+	(void) pthread_mutex_lock(&pool->lock);
+	i = pool->next;
+	if (i < pool->count) {
+	    ++pool->next;
+	}
+	(void) pthread_mutex_unlock(&pool->lock);
+	if (i >= pool->count) {
+	    break;
+	}
+	cur = &pool->arg[i];
+
+	/*
+	 * check the arg, collecting its errors
+	 */
+	errno = 0;		/* pre-clear errno for warnp() */
+	jparse_err_stream = open_memstream(&cur->errors, &cur->errors_len);
+	if (jparse_err_stream == NULL) {
+	    warnp(__func__, "open_memstream failed: reporting errors of %s on stderr", cur->input);
+	}
+	cur->valid = parse_arg(cur->input, pool->string_flag_used, pool->sax_flag_used);
+	if (jparse_err_stream != NULL) {
+	    (void) fclose(jparse_err_stream);
+	    jparse_err_stream = NULL;
+	}
+
+	/*
+	 * hand the result back to the main thread
+	 */
+	(void) pthread_mutex_lock(&pool->lock);
+	cur->done = true;
+	(void) pthread_cond_broadcast(&pool->done);
+	(void) pthread_mutex_unlock(&pool->lock);
+    }
+    return NULL;
+}
+
+
+/*
+ * parse_args_parallel - check args at the same time on a pool of worker threads
+ *
+ * For each arg, in command line order and as soon as it and all of the args
+ * before it are done, its scanner and parser errors (and a warning if it is
+ * invalid) are written to stderr and whether it is valid is written to stdout.
+ * The number of args checked, and how long it took, is then written to stderr.
+ *
+ * given:
+ *	program		    our program name
+ *	input		    array of args
+ *	count		    number of args
+ *	threads		    number of worker threads, 0 ==> one per online CPU
+ *	string_flag_used    true ==> args are strings
+ *	sax_flag_used	    true ==> check without building JSON parse trees
+ *
+ * returns:
+ *	0 ==> all args are valid JSON
+ *	1 ==> one or more args are invalid JSON
+ *
+ * NOTE: This function does not return on error.
+ */
+static int
+parse_args_parallel(char const *program, char * const *input, int count, int threads,
+		    bool string_flag_used, bool sax_flag_used)
+{
+    struct jparse_pool pool;		/* args shared by the worker threads */
+    pthread_t *tid = NULL;		/* worker threads */
+    struct timespec start;		/* when the first worker thread was started */
+    struct timespec stop;		/* when the last worker thread was joined */
+    double secs;			/* seconds between start and stop */
+    int invalid = 0;			/* number of invalid args */
+    int started;			/* number of worker threads started */
+    int ret;				/* pthread_create() return */
+    int i;
+
+    /*
+     * firewall
+     */
+    if (program == NULL || input == NULL) {
+	err(5, __func__, "program or input is NULL");
+	not_reached();
+    }
+
+    /*
+     * size the thread pool
+     */
+    if (threads <= 0) {
+	long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+	threads = (cpus > 0) ? (int)((cpus > JPARSE_MAX_THREADS) ? JPARSE_MAX_THREADS : cpus) : 1;
+    }
+    if (threads > count) {
+	threads = (count > 0) ? count : 1;
+    }
+
+    /*
+     * set up the shared args
+     */
+    memset(&pool, 0, sizeof(pool));
+    pool.count = count;
+    pool.string_flag_used = string_flag_used;
+    pool.sax_flag_used = sax_flag_used;
+    errno = 0;			/* pre-clear errno for errp() */
+    pool.arg = calloc((size_t)((count > 0) ? count : 1), sizeof(*pool.arg));
+    if (pool.arg == NULL) {
+	errp(6, __func__, "calloc of %d args failed", count);
+	not_reached();
+    }
+    for (i = 0; i < count; ++i) {
+	pool.arg[i].input = input[i];
+    }
+    errno = 0;			/* pre-clear errno for errp() */
+    tid = calloc((size_t)threads, sizeof(*tid));
+    if (tid == NULL) {
+	errp(7, __func__, "calloc of %d threads failed", threads);
+	not_reached();
+    }
+    if (pthread_mutex_init(&pool.lock, NULL) != 0 || pthread_cond_init(&pool.done, NULL) != 0) {
+	err(8, __func__, "cannot initialize -j mutex or condition");
+	not_reached();
+    }
+
+    /*
+     * start the worker threads, making do with fewer if we must
+     */
+    (void) clock_gettime(CLOCK_MONOTONIC, &start);
+    for (started = 0; started < threads; ++started) {
+	ret = pthread_create(&tid[started], NULL, parse_worker, &pool);
+	if (ret != 0) {
+	    if (started == 0) {
+		err(9, __func__, "pthread_create failed: %s", strerror(ret));
+		not_reached();
+	    }
+	    dbg(DBG_LOW, "pthread_create failed: %s: using %d threads", strerror(ret), started);
+	    break;
+	}
+    }
+
+    /*
+     * report results in command line order while the worker threads keep going
+     */
+    for (i = 0; i < count; ++i) {
+	(void) pthread_mutex_lock(&pool.lock);
+	while (!pool.arg[i].done) {
+	    (void) pthread_cond_wait(&pool.done, &pool.lock);
+	}
+	(void) pthread_mutex_unlock(&pool.lock);
+
+	if (pool.arg[i].errors != NULL) {
+	    if (pool.arg[i].errors_len > 0) {
+		(void) fwrite(pool.arg[i].errors, 1, pool.arg[i].errors_len, stderr);
+	    }
+	    free(pool.arg[i].errors);
+	    pool.arg[i].errors = NULL;
+	}
+	if (!pool.arg[i].valid) {
+	    warn_invalid(program, pool.arg[i].input, string_flag_used, sax_flag_used);
+	    ++invalid;
+	}
+	print("%s: %s\n", pool.arg[i].valid ? "valid" : "invalid", pool.arg[i].input);
+	(void) fflush(stdout);	/* keep stdout in order with stderr */
+    }
+    for (i = 0; i < started; ++i) {
+	(void) pthread_join(tid[i], NULL);
+    }
+    (void) clock_gettime(CLOCK_MONOTONIC, &stop);
+    (void) fflush(stdout);
+
+    /*
+     * aggregate timing
+     */
+    secs = (double)(stop.tv_sec - start.tv_sec) + (double)(stop.tv_nsec - start.tv_nsec) / 1e9;
+    if (secs <= 0.0) {
+	secs = 1e-9;
+    }
+    fprint(stderr, "%s: args: %d valid: %d invalid: %d threads: %d seconds: %.3f args/s: %.1f\n",
+	   JPARSE_BASENAME, count, count - invalid, invalid, started, secs, (double)count / secs);
+
+    /*
+     * free storage
+     */
+    (void) pthread_cond_destroy(&pool.done);
+    (void) pthread_mutex_destroy(&pool.lock);
+    free(tid);
+    tid = NULL;
+    free(pool.arg);
+    pool.arg = NULL;
+
+    return (invalid > 0) ? 1 : 0;
+}
@@ -44,6 +44,9 @@
 #    define  INCLUDE_JPARSE_MAIN_H
 
 
+#include <pthread.h>
+
+
 /*
  * dbg - info, debug, warning, error, and usage message facility
  */
@@ -82,5 +85,37 @@
  */
 #define JPARSE_BASENAME "jparse"
 
+/*
+ * -j threads
+ */
+#define JPARSE_MAX_THREADS (256)	/* maximum number of -j worker threads */
+
+
+/*
+ * jparse_arg - an arg checked by a -j worker thread
+ */
+struct jparse_arg
+{
+    char const *input;		/* string (if -s), filename or - for stdin */
+    bool valid;			/* true ==> JSON is valid */
+    char *errors;		/* malloced scanner and parser errors of the arg, or NULL */
+    size_t errors_len;		/* length of errors */
+    bool done;			/* true ==> a worker thread has finished with this arg */
+};
+
+/*
+ * jparse_pool - args shared by the -j worker threads
+ */
+struct jparse_pool
+{
+    struct jparse_arg *arg;	/* args to check, in command line order */
+    int count;			/* number of args */
+    int next;			/* index of the next arg to hand to a worker thread */
+    bool string_flag_used;	/* true ==> -s string was used */
+    bool sax_flag_used;		/* true ==> -S stream validate was used */
+    pthread_mutex_t lock;	/* guards next and each done */
+    pthread_cond_t done;	/* signalled each time an arg is done */
+};
+
 
 #endif /* INCLUDE_JPARSE_MAIN_H */
@@ -52,6 +52,13 @@
 #include <inttypes.h>
 #include <math.h>
 #include <string.h>
+#if defined(__SSE2__) && defined(__GNUC__)
+#include <emmintrin.h>
+#if defined(__x86_64__) || defined(__i386__)
+#define JSON_AVX2	/* json_encode_run() may use AVX2 if the CPU has it */
+#include <immintrin.h>
+#endif
+#endif
 
 /*
  * util - common utility functions for the JSON parser
@@ -68,13 +75,81 @@
  */
 #include "json_util.h"
 
+/*
+ * jparse - JSON parser, for jparse_err_stream
+ */
+#include "jparse.h"
+
+/* for json string encoding */
+static size_t json_encode_run(uint8_t const *p, size_t i, size_t len);
+#if defined(JSON_AVX2)
+static size_t json_encode_run_avx2(uint8_t const *p, size_t i, size_t len);
+#endif
+static void chk_json_encode_all(void);
+static void chk_json_encode(char const *ptr, size_t len, bool skip_quote);
 /* for json string decoding */
-static char *decode_json_string(char const *ptr, size_t len, size_t mlen, size_t *retlen);
+static int32_t json_hex4(char const *ptr);
+static bool json_decode_buf(char const *ptr, size_t len, char *ret, size_t *retlen);
 /* for json number strings */
 static bool json_process_decimal(struct json_number *item, char const *str, size_t len);
 static bool json_process_floating(struct json_number *item, char const *str, size_t len);
+static void json_conv_values(struct json_number *item);
 /* for convert JSON encoded string to C string */
 static void posix_safe_chk(char const *str, size_t len, bool *slash, bool *posix_safe, bool *first_alphanum, bool *upper);
+/* for JSON parse tree arenas */
+static size_t json_item_size(enum item_type type);
+static void *json_arena_take(struct json_arena *arena, size_t size, size_t align);
+static void json_arena_trim(struct json_arena *arena, void *ptr, size_t size);
+static char *json_str_alloc(size_t len);
+static struct json **json_arena_set_append(struct json_arena *arena, struct json **set, intmax_t len, struct json *node);
+
+
+/*
+ * json_number_lazy - true ==> json_conv_number() defers conversion to C values
+ *
+ * See json_number_convert().
+ */
+bool json_number_lazy = false;
+
+/*
+ * json_tree_arena - true ==> parse JSON into a JSON parse tree arena
+ *
+ * See json_arena_parse_begin() and json_tree_free().
+ */
+bool json_tree_arena = false;
+
+/*
+ * json_string_err_invalid - true ==> a JSON string that cannot be decoded makes the JSON invalid
+ *
+ * By default json_parse_string() does not return if a JSON string matched by the
+ * scanner cannot be decoded.  When this is true, json_parse_string() instead
+ * reports the string on jparse_err_stream (or stderr), sets json_string_err_found
+ * and returns, and the parse functions then report the JSON as invalid.
+ *
+ * NOTE: Each thread has its own json_string_err_invalid and json_string_err_found,
+ *	 so that a thread that checks many JSON documents (as jparse -j does) can
+ *	 report one of them as invalid instead of ending the process.
+ */
+_Thread_local bool json_string_err_invalid = false;
+
+/*
+ * json_string_err_found - true ==> json_parse_string() found a JSON string that cannot be decoded
+ *
+ * Only set when json_string_err_invalid is true.  The parse functions clear it
+ * before they parse.
+ */
+_Thread_local bool json_string_err_found = false;
+
+/*
+ * json_arena_cur - arena of the JSON parse tree being parsed, or NULL
+ *
+ * When non-NULL, json_alloc() and the JSON conversion functions allocate from
+ * this arena.  Set by json_arena_parse_begin() and cleared by json_arena_parse_end().
+ *
+ * NOTE: Each thread has its own json_arena_cur so that more than one thread may
+ *	 parse JSON at the same time.
+ */
+static _Thread_local struct json_arena *json_arena_cur = NULL;
 
 
 /*
@@ -189,6 +264,127 @@ struct byte2asciistr byte2asciistr[JSON_BYTE_VALUES] = {
 };
 
 
+/*
+ * JSON_ENCODE_PLAIN - true if the byte c JSON encodes as itself
+ *
+ * These are the bytes whose byte2asciistr[] encoding is the byte itself:
+ * every byte except \x00-\x1f, '"', '\\' and \x7f.  chkbyte2asciistr()
+ * verifies that the byte2asciistr[] table agrees.
+ */
+#define JSON_ENCODE_PLAIN(c) ((uint8_t)(c) >= 0x20 && (c) != '"' && (c) != '\\' && (uint8_t)(c) != 0x7f)
+
+
+#if defined(__SSE2__) && defined(__GNUC__)
+/*
+ * JSON_SSE2_ESC - SSE2 lanes holding bytes that are not JSON_ENCODE_PLAIN()
+ */
+#define JSON_SSE2_ESC(v) \
+	_mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(_mm_min_epu8((v), _mm_set1_epi8(0x1f)), (v)), \
+				  _mm_cmpeq_epi8((v), _mm_set1_epi8(0x7f))), \
+		     _mm_or_si128(_mm_cmpeq_epi8((v), _mm_set1_epi8('"')), \
+				  _mm_cmpeq_epi8((v), _mm_set1_epi8('\\'))))
+#if defined(JSON_AVX2)
+/*
+ * JSON_AVX2_ESC - AVX2 lanes holding bytes that are not JSON_ENCODE_PLAIN()
+ */
+#define JSON_AVX2_ESC(v) \
+	_mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(_mm256_min_epu8((v), _mm256_set1_epi8(0x1f)), (v)), \
+					_mm256_cmpeq_epi8((v), _mm256_set1_epi8(0x7f))), \
+			_mm256_or_si256(_mm256_cmpeq_epi8((v), _mm256_set1_epi8('"')), \
+					_mm256_cmpeq_epi8((v), _mm256_set1_epi8('\\'))))
+#endif
+#endif
+
+
+#if defined(JSON_AVX2)
+/*
+ * json_encode_avx2 - false ==> json_encode_run() does not use AVX2
+ *
+ * chkbyte2asciistr() clears this to check the SSE2 code on a CPU with AVX2.
+ */
+static bool json_encode_avx2 = true;
+
+
+/*
+ * json_encode_run_avx2 - skip 32 byte blocks of bytes that JSON encode as themselves
+ *
+ * given:
+ *	p	    start of memory block to encode
+ *	i	    offset in p where the run starts
+ *	len	    length of the memory block
+ *
+ * returns:
+ *	offset of the first byte that is not JSON_ENCODE_PLAIN(), or
+ *	the offset of the final < 32 bytes of the block if there is no such byte
+ *	before them
+ *
+ * NOTE: this function is used by json_encode_run() only if the CPU has AVX2.
+ */
+static __attribute__((target("avx2"))) size_t
+json_encode_run_avx2(uint8_t const *p, size_t i, size_t len)
+{
+    unsigned int mask;	    /* lanes holding bytes to escape */
+    __m256i v;		    /* 32 bytes of the block */
+
+    while (i + 32 <= len) {
+	v = _mm256_loadu_si256((__m256i const *)(p + i));
+	mask = (unsigned int)_mm256_movemask_epi8(JSON_AVX2_ESC(v));
+	if (mask != 0) {
+	    return i + (size_t)__builtin_ctz(mask);
+	}
+	i += 32;
+    }
+    return i;
+}
+#endif
+
+
+/*
+ * json_encode_run - find a run of bytes that JSON encode as themselves
+ *
+ * With SSE2 the run is examined 16 bytes at a time.  If the CPU also has
+ * AVX2, json_encode_run_avx2() first examines the run 32 bytes at a time.
+ * The tail of a run is finished one byte at a time.
+ *
+ * given:
+ *	p	    start of memory block to encode
+ *	i	    offset in p where the run starts
+ *	len	    length of the memory block
+ *
+ * returns:
+ *	length of the run of JSON_ENCODE_PLAIN() bytes starting at offset i
+ *
+ * NOTE: this function is used by json_encode().
+ */
+static size_t
+json_encode_run(uint8_t const *p, size_t i, size_t len)
+{
+    size_t start = i;	    /* start of the run */
+#if defined(__SSE2__) && defined(__GNUC__)
+    unsigned int mask;	    /* lanes holding bytes to escape */
+    __m128i v;		    /* 16 bytes of the block */
+
+#if defined(JSON_AVX2)
+    if (json_encode_avx2 && __builtin_cpu_supports("avx2")) {
+	i = json_encode_run_avx2(p, i, len);
+    }
+#endif
+    while (i + 16 <= len) {
+	v = _mm_loadu_si128((__m128i const *)(p + i));
+	mask = (unsigned int)_mm_movemask_epi8(JSON_SSE2_ESC(v));
+	if (mask != 0) {
+	    return i + (size_t)__builtin_ctz(mask) - start;
+	}
+	i += 16;
+    }
+#endif
+    while (i < len && JSON_ENCODE_PLAIN(p[i])) {
+	++i;
+    }
+    return i - start;
+}
+
+
 /*
  * json_encode - return a JSON encoding of a block of memory
  *
@@ -229,6 +425,9 @@ json_encode(char const *ptr, size_t len, size_t *retlen, bool skip_quote)
     char *beyond = NULL;    /* beyond the end of the allocated encoding string */
     ssize_t mlen = 0;	    /* length of allocated encoded string */
     char *p;		    /* next place to encode */
+    uint8_t const *uptr;    /* ptr as unsigned bytes */
+    size_t run;		    /* length of a run of bytes that encode as themselves */
+    size_t enc_len;	    /* length of the encoding of a run and the byte beyond it */
     size_t i;
 
     /*
@@ -242,12 +441,22 @@ json_encode(char const *ptr, size_t len, size_t *retlen, bool skip_quote)
 	warn(__func__, "called with NULL ptr");
 	return NULL;
     }
+    uptr = (uint8_t const *)ptr;
 
     /*
      * count the bytes that will be in the encoded allocated string
-     */
-    for (i=0; i < len; ++i) {
-	mlen += byte2asciistr[(uint8_t)(ptr[i])].len;
+     *
+     * Runs of bytes that encode as themselves count as their length: only
+     * the bytes that need escaping are looked up in byte2asciistr[].
+     */
+    for (i=0; i < len; ) {
+	run = json_encode_run(uptr, i, len);
+	mlen += (ssize_t)run;
+	i += run;
+	if (i < len) {
+	    mlen += (ssize_t)byte2asciistr[uptr[i]].len;
+	    ++i;
+	}
     }
     if (mlen < 0) { /* paranoia */
 	/* error - clear allocated length */
@@ -290,9 +499,17 @@ json_encode(char const *ptr, size_t len, size_t *retlen, bool skip_quote)
 
     /*
      * JSON encode each byte
-     */
-    for (p=ret; i < len; ++i) {
-	if (p+byte2asciistr[(uint8_t)(ptr[i])].len > beyond) {
+     *
+     * Runs of bytes that encode as themselves are copied as a block, and
+     * the byte2asciistr[] encoding is copied for each byte that needs escaping.
+     */
+    for (p=ret; i < len; ) {
+	run = json_encode_run(uptr, i, len);
+	enc_len = run;
+	if (i + run < len) {
+	    enc_len += byte2asciistr[uptr[i + run]].len;
+	}
+	if (p+enc_len > beyond) {
 	    /* error - clear allocated length */
 	    if (retlen != NULL) {
 		*retlen = 0;
@@ -304,8 +521,14 @@ json_encode(char const *ptr, size_t len, size_t *retlen, bool skip_quote)
 	    warn(__func__, "encoding ran beyond end of allocated encoded string");
 	    return NULL;
 	}
-	strcpy(p, byte2asciistr[(uint8_t)(ptr[i])].enc);
-	p += byte2asciistr[(uint8_t)(ptr[i])].len;
+	memcpy(p, ptr + i, run);
+	p += run;
+	i += run;
+	if (i < len) {
+	    memcpy(p, byte2asciistr[uptr[i]].enc, byte2asciistr[uptr[i]].len);
+	    p += byte2asciistr[uptr[i]].len;
+	    ++i;
+	}
     }
     *p = '\0';	/* paranoia */
     mlen = p - ret; /* paranoia */
@@ -891,6 +1114,150 @@ jdecencchk(int entertainment)
 }
 
 
+/*
+ * chkbyte2asciistr() compares json_encode() with a byte at a time encoding
+ * on blocks of up to CHK_JSON_ENCODE_LEN bytes, CHK_JSON_ENCODE_BLOCKS of
+ * which are pseudo-random
+ */
+#define CHK_JSON_ENCODE_LEN (100)
+#define CHK_JSON_ENCODE_BLOCKS (1000)
+
+
+/*
+ * chk_json_encode - verify json_encode() against a byte at a time encoding
+ *
+ * The reference encoding appends byte2asciistr[] of each byte, as json_encode()
+ * did before it copied runs of bytes that encode as themselves.
+ *
+ * given:
+ *	ptr		start of memory block to encode
+ *	len		length of block to encode in bytes
+ *	skip_quote	true ==> ignore any double quotes if they are both
+ *				 at the start and end of the memory block
+ *
+ * This function does not return on error.
+ */
+static void
+chk_json_encode(char const *ptr, size_t len, bool skip_quote)
+{
+    char *ref = NULL;	/* reference encoding */
+    char *mstr = NULL;	/* json_encode() encoding */
+    size_t ref_len = 0;	/* length of reference encoding */
+    size_t mlen = 0;	/* length of json_encode() encoding */
+    size_t start = 0;	/* first byte to encode */
+    size_t end = len;	/* beyond the last byte to encode */
+    size_t i;
+
+    /*
+     * firewall
+     */
+    if (ptr == NULL) {
+	err(250, __func__, "ptr is NULL");
+	not_reached();
+    }
+
+    /*
+     * form the reference encoding
+     */
+    if (skip_quote == true && len > 1 && ptr[0] == '"' && ptr[len-1] == '"') {
+	start = 1;
+	end = len - 1;
+    }
+    errno = 0;			/* pre-clear errno for errp() */
+    ref = calloc(len * LITLEN("\\uxxxx") + 1, sizeof(*ref));
+    if (ref == NULL) {
+	errp(251, __func__, "calloc of %zu bytes failed", len * LITLEN("\\uxxxx") + 1);
+	not_reached();
+    }
+    for (i=start; i < end; ++i) {
+	memcpy(ref + ref_len, byte2asciistr[(uint8_t)(ptr[i])].enc, byte2asciistr[(uint8_t)(ptr[i])].len);
+	ref_len += byte2asciistr[(uint8_t)(ptr[i])].len;
+    }
+
+    /*
+     * compare with json_encode()
+     */
+    mstr = json_encode(ptr, len, &mlen, skip_quote);
+    if (mstr == NULL) {
+	err(252, __func__, "json_encode(ptr, %zu, *mlen, %s) == NULL", len, booltostr(skip_quote));
+	not_reached();
+    }
+    if (mlen != ref_len) {
+	err(253, __func__, "json_encode(ptr, %zu, *mlen, %s): *mlen: %zu != %zu",
+			   len, booltostr(skip_quote), mlen, ref_len);
+	not_reached();
+    }
+    if (memcmp(mstr, ref, ref_len) != 0 || mstr[mlen] != '\0') {
+	err(254, __func__, "json_encode(ptr, %zu, *mlen, %s) != byte at a time encoding",
+			   len, booltostr(skip_quote));
+	not_reached();
+    }
+
+    /*
+     * free strings
+     */
+    free(mstr);
+    mstr = NULL;
+    free(ref);
+    ref = NULL;
+    return;
+}
+
+
+/*
+ * chk_json_encode_all - compare json_encode() with a byte at a time encoding
+ *
+ * Each byte value is placed at every offset of a block of bytes that
+ * encode as themselves, so that it is found in every lane and in the
+ * tail of json_encode_run().  Then all byte values, and pseudo-random
+ * blocks of bytes, are encoded with and without skip_quote.
+ *
+ * This function does not return on error.
+ */
+static void
+chk_json_encode_all(void)
+{
+    char block[CHK_JSON_ENCODE_LEN];	/* block to compare encodings of */
+    char all[JSON_BYTE_VALUES];		/* all byte values */
+    uint64_t seed;	/* pseudo-random block state */
+    size_t len;		/* length of pseudo-random block */
+    size_t j;
+    unsigned int i;
+
+    for (i=0; i < JSON_BYTE_VALUES; ++i) {
+	for (j=0; j < sizeof(block); ++j) {
+	    memset(block, 'x', sizeof(block));
+	    block[j] = (char)i;
+	    chk_json_encode(block, sizeof(block), false);
+	    chk_json_encode(block, j+1, false);
+	}
+	block[0] = (char)i;
+	chk_json_encode(block, 1, false);
+    }
+    for (i=0; i < JSON_BYTE_VALUES; ++i) {
+	all[i] = (char)i;
+    }
+    chk_json_encode(all, sizeof(all), false);
+    chk_json_encode(all, sizeof(all), true);
+    seed = 1;
+    for (i=0; i < CHK_JSON_ENCODE_BLOCKS; ++i) {
+	for (j=0; j < sizeof(block); ++j) {
+	    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;  /* 64-bit LCG */
+	    /* mostly bytes that encode as themselves, as in remarks and abstracts */
+	    block[j] = ((seed >> 60) == 0) ? (char)(seed >> 32) : (char)(' ' + (seed >> 33) % 95);
+	}
+	len = (size_t)(seed >> 40) % (sizeof(block) + 1);
+	block[0] = '"';
+	if (len > 0) {
+	    block[len - 1] = '"';
+	}
+	chk_json_encode(block, len, false);
+	chk_json_encode(block, len, true);
+    }
+    return;
+}
+
+
 /*
  * chkbyte2asciistr - validate the contents of the byte2asciistr[] table
  *
@@ -1317,6 +1684,32 @@ chkbyte2asciistr(void)
 	}
     }
 
+    /*
+     * assert: JSON_ENCODE_PLAIN() agrees with the byte2asciistr[] table
+     */
+    for (i=0; i < JSON_BYTE_VALUES; ++i) {
+	if (JSON_ENCODE_PLAIN(i) != (byte2asciistr[i].len == 1 && (uint8_t)(byte2asciistr[i].enc[0]) == i)) {
+	    err(255, __func__, "JSON_ENCODE_PLAIN(0x%02x) disagrees with byte2asciistr[0x%02x].enc: <%s>",
+			       i, i, byte2asciistr[i].enc);
+	    not_reached();
+	}
+    }
+
+    /*
+     * compare json_encode() with a byte at a time encoding
+     *
+     * On a CPU with AVX2 the comparison is made both with and without the
+     * AVX2 code of json_encode_run(), so that the SSE2 code is checked too.
+     */
+    chk_json_encode_all();
+#if defined(JSON_AVX2)
+    if (__builtin_cpu_supports("avx2")) {
+	json_encode_avx2 = false;
+	chk_json_encode_all();
+	json_encode_avx2 = true;
+    }
+#endif
+
     /*
      * all seems well with the byte2asciistr[] table
      */
@@ -1326,35 +1719,70 @@ chkbyte2asciistr(void)
 
 
 /*
- * decode_json_string - return the decoding of a JSON encoded block of memory
+ * json_hex4 - return the value of 4 hex characters
+ *
+ * given:
+ *	ptr	    start of the 4 characters (beyond the \u)
+ *
+ * returns:
+ *	value of the 4 hex characters, or -1 ==> not 4 hex characters
+ *
+ * NOTE: the caller must ensure that 4 characters may be read from ptr.
+ *
+ * NOTE: this function is used by json_decode().
+ */
+static int32_t
+json_hex4(char const *ptr)
+{
+    int a = hexval[(uint8_t)ptr[0]];
+    int b = hexval[(uint8_t)ptr[1]];
+    int c = hexval[(uint8_t)ptr[2]];
+    int d = hexval[(uint8_t)ptr[3]];
+
+    /*
+     * hexval[] is -1 for a non-hex character, so a single test of the OR
+     * rejects any non-hex character
+     */
+    if ((a | b | c | d) < 0) {
+	return -1;
+    }
+    return (int32_t)((a << 12) | (b << 8) | (c << 4) | d);
+}
+
+
+/*
+ * json_decode - return the decoding of a JSON encoded block of memory
  *
  * given:
  *	ptr	    start of memory block to decode
- *	len	    length of block
- *	mlen	    length of decoded bytes to allocate
+ *	len	    length of block to decode in bytes
+ *	quote       true ==> require surrounding double quotes ("s)
  *	retlen	    address of where to store allocated length, if retlen != NULL
  *
+ *
  * returns:
  *	allocated JSON decoding of a block, or NULL ==> error
  *	NOTE: retlen, if non-NULL, is set to 0 on error
  *
- * NOTE: this function is used by json_decode().
+ * NOTE: The block is validated and decoded in a single pass.  A JSON escape
+ *	 never decodes into more bytes than it occupies (\uxxxx decodes into
+ *	 at most 3 bytes, and a \uxxxx\uxxxx surrogate pair into 4 bytes), so
+ *	 the decoded string is written into a buffer of len + 2 bytes.
+ *
+ * NOTE: this does not convert a Unicode character like a letter with a
+ * diacritic or an emoji to its code point. In fact, for reasons we do not
+ * comprehend, the following is perfectly valid JSON:
+ *
+ *      { "🔥" "🐉" }
+ *
+ * Instead, if one were to pass to this function the string "\\", it would
+ * return "\\\\", for example.
  */
-static char *
-decode_json_string(char const *ptr, size_t len, size_t mlen, size_t *retlen)
+char *
+json_decode(char const *ptr, size_t len, bool quote, size_t *retlen)
 {
-    char *ret = NULL;	    /* allocated encoding string or NULL */
-    char *beyond = NULL;    /* beyond the end of the allocated encoding string */
-    char *p = NULL;	    /* next place to encode */
-    char n = 0;		    /* next character beyond a \\ */
-    uint32_t xa = 0;        /* first hex character numeric value */
-    uint32_t xb = 0;        /* second hex character numeric value */
-    char c = 0;		    /* character to decode or third hex character after \u */
-    size_t i;
-    int32_t bytes = 0;
-    int32_t surrogate = 0;
-    char *utf8 = NULL;
-    int scanned = 0;
+    char *ret = NULL;	    /* allocated decoding string or NULL */
+    size_t mlen = 0;	    /* length of decoded string */
 
     /*
      * firewall
@@ -1368,555 +1796,217 @@ decode_json_string(char const *ptr, size_t len, size_t mlen, size_t *retlen)
 	return NULL;
     }
 
+    if (quote) {
+	/*
+	 * firewall
+	 */
+	if (len < 2) {
+	    warn(__func__, "quote === true: called with len: %zu < 2", len);
+	    return NULL;
+	}
+	if (ptr[0] != '"') {
+	    warn(__func__, "quote === true: string does NOT start with a \"");
+	    return NULL;
+	}
+	if (ptr[len-1] != '"') {
+	    warn(__func__, "quote === true: string does NOT end with a \"");
+	    return NULL;
+	}
+	/*
+	 * ignore JSON surrounding '"'s
+	 */
+	++ptr;
+	len -= 2;
+    }
+
     /*
-     * allocated decoded string
+     * allocate the decoded string
      */
-    ret = calloc(mlen + 1 + 1, sizeof(*ret));
+    ret = malloc(len + 1 + 1);
     if (ret == NULL) {
 	/* error - clear allocated length */
 	if (retlen != NULL) {
 	    *retlen = 0;
 	}
-	warn(__func__, "calloc of %zu bytes failed", (mlen + 1 + 1));
+	warn(__func__, "malloc of %zu bytes failed", len + 1 + 1);
 	return NULL;
     }
-    ret[mlen] = '\0';   /* terminate string */
-    ret[mlen + 1] = '\0';   /* paranoia */
-    beyond = &(ret[mlen]);
-
 
     /*
-     * JSON string decode
-     *
-     * In the counting code in json_decode(), prior to the calloc for the
-     * decoded string, we already determined that the JSON encoded block of
-     * memory is valid.
+     * JSON string validate and decode
      */
-    for (i=0, p=utf8=ret; i < len; ++i, ++utf8) {
-	/*
-	 * paranoia
-	 */
-	if (p >= beyond) {
-	    /* error - clear allocated length and buffer */
-	    if (retlen != NULL) {
-		*retlen = 0;
-	    }
-	    if (ret != NULL) {
-		free(ret);
-		ret = NULL;
-	    }
-
-	    warn(__func__, "ran beyond end of decoded string");
-	    return NULL;
+    if (!json_decode_buf(ptr, len, ret, &mlen)) {
+	/* error - clear allocated length and free buffer */
+	if (retlen != NULL) {
+	    *retlen = 0;
 	}
+	free(ret);
+	return NULL;
+    }
+    if (retlen != NULL) {
+	*retlen = mlen;
+    }
 
-	/*
-	 * examine the current character
-	 */
-	c = (char)((uint8_t)(ptr[i]));
+    /*
+     * return result
+     */
+    dbg(DBG_VVVHIGH, "returning from json_decode(ptr, %zu, *%zu, %s): %s",
+		     len, mlen, booltostr(quote), ret);
+    return ret;
 
-	/*
-	 * case: JSON decode non \-escape character
-	 */
-	if (c != '\\') {
-	    /* no translation encoding */
-	    *p++ = c;
-
-	/*
-	 * case: JSON decode \-escape character
-	 */
-	} else {
-
-	    /*
-	     * look at the next character beyond \
-	     */
-	    n = (char)((uint8_t)(ptr[i+1]));
-
-	    /*
-	     * decode single \c escaped pairs
-	     */
-	    switch (n) {
-	    case 'b':	/* ASCII backspace */
-		++i;
-		*p++ = '\b';
-		break;
-	    case 't':	/* ASCII horizontal tab */
-		++i;
-		*p++ = '\t';
-		break;
-	    case 'n':	/* ASCII line feed */
-		++i;
-		*p++ = '\n';
-		break;
-	    case 'f':	/* ASCII form feed */
-		++i;
-		*p++ = '\f';
-		break;
-	    case 'r':	/* ASCII carriage return */
-		++i;
-		*p++ = '\r';
-		break;
-	    case 'a':	/* ASCII bell */
-		++i;
-		*p++ = '\a';
-		break;
-	    case 'v':	/* ASCII vertical tab */
-		++i;
-		*p++ = '\v';
-		break;
-	    case 'e':	/* ASCII escape */
-		++i;
-		*p++ = 0x0b;  /* not all C compilers understand \e */
-		break;
-	    case '"':	/*fallthrough*/
-	    case '/':	/*fallthrough*/
-	    case '\\':
-		++i;
-		*p++ = n;	/* escape decodes to itself */
-		break;
-
-	    /*
-	     * decode \uxxxx
-	     */
-	    case 'u':
-		/*
-		 * there must be at least five more characters beyond \
-		 */
-		if (i+5 >= len) {
-		    /* error - clear allocated length and free buffer */
-		    if (retlen != NULL) {
-			*retlen = 0;
-		    }
-		    if (ret != NULL) {
-			free(ret);
-			ret = NULL;
-		    }
-
-		    warn(__func__, "found \\u while decoding, but not enough for 4 hex chars at end of buffer");
-		    return NULL;
-		}
-		xa = 0;
-		xb = 0;
-
-		/*
-		 * we check for a second \uxxxx first, in case it is a surrogate
-		 * pair
-		 */
-		scanned = sscanf(ptr + i + 2, "%4x\\u%4x", &xa, &xb);
-		if (scanned == EOF) {
-		    /* error - clear allocated length and free buffer */
-		    if (retlen != NULL) {
-			*retlen = 0;
-		    }
-		    if (ret != NULL) {
-			free(ret);
-			ret = NULL;
-		    }
-
-		    warn(__func__, "reached EOF trying to scan for hex bytes");
-		    return NULL;
-		} else if (scanned == 1 || (scanned == 2 && surrogate_pair_to_codepoint((int32_t)xa, (int32_t)xb) < 0)) {
-		    /*
-		     * no possible surrogate pair found so proceed like there
-		     * was not another \uxxxx
-		     */
-
-		    bytes = codepoint_to_unicode(utf8, xa);
-		    if (bytes <= 0) {
-			/* error - clear allocated length and free buffer */
-			if (retlen != NULL) {
-			    *retlen = 0;
-			}
-			if (ret != NULL) {
-			    free(ret);
-			    ret = NULL;
-			}
-			/* codepoint_to_unicode warns on error */
-			return NULL;
-		    }
-		    /*
-		     * bytes - 1 because we increment utf8 in the increment phase
-		     * of the loop
-		     */
-		    utf8 += bytes - 1;
-		    /*
-		     * however, for p we need to update the entire amount
-		     */
-		    p += bytes;
-		    /*
-		     * we increment by 5 because LITLEN("uxxxx") is 5: the for() loop
-		     * increments by 1 at the increment/update phase.
-		     */
-		    i += 5;
-		} else if (scanned == 2) {
-		    /*
-		     * in this case we have to check if we have a valid
-		     * surrogate pair.
-		     */
-		    surrogate = surrogate_pair_to_codepoint((int32_t)xa, (int32_t)xb);
-		    if (surrogate < 0) {
-			if (retlen != NULL) {
-			    *retlen = 0;
-			}
-			if (ret != NULL) {
-			    free(ret);
-			    ret = NULL;
-			}
-			warn(__func__, "surrogate pair invalid: \\u%X\\u%X", xa, xb);
-
-			return NULL;
-		    }
-
-		    bytes = codepoint_to_unicode(utf8, surrogate);
-		    if (bytes <= 0) {
-			/* error - clear allocated length and free buffer */
-			if (retlen != NULL) {
-			    *retlen = 0;
-			}
-			if (ret != NULL) {
-			    free(ret);
-			    ret = NULL;
-			}
-			/* codepoint_to_unicode() warns on error */
-			return NULL;
-		    }
-
-		    /*
-		     * bytes - 1 because we increment utf8 in the increment phase
-		     * of the loop
-		     */
-		    utf8 += bytes - 1;
-		    /*
-		     * however, for p we need to update the entire amount
-		     */
-		    p += bytes;
-
-		    /*
-		     * we increment by 11 because LITLEN("uxxxx") +
-		     * LITLEN("\\uxxxx") is 11.
-		     */
-		    i += 11;
-		} else {
-		    /* error - clear allocated length and free buffer */
-		    if (retlen != NULL) {
-			*retlen = 0;
-		    }
-		    if (ret != NULL) {
-			free(ret);
-			ret = NULL;
-		    }
-		    warn(__func__, "did not read \\uxxxx hex value");
-		    return NULL;
-		}
-		break;
-
-	    /*
-	     * unknown \c escaped pairs
-	     */
-	    default:
-		/* error - clear allocated length and free buffer */
-		if (retlen != NULL) {
-		    *retlen = 0;
-		}
-		if (ret != NULL) {
-		    free(ret);
-		    ret = NULL;
-		}
-
-		warn(__func__, "found invalid JSON \\-escape while decoding: followed by 0x%02x", (uint8_t)c);
-		return NULL;
-	    }
-	}
-     }
-
-    /*
-     * return result
-     */
-
-    dbg(DBG_VVVHIGH, "returning from decode_json_string(ptr, %zu, %zu, *%zu)",
-		 len, mlen, retlen != NULL ? *retlen : 0);
-    if (retlen != NULL) {
-	*retlen = mlen;
-    }
-
-    return ret;
-}
+}
 
 
 /*
- * json_decode - return the decoding of a JSON encoded block of memory
+ * json_decode_buf - validate and decode a JSON encoded block of memory into a buffer
  *
  * given:
- *	ptr	    start of memory block to decode
+ *	ptr	    start of memory block to decode, without surrounding double quotes
  *	len	    length of block to decode in bytes
- *	quote       true ==> require surrounding double quotes ("s)
- *	retlen	    address of where to store allocated length, if retlen != NULL
- *
+ *	ret	    buffer of at least len + 2 bytes to decode into
+ *	retlen	    address of where to store the decoded length
  *
  * returns:
- *	allocated JSON decoding of a block, or NULL ==> error
- *	NOTE: retlen, if non-NULL, is set to 0 on error
- *
- * NOTE: this does not convert a Unicode character like a letter with a
- * diacritic or an emoji to its code point. In fact, for reasons we do not
- * comprehend, the following is perfectly valid JSON:
- *
- *      { "🔥" "🐉" }
+ *	true ==> block decoded into ret and NUL terminated,
+ *	false ==> block is not a valid JSON encoded string
  *
- * Instead, if one were to pass to this function the string "\\", it would
- * return "\\\\", for example.
+ * NOTE: See json_decode() for why len + 2 bytes are enough.
  */
-char *
-json_decode(char const *ptr, size_t len, bool quote, size_t *retlen)
+static bool
+json_decode_buf(char const *ptr, size_t len, char *ret, size_t *retlen)
 {
-    char *ret = NULL;	    /* allocated encoding string or NULL */
-    size_t mlen = 0;	    /* length of allocated encoded string */
-    char n = 0;		    /* next character beyond a \\ */
-    char c = 0;		    /* character to decode or third hex character after \u */
-    uint32_t xa = 0;        /* first hex number for \uxxxx (if surrogates) */
-    uint32_t xb = 0;        /* second hex number for \uxxxx (if surrogates) */
-    int32_t surrogate = 0;  /* for surrogate pairs */
-    int scanned = 0;	    /* for sscanf() */
-    size_t i;
-    size_t bytes = 0;	    /* for utf8len() */
-
     /*
-     * firewall
+     * decode_char[c] is the decoding of the \c escape pair, 'u' for \uxxxx,
+     * or 0 for an invalid JSON \-escape
      */
-    if (ptr == NULL) {
-	/* error - clear allocated length */
-	if (retlen != NULL) {
-	    *retlen = 0;
-	}
-	warn(__func__, "called with NULL ptr");
-	return NULL;
-    }
-
-    if (quote) {
-	/*
-	 * firewall
-	 */
-	if (len < 2) {
-	    warn(__func__, "quote === true: called with len: %zu < 2", len);
-	    return NULL;
-	}
-	if (ptr[0] != '"') {
-	    warn(__func__, "quote === true: string does NOT start with a \"");
-	    return NULL;
-	}
-	if (ptr[len-1] != '"') {
-	    warn(__func__, "quote === true: string does NOT end with a \"");
-	    return NULL;
-	}
-	/*
-	 * ignore JSON surrounding '"'s
-	 */
-	++ptr;
-	len -= 2;
-    }
+    static char const decode_char[JSON_BYTE_VALUES] = {
+	['b'] = '\b', ['t'] = '\t', ['n'] = '\n', ['f'] = '\f', ['r'] = '\r',
+	['"'] = '"', ['/'] = '/', ['\\'] = '\\', ['u'] = 'u',
+    };
+    /*
+     * raw_bad[c] is true if the byte c must be \-escaped in the block
+     *
+     * NOTE: '\\' is handled as the start of an escape before raw_bad[] is consulted.
+     */
+    static bool const raw_bad[JSON_BYTE_VALUES] = {
+	['\b'] = true, ['\t'] = true, ['\n'] = true, ['\f'] = true, ['\r'] = true,
+	['"'] = true,
+    };
+    char *p = NULL;	    /* next place to decode */
+    uint8_t c = 0;	    /* character to decode */
+    char n = 0;		    /* decoding of the character beyond a \\ */
+    int32_t xa = 0;	    /* first hex number for \uxxxx */
+    int32_t xb = 0;	    /* second hex number for \uxxxx (if surrogates) */
+    int32_t codepoint = 0;  /* Unicode code point of \uxxxx or \uxxxx\uxxxx */
+    int bytes = 0;	    /* for codepoint_to_unicode() */
+    size_t mlen = 0;	    /* length of decoded string */
+    size_t i;
 
     /*
-     * count the bytes that will be in the decoded allocated string
+     * JSON string validate and decode
      */
-    for (i=0; i < len; ++i) {
+    for (i=0, p=ret; i < len; ++i) {
 
 	/*
 	 * examine the current character
 	 */
-	c = (char)((uint8_t)(ptr[i]));
+	c = (uint8_t)ptr[i];
 
 	/*
-	 * valid non-\-escaped characters count as 1
+	 * case: copy a non \-escape character
 	 */
-        if (c != '\\') {
-
-	    /*
-	     * disallow characters that should have been escaped
-	     */
-	    switch (c) {
-	    case '\b':  /*fallthrough*/
-	    case '\t':  /*fallthrough*/
-	    case '\n':  /*fallthrough*/
-	    case '\f':  /*fallthrough*/
-	    case '\r':  /*fallthrough*/
-	    case '"':   /*fallthrough*/
-	    case '\\':
-		/* error - clear allocated length */
-		if (retlen != NULL) {
-		    *retlen = 0;
-		}
-		warn(__func__, "found non-\\-escaped char: 0x%02x", (uint8_t)c);
-		return NULL;
-		break;
-
-	    /*
-	     * count a valid character
-	     */
-	    default:
-		++mlen;
-		break;
+	if (c != '\\') {
+	    if (raw_bad[c]) {
+		warn(__func__, "found non-\\-escaped char: 0x%02x", c);
+		return false;
 	    }
+	    *p++ = (char)c;
+	    continue;
+	}
 
 	/*
-	 * valid \-escaped characters count as 2 or 6
+	 * case: JSON decode \-escape character
+	 *
+	 * there must be at least one more character beyond \
 	 */
-	} else {
-
-	    /*
-	     * there must be at least one more character beyond \
-	     */
-	    if (i+1 >= len) {
-		/* error - clear allocated length */
-		if (retlen != NULL) {
-		    *retlen = 0;
-		}
-		warn(__func__, "found \\ at end of buffer, missing next character");
-		return NULL;
-	    }
-
-	    /*
-	     * look at the next character beyond \
-	     */
-	    n = (char)((uint8_t)(ptr[i+1]));
-
-	    /*
-	     * process single \c escaped pairs
-	     */
-	    switch (n) {
-	    case 'b':	/*fallthrough*/
-	    case 't':	/*fallthrough*/
-	    case 'n':	/*fallthrough*/
-	    case 'f':	/*fallthrough*/
-	    case 'r':	/*fallthrough*/
-	    case '"':	/*fallthrough*/
-	    case '/':	/*fallthrough*/
-	    case '\\':
-		/*
-		 * count \c escaped pair as 1 character
-		 */
-		++mlen;
-		++i;
-		break;
-
-	    /*
-	     * process \uxxxx where x is a hex character
-	     */
-	    case 'u':
-		/*
-		 * there must be at least five more characters beyond \
-		 */
-		if (i+5 >= len) {
-		    /* error - clear allocated length */
-		    if (retlen != NULL) {
-			*retlen = 0;
-		    }
-		    warn(__func__, "found \\u, but not enough for 4 hex chars at end of buffer");
-		    return NULL;
-		}
-		xa = 0;
-		xb = 0;
-		scanned = sscanf(ptr + i + 2, "%4x\\u%4x", &xa, &xb);
-		if (scanned == EOF) {
-		    /* error - clear allocated length and free buffer */
-		    if (retlen != NULL) {
-			*retlen = 0;
-		    }
-
-		    warn(__func__, "reached EOF trying to scan for hex bytes");
-		    return NULL;
-		} else if (scanned == 1 || (scanned == 2 && surrogate_pair_to_codepoint((int32_t)xa, (int32_t)xb) < 0)) {
-		    surrogate = xa;
-		    bytes = utf8len(ptr + i, surrogate);
-		    if (bytes <= 0) {
-			if (retlen != NULL) {
-			    *retlen = 0;
-			}
-			/* utf8len() already warns */
-			return NULL;
-		    }
-		    dbg(DBG_VVHIGH, "UTF-8 bytes: %zu", bytes);
-		    mlen += bytes;
-		    i += 5;
-		} else if (scanned == 2) {
-		    /*
-		     * if there is a \uxxxx\uxxxx then we try for a surrogate
-		     * pair.
-		     */
-		    surrogate = surrogate_pair_to_codepoint((int32_t)xa, (int32_t)xb);
-		    if (surrogate < 0) {
-			if (retlen != NULL) {
-			    *retlen = 0;
-			}
-			warn(__func__, "surrogate pair invalid: \\u%X\\u%X", xa, xb);
-
-			return NULL;
-		    }
+	if (i+1 >= len) {
+	    warn(__func__, "found \\ at end of buffer, missing next character");
+	    return false;
+	}
+	n = decode_char[(uint8_t)ptr[i+1]];
+	if (n == 0) {
+	    warn(__func__, "found invalid JSON \\-escape: followed by 0x%02x", (uint8_t)ptr[i+1]);
+	    return false;
+	}
+	if (n != 'u') {
+	    /* decode single \c escaped pair */
+	    *p++ = n;
+	    ++i;
+	    continue;
+	}
 
-		    /*
-		     * assuming no error from surrogate_pair_to_codepoint(), we will
-		     * try counting the bytes needed.
-		     */
-		    bytes = utf8len(NULL, surrogate);
-		    if (bytes <= 0) {
-			if (retlen != NULL) {
-			    *retlen = 0;
-			}
-			/* utf8len() already warns */
-			return NULL;
-		    }
-		    dbg(DBG_VVHIGH, "UTF-8 bytes: %zu", bytes);
-		    mlen += bytes;
+	/*
+	 * decode \uxxxx
+	 *
+	 * there must be at least five more characters beyond \
+	 */
+	if (i+5 >= len) {
+	    warn(__func__, "found \\u, but not enough for 4 hex chars at end of buffer");
+	    return false;
+	}
+	xa = json_hex4(ptr + i + 2);
+	if (xa < 0) {
+	    warn(__func__, "did not read \\uxxxx hex value");
+	    return false;
+	}
+	codepoint = xa;
 
+	/*
+	 * we check for a second \uxxxx in case it is a surrogate pair
+	 */
+	if (xa >= 0xD800 && xa <= 0xDBFF && i+11 < len && ptr[i+6] == '\\' && ptr[i+7] == 'u') {
+	    xb = json_hex4(ptr + i + 8);
+	    if (xb >= 0) {
+		codepoint = surrogate_pair_to_codepoint(xa, xb);
+		if (codepoint >= 0) {
 		    /*
-		     * we skip 11 instead of 5 because 5 + LITLEN("\\uxxxx") is
-		     * 11.
+		     * we skip 6 more because LITLEN("\\uxxxx") is 6
 		     */
-		    i += 11;
+		    i += 6;
 		} else {
-		    /* error - clear allocated length and free buffer */
-		    if (retlen != NULL) {
-			*retlen = 0;
-		    }
-		    warn(__func__, "did not read \\uxxxx hex value");
-		    return NULL;
-		}
-
-		break;
-
-	    /*
-	     * found invalid JSON \-escape character
-	     */
-	    default:
-		/* error - clear allocated length */
-		if (retlen != NULL) {
-		    *retlen = 0;
+		    /* not a surrogate pair, so proceed like there was not another \uxxxx */
+		    codepoint = xa;
 		}
-		warn(__func__, "found invalid JSON \\-escape: followed by 0x%02x", (uint8_t)c);
-		return NULL;
 	    }
 	}
-    }
 
-   /*
-     * decode JSON string
-     */
-    ret = decode_json_string(ptr, (uintmax_t)len, (uintmax_t)mlen, retlen);
+	/*
+	 * encode the code point as UTF-8
+	 *
+	 * NOTE: codepoint_to_unicode() rejects a lone surrogate.
+	 */
+	bytes = codepoint_to_unicode(p, (unsigned int)codepoint);
+	if (bytes <= 0) {
+	    /* codepoint_to_unicode() warns on error */
+	    return false;
+	}
+	p += bytes;
+
+	/*
+	 * we increment by 5 because LITLEN("uxxxx") is 5: the for() loop
+	 * increments by 1 at the increment/update phase.
+	 */
+	i += 5;
+    }
 
     /*
-     * return result, if not NULL
+     * terminate the decoded string
      */
-    if (ret != NULL) {
-	dbg(DBG_VVVHIGH, "returning from json_decode(ptr, %zu, *%zu, %s): %s",
-			 len, mlen, booltostr(quote), ret);
-    } else {
-	dbg(DBG_VVVHIGH, "in json_decode(): decode_json_string(ptr, %zu, *%zu) returned NULL",
-			 len, mlen);
-	if (retlen != NULL) {
-	    *retlen = 0;
-	}
-	return NULL;
-    }
-    return ret;
+    mlen = (size_t)(p - ret);
+    ret[mlen] = '\0';	    /* terminate string */
+    ret[mlen + 1] = '\0';   /* paranoia */
+    *retlen = mlen;
+    return true;
 }
 
 
@@ -2008,7 +2098,10 @@ json_decode_str(char const *str, bool quote, size_t *retlen)
  * would rely on strlen() which would mean that the first NUL byte would be the
  * end of the string. If len <= 0 this function uses strlen() on the string.
  *
- * NOTE: This function does not return if passed a NULL string or if conversion fails.
+ * NOTE: This function does not return if passed a NULL string, or if conversion
+ *	 fails and json_string_err_invalid is false.  If conversion fails and
+ *	 json_string_err_invalid is true, json_string_err_found is set and the
+ *	 unconverted JSON string is returned.
  */
 struct json *
 json_parse_string(char const *string, size_t len)
@@ -2043,6 +2136,12 @@ json_parse_string(char const *string, size_t len)
     }
     item = &(str->item.string);
     if (!VALID_JSON_NODE(item)) {
+	if (json_string_err_invalid) {
+	    json_string_err_found = true;
+	    fprint((jparse_err_stream != NULL) ? jparse_err_stream : stderr,
+		   "Warning: %s: couldn't parse string: <%s>\n", __func__, string);
+	    return str;
+	}
 	err(223, __func__, "couldn't parse string: <%s>", string);
 	not_reached();
     }
@@ -2294,6 +2393,8 @@ json_parse_array(struct json *elements)
  *	pointer to a struct json with the converted JSON member
  *
  * NOTE: This function does not return if passed a NULL name or value or if conversion fails.
+ *	 If the name could not be decoded and json_string_err_found is set, the
+ *	 unconverted member is returned.
  */
 struct json *
 json_parse_member(struct json *name, struct json *value)
@@ -2330,6 +2431,10 @@ json_parse_member(struct json *name, struct json *value)
     }
     item = &(member->item.member);
     if (!VALID_JSON_NODE(item)) {
+	if (json_string_err_found) {
+	    /* json_parse_string() reported the name that could not be decoded */
+	    return member;
+	}
 	err(10, __func__, "couldn't convert member");
 	not_reached();
     }
@@ -2375,12 +2480,20 @@ json_alloc(enum item_type type)
 
     /*
      * allocate the JSON parse tree item
+     *
+     * A node in a JSON parse tree arena is only as large as the union member of its type.
      */
-    errno = 0;			/* pre-clear errno for errp() */
-    ret = calloc(1, sizeof(*ret));
-    if (ret == NULL) {
-	errp(11, __func__, "calloc #0 error allocating %zu bytes", sizeof(*ret));
-	not_reached();
+    if (json_arena_cur != NULL) {
+	ret = json_arena_take(json_arena_cur, offsetof(struct json, item) + json_item_size(type),
+			      _Alignof(struct json));
+	++json_arena_cur->nodes;
+    } else {
+	errno = 0;			/* pre-clear errno for errp() */
+	ret = calloc(1, sizeof(*ret));
+	if (ret == NULL) {
+	    errp(11, __func__, "calloc #0 error allocating %zu bytes", sizeof(*ret));
+	    not_reached();
+	}
     }
 
     /*
@@ -2388,6 +2501,7 @@ json_alloc(enum item_type type)
      */
     ret->type = type;
     ret->parent = NULL;
+    ret->arena = json_arena_cur;
 
     /*
      * paranoia - explicitly elements in the "struct json_foo" structure
@@ -3164,57 +3278,156 @@ json_process_floating(struct json_number *item, char const *str, size_t len)
 
 
 /*
- * json_conv_number - convert JSON number string to C numeric value
- *
- * A JSON number string is of the form:
- *
- *	({JSON_INTEGER}|{JSON_INTEGER}{JSON_FRACTION}|{JSON_INTEGER}{JSON_FRACTION}{JSON_EXPONENT}|{JSON_INTEGER}{JSON_EXPONENT})
- *
- * where {JSON_INTEGER} is of the form:
- *
- *      -?([1-9][0-9]*|0)
- *
- * and where {JSON_FRACTION} is of the form:
+ * json_conv_values - convert a JSON number string to C values
  *
- *      \.[0-9]+
- *
- * and where {JSON_EXPONENT} is of the form:
- *
- *      [Ee][-+]?[0-9]+
+ * The JSON number string (item->first, item->number_len) is converted
+ * according to the notation found by json_conv_number().
  *
  * given:
- *	ptr	pointer to buffer containing a JSON number
- *	len	length, starting at ptr, of the JSON number string
- *
- * returns:
- *	allocated JSON parser tree node of the parsed JSON number
+ *	item	pointer to a JSON number structure (struct json_number*)
  *
- * NOTE: This function will not return on calloc error.
- * NOTE: This function will not return NULL.
+ * NOTE: this function is used by json_conv_number() and json_number_convert().
  */
-struct json *
-json_conv_number(char const *ptr, size_t len)
+static void
+json_conv_values(struct json_number *item)
 {
-    struct json *ret = NULL;		    /* JSON parser tree node to return */
-    struct json_number *item = NULL;	    /* JSON number item inside JSON parser tree node */
-    bool decimal = false;		    /* true ==> ptr points to a base 10 integer in ASCII */
-    bool e_notation = false;		    /* true ==> ptr points to e notation in ASCII */
-    bool floating_notation = false;	    /* true ==> ptr points to floating point notation in ASCII */
     bool success = false;		    /* true ==> processing was successful */
 
     /*
-     * allocate an initialized JSON parse tree item
+     * case: JSON number is a floating point number
      */
-    ret = json_alloc(JTYPE_NUMBER);
-    if (ret == NULL) {
-	errp(12, __func__, "json_alloc(JTYPE_NUMBER) returned NULL");
-	not_reached();
-    }
+    if (item->is_floating) {
 
-    /*
-     * initialize the JSON item
-     */
-    item = &(ret->item.number);
+	/* process JSON number as floating point number */
+	success = json_process_floating(item, item->first, item->number_len);
+	if (success == false) {
+
+	    /*
+	     * this JSON number is not a true floating point value
+	     */
+	    json_dbg(JSON_DBG_HIGH, __func__, "JSON number as floating point number failed: <%s>",
+				   item->as_str);
+
+	} else {
+
+	    /*
+	     * this JSON number is a converted floating point value
+	     */
+	    item->converted = true;
+	    json_dbg(JSON_DBG_VHIGH, __func__, "converted JSON floating point number: <%s>",
+				     item->as_str);
+	}
+	item->parsed = true;	/* floating point number has been parsed, regardless of conversion status */
+    }
+
+    /*
+     * case: JSON number is an e-notation number
+     */
+    if (item->is_e_notation) {
+
+	/* process JSON number as floating point or e-notation number */
+	success = json_process_floating(item, item->first, item->number_len);
+	if (success == false) {
+
+	    /*
+	     * this JSON number is not a true e_notation value
+	     */
+	    json_dbg(JSON_DBG_HIGH, __func__, "JSON number as e-notation number failed: <%s>", item->as_str);
+
+	} else {
+
+	    /*
+	     * this JSON number is a converted e_notation value
+	     */
+	    item->converted = true;
+	    json_dbg(JSON_DBG_VHIGH, __func__, "converted JSON e-notation number: <%s>",
+				     item->as_str);
+	}
+	item->parsed = true;	/* e-notation number has been parsed, regardless of conversion status */
+    }
+
+    /*
+     * case: JSON number is a base 10 integer in ASCII
+     */
+    if (item->is_integer) {
+
+	/*
+	 * process JSON number as a base 10 integer in ASCII
+	 */
+	success = json_process_decimal(item, item->first, item->number_len);
+	if (success == false) {
+
+	    /*
+	     * this JSON number is not a true integer value
+	     */
+	    json_dbg(JSON_DBG_HIGH, __func__, "JSON number as base 10 integer in ASCII processing failed: <%s>", item->as_str);
+
+	} else {
+
+	    /*
+	     * this JSON number is a converted integer value
+	     */
+	    item->converted = true;
+	    json_dbg(JSON_DBG_VHIGH, __func__, "converted JSON integer: <%s>",
+				     item->as_str);
+	}
+	item->parsed = true;	/* 10 integer has been parsed, regardless of conversion status */
+    }
+    return;
+}
+
+
+/*
+ * json_conv_number - convert JSON number string to C numeric value
+ *
+ * A JSON number string is of the form:
+ *
+ *	({JSON_INTEGER}|{JSON_INTEGER}{JSON_FRACTION}|{JSON_INTEGER}{JSON_FRACTION}{JSON_EXPONENT}|{JSON_INTEGER}{JSON_EXPONENT})
+ *
+ * where {JSON_INTEGER} is of the form:
+ *
+ *      -?([1-9][0-9]*|0)
+ *
+ * and where {JSON_FRACTION} is of the form:
+ *
+ *      \.[0-9]+
+ *
+ * and where {JSON_EXPONENT} is of the form:
+ *
+ *      [Ee][-+]?[0-9]+
+ *
+ * given:
+ *	ptr	pointer to buffer containing a JSON number
+ *	len	length, starting at ptr, of the JSON number string
+ *
+ * returns:
+ *	allocated JSON parser tree node of the parsed JSON number
+ *
+ * NOTE: This function will not return on calloc error.
+ * NOTE: This function will not return NULL.
+ */
+struct json *
+json_conv_number(char const *ptr, size_t len)
+{
+    struct json *ret = NULL;		    /* JSON parser tree node to return */
+    struct json_number *item = NULL;	    /* JSON number item inside JSON parser tree node */
+    bool decimal = false;		    /* true ==> ptr points to a base 10 integer in ASCII */
+    bool e_notation = false;		    /* true ==> ptr points to e notation in ASCII */
+    bool floating_notation = false;	    /* true ==> ptr points to floating point notation in ASCII */
+
+    /*
+     * allocate an initialized JSON parse tree item
+     */
+    ret = json_alloc(JTYPE_NUMBER);
+    if (ret == NULL) {
+	errp(12, __func__, "json_alloc(JTYPE_NUMBER) returned NULL");
+	not_reached();
+    }
+
+    /*
+     * initialize the JSON item
+     */
+    item = &(ret->item.number);
     item->parsed = false;
     item->converted = false;
     item->as_str = NULL;
@@ -3253,6 +3466,7 @@ json_conv_number(char const *ptr, size_t len)
     item->longdouble_sized = false;
     item->as_longdouble = 0.0L;
     item->as_longdouble_int = false;
+    item->lazy = false;
 
     /*
      * firewall
@@ -3275,7 +3489,7 @@ json_conv_number(char const *ptr, size_t len)
      * duplicate the JSON integer string
      */
     errno = 0;			/* pre-clear errno for errp() */
-    item->as_str = calloc(len+1+1, sizeof(*(item->as_str)));
+    item->as_str = json_str_alloc(len);
     if (item->as_str == NULL) {
 	errp(13, __func__, "calloc #1 error allocating %zu bytes", (len+1+1));
 	not_reached();
@@ -3317,85 +3531,19 @@ json_conv_number(char const *ptr, size_t len)
     item->is_integer = decimal;
 
     /*
-     * case: JSON number is a floating point number
-     */
-    if (floating_notation) {
-
-	/* process JSON number as floating point number */
-	success = json_process_floating(item, item->first, item->number_len);
-	if (success == false) {
-
-	    /*
-	     * this JSON number is not a true floating point value
-	     */
-	    json_dbg(JSON_DBG_HIGH, __func__, "JSON number as floating point number failed: <%s>",
-				   item->as_str);
-
-	} else {
-
-	    /*
-	     * this JSON number is a converted floating point value
-	     */
-	    item->converted = true;
-	    json_dbg(JSON_DBG_VHIGH, __func__, "converted JSON floating point number of type %s: <%s>",
-				     json_item_type_name(ret), item->as_str);
-	}
-	item->parsed = true;	/* floating point number has been parsed, regardless of conversion status */
-    }
-
-    /*
-     * case: JSON number is an e-notation number
+     * case: lazy conversion - C values are converted by json_number_convert()
      */
-    if (e_notation) {
-
-	/* process JSON number as floating point or e-notation number */
-	success = json_process_floating(item, item->first, item->number_len);
-	if (success == false) {
-
-	    /*
-	     * this JSON number is not a true e_notation value
-	     */
-	    json_dbg(JSON_DBG_HIGH, __func__, "JSON number as e-notation number failed: <%s>", item->as_str);
-
-	} else {
-
-	    /*
-	     * this JSON number is a converted e_notation value
-	     */
-	    item->converted = true;
-	    json_dbg(JSON_DBG_VHIGH, __func__, "converted JSON e-notation number of type %s: <%s>",
-				     json_item_type_name(ret), item->as_str);
-	}
-	item->parsed = true;	/* e-notation number has been parsed, regardless of conversion status */
+    if (json_number_lazy) {
+	item->parsed = floating_notation || e_notation || decimal;
+	item->lazy = true;
+	json_dbg(JSON_DBG_VHIGH, __func__, "deferred conversion of JSON number: <%s>", item->as_str);
+	return ret;
     }
 
     /*
-     * case: JSON number is a base 10 integer in ASCII
+     * convert the JSON number to C values
      */
-    if (decimal) {
-
-	/*
-	 * process JSON number as a base 10 integer in ASCII
-	 */
-	success = json_process_decimal(item, item->first, item->number_len);
-	if (success == false) {
-
-	    /*
-	     * this JSON number is not a true integer value
-	     */
-	    json_dbg(JSON_DBG_HIGH, __func__, "JSON number as base 10 integer in ASCII processing failed: <%s>", item->as_str);
-
-	} else {
-
-	    /*
-	     * this JSON number is a converted integer value
-	     */
-	    item->converted = true;
-	    json_dbg(JSON_DBG_VHIGH, __func__, "converted JSON integer of type %s: <%s>",
-				     json_item_type_name(ret), item->as_str);
-	}
-	item->parsed = true;	/* 10 integer has been parsed, regardless of conversion status */
-    }
+    json_conv_values(item);
 
     /*
      * return the JSON parse tree item
@@ -3463,59 +3611,362 @@ json_conv_number_str(char const *str, size_t *retlen)
 
 
 /*
- * posix_safe_chk - test a string for various POSIX related tests
+ * json_number_convert - convert a JSON number to C values if not yet converted
+ *
+ * When json_number_lazy was true when the JSON number was parsed, the C values
+ * of the JSON number are converted on the first call, as json_conv_number()
+ * would have converted them, and cached in item.  Later calls, and calls for
+ * JSON numbers that were converted when parsed, do nothing.
  *
  * given:
- *	str		- string to test
- *	len		- length of str to test
- *	*slash		- set to true ==> a / was found
- *			  set to false ==> no / was found
- *	*posix_safe	- set to true ==> all chars are POSIX portable safe plus +/
- *			- set to false ==> one or more chars are not portable safe plus +/
- *	*first_alphanum	- set to true ==> first char is alphanumeric
- *			  set to false ==> first char is not alphanumeric
- *	*upper		- set to true ==> UPPER case chars found
- *			- set to false ==> no UPPER case chars found
+ *	item	pointer to a JSON number structure (struct json_number*)
  *
- * NOTE: This function does not return when given NULL ptr
+ * returns:
+ *	true ==> JSON number was converted to some form of C value,
+ *	false ==> JSON number could not be converted, or item is NULL
  */
-static void
-posix_safe_chk(char const *str, size_t len, bool *slash, bool *posix_safe, bool *first_alphanum, bool *upper)
+bool
+json_number_convert(struct json_number *item)
 {
-    bool found_unsafe = false;		/* true ==> found non-ASCII or non-POSIX portable safe plus +/ */
-    size_t i;
-
     /*
      * firewall
      */
-    if (str == NULL || slash == NULL || posix_safe == NULL || first_alphanum == NULL || upper == NULL) {
-	err(15, __func__, "called with NULL arg(s)");
-	not_reached();
+    if (item == NULL) {
+	warn(__func__, "called with NULL item");
+	return false;
     }
 
     /*
-     * assume all tests will fail
+     * convert the JSON number on first use
      */
-    *slash = false;
-    *posix_safe = false;
-    *first_alphanum = false;
-    *upper = false;
+    if (item->lazy) {
+	item->lazy = false;
+	if (item->first != NULL && item->number_len > 0) {
+	    json_conv_values(item);
+	}
+    }
+    return item->converted;
+}
+
 
+/*
+ * json_number_as_int - return the int value of a JSON number
+ *
+ * The JSON number is converted first if needed, see json_number_convert().
+ *
+ * given:
+ *	item	pointer to a JSON number structure (struct json_number*)
+ *	value	where to store the int value
+ *
+ * returns:
+ *	true ==> *value is the JSON number as an int,
+ *	false ==> JSON number is not convertible to int, or NULL arg
+ */
+bool
+json_number_as_int(struct json_number *item, int *value)
+{
     /*
-     * empty string fails all tests
+     * firewall
      */
-    if (len <= 0) {
-	dbg(DBG_VVHIGH, "posix_safe_chk(\"%s\", false, false, false, false) returning: str is an empty string", str);
-	return;
+    if (item == NULL || value == NULL) {
+	warn(__func__, "called with NULL arg(s)");
+	return false;
     }
 
+    (void) json_number_convert(item);
+    if (item->int_sized == false) {
+	return false;
+    }
+    *value = item->as_int;
+    return true;
+}
+
+
+/*
+ * json_number_as_int64 - return the int64_t value of a JSON number
+ *
+ * The JSON number is converted first if needed, see json_number_convert().
+ *
+ * given:
+ *	item	pointer to a JSON number structure (struct json_number*)
+ *	value	where to store the int64_t value
+ *
+ * returns:
+ *	true ==> *value is the JSON number as an int64_t,
+ *	false ==> JSON number is not convertible to int64_t, or NULL arg
+ */
+bool
+json_number_as_int64(struct json_number *item, int64_t *value)
+{
     /*
-     * test first character
+     * firewall
      */
-    if (isascii(str[0])) {
+    if (item == NULL || value == NULL) {
+	warn(__func__, "called with NULL arg(s)");
+	return false;
+    }
 
-	/*
-	 * case: first character is /
+    (void) json_number_convert(item);
+    if (item->int64_sized == false) {
+	return false;
+    }
+    *value = item->as_int64;
+    return true;
+}
+
+
+/*
+ * json_number_as_uint64 - return the uint64_t value of a JSON number
+ *
+ * The JSON number is converted first if needed, see json_number_convert().
+ *
+ * given:
+ *	item	pointer to a JSON number structure (struct json_number*)
+ *	value	where to store the uint64_t value
+ *
+ * returns:
+ *	true ==> *value is the JSON number as an uint64_t,
+ *	false ==> JSON number is not convertible to uint64_t, or NULL arg
+ */
+bool
+json_number_as_uint64(struct json_number *item, uint64_t *value)
+{
+    /*
+     * firewall
+     */
+    if (item == NULL || value == NULL) {
+	warn(__func__, "called with NULL arg(s)");
+	return false;
+    }
+
+    (void) json_number_convert(item);
+    if (item->uint64_sized == false) {
+	return false;
+    }
+    *value = item->as_uint64;
+    return true;
+}
+
+
+/*
+ * json_number_as_size - return the size_t value of a JSON number
+ *
+ * The JSON number is converted first if needed, see json_number_convert().
+ *
+ * given:
+ *	item	pointer to a JSON number structure (struct json_number*)
+ *	value	where to store the size_t value
+ *
+ * returns:
+ *	true ==> *value is the JSON number as a size_t,
+ *	false ==> JSON number is not convertible to size_t, or NULL arg
+ */
+bool
+json_number_as_size(struct json_number *item, size_t *value)
+{
+    /*
+     * firewall
+     */
+    if (item == NULL || value == NULL) {
+	warn(__func__, "called with NULL arg(s)");
+	return false;
+    }
+
+    (void) json_number_convert(item);
+    if (item->size_sized == false) {
+	return false;
+    }
+    *value = item->as_size;
+    return true;
+}
+
+
+/*
+ * json_number_as_maxint - return the intmax_t value of a JSON number
+ *
+ * The JSON number is converted first if needed, see json_number_convert().
+ *
+ * given:
+ *	item	pointer to a JSON number structure (struct json_number*)
+ *	value	where to store the intmax_t value
+ *
+ * returns:
+ *	true ==> *value is the JSON number as an intmax_t,
+ *	false ==> JSON number is not convertible to intmax_t, or NULL arg
+ */
+bool
+json_number_as_maxint(struct json_number *item, intmax_t *value)
+{
+    /*
+     * firewall
+     */
+    if (item == NULL || value == NULL) {
+	warn(__func__, "called with NULL arg(s)");
+	return false;
+    }
+
+    (void) json_number_convert(item);
+    if (item->maxint_sized == false) {
+	return false;
+    }
+    *value = item->as_maxint;
+    return true;
+}
+
+
+/*
+ * json_number_as_umaxint - return the uintmax_t value of a JSON number
+ *
+ * The JSON number is converted first if needed, see json_number_convert().
+ *
+ * given:
+ *	item	pointer to a JSON number structure (struct json_number*)
+ *	value	where to store the uintmax_t value
+ *
+ * returns:
+ *	true ==> *value is the JSON number as an uintmax_t,
+ *	false ==> JSON number is not convertible to uintmax_t, or NULL arg
+ */
+bool
+json_number_as_umaxint(struct json_number *item, uintmax_t *value)
+{
+    /*
+     * firewall
+     */
+    if (item == NULL || value == NULL) {
+	warn(__func__, "called with NULL arg(s)");
+	return false;
+    }
+
+    (void) json_number_convert(item);
+    if (item->umaxint_sized == false) {
+	return false;
+    }
+    *value = item->as_umaxint;
+    return true;
+}
+
+
+/*
+ * json_number_as_double - return the double value of a JSON number
+ *
+ * The JSON number is converted first if needed, see json_number_convert().
+ *
+ * given:
+ *	item	pointer to a JSON number structure (struct json_number*)
+ *	value	where to store the double value
+ *
+ * returns:
+ *	true ==> *value is the JSON number as a double,
+ *	false ==> JSON number is not convertible to double, or NULL arg
+ */
+bool
+json_number_as_double(struct json_number *item, double *value)
+{
+    /*
+     * firewall
+     */
+    if (item == NULL || value == NULL) {
+	warn(__func__, "called with NULL arg(s)");
+	return false;
+    }
+
+    (void) json_number_convert(item);
+    if (item->double_sized == false) {
+	return false;
+    }
+    *value = item->as_double;
+    return true;
+}
+
+
+/*
+ * json_number_as_longdouble - return the long double value of a JSON number
+ *
+ * The JSON number is converted first if needed, see json_number_convert().
+ *
+ * given:
+ *	item	pointer to a JSON number structure (struct json_number*)
+ *	value	where to store the long double value
+ *
+ * returns:
+ *	true ==> *value is the JSON number as a long double,
+ *	false ==> JSON number is not convertible to long double, or NULL arg
+ */
+bool
+json_number_as_longdouble(struct json_number *item, long double *value)
+{
+    /*
+     * firewall
+     */
+    if (item == NULL || value == NULL) {
+	warn(__func__, "called with NULL arg(s)");
+	return false;
+    }
+
+    (void) json_number_convert(item);
+    if (item->longdouble_sized == false) {
+	return false;
+    }
+    *value = item->as_longdouble;
+    return true;
+}
+
+
+/*
+ * posix_safe_chk - test a string for various POSIX related tests
+ *
+ * given:
+ *	str		- string to test
+ *	len		- length of str to test
+ *	*slash		- set to true ==> a / was found
+ *			  set to false ==> no / was found
+ *	*posix_safe	- set to true ==> all chars are POSIX portable safe plus +/
+ *			- set to false ==> one or more chars are not portable safe plus +/
+ *	*first_alphanum	- set to true ==> first char is alphanumeric
+ *			  set to false ==> first char is not alphanumeric
+ *	*upper		- set to true ==> UPPER case chars found
+ *			- set to false ==> no UPPER case chars found
+ *
+ * NOTE: This function does not return when given NULL ptr
+ */
+static void
+posix_safe_chk(char const *str, size_t len, bool *slash, bool *posix_safe, bool *first_alphanum, bool *upper)
+{
+    bool found_unsafe = false;		/* true ==> found non-ASCII or non-POSIX portable safe plus +/ */
+    size_t i;
+
+    /*
+     * firewall
+     */
+    if (str == NULL || slash == NULL || posix_safe == NULL || first_alphanum == NULL || upper == NULL) {
+	err(15, __func__, "called with NULL arg(s)");
+	not_reached();
+    }
+
+    /*
+     * assume all tests will fail
+     */
+    *slash = false;
+    *posix_safe = false;
+    *first_alphanum = false;
+    *upper = false;
+
+    /*
+     * empty string fails all tests
+     */
+    if (len <= 0) {
+	dbg(DBG_VVHIGH, "posix_safe_chk(\"%s\", false, false, false, false) returning: str is an empty string", str);
+	return;
+    }
+
+    /*
+     * test first character
+     */
+    if (isascii(str[0])) {
+
+	/*
+	 * case: first character is /
 	 */
 	if (str[0] == '/') {
 	    *slash = true;
@@ -3727,7 +4178,7 @@ json_conv_string(char const *ptr, size_t len, bool quote)
      * duplicate the JSON string
      */
     errno = 0;			/* pre-clear errno for errp() */
-    item->as_str = calloc(len+1+1, sizeof(*(item->as_str)));
+    item->as_str = json_str_alloc(len);
     if (item->as_str == NULL) {
 	errp(17, __func__, "calloc #1 error allocating %zu bytes", (len+1+1));
 	not_reached();
@@ -3739,8 +4190,17 @@ json_conv_string(char const *ptr, size_t len, bool quote)
     /*
      * decode the JSON encoded string
      */
-    /* decode the entire string */
-    item->str = json_decode(item->as_str, len, quote, &(item->str_len));
+    if (ret->arena != NULL) {
+	/* decode the entire string into the arena */
+	item->str = json_arena_take(ret->arena, len+1+1, 1);
+	if (!json_decode_buf(item->as_str, len, item->str, &(item->str_len))) {
+	    item->str = NULL;
+	    item->str_len = 0;
+	}
+    } else {
+	/* decode the entire string */
+	item->str = json_decode(item->as_str, len, quote, &(item->str_len));
+    }
     if (item->str == NULL) {
 	warn(__func__, "quote === %s: JSON string decode failed for: <%s>",
 		       booltostr(quote), item->as_str);
@@ -3759,6 +4219,19 @@ json_conv_string(char const *ptr, size_t len, bool quote)
 	item->same = true;	/* decoded string same an original JSON encoded string (perhaps sans '"'s) */
     }
 
+    /*
+     * in an arena, share as_str when decoding did not change the string,
+     * otherwise return the unused end of the decoding buffer
+     */
+    if (ret->arena != NULL) {
+	if (item->same) {
+	    json_arena_trim(ret->arena, item->str, 0);
+	    item->str = item->as_str;
+	} else {
+	    json_arena_trim(ret->arena, item->str, item->str_len+1+1);
+	}
+    }
+
     /*
      * determine POSIX state of the decoded string
      */
@@ -3894,7 +4367,7 @@ json_conv_bool(char const *ptr, size_t len)
      * duplicate the JSON encoded string
      */
     errno = 0;			/* pre-clear errno for errp() */
-    item->as_str = calloc(len+1+1, sizeof(*(item->as_str)));
+    item->as_str = json_str_alloc(len);
     if (item->as_str == NULL) {
 	errp(20, __func__, "calloc #1 error allocating %zu bytes", (len+1+1));
 	not_reached();
@@ -4049,7 +4522,7 @@ json_conv_null(char const *ptr, size_t len)
      * duplicate the JSON string
      */
     errno = 0;			/* pre-clear errno for errp() */
-    item->as_str = calloc(len+1+1, sizeof(*(item->as_str)));
+    item->as_str = json_str_alloc(len);
     if (item->as_str == NULL) {
 	errp(23, __func__, "calloc #1 error allocating %zu bytes", (len+1+1));
 	not_reached();
@@ -4168,6 +4641,7 @@ json_conv_null_str(char const *str, size_t *retlen)
  *
  * NOTE: This function will not return on calloc error.
  * NOTE: This function will not return NULL.
+ * NOTE: If name was not converted, the member links name and value but is not converted.
  */
 struct json *
 json_conv_member(struct json *name, struct json *value)
@@ -4244,13 +4718,20 @@ json_conv_member(struct json *name, struct json *value)
      */
     item->name = name;
     item->value = value;
+
+    /*
+     * a name that could not be decoded leaves the member unconverted
+     */
+    item2 = &(name->item.string);
+    if (!VALID_JSON_NODE(item2)) {
+	return ret;
+    }
     item->converted = true;
     item->parsed = true;
 
     /*
      * copy convenience values related to name
      */
-    item2 = &(name->item.string);
     item->name_as_str = item2->as_str;
     /* paranoia */
     if (item->name_as_str == NULL) {
@@ -4318,18 +4799,26 @@ json_create_object(void)
 
     /*
      * create a dynamic array to store JSON objects
+     *
+     * In a JSON parse tree arena, the object is a vector in the arena instead.
      */
-    item->s = dyn_array_create(sizeof (struct json *), JSON_CHUNK, JSON_CHUNK, true);
-    if (item->s == NULL) {
-	errp(29, __func__, "dyn_array_create() returned NULL");
-	not_reached();
-    }
+    if (ret->arena != NULL) {
+	item->set = json_arena_take(ret->arena, JSON_ARENA_SET_MIN * sizeof(*(item->set)),
+				    _Alignof(struct json *));
+	item->len = 0;
+    } else {
+	item->s = dyn_array_create(sizeof (struct json *), JSON_CHUNK, JSON_CHUNK, true);
+	if (item->s == NULL) {
+	    errp(29, __func__, "dyn_array_create() returned NULL");
+	    not_reached();
+	}
 
-    /*
-     * initialize accounting for the object
-     */
-    item->len = dyn_array_tell(item->s);
-    item->set = dyn_array_addr(item->s, struct json *, 0);
+	/*
+	 * initialize accounting for the object
+	 */
+	item->len = dyn_array_tell(item->s);
+	item->set = dyn_array_addr(item->s, struct json *, 0);
+    }
     item->converted = true;
     item->parsed = true;
 
@@ -4397,7 +4886,7 @@ json_object_add_member(struct json *node, struct json *member)
      * point to object
      */
     item = &(node->item.object);
-    if (item->s == NULL) {
+    if (item->s == NULL && node->arena == NULL) {
 	err(34, __func__, "item->s is NULL");
 	not_reached();
     }
@@ -4410,17 +4899,22 @@ json_object_add_member(struct json *node, struct json *member)
     /*
      * append member
      */
-    moved = dyn_array_append_value(item->s, &member);
-    if (moved == true) {
-	dbg(DBG_HIGH, "in %s(): dyn_array_append_value moved data",
-		      __func__);
-    }
+    if (node->arena != NULL) {
+	item->set = json_arena_set_append(node->arena, item->set, item->len, member);
+	++item->len;
+    } else {
+	moved = dyn_array_append_value(item->s, &member);
+	if (moved == true) {
+	    dbg(DBG_HIGH, "in %s(): dyn_array_append_value moved data",
+			  __func__);
+	}
 
-    /*
-     * update accounting for the object
-     */
-    item->len = dyn_array_tell(item->s);
-    item->set = dyn_array_addr(item->s, struct json *, 0);
+	/*
+	 * update accounting for the object
+	 */
+	item->len = dyn_array_tell(item->s);
+	item->set = dyn_array_addr(item->s, struct json *, 0);
+    }
 
     json_dbg(JSON_DBG_VHIGH, __func__, "JSON object node type: %s", json_item_type_name(node));
     json_dbg(JSON_DBG_VHIGH, __func__, "JSON object member type: %s", json_item_type_name(member));
@@ -4471,18 +4965,26 @@ json_create_elements(void)
 
     /*
      * create a dynamic array to store JSON values
+     *
+     * In a JSON parse tree arena, the array is a vector in the arena instead.
      */
-    item->s = dyn_array_create(sizeof (struct json *), JSON_CHUNK, JSON_CHUNK, true);
-    if (item->s == NULL) {
-	errp(36, __func__, "dyn_array_create() returned NULL");
-	not_reached();
-    }
+    if (ret->arena != NULL) {
+	item->set = json_arena_take(ret->arena, JSON_ARENA_SET_MIN * sizeof(*(item->set)),
+				    _Alignof(struct json *));
+	item->len = 0;
+    } else {
+	item->s = dyn_array_create(sizeof (struct json *), JSON_CHUNK, JSON_CHUNK, true);
+	if (item->s == NULL) {
+	    errp(36, __func__, "dyn_array_create() returned NULL");
+	    not_reached();
+	}
 
-    /*
-     * initialize accounting for the array
-     */
-    item->len = dyn_array_tell(item->s);
-    item->set = dyn_array_addr(item->s, struct json *, 0);
+	/*
+	 * initialize accounting for the array
+	 */
+	item->len = dyn_array_tell(item->s);
+	item->set = dyn_array_addr(item->s, struct json *, 0);
+    }
     item->converted = true;
     item->parsed = true;
 
@@ -4563,7 +5065,7 @@ json_elements_add_value(struct json *node, struct json *value)
      * point to array
      */
     item = &(node->item.elements);
-    if (item->s == NULL) {
+    if (item->s == NULL && node->arena == NULL) {
 	err(42, __func__, "item->s is NULL");
 	not_reached();
     }
@@ -4576,17 +5078,22 @@ json_elements_add_value(struct json *node, struct json *value)
     /*
      * append value
      */
-    moved = dyn_array_append_value(item->s, &value);
-    if (moved == true) {
-	dbg(DBG_HIGH, "in %s(): dyn_array_append_value moved data",
-		      __func__);
-    }
+    if (node->arena != NULL) {
+	item->set = json_arena_set_append(node->arena, item->set, item->len, value);
+	++item->len;
+    } else {
+	moved = dyn_array_append_value(item->s, &value);
+	if (moved == true) {
+	    dbg(DBG_HIGH, "in %s(): dyn_array_append_value moved data",
+			  __func__);
+	}
 
-    /*
-     * update accounting for the array
-     */
-    item->len = dyn_array_tell(item->s);
-    item->set = dyn_array_addr(item->s, struct json *, 0);
+	/*
+	 * update accounting for the array
+	 */
+	item->len = dyn_array_tell(item->s);
+	item->set = dyn_array_addr(item->s, struct json *, 0);
+    }
     return node;
 }
 
@@ -4636,18 +5143,26 @@ json_create_array(void)
 
     /*
      * create a dynamic array to store JSON arrays
+     *
+     * In a JSON parse tree arena, the array is a vector in the arena instead.
      */
-    item->s = dyn_array_create(sizeof (struct json *), JSON_CHUNK, JSON_CHUNK, true);
-    if (item->s == NULL) {
-	errp(44, __func__, "dyn_array_create() returned NULL");
-	not_reached();
-    }
+    if (ret->arena != NULL) {
+	item->set = json_arena_take(ret->arena, JSON_ARENA_SET_MIN * sizeof(*(item->set)),
+				    _Alignof(struct json *));
+	item->len = 0;
+    } else {
+	item->s = dyn_array_create(sizeof (struct json *), JSON_CHUNK, JSON_CHUNK, true);
+	if (item->s == NULL) {
+	    errp(44, __func__, "dyn_array_create() returned NULL");
+	    not_reached();
+	}
 
-    /*
-     * initialize accounting for the array
-     */
-    item->len = dyn_array_tell(item->s);
-    item->set = dyn_array_addr(item->s, struct json *, 0);
+	/*
+	 * initialize accounting for the array
+	 */
+	item->len = dyn_array_tell(item->s);
+	item->set = dyn_array_addr(item->s, struct json *, 0);
+    }
     item->converted = true;
     item->parsed = true;
 
@@ -4658,3 +5173,471 @@ json_create_array(void)
      */
     return ret;
 }
+
+
+/*
+ * json_item_size - size of the struct json union member of a JSON item type
+ *
+ * given:
+ *	type	a struct json type
+ *
+ * returns:
+ *	size of the union member of type, or of the whole union for JTYPE_UNSET
+ *	or an unknown type
+ */
+static size_t
+json_item_size(enum item_type type)
+{
+    switch (type) {
+    case JTYPE_NUMBER:
+	return sizeof(struct json_number);
+    case JTYPE_STRING:
+	return sizeof(struct json_string);
+    case JTYPE_BOOL:
+	return sizeof(struct json_boolean);
+    case JTYPE_NULL:
+	return sizeof(struct json_null);
+    case JTYPE_MEMBER:
+	return sizeof(struct json_member);
+    case JTYPE_OBJECT:
+	return sizeof(struct json_object);
+    case JTYPE_ARRAY:
+	return sizeof(struct json_array);
+    case JTYPE_ELEMENTS:
+	return sizeof(struct json_elements);
+    case JTYPE_UNSET:
+    default:
+	break;
+    }
+    return sizeof(union json_union);
+}
+
+
+/*
+ * json_arena_create - allocate an empty JSON parse tree arena
+ *
+ * returns:
+ *	pointer to an empty JSON parse tree arena
+ *
+ * NOTE: This function will not return on calloc error.
+ * NOTE: This function will not return NULL.
+ */
+struct json_arena *
+json_arena_create(void)
+{
+    struct json_arena *arena = NULL;	/* arena to return */
+
+    errno = 0;			/* pre-clear errno for errp() */
+    arena = calloc(1, sizeof(*arena));
+    if (arena == NULL) {
+	errp(45, __func__, "calloc error allocating %zu bytes", sizeof(*arena));
+	not_reached();
+    }
+    arena->block = NULL;
+    arena->root = NULL;
+    return arena;
+}
+
+
+/*
+ * json_arena_take - allocate zeroized storage from a JSON parse tree arena
+ *
+ * given:
+ *	arena	pointer to a JSON parse tree arena
+ *	size	number of bytes to allocate
+ *	align	alignment of the storage, a power of 2 <= _Alignof(max_align_t)
+ *
+ * returns:
+ *	pointer to size zeroized bytes in the arena
+ *
+ * NOTE: When the current block is full, a new block of at least twice the size
+ *	 of the previous block, up to JSON_ARENA_BLOCK_MAX, is calloc()ed.
+ *
+ * NOTE: This function will not return on calloc error.
+ * NOTE: This function will not return NULL.
+ */
+static void *
+json_arena_take(struct json_arena *arena, size_t size, size_t align)
+{
+    struct json_arena_block *block = NULL;  /* current or new arena block */
+    size_t off = 0;			    /* offset of storage in block data */
+    size_t bsize = 0;			    /* size of a new block */
+
+    /*
+     * firewall
+     */
+    if (arena == NULL) {
+	err(46, __func__, "arena is NULL");
+	not_reached();
+    }
+
+    /*
+     * try the current block
+     */
+    block = arena->block;
+    if (block != NULL) {
+	off = (block->used + align - 1) & ~(align - 1);
+	if (off <= block->size && size <= block->size - off) {
+	    block->used = off + size;
+	    arena->used += size;
+	    ++arena->allocs;
+	    return (char *)block->data + off;
+	}
+    }
+
+    /*
+     * start a new block
+     */
+    bsize = (block == NULL) ? JSON_ARENA_BLOCK : block->size * 2;
+    if (bsize > JSON_ARENA_BLOCK_MAX) {
+	bsize = JSON_ARENA_BLOCK_MAX;
+    }
+    if (bsize < size) {
+	bsize = size;
+    }
+    errno = 0;			/* pre-clear errno for errp() */
+    block = calloc(1, sizeof(*block) + bsize);
+    if (block == NULL) {
+	errp(47, __func__, "calloc error allocating %zu bytes", sizeof(*block) + bsize);
+	not_reached();
+    }
+    block->prev = arena->block;
+    block->size = bsize;
+    block->used = size;
+    arena->block = block;
+    ++arena->blocks;
+    arena->size += bsize;
+    arena->used += size;
+    ++arena->allocs;
+    return block->data;
+}
+
+
+/*
+ * json_arena_alloc - allocate zeroized storage from a JSON parse tree arena
+ *
+ * The storage is suitably aligned for any type, and is released by
+ * json_arena_free() with the rest of the arena.
+ *
+ * given:
+ *	arena	pointer to a JSON parse tree arena
+ *	size	number of bytes to allocate
+ *
+ * returns:
+ *	pointer to size zeroized bytes in the arena
+ *
+ * NOTE: This function will not return on calloc error.
+ * NOTE: This function will not return NULL.
+ */
+void *
+json_arena_alloc(struct json_arena *arena, size_t size)
+{
+    return json_arena_take(arena, size, _Alignof(max_align_t));
+}
+
+
+/*
+ * json_arena_trim - shrink the most recent allocation from a JSON parse tree arena
+ *
+ * given:
+ *	arena	pointer to a JSON parse tree arena
+ *	ptr	the most recent allocation from the arena
+ *	size	new size of ptr in bytes, no larger than its allocated size
+ *
+ * NOTE: The released bytes are zeroized so that later allocations from the
+ *	 arena remain zeroized.
+ */
+static void
+json_arena_trim(struct json_arena *arena, void *ptr, size_t size)
+{
+    struct json_arena_block *block = NULL;  /* current arena block */
+    size_t off = 0;			    /* offset of ptr in block data */
+
+    /*
+     * firewall
+     */
+    if (arena == NULL || arena->block == NULL || ptr == NULL) {
+	return;
+    }
+    block = arena->block;
+    if ((char *)ptr < (char *)block->data) {
+	return;
+    }
+    off = (size_t)((char *)ptr - (char *)block->data);
+    if (off > block->used || size > block->used - off) {
+	return;
+    }
+
+    /*
+     * release the end of the allocation
+     */
+    memset((char *)ptr + size, 0, block->used - off - size);
+    arena->used -= block->used - off - size;
+    block->used = off + size;
+    return;
+}
+
+
+/*
+ * json_arena_free - free a JSON parse tree arena
+ *
+ * All storage allocated from the arena, including the nodes of a JSON parse
+ * tree parsed into it, is released.
+ *
+ * given:
+ *	arena	pointer to a JSON parse tree arena, or NULL
+ *
+ * NOTE: This function does nothing if arena is NULL.
+ */
+void
+json_arena_free(struct json_arena *arena)
+{
+    struct json_arena_block *block = NULL;  /* arena block to free */
+    struct json_arena_block *prev = NULL;   /* block before block */
+
+    if (arena == NULL) {
+	return;
+    }
+    for (block = arena->block; block != NULL; block = prev) {
+	prev = block->prev;
+	free(block);
+    }
+    arena->block = NULL;
+    arena->root = NULL;
+    free(arena);
+    return;
+}
+
+
+/*
+ * json_arena_reset - release all storage allocated from a JSON parse tree arena
+ *
+ * Unlike json_arena_free(), the arena and its most recent (and largest) block
+ * are kept for reuse, so that an arena used for short lived nodes does not
+ * allocate once it has grown large enough.
+ *
+ * given:
+ *	arena	pointer to a JSON parse tree arena, or NULL
+ *
+ * NOTE: The block kept is zeroized so that later allocations from the arena
+ *	 remain zeroized.
+ */
+void
+json_arena_reset(struct json_arena *arena)
+{
+    struct json_arena_block *block = NULL;  /* arena block to free */
+    struct json_arena_block *prev = NULL;   /* block before block */
+
+    if (arena == NULL || arena->block == NULL) {
+	return;
+    }
+    for (block = arena->block->prev; block != NULL; block = prev) {
+	prev = block->prev;
+	free(block);
+    }
+    block = arena->block;
+    memset(block->data, 0, block->used);
+    block->prev = NULL;
+    block->used = 0;
+    arena->root = NULL;
+    arena->nodes = 0;
+    arena->allocs = 0;
+    arena->used = 0;
+    arena->blocks = 1;
+    arena->size = block->size;
+    return;
+}
+
+
+/*
+ * json_str_alloc - allocate zeroized storage for a JSON item string
+ *
+ * When a JSON parse tree arena is being parsed into, the storage comes from
+ * the arena, otherwise it is calloc()ed.
+ *
+ * given:
+ *	len	length of the string, not including the final NUL
+ *
+ * returns:
+ *	pointer to len+1+1 zeroized bytes, or NULL ==> calloc error
+ */
+static char *
+json_str_alloc(size_t len)
+{
+    if (json_arena_cur != NULL) {
+	return json_arena_take(json_arena_cur, len+1+1, 1);
+    }
+    return calloc(len+1+1, sizeof(char));
+}
+
+
+/*
+ * json_arena_set_append - append a JSON node to a child vector in a JSON parse tree arena
+ *
+ * A child vector has room for JSON_ARENA_SET_MIN pointers, or for the next
+ * power of 2 pointers above that.  When it is full, it is copied into a
+ * vector twice as large.
+ *
+ * given:
+ *	arena	pointer to the JSON parse tree arena of the vector
+ *	set	child vector
+ *	len	number of JSON nodes in set
+ *	node	JSON node to append
+ *
+ * returns:
+ *	child vector with node appended
+ *
+ * NOTE: This function will not return on calloc error.
+ */
+static struct json **
+json_arena_set_append(struct json_arena *arena, struct json **set, intmax_t len, struct json *node)
+{
+    struct json **grown = NULL;	    /* child vector twice as large as set */
+
+    if (len >= JSON_ARENA_SET_MIN && (len & (len-1)) == 0) {
+	grown = json_arena_take(arena, (size_t)len * 2 * sizeof(*grown), _Alignof(struct json *));
+	memcpy(grown, set, (size_t)len * sizeof(*grown));
+	set = grown;
+    }
+    set[len] = node;
+    return set;
+}
+
+
+/*
+ * json_arena_parse_begin - prepare to parse a JSON blob
+ *
+ * When json_tree_arena is true, a new JSON parse tree arena is created, and
+ * the nodes allocated until json_arena_parse_end() are allocated from it.
+ *
+ * NOTE: Every call must be followed by a call to json_arena_parse_end().
+ */
+void
+json_arena_parse_begin(void)
+{
+    /* paranoia - a previous parse did not call json_arena_parse_end() */
+    if (json_arena_cur != NULL) {
+	warn(__func__, "JSON parse tree arena was not ended");
+	json_arena_free(json_arena_cur);
+	json_arena_cur = NULL;
+    }
+    if (json_tree_arena) {
+	json_arena_cur = json_arena_create();
+    }
+    return;
+}
+
+
+/*
+ * json_arena_parse_swap - switch the JSON parse tree arena being parsed into
+ *
+ * A parser that is fed its input a piece at a time, such as jparse_feed(),
+ * owns the arena of its parse and switches to it only while it builds nodes,
+ * so that several such parses may be in progress at once.
+ *
+ * given:
+ *	arena	JSON parse tree arena to allocate nodes from, or NULL ==> use the heap
+ *
+ * returns:
+ *	the previous JSON parse tree arena, or NULL
+ */
+struct json_arena *
+json_arena_parse_swap(struct json_arena *arena)
+{
+    struct json_arena *prev = json_arena_cur;	/* previous arena */
+
+    json_arena_cur = arena;
+    return prev;
+}
+
+
+/*
+ * json_arena_parse_end - finish parsing a JSON blob
+ *
+ * If json_arena_parse_begin() created a JSON parse tree arena, the arena is
+ * handed to the JSON parse tree.  The root of the tree is moved into a calloc()ed
+ * struct json, so that, as for a tree not in an arena, the caller frees it after
+ * json_tree_free().  If the parse did not produce a tree, the arena is freed.
+ *
+ * given:
+ *	tree	JSON parse tree returned by the parser, or NULL
+ *
+ * returns:
+ *	the JSON parse tree, or NULL if tree is NULL
+ *
+ * NOTE: This function will not return on calloc error.
+ */
+struct json *
+json_arena_parse_end(struct json *tree)
+{
+    struct json_arena *arena = json_arena_cur;	/* arena of the parse */
+    struct json *root = NULL;			/* calloc()ed root of the JSON parse tree */
+    intmax_t len = 0;				/* number of children of the root */
+    struct json **set = NULL;			/* children of the root */
+    intmax_t i;
+
+    /*
+     * case: not parsing into an arena
+     */
+    json_arena_cur = NULL;
+    if (arena == NULL) {
+	return tree;
+    }
+
+    /*
+     * case: no JSON parse tree in the arena
+     */
+    if (tree == NULL || tree->arena != arena) {
+	json_arena_free(arena);
+	return tree;
+    }
+
+    /*
+     * move the root out of the arena
+     */
+    errno = 0;			/* pre-clear errno for errp() */
+    root = calloc(1, sizeof(*root));
+    if (root == NULL) {
+	errp(48, __func__, "calloc error allocating %zu bytes", sizeof(*root));
+	not_reached();
+    }
+    memcpy(root, tree, offsetof(struct json, item) + json_item_size(tree->type));
+    arena->root = root;
+
+    /*
+     * link the children to the moved root
+     */
+    switch (root->type) {
+    case JTYPE_MEMBER:
+	if (root->item.member.name != NULL) {
+	    root->item.member.name->parent = root;
+	}
+	if (root->item.member.value != NULL) {
+	    root->item.member.value->parent = root;
+	}
+	break;
+    case JTYPE_OBJECT:
+	len = root->item.object.len;
+	set = root->item.object.set;
+	break;
+    case JTYPE_ARRAY:
+	len = root->item.array.len;
+	set = root->item.array.set;
+	break;
+    case JTYPE_ELEMENTS:
+	len = root->item.elements.len;
+	set = root->item.elements.set;
+	break;
+    default:
+	break;
+    }
+    for (i=0; i < len && set != NULL; ++i) {
+	if (set[i] != NULL) {
+	    set[i]->parent = root;
+	}
+    }
+
+    json_dbg(JSON_DBG_MED, __func__, "JSON parse tree arena: %zu nodes, %zu allocations, %zu bytes used of %zu in %zu blocks",
+			   arena->nodes, arena->allocs, arena->used, arena->size, arena->blocks);
+    return root;
+}
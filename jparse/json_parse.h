@@ -42,6 +42,11 @@
 #    define  INCLUDE_JSON_PARSE_H
 
 
+/*
+ * for max_align_t
+ */
+#include <stddef.h>
+
 /*
  * util - common utility functions for the JSON parser
  */
@@ -153,6 +158,14 @@ struct byte2asciistr
  *
  *	[Ee][-+]?[0-9]+
  *
+ * When json_number_lazy is true, json_conv_number() only records the JSON
+ * number string (as_str, first, as_str_len, number_len) and its notation
+ * (parsed, is_floating, is_e_notation, is_integer), and sets lazy == true.
+ * The C values, is_negative and converted are left unset until the first
+ * call to json_number_convert(), or to one of the json_number_as_*()
+ * accessors, which converts the number as json_conv_number() would have,
+ * caches the result in this structure and sets lazy = false.
+ *
  * For more information see jparse.y and jparse.l.
  */
 struct json_number
@@ -244,6 +257,8 @@ struct json_number
     bool longdouble_sized;	/* true ==> converted JSON float to C long double */
     long double as_longdouble;	/* JSON floating point value in long double form, if longdouble_sized  == true */
     bool as_longdouble_int;	/* if longdouble_sized == true, true ==> as_longdouble is an integer */
+
+    bool lazy;			/* true ==> C values not yet converted, see json_number_convert() */
 };
 
 
@@ -478,14 +493,77 @@ enum item_type {
     JTYPE_ELEMENTS,	    /* JSON item for building a JSON array */
 };
 
+/*
+ * json_push_expect - what the push mode and event driven parsers expect next
+ *
+ * Unlike the bison parser, these parsers are hand-written state machines: see
+ * json_push.c and json_sax.c.
+ */
+enum json_push_expect {
+    JSON_PUSH_VALUE = 0,	/* a JSON value */
+    JSON_PUSH_VALUE_OR_CLOSE,	/* a JSON value or ], just after [ */
+    JSON_PUSH_NAME_OR_CLOSE,	/* a member name or }, just after { */
+    JSON_PUSH_NAME,		/* a member name, after , in an object */
+    JSON_PUSH_COLON,		/* : after a member name */
+    JSON_PUSH_COMMA_OR_CLOSE,	/* , or the close of the current object or array */
+    JSON_PUSH_END,		/* nothing more than whitespace */
+};
+
+/*
+ * JSON parse tree arena
+ *
+ * When json_tree_arena is true, the nodes of a JSON parse tree, their strings
+ * and the child vectors of JSON objects and arrays are allocated from a single
+ * arena owned by the tree, and json_tree_free() releases the arena as a whole.
+ *
+ * An arena is a list of calloc()ed blocks.  Allocations are taken from the
+ * current block in order, and are never freed individually.  Because blocks
+ * are calloc()ed, and json_arena_reset() zeroizes the block it keeps for reuse,
+ * all allocations start out zeroized.
+ */
+#define JSON_ARENA_BLOCK (64*1024)		/* size of the first arena block */
+#define JSON_ARENA_BLOCK_MAX (8*1024*1024)	/* maximum size of a new arena block */
+#define JSON_ARENA_SET_MIN (4)			/* minimum number of pointers in an arena child vector */
+
+struct json_arena_block
+{
+    struct json_arena_block *prev;	/* previous arena block or NULL */
+    size_t size;			/* size of data in bytes */
+    size_t used;			/* bytes of data allocated */
+    max_align_t data[];			/* arena storage */
+};
+
+struct json_arena
+{
+    struct json_arena_block *block;	/* current arena block, or NULL */
+    struct json *root;			/* root of the JSON parse tree that owns the arena, or NULL */
+
+    size_t nodes;			/* number of struct json nodes allocated */
+    size_t allocs;			/* number of allocations */
+    size_t used;			/* bytes allocated, including alignment */
+    size_t blocks;			/* number of arena blocks */
+    size_t size;			/* bytes in arena blocks */
+};
+
 /*
  * struct json - item for the JSON parse tree
  *
  * For the parse tree we have this struct and its associated union.
+ *
+ * IMPORTANT: item must be the last member of struct json, because a node in
+ *	      a JSON parse tree arena is only allocated as large as the union
+ *	      member of its type.  See json_alloc().
  */
 struct json
 {
     enum item_type type;		/* union item specifier */
+
+    /*
+     * JSON parse tree links
+     */
+    struct json *parent;	/* parent node in the JSON parse tree, or NULL if tree root or unlinked */
+    struct json_arena *arena;	/* JSON parse tree arena holding this node storage, or NULL ==> malloced */
+
     union json_union {
 	struct json_number number;	/* JTYPE_NUMBER - value is number (integer or floating point) */
 	struct json_string string;	/* JTYPE_STRING - value is a string */
@@ -496,11 +574,6 @@ struct json
 	struct json_array array;	/* JTYPE_ARRAY - value is a JSON [ elements ] */
 	struct json_elements elements;	/* JTYPE_ELEMENTS - zero or more JSON values */
     } item;
-
-    /*
-     * JSON parse tree links
-     */
-    struct json *parent;	/* parent node in the JSON parse tree, or NULL if tree root or unlinked */
 };
 
 
@@ -523,6 +596,29 @@ struct json
  */
 extern struct byte2asciistr byte2asciistr[];
 
+/*
+ * json_number_lazy - true ==> json_conv_number() defers conversion to C values
+ *
+ * See json_number_convert() and the json_number_as_*() accessors.
+ */
+extern bool json_number_lazy;
+
+/*
+ * json_tree_arena - true ==> parse JSON into a JSON parse tree arena
+ *
+ * See json_arena_parse_begin() and json_tree_free().
+ */
+extern bool json_tree_arena;
+
+/*
+ * json_string_err_invalid - true ==> a JSON string that cannot be decoded makes the JSON invalid
+ * json_string_err_found - true ==> json_parse_string() found a JSON string that cannot be decoded
+ *
+ * See json_parse_string().
+ */
+extern _Thread_local bool json_string_err_invalid;
+extern _Thread_local bool json_string_err_found;
+
 
 /*
  * external function declarations
@@ -542,6 +638,15 @@ extern struct json *json_parse_member(struct json *name, struct json *value);
 extern struct json *json_alloc(enum item_type type);
 extern struct json *json_conv_number(char const *ptr, size_t len);
 extern struct json *json_conv_number_str(char const *str, size_t *retlen);
+extern bool json_number_convert(struct json_number *item);
+extern bool json_number_as_int(struct json_number *item, int *value);
+extern bool json_number_as_int64(struct json_number *item, int64_t *value);
+extern bool json_number_as_uint64(struct json_number *item, uint64_t *value);
+extern bool json_number_as_size(struct json_number *item, size_t *value);
+extern bool json_number_as_maxint(struct json_number *item, intmax_t *value);
+extern bool json_number_as_umaxint(struct json_number *item, uintmax_t *value);
+extern bool json_number_as_double(struct json_number *item, double *value);
+extern bool json_number_as_longdouble(struct json_number *item, long double *value);
 extern struct json *json_conv_string(char const *ptr, size_t len, bool quote);
 extern struct json *json_conv_string_str(char const *str, size_t *retlen, bool quote);
 extern struct json *json_conv_bool(char const *ptr, size_t len);
@@ -554,6 +659,13 @@ extern struct json *json_object_add_member(struct json *node, struct json *membe
 extern struct json *json_create_elements(void);
 extern struct json *json_elements_add_value(struct json *node, struct json *value);
 extern struct json *json_create_array(void);
+extern struct json_arena *json_arena_create(void);
+extern void *json_arena_alloc(struct json_arena *arena, size_t size);
+extern void json_arena_free(struct json_arena *arena);
+extern void json_arena_reset(struct json_arena *arena);
+extern void json_arena_parse_begin(void);
+extern struct json *json_arena_parse_end(struct json *tree);
+extern struct json_arena *json_arena_parse_swap(struct json_arena *arena);
 
 
 #endif /* INCLUDE_JSON_PARSE_H */
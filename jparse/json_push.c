@@ -0,0 +1,1358 @@
+/*
+ * json_push - incremental push mode JSON parser
+ *
+ * "Because sometimes the JSON is still on its way." :-)
+ *
+ * Copyright (c) 2022-2025 by Cody Boone Ferguson and Landon Curt Noll. All
+ * rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software and
+ * its documentation for any purpose and without fee is hereby granted,
+ * provided that the above copyright, this permission notice and text
+ * this comment, and the disclaimer below appear in all of the following:
+ *
+ *       supporting documentation
+ *       source copies
+ *       source works derived from this source
+ *       binaries derived from this source or from derived source
+ *
+ * THE AUTHORS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE, INCLUDING
+ * ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHORS BE LIABLE FOR ANY SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES OR ANY
+ * DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE OR JSON.
+ *
+ * This JSON parser, library and tools were co-developed in 2022-2025 by Cody Boone
+ * Ferguson and Landon Curt Noll:
+ *
+ *  @xexyl
+ *	https://xexyl.net		Cody Boone Ferguson
+ *	https://ioccc.xexyl.net
+ * and:
+ *	chongo (Landon Curt Noll, http://www.isthe.com/chongo/index.html) /\oo/\
+ *
+ * "Because sometimes even the IOCCC Judges need some help." :-)
+ *
+ * "Share and Enjoy!"
+ *     --  Sirius Cybernetics Corporation Complaints Division, JSON spec department. :-)
+ */
+
+
+
+/* special comments for the seqcexit tool */
+/* exit code out of numerical order - ignore in sequencing - ooo */
+/* exit code change of order - use new value in sequencing - coo */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+
+/*
+ * json_push - incremental push mode JSON parser
+ */
+#include "json_push.h"
+
+
+
+/*
+ * static functions
+ */
+static void json_push_error(struct jparse_push *ctx, char const *msg, char const *text, size_t len);
+static void json_push_report(struct jparse_push *ctx);
+static void json_push_low_bytes(struct jparse_push *ctx, char const *buf, size_t len);
+static size_t json_push_number_len(char const *str, size_t len);
+static void json_push_discard(struct json *node);
+static void json_push_loc(struct jparse_push *ctx, char const *text, size_t len, bool start);
+static bool json_push_shift(struct jparse_push *ctx, char const *text, size_t len);
+static void json_push_token(struct jparse_push *ctx, enum json_push_kind kind, char const *text, size_t len);
+static void json_push_value(struct jparse_push *ctx, struct json *value);
+static void json_push_open(struct jparse_push *ctx, bool object, char const *text);
+static void json_push_close(struct jparse_push *ctx, bool object, char const *text);
+static void json_push_match(struct jparse_push *ctx);
+static void json_push_scan(struct jparse_push *ctx, char const *buf, size_t len);
+
+
+/*
+ * json_push_error - note a JSON syntax error found by the push mode parser
+ *
+ * The error is at the location of the last token.  Only the first error is
+ * kept, and the parse is marked invalid so that further input is ignored.
+ * jparse_finish() reports the error unless low bytes were found, as the
+ * scanner reports low bytes instead of parsing.
+ *
+ * given:
+ *	ctx	push mode parser state
+ *	msg	error message
+ *	text	text of the token in error, or NULL at the end of the input
+ *	len	length of text
+ *
+ * NOTE: This function does not return on NULL ctx or msg, or on malloc error.
+ */
+static void
+json_push_error(struct jparse_push *ctx, char const *msg, char const *text, size_t len)
+{
+    /*
+     * firewall
+     */
+    if (ctx == NULL || msg == NULL) {
+	err(1, __func__, "ctx or msg is NULL");
+	not_reached();
+    }
+
+    /*
+     * keep only the first error
+     */
+    if (ctx->valid == false) {
+	return;
+    }
+    ctx->valid = false;
+    ctx->err_msg = msg;
+    ctx->err_line = ctx->first_line;
+    ctx->err_column = ctx->first_column;
+    ctx->err_type = (ctx->tree != NULL) ? json_item_type_name(ctx->tree) : NULL;
+    if (text != NULL) {
+	errno = 0;		/* pre-clear errno for errp() */
+	ctx->err_text = malloc(len+1);
+	if (ctx->err_text == NULL) {
+	    errp(2, __func__, "malloc of %zu bytes failed", len+1);
+	    not_reached();
+	}
+	memcpy(ctx->err_text, text, len);
+	ctx->err_text[len] = '\0';
+    }
+    return;
+}
+
+
+/*
+ * json_push_report - report the first JSON syntax error as yyerror() does
+ *
+ * given:
+ *	ctx	push mode parser state
+ *
+ * NOTE: This function does not return on NULL ctx.
+ */
+static void
+json_push_report(struct jparse_push *ctx)
+{
+    FILE *stream;		/* where to report the error */
+
+    /*
+     * firewall
+     */
+    if (ctx == NULL) {
+	err(3, __func__, "ctx is NULL");
+	not_reached();
+    }
+    if (ctx->err_msg == NULL) {
+	return;
+    }
+
+    /*
+     * generate an error message as yyerror() does, on the same stream
+     */
+    stream = (jparse_err_stream != NULL) ? jparse_err_stream : stderr;
+    fprint(stream, "%s", ctx->err_msg);
+    if (ctx->err_type != NULL) {
+	fprint(stream, " node type %s", ctx->err_type);
+    }
+    if (ctx->filename != NULL && *ctx->filename != '\0') {
+	fprint(stream, " in file %s", ctx->filename);
+    }
+    fprint(stream, " at line %d column %d: ", ctx->err_line, ctx->err_column);
+    if (ctx->err_text != NULL && *ctx->err_text != '\0') {
+	fprint(stream, "%s\n", ctx->err_text);
+    } else {
+	fprstr(stream, "empty text\n");
+    }
+
+    /*
+     * flush the error stream
+     */
+    clearerr(stream);		/* pre-clear ferror() status */
+    errno = 0;			/* pre-clear errno for warnp() */
+    if (fflush(stream) != 0) {
+	warnp(__func__, "fflush: error code: %d", ferror(stream));
+    }
+    return;
+}
+
+
+/*
+ * json_push_low_bytes - detect low byte values as low_byte_scan() does
+ *
+ * The scanner does not parse a JSON document with bytes in the class
+ * [\x00-\x08\x0e-\x1f].  Each such byte is reported as it is found, up to
+ * MAX_NUL_BYTES_REPORTED NUL bytes and MAX_LOW_BYTES_REPORTED other low bytes,
+ * and jparse_finish() reports the totals.
+ *
+ * given:
+ *	ctx	push mode parser state
+ *	buf	next bytes of the JSON document
+ *	len	number of bytes in buf
+ */
+static void
+json_push_low_bytes(struct jparse_push *ctx, char const *buf, size_t len)
+{
+    size_t i;
+
+    for (i=0; i < len; ++i) {
+
+	/* count this byte within the line */
+	++ctx->low_pos;
+
+	if (buf[i] == '\n') {
+	    ++ctx->low_line;
+	    ctx->low_pos = 0;
+	} else if (buf[i] == '\0') {
+	    ++ctx->nul_bytes;
+	    if (ctx->nul_bytes <= MAX_NUL_BYTES_REPORTED) {
+		werr(4, __func__, "invalid NUL (0) byte detected in line: %zu byte position: %zu",
+			 ctx->low_line, ctx->low_pos);
+	    } else if (ctx->nul_bytes == MAX_NUL_BYTES_REPORTED+1) {
+		werr(5, __func__, "too many NUL ('\\0') bytes detected: "
+			 "additional NUL byte reports disabled");
+	    }
+	} else if ((buf[i] >= '\x01' && buf[i] <= '\x08') || (buf[i] >= '\x0e' && buf[i] <= '\x1f')) {
+	    ++ctx->low_bytes;
+	    if (ctx->low_bytes <= MAX_LOW_BYTES_REPORTED) {
+		werr(6, __func__, "invalid LOW byte 0x%02x detected in line: %zu byte position: %zu",
+			 buf[i], ctx->low_line, ctx->low_pos);
+	    } else if (ctx->low_bytes == MAX_LOW_BYTES_REPORTED+1) {
+		werr(7, __func__, "too many LOW bytes ([\\x01-\\x08\\x0e-\\x1f] detected: "
+			 "additional low byte reports disabled");
+	    }
+	}
+    }
+    return;
+}
+
+
+/*
+ * json_push_number_len - length of the JSON number at the start of a run
+ *
+ * The scanner collects a run of [-+.0-9eE] bytes.  As the flex scanner matches
+ * the longest text it can, the JSON number is the longest start of the run
+ * that matches:
+ *
+ *	-?([1-9][0-9]*|0)(\.[0-9]+)?([eE][-+]?[0-9]+)?
+ *
+ * which is the JSON_NUMBER pattern of jparse.l.  The rest of the run is
+ * scanned again.
+ *
+ * given:
+ *	str	run of number bytes
+ *	len	length of str
+ *
+ * returns:
+ *	length of the JSON number at the start of str, 0 ==> str does not start
+ *	with a JSON number
+ */
+static size_t
+json_push_number_len(char const *str, size_t len)
+{
+    size_t i = 0;		/* byte index */
+    size_t digits;		/* index of the first byte of a run of digits */
+
+    if (str == NULL) {
+	return 0;
+    }
+
+    /* -? */
+    if (i < len && str[i] == '-') {
+	++i;
+    }
+
+    /* ([1-9][0-9]*|0) */
+    if (i >= len) {
+	return 0;
+    }
+    if (str[i] == '0') {
+	++i;
+    } else if (str[i] >= '1' && str[i] <= '9') {
+	do {
+	    ++i;
+	} while (i < len && str[i] >= '0' && str[i] <= '9');
+    } else {
+	return 0;
+    }
+
+    /* (\.[0-9]+)? */
+    if (i+1 < len && str[i] == '.' && str[i+1] >= '0' && str[i+1] <= '9') {
+	i += 2;
+	while (i < len && str[i] >= '0' && str[i] <= '9') {
+	    ++i;
+	}
+    }
+
+    /* ([eE][-+]?[0-9]+)? */
+    if (i < len && (str[i] == 'e' || str[i] == 'E')) {
+	digits = i+1;
+	if (digits < len && (str[digits] == '-' || str[digits] == '+')) {
+	    ++digits;
+	}
+	if (digits < len && str[digits] >= '0' && str[digits] <= '9') {
+	    i = digits+1;
+	    while (i < len && str[i] >= '0' && str[i] <= '9') {
+		++i;
+	    }
+	}
+    }
+    return i;
+}
+
+
+/*
+ * json_push_discard - free a partial JSON parse tree of an invalid parse
+ *
+ * Nodes allocated from a JSON parse tree arena are released with the arena,
+ * so only nodes allocated on the heap are freed.
+ *
+ * given:
+ *	node	partial JSON parse tree, or NULL
+ */
+static void
+json_push_discard(struct json *node)
+{
+    if (node != NULL && node->arena == NULL) {
+	json_tree_free(node, JSON_INFINITE_DEPTH);
+	free(node);
+    }
+    return;
+}
+
+
+/*
+ * json_push_loc - move the location over a token as YY_USER_ACTION does
+ *
+ * The flex scanner of jparse.l sets the location of each token, including runs
+ * of whitespace and newlines, with the YY_USER_ACTION macro.  A tab moves only
+ * the last column, and the first column ends up at the last byte of the token.
+ * The location of an error is the first line and column of the token in error,
+ * or of the last token at the end of the input.
+ *
+ * given:
+ *	ctx	push mode parser state
+ *	text	bytes of the token
+ *	len	number of bytes in text
+ *	start	true ==> text starts the token, false ==> text continues a run
+ */
+static void
+json_push_loc(struct jparse_push *ctx, char const *text, size_t len, bool start)
+{
+    size_t i;
+
+    if (start == true) {
+	ctx->first_line = ctx->last_line + 1;
+	ctx->first_column = ctx->last_column;
+    }
+    for (i=0; i < len; ++i) {
+	if (text[i] == '\n') {
+	    ctx->last_line++;
+	    ctx->last_column = 0;
+	} else if (text[i] == '\t') {
+	    ctx->last_column += 8;
+	} else if (ctx->first_column == 0 || ctx->last_column == 0) {
+	    if (ctx->first_column == 0) {
+		ctx->first_column = 1;
+	    }
+	    if (ctx->last_column == 0) {
+		ctx->last_column = 1;
+	    }
+	} else {
+	    ctx->last_column++;
+	    ctx->first_column++;
+	}
+    }
+    return;
+}
+
+
+/*
+ * json_push_shift - push a token on the bison parser stack
+ *
+ * The bison parser runs out of stack when it shifts a token onto a stack of
+ * JSON_PUSH_MAX_DEPTH-1 states.  The depth is that of the bison stack: one
+ * state to start, and for each object or array being parsed, one for the { or [
+ * and one for each of the members or values, the , the name and the : that
+ * are not yet reduced.
+ *
+ * given:
+ *	ctx	push mode parser state
+ *	text	text of the token
+ *	len	length of text
+ *
+ * returns:
+ *	true ==> token shifted, false ==> memory exhausted
+ */
+static bool
+json_push_shift(struct jparse_push *ctx, char const *text, size_t len)
+{
+    if (ctx->depth+1 >= JSON_PUSH_MAX_DEPTH) {
+	json_push_error(ctx, "memory exhausted", text, len);
+	return false;
+    }
+    ++ctx->depth;
+    return true;
+}
+
+
+/*
+ * json_push_token - give a token to the parser
+ *
+ * A JSON string, number, true, false or null is converted into a JSON parse
+ * tree node by the same functions the bison grammar uses.  A token that the
+ * grammar does not accept, such as one matched by the flex "." rule, is a
+ * syntax error.
+ *
+ * given:
+ *	ctx	push mode parser state
+ *	kind	kind of token
+ *	text	text of the token, NUL terminated for a number, true, false or null
+ *	len	length of text
+ *
+ * NOTE: This function does not return on NULL ctx or text.
+ */
+static void
+json_push_token(struct jparse_push *ctx, enum json_push_kind kind, char const *text, size_t len)
+{
+    struct json_push_frame *frame = NULL;	/* object or array being parsed */
+    struct json *node = NULL;			/* JSON parse tree node of the token */
+
+    /*
+     * firewall
+     */
+    if (ctx == NULL || text == NULL) {
+	err(8, __func__, "ctx or text is NULL");
+	not_reached();
+    }
+    json_push_loc(ctx, text, len, true);
+
+    /*
+     * case: token that is not a value
+     */
+    switch (kind) {
+    case JSON_PUSH_KIND_OPEN_BRACE:
+    case JSON_PUSH_KIND_OPEN_BRACKET:
+	json_push_open(ctx, kind == JSON_PUSH_KIND_OPEN_BRACE, text);
+	return;
+    case JSON_PUSH_KIND_CLOSE_BRACE:
+    case JSON_PUSH_KIND_CLOSE_BRACKET:
+	json_push_close(ctx, kind == JSON_PUSH_KIND_CLOSE_BRACE, text);
+	return;
+    case JSON_PUSH_KIND_COLON:
+	if (ctx->expect != JSON_PUSH_COLON) {
+	    json_push_error(ctx, "syntax error", text, len);
+	} else if (json_push_shift(ctx, text, len) == true) {
+	    ctx->expect = JSON_PUSH_VALUE;
+	}
+	return;
+    case JSON_PUSH_KIND_COMMA:
+	if (ctx->expect != JSON_PUSH_COMMA_OR_CLOSE) {
+	    json_push_error(ctx, "syntax error", text, len);
+	} else if (json_push_shift(ctx, text, len) == true) {
+	    /* top of stack is an object or array as the parser expects a , */
+	    frame = dyn_array_addr(ctx->stack, struct json_push_frame, dyn_array_tell(ctx->stack)-1);
+	    ctx->expect = frame->object ? JSON_PUSH_NAME : JSON_PUSH_VALUE;
+	}
+	return;
+    case JSON_PUSH_KIND_INVALID:
+	json_push_error(ctx, "syntax error", text, len);
+	return;
+    default:
+	break;
+    }
+
+    /*
+     * check that the value is expected
+     */
+    switch (ctx->expect) {
+    case JSON_PUSH_VALUE:
+    case JSON_PUSH_VALUE_OR_CLOSE:
+	break;
+    case JSON_PUSH_NAME:
+    case JSON_PUSH_NAME_OR_CLOSE:
+	if (kind == JSON_PUSH_KIND_STRING) {
+	    break;
+	}
+	/*FALLTHRU*/
+    default:
+	json_push_error(ctx, "syntax error", text, len);
+	return;
+    }
+    if (json_push_shift(ctx, text, len) == false) {
+	return;
+    }
+
+    /*
+     * convert the value
+     */
+    switch (kind) {
+    case JSON_PUSH_KIND_STRING:
+	json_string_err_found = false;
+	node = json_parse_string(text, len);
+	if (json_string_err_found == true) {
+	    /* json_parse_string() reported the string that could not be decoded */
+	    ctx->string_err = true;
+	}
+	if (ctx->expect == JSON_PUSH_NAME || ctx->expect == JSON_PUSH_NAME_OR_CLOSE) {
+	    /* top of stack is an object as the parser expects a name */
+	    frame = dyn_array_addr(ctx->stack, struct json_push_frame, dyn_array_tell(ctx->stack)-1);
+	    frame->name = node;
+	    ctx->expect = JSON_PUSH_COLON;
+	    return;
+	}
+	break;
+    case JSON_PUSH_KIND_NUMBER:
+	node = json_parse_number(text);
+	break;
+    case JSON_PUSH_KIND_TRUE:
+    case JSON_PUSH_KIND_FALSE:
+	node = json_parse_bool(text);
+	break;
+    case JSON_PUSH_KIND_NULL:
+	node = json_parse_null(text);
+	break;
+    default:
+	err(9, __func__, "invalid token kind: %d", (int)kind);
+	not_reached();
+	break;
+    }
+    json_push_value(ctx, node);
+    return;
+}
+
+
+/*
+ * json_push_value - give a complete JSON value to the parser
+ *
+ * The value becomes the JSON parse tree, an element of the array, or the value
+ * of the member being parsed, depending on the top of the parser stack.  As the
+ * bison grammar does, a JSON object or JTYPE_ELEMENTS node is created when its
+ * first member or value is complete.
+ *
+ * given:
+ *	ctx	push mode parser state
+ *	value	JSON parse tree node of the value
+ *
+ * NOTE: This function does not return on NULL ctx or value.
+ */
+static void
+json_push_value(struct jparse_push *ctx, struct json *value)
+{
+    struct json_push_frame *frame = NULL;	/* object or array being parsed */
+    intmax_t depth;				/* number of objects and arrays being parsed */
+
+    /*
+     * firewall
+     */
+    if (ctx == NULL || value == NULL) {
+	err(10, __func__, "ctx or value is NULL");
+	not_reached();
+    }
+
+    /*
+     * case: top level value
+     */
+    depth = dyn_array_tell(ctx->stack);
+    if (depth == 0) {
+	ctx->tree = value;
+	ctx->expect = JSON_PUSH_END;
+	return;
+    }
+
+    /*
+     * case: value in an object or array
+     *
+     * The bison parser reduces name : value to a member, and members , member
+     * or elements , value to members or elements.
+     */
+    frame = dyn_array_addr(ctx->stack, struct json_push_frame, depth-1);
+    if (frame->object == true) {
+	ctx->depth -= 2;
+	if (frame->node == NULL) {
+	    frame->node = json_create_object();
+	} else {
+	    ctx->depth -= 2;
+	}
+	frame->node = json_object_add_member(frame->node, json_parse_member(frame->name, value));
+	frame->name = NULL;
+    } else {
+	if (frame->node == NULL) {
+	    frame->node = json_create_elements();
+	} else {
+	    ctx->depth -= 2;
+	}
+	frame->node = json_elements_add_value(frame->node, value);
+    }
+    ctx->expect = JSON_PUSH_COMMA_OR_CLOSE;
+    return;
+}
+
+
+/*
+ * json_push_open - start parsing a JSON object or array
+ *
+ * given:
+ *	ctx	push mode parser state
+ *	object	true ==> {, false ==> [
+ *	text	text of the token
+ *
+ * NOTE: This function does not return on NULL ctx.
+ */
+static void
+json_push_open(struct jparse_push *ctx, bool object, char const *text)
+{
+    struct json_push_frame frame;	/* object or array to parse */
+
+    /*
+     * firewall
+     */
+    if (ctx == NULL) {
+	err(11, __func__, "ctx is NULL");
+	not_reached();
+    }
+
+    /*
+     * check that a value is expected
+     */
+    if (ctx->expect != JSON_PUSH_VALUE && ctx->expect != JSON_PUSH_VALUE_OR_CLOSE) {
+	json_push_error(ctx, "syntax error", text, 1);
+	return;
+    }
+    if (json_push_shift(ctx, text, 1) == false) {
+	return;
+    }
+
+    /*
+     * push the object or array
+     */
+    memset(&frame, 0, sizeof(frame));
+    frame.object = object;
+    (void) dyn_array_append_value(ctx->stack, &frame);
+    ctx->expect = object ? JSON_PUSH_NAME_OR_CLOSE : JSON_PUSH_VALUE_OR_CLOSE;
+    return;
+}
+
+
+/*
+ * json_push_close - finish parsing a JSON object or array
+ *
+ * given:
+ *	ctx	push mode parser state
+ *	object	true ==> }, false ==> ]
+ *	text	text of the token
+ *
+ * NOTE: This function does not return on NULL ctx.
+ */
+static void
+json_push_close(struct jparse_push *ctx, bool object, char const *text)
+{
+    struct json_push_frame frame;	/* object or array parsed */
+    struct json *node = NULL;		/* JSON object or array */
+    intmax_t depth;			/* number of objects and arrays being parsed */
+    bool ok = false;			/* true ==> close is expected */
+
+    /*
+     * firewall
+     */
+    if (ctx == NULL) {
+	err(12, __func__, "ctx is NULL");
+	not_reached();
+    }
+
+    /*
+     * check that the close matches the object or array being parsed
+     */
+    depth = dyn_array_tell(ctx->stack);
+    if (depth > 0 && dyn_array_addr(ctx->stack, struct json_push_frame, depth-1)->object == object) {
+	if (object) {
+	    ok = (ctx->expect == JSON_PUSH_NAME_OR_CLOSE || ctx->expect == JSON_PUSH_COMMA_OR_CLOSE);
+	} else {
+	    ok = (ctx->expect == JSON_PUSH_VALUE_OR_CLOSE || ctx->expect == JSON_PUSH_COMMA_OR_CLOSE);
+	}
+    }
+    if (ok == false) {
+	json_push_error(ctx, "syntax error", text, 1);
+	return;
+    }
+    if (json_push_shift(ctx, text, 1) == false) {
+	return;
+    }
+
+    /*
+     * pop the object or array
+     *
+     * The bison parser reduces { } or [ ] to one state, and { members } or
+     * [ elements ] to one state.
+     */
+    (void) dyn_array_pop(ctx->stack, &frame);
+    if (object) {
+	node = (frame.node != NULL) ? frame.node : json_create_object();
+    } else {
+	node = (frame.node != NULL) ? json_parse_array(frame.node) : json_create_array();
+    }
+    ctx->depth -= (frame.node != NULL) ? 2 : 1;
+    json_push_value(ctx, node);
+    return;
+}
+
+
+/*
+ * json_push_match - complete the token in the token buffer
+ *
+ * The token buffer holds a JSON string, a run of number bytes or the start of
+ * true, false or null that cannot be extended.  As the flex scanner does, the
+ * longest token is matched: a JSON string ends at its last \" if no later "
+ * ends it, and a JSON number is the longest start of the run.  The bytes after
+ * the token are scanned again.  If no token matches, the first byte is matched
+ * by the flex "." rule.
+ *
+ * given:
+ *	ctx	push mode parser state
+ *
+ * NOTE: This function does not return on NULL ctx or malloc error.
+ */
+static void
+json_push_match(struct jparse_push *ctx)
+{
+    char *rest = NULL;		/* bytes after the token, to be scanned again */
+    size_t rest_len = 0;	/* number of bytes in rest */
+    size_t len;			/* number of bytes in the token buffer */
+    size_t match = 0;		/* length of the matched token */
+    enum json_push_kind kind = JSON_PUSH_KIND_INVALID; /* kind of the matched token */
+
+    /*
+     * firewall
+     */
+    if (ctx == NULL) {
+	err(13, __func__, "ctx is NULL");
+	not_reached();
+    }
+
+    /*
+     * match the longest token
+     */
+    len = (size_t)dyn_array_tell(ctx->token);
+    switch (ctx->lex) {
+    case JSON_PUSH_LEX_STRING:
+	match = ctx->string_len;
+	kind = JSON_PUSH_KIND_STRING;
+	break;
+    case JSON_PUSH_LEX_NUMBER:
+	match = json_push_number_len(dyn_array_addr(ctx->token, char, 0), len);
+	kind = JSON_PUSH_KIND_NUMBER;
+	break;
+    default:
+	break;
+    }
+    ctx->lex = JSON_PUSH_LEX_NONE;
+    if (match == 0) {
+	match = 1;
+	kind = JSON_PUSH_KIND_INVALID;
+    }
+
+    /*
+     * save the bytes after the token
+     */
+    if (match < len) {
+	rest_len = len - match;
+	errno = 0;		/* pre-clear errno for errp() */
+	rest = malloc(rest_len);
+	if (rest == NULL) {
+	    errp(14, __func__, "malloc of %zu bytes failed", rest_len);
+	    not_reached();
+	}
+	memcpy(rest, dyn_array_addr(ctx->token, char, match), rest_len);
+    }
+
+    /*
+     * give the NUL terminated token to the parser
+     */
+    (void) dyn_array_seek(ctx->token, (off_t)match, SEEK_SET);
+    (void) dyn_array_append_value(ctx->token, "");
+    json_push_token(ctx, kind, dyn_array_addr(ctx->token, char, 0), match);
+    dyn_array_clear(ctx->token);
+
+    /*
+     * scan the bytes after the token again
+     */
+    if (rest != NULL) {
+	json_push_scan(ctx, rest, rest_len);
+	free(rest);
+	rest = NULL;
+    }
+    return;
+}
+
+
+/*
+ * json_push_scan - scan bytes of a JSON document
+ *
+ * The tokens are those of the flex scanner in jparse.l.
+ *
+ * given:
+ *	ctx	push mode parser state
+ *	buf	bytes to scan
+ *	len	number of bytes in buf
+ */
+static void
+json_push_scan(struct jparse_push *ctx, char const *buf, size_t len)
+{
+    size_t i = 0;			/* index into buf */
+    size_t start;			/* start of the token bytes in buf */
+    size_t used;			/* bytes of the token already in the token buffer */
+    unsigned char c;			/* byte from buf */
+    bool done = false;			/* true ==> end of the token found */
+
+    while (i < len && ctx->valid == true) {
+	switch (ctx->lex) {
+
+	/*
+	 * case: inside a run of whitespace or newlines
+	 */
+	case JSON_PUSH_LEX_WS:
+	case JSON_PUSH_LEX_NL:
+	    start = i;
+	    if (ctx->lex == JSON_PUSH_LEX_WS) {
+		while (i < len && (buf[i] == ' ' || buf[i] == '\t' || buf[i] == '\r')) {
+		    ++i;
+		}
+	    } else {
+		while (i < len && buf[i] == '\n') {
+		    ++i;
+		}
+	    }
+	    json_push_loc(ctx, buf+start, i-start, false);
+	    if (i < len) {
+		ctx->lex = JSON_PUSH_LEX_NONE;
+	    }
+	    break;
+
+	/*
+	 * case: inside a JSON string
+	 *
+	 * A " ends the string unless it follows a \, when the string may go on.
+	 * A byte in [\x01-\x1f] ends the string at its last \" so far.
+	 */
+	case JSON_PUSH_LEX_STRING:
+	    start = i;
+	    used = (size_t)dyn_array_tell(ctx->token);
+	    done = false;
+	    while (i < len) {
+		c = (unsigned char)buf[i];
+		if (c >= 0x01 && c <= 0x1f) {
+		    break;
+		}
+		++i;
+		if (c == '"') {
+		    ctx->string_len = used + (i-start);
+		    if (ctx->backslash == false) {
+			done = true;
+			break;
+		    }
+		}
+		ctx->backslash = (c == '\\');
+	    }
+	    (void) dyn_array_append_set(ctx->token, (void *)(buf+start), (intmax_t)(i-start));
+	    if (done == true) {
+		ctx->string_len = (size_t)dyn_array_tell(ctx->token);
+		json_push_match(ctx);
+	    } else if (i < len) {
+		json_push_match(ctx);
+	    }
+	    break;
+
+	/*
+	 * case: inside a run of number bytes
+	 */
+	case JSON_PUSH_LEX_NUMBER:
+	    start = i;
+	    while (i < len && ((buf[i] >= '0' && buf[i] <= '9') ||
+			       buf[i] == '-' || buf[i] == '+' || buf[i] == '.' || buf[i] == 'e' || buf[i] == 'E')) {
+		++i;
+	    }
+	    (void) dyn_array_append_set(ctx->token, (void *)(buf+start), (intmax_t)(i-start));
+	    if (i < len) {
+		json_push_match(ctx);
+	    }
+	    break;
+
+	/*
+	 * case: inside true, false or null
+	 */
+	case JSON_PUSH_LEX_WORD:
+	    used = (size_t)dyn_array_tell(ctx->token);
+	    if (buf[i] != ctx->word[used]) {
+		json_push_match(ctx);
+		break;
+	    }
+	    (void) dyn_array_append_value(ctx->token, (void *)(buf+i));
+	    ++i;
+	    if (ctx->word[used+1] == '\0') {
+		ctx->lex = JSON_PUSH_LEX_NONE;
+		dyn_array_clear(ctx->token);
+		json_push_token(ctx, (ctx->word[0] == 't') ? JSON_PUSH_KIND_TRUE :
+				     (ctx->word[0] == 'f') ? JSON_PUSH_KIND_FALSE : JSON_PUSH_KIND_NULL,
+				ctx->word, used+1);
+	    }
+	    break;
+
+	/*
+	 * case: between tokens
+	 */
+	case JSON_PUSH_LEX_NONE:
+	default:
+	    c = (unsigned char)buf[i];
+	    switch (c) {
+	    case ' ':
+	    case '\t':
+	    case '\r':
+		ctx->lex = JSON_PUSH_LEX_WS;
+		json_push_loc(ctx, buf+i, 1, true);
+		++i;
+		break;
+	    case '\n':
+		ctx->lex = JSON_PUSH_LEX_NL;
+		json_push_loc(ctx, buf+i, 1, true);
+		++i;
+		break;
+	    case '{':
+		json_push_token(ctx, JSON_PUSH_KIND_OPEN_BRACE, buf+i, 1);
+		++i;
+		break;
+	    case '}':
+		json_push_token(ctx, JSON_PUSH_KIND_CLOSE_BRACE, buf+i, 1);
+		++i;
+		break;
+	    case '[':
+		json_push_token(ctx, JSON_PUSH_KIND_OPEN_BRACKET, buf+i, 1);
+		++i;
+		break;
+	    case ']':
+		json_push_token(ctx, JSON_PUSH_KIND_CLOSE_BRACKET, buf+i, 1);
+		++i;
+		break;
+	    case ':':
+		json_push_token(ctx, JSON_PUSH_KIND_COLON, buf+i, 1);
+		++i;
+		break;
+	    case ',':
+		json_push_token(ctx, JSON_PUSH_KIND_COMMA, buf+i, 1);
+		++i;
+		break;
+	    case '"':
+		ctx->lex = JSON_PUSH_LEX_STRING;
+		ctx->backslash = false;
+		ctx->string_len = 0;
+		(void) dyn_array_append_value(ctx->token, "\"");
+		++i;
+		break;
+	    case '-':
+	    case '0': case '1': case '2': case '3': case '4':
+	    case '5': case '6': case '7': case '8': case '9':
+		ctx->lex = JSON_PUSH_LEX_NUMBER;
+		break;
+	    case 't':
+		ctx->lex = JSON_PUSH_LEX_WORD;
+		ctx->word = "true";
+		break;
+	    case 'f':
+		ctx->lex = JSON_PUSH_LEX_WORD;
+		ctx->word = "false";
+		break;
+	    case 'n':
+		ctx->lex = JSON_PUSH_LEX_WORD;
+		ctx->word = "null";
+		break;
+	    default:
+		json_push_token(ctx, JSON_PUSH_KIND_INVALID, buf+i, 1);
+		++i;
+		break;
+	    }
+	    break;
+	}
+    }
+    return;
+}
+
+
+/*
+ * jparse_push_create - create a push mode JSON parser
+ *
+ * If json_tree_arena is true, the JSON parse tree is allocated from an arena
+ * that belongs to the parser until jparse_finish() hands it to the tree.
+ *
+ * given:
+ *	filename    name of the file being parsed for error messages, or NULL
+ *
+ * returns:
+ *	pointer to a new push mode parser state
+ *
+ * NOTE: This function does not return on calloc error.
+ */
+struct jparse_push *
+jparse_push_create(char const *filename)
+{
+    struct jparse_push *ctx = NULL;	/* push mode parser state */
+
+    errno = 0;			/* pre-clear errno for errp() */
+    ctx = calloc(1, sizeof(*ctx));
+    if (ctx == NULL) {
+	errp(15, __func__, "calloc of struct jparse_push failed");
+	not_reached();
+    }
+    ctx->filename = filename;
+    ctx->valid = true;
+    ctx->finished = false;
+    ctx->lex = JSON_PUSH_LEX_NONE;
+    ctx->token = dyn_array_create(sizeof(char), JSON_PUSH_TOKEN_CHUNK, JSON_PUSH_TOKEN_CHUNK, false);
+    ctx->backslash = false;
+    ctx->string_len = 0;
+    ctx->word = NULL;
+    ctx->first_line = 0;
+    ctx->first_column = 0;
+    ctx->last_line = 0;
+    ctx->last_column = 0;
+    ctx->expect = JSON_PUSH_VALUE;
+    ctx->stack = dyn_array_create(sizeof(struct json_push_frame), JSON_PUSH_TOKEN_CHUNK, JSON_PUSH_TOKEN_CHUNK, true);
+    ctx->depth = 1;
+    ctx->tree = NULL;
+    ctx->arena = json_tree_arena ? json_arena_create() : NULL;
+    ctx->string_err = false;
+    ctx->err_msg = NULL;
+    ctx->err_text = NULL;
+    ctx->err_type = NULL;
+    ctx->bytes = 0;
+    ctx->low_bytes = 0;
+    ctx->nul_bytes = 0;
+    ctx->low_line = 1;
+    ctx->low_pos = 0;
+    return ctx;
+}
+
+
+/*
+ * jparse_feed - give the next chunk of a JSON document to a push mode parser
+ *
+ * The chunk may end anywhere, including within a token or a UTF-8 character.
+ * Only the token being scanned is kept between calls.
+ *
+ * given:
+ *	ctx	push mode parser state from jparse_push_create()
+ *	buf	next bytes of the JSON document
+ *	len	number of bytes in buf
+ *
+ * returns:
+ *	true ==> no error found so far, false ==> the JSON document is invalid
+ *
+ * NOTE: After an error is found, further input is only scanned for low bytes,
+ *	 as the scanner reports those instead of any syntax error.
+ *
+ * NOTE: This function does not return on NULL ctx, on NULL buf with a non-zero
+ *	 len, or if called after jparse_finish().
+ */
+bool
+jparse_feed(struct jparse_push *ctx, char const *buf, size_t len)
+{
+    struct json_arena *prev = NULL;	/* JSON parse tree arena in use by the caller */
+
+    /*
+     * firewall
+     */
+    if (ctx == NULL) {
+	err(16, __func__, "ctx is NULL");
+	not_reached();
+    }
+    if (buf == NULL && len > 0) {
+	err(17, __func__, "buf is NULL and len: %zu > 0", len);
+	not_reached();
+    }
+    if (ctx->finished == true) {
+	err(18, __func__, "called after jparse_finish()");
+	not_reached();
+    }
+    if (len == 0) {
+	return ctx->valid;
+    }
+    ctx->bytes += len;
+
+    /*
+     * a JSON document with low bytes is not parsed
+     */
+    json_push_low_bytes(ctx, buf, len);
+    if (ctx->low_bytes > 0 || ctx->nul_bytes > 0) {
+	ctx->valid = false;
+    }
+    if (ctx->valid == false) {
+	return false;
+    }
+
+    /*
+     * scan the chunk, allocating nodes from the arena of this parse
+     */
+    prev = json_arena_parse_swap(ctx->arena);
+    json_push_scan(ctx, buf, len);
+    (void) json_arena_parse_swap(prev);
+    return ctx->valid;
+}
+
+
+/*
+ * jparse_finish - finish a push mode parse and return the JSON parse tree
+ *
+ * The token at the end of the input is completed, and the JSON document is
+ * invalid if it is not complete.  The first error is then reported as the
+ * scanner and parser report it: low bytes, an empty document, or a syntax
+ * error.  If json_tree_arena is true when the parser was created, the arena is
+ * handed to the JSON parse tree as in parse_json().
+ *
+ * given:
+ *	ctx	    push mode parser state from jparse_push_create()
+ *	is_valid    non-NULL pointer to boolean to set depending on JSON validity
+ *
+ * returns:
+ *	pointer to the JSON parse tree, or NULL if the JSON document is invalid
+ *
+ * NOTE: The caller frees the tree with json_tree_free() and free() and then
+ *	 frees ctx with jparse_push_free().
+ *
+ * NOTE: This function does not return on NULL ctx or is_valid, or if called twice.
+ */
+struct json *
+jparse_finish(struct jparse_push *ctx, bool *is_valid)
+{
+    struct json_arena *prev = NULL;	/* JSON parse tree arena in use by the caller */
+    struct json_push_frame *frame = NULL; /* object or array not closed */
+    struct json *tree = NULL;		/* JSON parse tree */
+    intmax_t i;
+
+    /*
+     * firewall
+     */
+    if (ctx == NULL) {
+	err(19, __func__, "ctx is NULL");
+	not_reached();
+    }
+    if (is_valid == NULL) {
+	err(20, __func__, "is_valid is NULL");
+	not_reached();
+    }
+    if (ctx->finished == true) {
+	err(21, __func__, "called twice");
+	not_reached();
+    }
+    ctx->finished = true;
+    prev = json_arena_parse_swap(ctx->arena);
+    ctx->arena = NULL;
+
+    /*
+     * complete the tokens at the end of the input
+     */
+    while (ctx->valid == true && ctx->lex != JSON_PUSH_LEX_NONE &&
+	   ctx->lex != JSON_PUSH_LEX_WS && ctx->lex != JSON_PUSH_LEX_NL) {
+	json_push_match(ctx);
+    }
+    ctx->lex = JSON_PUSH_LEX_NONE;
+
+    /*
+     * check for an incomplete JSON document
+     */
+    if (ctx->valid == true && ctx->expect != JSON_PUSH_END) {
+	json_push_error(ctx, "syntax error", NULL, 0);
+    }
+
+    /*
+     * report the first error as the scanner and parser do
+     */
+    if (ctx->low_bytes > 0 && ctx->nul_bytes > 0) {
+	werr(22, __func__, "%zu low byte%s and %zu NUL byte%s detected: data block is NOT valid JSON",
+		ctx->low_bytes, ctx->low_bytes > 1 ? "s":"",
+		ctx->nul_bytes, ctx->nul_bytes > 1 ? "s":"");
+    } else if (ctx->low_bytes > 0) {
+	werr(23, __func__, "%zu low byte%s detected: data block is NOT valid JSON",
+		ctx->low_bytes, ctx->low_bytes > 1 ? "s":"");
+    } else if (ctx->nul_bytes > 0) {
+	werr(24, __func__, "%zu NUL byte%s detected: data block is NOT valid JSON",
+		ctx->nul_bytes, ctx->nul_bytes > 1 ? "s":"");
+    } else if (ctx->bytes == 0) {
+	/* as low_byte_scan() reports an empty JSON document */
+	werr(25, __func__, "len: %ju <= 0 ", ctx->bytes);
+    } else {
+	json_push_report(ctx);
+    }
+
+    /*
+     * a JSON string that could not be decoded makes the JSON invalid
+     *
+     * NOTE: ctx->string_err is only set when json_string_err_invalid is true.
+     */
+    if (ctx->string_err == true) {
+	ctx->valid = false;
+    }
+
+    /*
+     * discard a partial JSON parse tree
+     */
+    if (ctx->valid == true) {
+	tree = ctx->tree;
+    } else {
+	for (i=0; i < dyn_array_tell(ctx->stack); ++i) {
+	    frame = dyn_array_addr(ctx->stack, struct json_push_frame, i);
+	    json_push_discard(frame->name);
+	    json_push_discard(frame->node);
+	}
+	json_push_discard(ctx->tree);
+    }
+    dyn_array_clear(ctx->stack);
+    ctx->tree = NULL;
+
+    /*
+     * hand the arena, if any, to the JSON parse tree
+     */
+    tree = json_arena_parse_end(tree);
+    (void) json_arena_parse_swap(prev);
+
+    if (ctx->valid == true) {
+	json_dbg(JSON_DBG_LOW, __func__, "valid JSON: %ju bytes", ctx->bytes);
+    } else {
+	json_dbg(JSON_DBG_LOW, __func__, "invalid JSON: %ju bytes", ctx->bytes);
+    }
+    *is_valid = ctx->valid;
+    return tree;
+}
+
+
+/*
+ * jparse_push_free - free a push mode JSON parser
+ *
+ * If jparse_finish() was not called, the partial JSON parse tree is freed.
+ *
+ * given:
+ *	ctx	push mode parser state from jparse_push_create(), or NULL
+ */
+void
+jparse_push_free(struct jparse_push *ctx)
+{
+    struct json_push_frame *frame = NULL; /* object or array not closed */
+    intmax_t i;
+
+    if (ctx == NULL) {
+	return;
+    }
+
+    /*
+     * free a partial JSON parse tree
+     */
+    if (ctx->finished == false) {
+	for (i=0; i < dyn_array_tell(ctx->stack); ++i) {
+	    frame = dyn_array_addr(ctx->stack, struct json_push_frame, i);
+	    json_push_discard(frame->name);
+	    json_push_discard(frame->node);
+	}
+	json_push_discard(ctx->tree);
+	if (ctx->arena != NULL) {
+	    json_arena_free(ctx->arena);
+	}
+    }
+
+    /*
+     * free the parser state
+     */
+    dyn_array_free(ctx->token);
+    dyn_array_free(ctx->stack);
+    if (ctx->err_text != NULL) {
+	free(ctx->err_text);
+	ctx->err_text = NULL;
+    }
+    memset(ctx, 0, sizeof(*ctx));
+    free(ctx);
+    return;
+}
+
+
+/*
+ * parse_json_push - parse an open file stream for JSON data a chunk at a time
+ *
+ * Unlike parse_json_stream(), the stream is not read into memory first: each
+ * JSON_PUSH_CHUNK bytes read are given to a push mode parser, so the memory
+ * used is that of the JSON parse tree.  The whole stream is read even after an
+ * error is found, so that low bytes are reported as parse_json_file() does.
+ *
+ * given:
+ *	stream      - open file stream containing JSON data, or NULL for stdin
+ *	filename    - name of file for error messages, or NULL
+ *	is_valid    - non-NULL pointer to boolean to set depending on JSON validity
+ *
+ * returns:
+ *	pointer to the JSON parse tree, or NULL if the JSON is invalid
+ *
+ * NOTE: This function warns on a read error.
+ *
+ * NOTE: This function does not return on NULL is_valid or malloc error.
+ */
+struct json *
+parse_json_push(FILE *stream, char const *filename, bool *is_valid)
+{
+    struct jparse_push *ctx = NULL;	/* push mode parser state */
+    struct json *tree = NULL;		/* JSON parse tree */
+    char *buf = NULL;			/* chunk read from stream */
+    size_t len = 0;			/* length of the chunk */
+    bool read_ok = true;		/* false ==> read error */
+
+    /*
+     * firewall
+     */
+    if (is_valid == NULL) {
+	err(26, __func__, "is_valid is NULL");
+	not_reached();
+    }
+    if (stream == NULL) {
+	stream = stdin;
+    }
+    if (filename == NULL) {
+	filename = "-";
+    }
+
+    /*
+     * feed the stream to a push mode parser
+     */
+    errno = 0;			/* pre-clear errno for errp() */
+    buf = malloc(JSON_PUSH_CHUNK);
+    if (buf == NULL) {
+	errp(27, __func__, "malloc of %d bytes failed", JSON_PUSH_CHUNK);
+	not_reached();
+    }
+    ctx = jparse_push_create(filename);
+    do {
+	clearerr(stream);	/* pre-clear ferror() status */
+	errno = 0;		/* pre-clear errno for warnp() */
+	len = fread(buf, 1, JSON_PUSH_CHUNK, stream);
+	if (len == 0 && ferror(stream)) {
+	    warnp(__func__, "error reading JSON from %s", filename);
+	    read_ok = false;
+	    break;
+	}
+	(void) jparse_feed(ctx, buf, len);
+    } while (len > 0);
+    free(buf);
+    buf = NULL;
+
+    /*
+     * finish the parse
+     */
+    tree = jparse_finish(ctx, is_valid);
+    jparse_push_free(ctx);
+    ctx = NULL;
+    if (read_ok == false) {
+	*is_valid = false;
+	if (tree != NULL) {
+	    json_tree_free(tree, JSON_INFINITE_DEPTH);
+	    free(tree);
+	    tree = NULL;
+	}
+    }
+    return tree;
+}
@@ -0,0 +1,188 @@
+/*
+ * json_push - incremental push mode JSON parser
+ *
+ * "Because sometimes the JSON is still on its way." :-)
+ *
+ * Copyright (c) 2022-2025 by Cody Boone Ferguson and Landon Curt Noll. All
+ * rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software and
+ * its documentation for any purpose and without fee is hereby granted,
+ * provided that the above copyright, this permission notice and text
+ * this comment, and the disclaimer below appear in all of the following:
+ *
+ *       supporting documentation
+ *       source copies
+ *       source works derived from this source
+ *       binaries derived from this source or from derived source
+ *
+ * THE AUTHORS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE, INCLUDING
+ * ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHORS BE LIABLE FOR ANY SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES OR ANY
+ * DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE OR JSON.
+ *
+ * This JSON parser, library and tools were co-developed in 2022-2025 by Cody Boone
+ * Ferguson and Landon Curt Noll:
+ *
+ *  @xexyl
+ *	https://xexyl.net		Cody Boone Ferguson
+ *	https://ioccc.xexyl.net
+ * and:
+ *	chongo (Landon Curt Noll, http://www.isthe.com/chongo/index.html) /\oo/\
+ *
+ * "Because sometimes even the IOCCC Judges need some help." :-)
+ *
+ * "Share and Enjoy!"
+ *     --  Sirius Cybernetics Corporation Complaints Division, JSON spec department. :-)
+ */
+
+
+#if !defined(INCLUDE_JSON_PUSH_H)
+#    define  INCLUDE_JSON_PUSH_H
+
+
+/*
+ * dbg - info, debug, warning, error, and usage message facility
+ */
+#if defined(INTERNAL_INCLUDE)
+  #include "../dbg/c_bool.h"
+  #include "../dbg/c_compat.h"
+  #include "../dbg/dbg.h"
+#elif defined(INTERNAL_INCLUDE_2)
+  #include "../dbg/c_bool.h"
+  #include "../dbg/c_compat.h"
+  #include "../dbg/dbg.h"
+#else
+  #include <c_bool.h>
+  #include <c_compat.h>
+  #include <dbg.h>
+#endif
+
+/*
+ * util - common utility functions for the JSON parser
+ */
+#include "util.h"
+
+/*
+ * json_parse - JSON parser support code
+ */
+#include "json_parse.h"
+
+/*
+ * json_util - general JSON parser utility support functions
+ */
+#include "json_util.h"
+
+
+/*
+ * definitions
+ */
+#define JSON_PUSH_CHUNK (64*1024)	/* bytes read at a time by parse_json_push() */
+#define JSON_PUSH_MAX_DEPTH (10000)	/* maximum depth of the bison parser stack, as YYMAXDEPTH */
+#define JSON_PUSH_TOKEN_CHUNK (256)	/* bytes to grow the token buffer at a time */
+
+/*
+ * json_push_lex - what the push mode scanner is in the middle of
+ *
+ * The runs of whitespace and newlines are tokens of the flex scanner too: they
+ * move the location that is reported for an error.
+ */
+enum json_push_lex {
+    JSON_PUSH_LEX_NONE = 0,	/* between tokens */
+    JSON_PUSH_LEX_WS,		/* inside a run of [ \t\r] */
+    JSON_PUSH_LEX_NL,		/* inside a run of \n */
+    JSON_PUSH_LEX_STRING,	/* inside a JSON string */
+    JSON_PUSH_LEX_NUMBER,	/* inside a run of [-+.0-9eE] */
+    JSON_PUSH_LEX_WORD,		/* inside true, false or null */
+};
+
+/*
+ * json_push_kind - kind of token matched by the push mode scanner
+ */
+enum json_push_kind {
+    JSON_PUSH_KIND_INVALID = 0,	/* any other byte, as the flex "." rule */
+    JSON_PUSH_KIND_OPEN_BRACE,	/* { */
+    JSON_PUSH_KIND_CLOSE_BRACE,	/* } */
+    JSON_PUSH_KIND_OPEN_BRACKET, /* [ */
+    JSON_PUSH_KIND_CLOSE_BRACKET, /* ] */
+    JSON_PUSH_KIND_COLON,	/* : */
+    JSON_PUSH_KIND_COMMA,	/* , */
+    JSON_PUSH_KIND_STRING,	/* JSON string */
+    JSON_PUSH_KIND_NUMBER,	/* JSON number */
+    JSON_PUSH_KIND_TRUE,	/* true */
+    JSON_PUSH_KIND_FALSE,	/* false */
+    JSON_PUSH_KIND_NULL,	/* null */
+};
+
+/*
+ * json_push_frame - a JSON object or array being parsed
+ */
+struct json_push_frame
+{
+    bool object;		/* true ==> JSON object, false ==> JSON array */
+    struct json *node;		/* JTYPE_OBJECT or JTYPE_ELEMENTS node, NULL until the first member or value */
+    struct json *name;		/* JTYPE_STRING name of the member being parsed, or NULL */
+};
+
+/*
+ * jparse_push - incremental push mode JSON parser state
+ *
+ * Bytes are given to jparse_feed() in chunks of any size.  Tokens, including
+ * JSON strings and multi-byte UTF-8 characters, may be split across chunks.
+ * Only the token being scanned is buffered, not the input.
+ *
+ * The tokens, the error locations and the error messages are those of the
+ * flex scanner and bison parser, so that the same input gives the same report
+ * whether it is parsed with parse_json() or a push mode parser.
+ */
+struct jparse_push
+{
+    char const *filename;	/* filename for error messages, or NULL */
+    bool valid;			/* false ==> an error was found, further input is only scanned for low bytes */
+    bool finished;		/* true ==> jparse_finish() was called */
+
+    enum json_push_lex lex;	/* what the scanner is in the middle of */
+    struct dyn_array *token;	/* bytes of the token being scanned */
+    bool backslash;		/* true ==> the previous byte of a JSON string was a \ */
+    size_t string_len;		/* length of the JSON string token ending at the last \" so far, or 0 */
+    char const *word;		/* true, false or null being matched */
+
+    int first_line;		/* location of the last token, as YY_USER_ACTION in jparse.l sets it */
+    int first_column;
+    int last_line;
+    int last_column;
+
+    enum json_push_expect expect; /* what the parser expects next */
+    struct dyn_array *stack;	/* stack of struct json_push_frame */
+    int depth;			/* depth the bison parser stack would have */
+    struct json *tree;		/* JSON parse tree of the top level value, or NULL */
+    struct json_arena *arena;	/* JSON parse tree arena, or NULL */
+    bool string_err;		/* true ==> json_parse_string() found a string that cannot be decoded */
+
+    char const *err_msg;	/* first error message, reported by jparse_finish(), or NULL */
+    char *err_text;		/* text of the token in error, or NULL at the end of the input */
+    int err_line;		/* line number of the first error */
+    int err_column;		/* column number of the first error */
+    char const *err_type;	/* type of the JSON parse tree when the first error was found, or NULL */
+
+    uintmax_t bytes;		/* number of bytes fed */
+    size_t low_bytes;		/* number of low [\x01-\x08\x0e-\x1f] bytes found */
+    size_t nul_bytes;		/* number of NUL bytes found */
+    size_t low_line;		/* line number of the next byte, as low_byte_scan() counts lines */
+    size_t low_pos;		/* byte position of the last byte within its line */
+};
+
+
+/*
+ * external function declarations
+ */
+extern struct jparse_push *jparse_push_create(char const *filename);
+extern bool jparse_feed(struct jparse_push *ctx, char const *buf, size_t len);
+extern struct json *jparse_finish(struct jparse_push *ctx, bool *is_valid);
+extern void jparse_push_free(struct jparse_push *ctx);
+extern struct json *parse_json_push(FILE *stream, char const *filename, bool *is_valid);
+
+
+#endif /* INCLUDE_JSON_PUSH_H */
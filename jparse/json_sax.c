@@ -0,0 +1,416 @@
+/*
+ * json_sax - event driven JSON parser that does not build a JSON parse tree
+ *
+ * "Because sometimes you only want to know if you have a tree, not the tree." :-)
+ *
+ * Copyright (c) 2022-2025 by Cody Boone Ferguson and Landon Curt Noll. All
+ * rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software and
+ * its documentation for any purpose and without fee is hereby granted,
+ * provided that the above copyright, this permission notice and text
+ * this comment, and the disclaimer below appear in all of the following:
+ *
+ *       supporting documentation
+ *       source copies
+ *       source works derived from this source
+ *       binaries derived from this source or from derived source
+ *
+ * THE AUTHORS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE, INCLUDING
+ * ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHORS BE LIABLE FOR ANY SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES OR ANY
+ * DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE OR JSON.
+ *
+ * This JSON parser, library and tools were co-developed in 2022-2025 by Cody Boone
+ * Ferguson and Landon Curt Noll:
+ *
+ *  @xexyl
+ *	https://xexyl.net		Cody Boone Ferguson
+ *	https://ioccc.xexyl.net
+ * and:
+ *	chongo (Landon Curt Noll, http://www.isthe.com/chongo/index.html) /\oo/\
+ *
+ * "Because sometimes even the IOCCC Judges need some help." :-)
+ *
+ * "Share and Enjoy!"
+ *     --  Sirius Cybernetics Corporation Complaints Division, JSON spec department. :-)
+ */
+
+
+
+
+/* special comments for the seqcexit tool */
+/* exit code out of numerical order - ignore in sequencing - ooo */
+/* exit code change of order - use new value in sequencing - coo */
+
+
+#include <string.h>
+
+/*
+ * jparse - JSON parser, for the scanner token numbers
+ */
+#include "jparse.h"
+
+/*
+ * json_sax - event driven JSON parser that does not build a JSON parse tree
+ */
+#include "json_sax.h"
+
+
+/*
+ * static functions
+ */
+static struct json *json_sax_convert(struct json_sax_parser *parser, int token, char const *text, size_t len);
+static void json_sax_value_end(struct json_sax_parser *parser);
+
+
+/*
+ * json_sax_parser_init - initialize an event driven JSON parser
+ *
+ * given:
+ *	parser	pointer to the parser state to initialize
+ *	sax	callbacks, or NULL ==> only check the JSON
+ *	data	data passed to the callbacks
+ *
+ * NOTE: The parser must be freed with json_sax_parser_free().
+ *
+ * NOTE: This function does not return on NULL parser.
+ */
+void
+json_sax_parser_init(struct json_sax_parser *parser, struct json_sax const *sax, void *data)
+{
+    /*
+     * firewall
+     */
+    if (parser == NULL) {
+	err(1, __func__, "parser is NULL");
+	not_reached();
+    }
+
+    /*
+     * initialize the parser
+     */
+    memset(parser, 0, sizeof(*parser));
+    parser->sax = sax;
+    parser->data = data;
+    parser->stopped = false;
+    parser->expect = JSON_PUSH_VALUE;
+    parser->stack = dyn_array_create(sizeof(struct json_sax_frame), JSON_PUSH_TOKEN_CHUNK, JSON_PUSH_TOKEN_CHUNK, true);
+    parser->scratch = json_arena_create();
+    parser->name = NULL;
+    parser->events = 0;
+    return;
+}
+
+
+/*
+ * json_sax_convert - convert a scalar token into a scratch JSON node
+ *
+ * The token is converted by the same json_parse_*() function as the bison
+ * grammar uses, but into the scratch arena of the parser.  Unless the token
+ * is the value of a member, the scratch arena is first reset, releasing the
+ * nodes of the previous value.
+ *
+ * given:
+ *	parser	event driven JSON parser state
+ *	token	JSON_STRING, JSON_NUMBER, JSON_TRUE, JSON_FALSE or JSON_NULL
+ *	text	NUL terminated text of the token
+ *	len	length of text
+ *
+ * returns:
+ *	JSON node in the scratch arena
+ *
+ * NOTE: This function does not return on NULL parser or text, or on an
+ *	 invalid token.
+ */
+static struct json *
+json_sax_convert(struct json_sax_parser *parser, int token, char const *text, size_t len)
+{
+    struct json_arena *prev = NULL;	/* JSON parse tree arena in use by the caller */
+    struct json *node = NULL;		/* converted token */
+
+    /*
+     * firewall
+     */
+    if (parser == NULL || text == NULL) {
+	err(2, __func__, "parser or text is NULL");
+	not_reached();
+    }
+
+    /*
+     * convert the token into the scratch arena
+     */
+    if (parser->name == NULL) {
+	json_arena_reset(parser->scratch);
+    }
+    prev = json_arena_parse_swap(parser->scratch);
+    switch (token) {
+    case JSON_STRING:
+	node = json_parse_string(text, len);
+	break;
+    case JSON_NUMBER:
+	node = json_parse_number(text);
+	break;
+    case JSON_TRUE:
+    case JSON_FALSE:
+	node = json_parse_bool(text);
+	break;
+    case JSON_NULL:
+	node = json_parse_null(text);
+	break;
+    default:
+	err(3, __func__, "invalid token: %d", token);
+	not_reached();
+	break;
+    }
+    (void) json_arena_parse_swap(prev);
+    return node;
+}
+
+
+/*
+ * json_sax_value_end - note that a complete value was parsed
+ *
+ * given:
+ *	parser	event driven JSON parser state
+ */
+static void
+json_sax_value_end(struct json_sax_parser *parser)
+{
+    intmax_t depth;		/* number of objects and arrays being parsed */
+
+    depth = dyn_array_tell(parser->stack);
+    if (depth == 0) {
+	parser->expect = JSON_PUSH_END;
+    } else {
+	++dyn_array_addr(parser->stack, struct json_sax_frame, depth-1)->len;
+	parser->expect = JSON_PUSH_COMMA_OR_CLOSE;
+    }
+    parser->name = NULL;
+    return;
+}
+
+
+/*
+ * json_sax_token - give the next token of the JSON scanner to an event driven parser
+ *
+ * given:
+ *	parser	event driven JSON parser state
+ *	token	token number returned by the scanner
+ *	text	NUL terminated text of the token
+ *	len	length of text
+ *
+ * returns:
+ *	NULL ==> no error, else the syntax error message to report
+ *
+ * NOTE: When a callback stops the parse, parser->stopped is set to true, and
+ *	 later tokens are ignored.
+ *
+ * NOTE: This function does not return on NULL parser or text.
+ */
+char const *
+json_sax_token(struct json_sax_parser *parser, int token, char const *text, size_t len)
+{
+    struct json_sax const *sax = NULL;	/* callbacks or NULL */
+    struct json_sax_frame frame;	/* object or array being parsed */
+    struct json *node = NULL;		/* converted scalar token */
+    unsigned int depth;			/* number of objects and arrays being parsed */
+    bool object = false;		/* true ==> { or }, false ==> [ or ] */
+    bool more = true;			/* false ==> a callback stopped the parse */
+
+    /*
+     * firewall
+     */
+    if (parser == NULL || text == NULL) {
+	err(4, __func__, "parser or text is NULL");
+	not_reached();
+    }
+    if (parser->stopped) {
+	return NULL;
+    }
+    sax = parser->sax;
+    depth = (unsigned int)dyn_array_tell(parser->stack);
+
+    switch (token) {
+
+    /*
+     * case: start of an object or array
+     */
+    case JSON_OPEN_BRACE:
+    case JSON_OPEN_BRACKET:
+	if (parser->expect != JSON_PUSH_VALUE && parser->expect != JSON_PUSH_VALUE_OR_CLOSE) {
+	    return "syntax error";
+	}
+	if (depth >= JSON_SAX_MAX_DEPTH) {
+	    return "memory exhausted";
+	}
+	object = (token == JSON_OPEN_BRACE);
+	++parser->events;
+	if (sax != NULL && object && sax->begin_object != NULL) {
+	    more = sax->begin_object(parser->data, depth, parser->name);
+	} else if (sax != NULL && !object && sax->begin_array != NULL) {
+	    more = sax->begin_array(parser->data, depth, parser->name);
+	}
+	memset(&frame, 0, sizeof(frame));
+	frame.object = object;
+	(void) dyn_array_append_value(parser->stack, &frame);
+	parser->expect = object ? JSON_PUSH_NAME_OR_CLOSE : JSON_PUSH_VALUE_OR_CLOSE;
+	parser->name = NULL;
+	break;
+
+    /*
+     * case: end of an object or array
+     */
+    case JSON_CLOSE_BRACE:
+    case JSON_CLOSE_BRACKET:
+	object = (token == JSON_CLOSE_BRACE);
+	if (depth == 0 || dyn_array_addr(parser->stack, struct json_sax_frame, depth-1)->object != object ||
+	    (parser->expect != JSON_PUSH_COMMA_OR_CLOSE &&
+	     parser->expect != (object ? JSON_PUSH_NAME_OR_CLOSE : JSON_PUSH_VALUE_OR_CLOSE))) {
+	    return "syntax error";
+	}
+	(void) dyn_array_pop(parser->stack, &frame);
+	--depth;
+	++parser->events;
+	if (sax != NULL && object && sax->end_object != NULL) {
+	    more = sax->end_object(parser->data, depth, frame.len);
+	} else if (sax != NULL && !object && sax->end_array != NULL) {
+	    more = sax->end_array(parser->data, depth, frame.len);
+	}
+	json_sax_value_end(parser);
+	break;
+
+    /*
+     * case: separators
+     */
+    case JSON_COMMA:
+	if (parser->expect != JSON_PUSH_COMMA_OR_CLOSE) {
+	    return "syntax error";
+	}
+	parser->expect = dyn_array_addr(parser->stack, struct json_sax_frame, depth-1)->object ?
+			 JSON_PUSH_NAME : JSON_PUSH_VALUE;
+	break;
+    case JSON_COLON:
+	if (parser->expect != JSON_PUSH_COLON) {
+	    return "syntax error";
+	}
+	parser->expect = JSON_PUSH_VALUE;
+	break;
+
+    /*
+     * case: member name or string
+     */
+    case JSON_STRING:
+	if (parser->expect == JSON_PUSH_NAME || parser->expect == JSON_PUSH_NAME_OR_CLOSE) {
+	    parser->name = NULL;
+	    parser->name = json_sax_convert(parser, token, text, len);
+	    ++parser->events;
+	    if (sax != NULL && sax->member_name != NULL) {
+		more = sax->member_name(parser->data, depth, parser->name);
+	    }
+	    parser->expect = JSON_PUSH_COLON;
+	    break;
+	}
+	if (parser->expect != JSON_PUSH_VALUE && parser->expect != JSON_PUSH_VALUE_OR_CLOSE) {
+	    return "syntax error";
+	}
+	node = json_sax_convert(parser, token, text, len);
+	++parser->events;
+	if (sax != NULL && sax->string != NULL) {
+	    more = sax->string(parser->data, depth, parser->name, node);
+	}
+	json_sax_value_end(parser);
+	break;
+
+    /*
+     * case: number, true, false or null
+     */
+    case JSON_NUMBER:
+    case JSON_TRUE:
+    case JSON_FALSE:
+    case JSON_NULL:
+	if (parser->expect != JSON_PUSH_VALUE && parser->expect != JSON_PUSH_VALUE_OR_CLOSE) {
+	    return "syntax error";
+	}
+	node = json_sax_convert(parser, token, text, len);
+	++parser->events;
+	if (sax != NULL) {
+	    if (token == JSON_NUMBER && sax->number != NULL) {
+		more = sax->number(parser->data, depth, parser->name, node);
+	    } else if ((token == JSON_TRUE || token == JSON_FALSE) && sax->boolean != NULL) {
+		more = sax->boolean(parser->data, depth, parser->name, node);
+	    } else if (token == JSON_NULL && sax->null != NULL) {
+		more = sax->null(parser->data, depth, parser->name, node);
+	    }
+	}
+	json_sax_value_end(parser);
+	break;
+
+    /*
+     * case: invalid token
+     */
+    default:
+	return "syntax error";
+    }
+
+    if (more == false) {
+	json_dbg(JSON_DBG_MED, __func__, "callback stopped the parse after %ju events", parser->events);
+	parser->stopped = true;
+    }
+    return NULL;
+}
+
+
+/*
+ * json_sax_finish - note the end of the tokens of an event driven parse
+ *
+ * given:
+ *	parser	event driven JSON parser state
+ *
+ * returns:
+ *	NULL ==> the JSON is complete, or a callback stopped the parse,
+ *	else the syntax error message to report
+ *
+ * NOTE: This function does not return on NULL parser.
+ */
+char const *
+json_sax_finish(struct json_sax_parser *parser)
+{
+    /*
+     * firewall
+     */
+    if (parser == NULL) {
+	err(5, __func__, "parser is NULL");
+	not_reached();
+    }
+
+    if (parser->stopped == false && parser->expect != JSON_PUSH_END) {
+	return "syntax error";
+    }
+    return NULL;
+}
+
+
+/*
+ * json_sax_parser_free - free the storage of an event driven JSON parser
+ *
+ * given:
+ *	parser	pointer to the parser state, or NULL
+ */
+void
+json_sax_parser_free(struct json_sax_parser *parser)
+{
+    if (parser == NULL) {
+	return;
+    }
+    if (parser->stack != NULL) {
+	dyn_array_free(parser->stack);
+	parser->stack = NULL;
+    }
+    json_arena_free(parser->scratch);
+    parser->scratch = NULL;
+    parser->name = NULL;
+    return;
+}
@@ -0,0 +1,155 @@
+/*
+ * json_sax - event driven JSON parser that does not build a JSON parse tree
+ *
+ * "Because sometimes you only want to know if you have a tree, not the tree." :-)
+ *
+ * Copyright (c) 2022-2025 by Cody Boone Ferguson and Landon Curt Noll. All
+ * rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software and
+ * its documentation for any purpose and without fee is hereby granted,
+ * provided that the above copyright, this permission notice and text
+ * this comment, and the disclaimer below appear in all of the following:
+ *
+ *       supporting documentation
+ *       source copies
+ *       source works derived from this source
+ *       binaries derived from this source or from derived source
+ *
+ * THE AUTHORS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE, INCLUDING
+ * ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHORS BE LIABLE FOR ANY SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES OR ANY
+ * DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE OR JSON.
+ *
+ * This JSON parser, library and tools were co-developed in 2022-2025 by Cody Boone
+ * Ferguson and Landon Curt Noll:
+ *
+ *  @xexyl
+ *	https://xexyl.net		Cody Boone Ferguson
+ *	https://ioccc.xexyl.net
+ * and:
+ *	chongo (Landon Curt Noll, http://www.isthe.com/chongo/index.html) /\oo/\
+ *
+ * "Because sometimes even the IOCCC Judges need some help." :-)
+ *
+ * "Share and Enjoy!"
+ *     --  Sirius Cybernetics Corporation Complaints Division, JSON spec department. :-)
+ */
+
+
+#if !defined(INCLUDE_JSON_SAX_H)
+#    define  INCLUDE_JSON_SAX_H
+
+
+/*
+ * dbg - info, debug, warning, error, and usage message facility
+ */
+#if defined(INTERNAL_INCLUDE)
+  #include "../dbg/c_bool.h"
+  #include "../dbg/c_compat.h"
+  #include "../dbg/dbg.h"
+#elif defined(INTERNAL_INCLUDE_2)
+  #include "../dbg/c_bool.h"
+  #include "../dbg/c_compat.h"
+  #include "../dbg/dbg.h"
+#else
+  #include <c_bool.h>
+  #include <c_compat.h>
+  #include <dbg.h>
+#endif
+
+/*
+ * util - common utility functions for the JSON parser
+ */
+#include "util.h"
+
+/*
+ * json_parse - JSON parser support code
+ */
+#include "json_parse.h"
+
+/*
+ * json_util - general JSON parser utility support functions
+ */
+#include "json_util.h"
+
+
+/*
+ * definitions
+ */
+#define JSON_SAX_MAX_DEPTH (10000)	/* maximum nesting of JSON objects and arrays */
+
+/*
+ * json_sax - callbacks of an event driven JSON parse
+ *
+ * Any callback may be NULL.  A callback returns true to continue the parse, or
+ * false to stop it.
+ *
+ * The depth of a value is 0 at the top level, and 1 more than that of the
+ * object or array it is in.
+ *
+ * The name of a member is passed to member_name, and again, as name, to the
+ * callback of the value of the member.  For a value that is not the value of
+ * a member, name is NULL.
+ *
+ * The struct json nodes given to the callbacks belong to the parser, and
+ * are only valid during the callback: the nodes of a value, and of its name,
+ * are allocated from a scratch arena that is reused for the next value.
+ */
+struct json_sax
+{
+    bool (*begin_object)(void *data, unsigned int depth, struct json const *name);
+    bool (*end_object)(void *data, unsigned int depth, intmax_t len);
+    bool (*begin_array)(void *data, unsigned int depth, struct json const *name);
+    bool (*end_array)(void *data, unsigned int depth, intmax_t len);
+    bool (*member_name)(void *data, unsigned int depth, struct json const *name);
+    bool (*string)(void *data, unsigned int depth, struct json const *name, struct json const *node);
+    bool (*number)(void *data, unsigned int depth, struct json const *name, struct json *node);
+    bool (*boolean)(void *data, unsigned int depth, struct json const *name, struct json const *node);
+    bool (*null)(void *data, unsigned int depth, struct json const *name, struct json const *node);
+};
+
+/*
+ * json_sax_frame - a JSON object or array being parsed
+ */
+struct json_sax_frame
+{
+    bool object;		/* true ==> JSON object, false ==> JSON array */
+    intmax_t len;		/* number of members or values so far */
+};
+
+/*
+ * json_sax_parser - event driven JSON parser state
+ *
+ * The parser is given the tokens of the JSON scanner one at a time by
+ * json_sax_token().  It checks them against the JSON grammar using the
+ * same states as the push mode parser, but instead of building nodes
+ * of a JSON parse tree it calls the callbacks.
+ */
+struct json_sax_parser
+{
+    struct json_sax const *sax;	/* callbacks, or NULL */
+    void *data;			/* data passed to the callbacks */
+    bool stopped;		/* true ==> a callback stopped the parse */
+
+    enum json_push_expect expect; /* what the parser expects next */
+    struct dyn_array *stack;	/* stack of struct json_sax_frame */
+    struct json_arena *scratch;	/* scratch arena for the nodes given to the callbacks */
+    struct json *name;		/* name of the member being parsed, or NULL */
+
+    uintmax_t events;		/* number of callbacks called, or that would have been */
+};
+
+
+/*
+ * external function declarations
+ */
+extern void json_sax_parser_init(struct json_sax_parser *parser, struct json_sax const *sax, void *data);
+extern char const *json_sax_token(struct json_sax_parser *parser, int token, char const *text, size_t len);
+extern char const *json_sax_finish(struct json_sax_parser *parser);
+extern void json_sax_parser_free(struct json_sax_parser *parser);
+
+
+#endif /* INCLUDE_JSON_SAX_H */
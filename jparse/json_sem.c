@@ -108,6 +108,10 @@ static struct json_sem_val_err sem_val_err_NULL =
 /*
  * static functions
  */
+static int sem_node_info(struct json *node, unsigned int depth, struct json_sem *sem, char **name, char const *caller);
+static uint32_t sem_hash(unsigned int depth, enum item_type type, char const *name, size_t name_len);
+static struct json_sem_slot *sem_slot(struct json_sem_index *index, unsigned int depth, enum item_type type,
+				      char const *name, size_t name_len);
 static void sem_walk(struct json *node, unsigned int depth, va_list ap);
 
 
@@ -618,7 +622,7 @@ sem_node_valid(struct json const *node, unsigned int depth, struct json_sem *sem
 		}
 		return false;
 	    }
-	    if (item->s == NULL) {
+	    if (item->s == NULL && node->arena == NULL) {
 		if (val_err != NULL) {
 		    *val_err = werr_sem_val(37, node, depth, sem, name, "JTYPE_OBJECT node: s is NULL");
 		}
@@ -653,7 +657,7 @@ sem_node_valid(struct json const *node, unsigned int depth, struct json_sem *sem
 		}
 		return false;
 	    }
-	    if (item->s == NULL) {
+	    if (item->s == NULL && node->arena == NULL) {
 		if (val_err != NULL) {
 		    *val_err = werr_sem_val(41, node, depth, sem, name, "JTYPE_ARRAY node: s is NULL");
 		}
@@ -688,7 +692,7 @@ sem_node_valid(struct json const *node, unsigned int depth, struct json_sem *sem
 		}
 		return false;
 	    }
-	    if (item->s == NULL) {
+	    if (item->s == NULL && node->arena == NULL) {
 		if (val_err != NULL) {
 		    *val_err = werr_sem_val(45, node, depth, sem, name, "JTYPE_ARRAY node: s is NULL");
 		}
@@ -1284,6 +1288,7 @@ sem_member_value_int(struct json const *node, unsigned int depth, struct json_se
 	return NULL;
     }
     inum = &(value->item.number);
+    (void) json_number_convert(inum);	/* convert if parsed in lazy mode */
     if (!VALID_JSON_NODE(inum)) {
 	if (val_err != NULL) {
 	    *val_err = werr_sem_val(67, node, depth, sem, name, "node value JTYPE_NUMBER converted is false");
@@ -1361,6 +1366,7 @@ sem_member_value_size_t(struct json const *node, unsigned int depth, struct json
 	return NULL;
     }
     snum = &(value->item.number);
+    (void) json_number_convert(snum);	/* convert if parsed in lazy mode */
     if (!VALID_JSON_NODE(snum)) {
 	if (val_err != NULL) {
 	    *val_err = werr_sem_val(70, node, depth, sem, name, "node value JTYPE_NUMBER converted is false");
@@ -1439,6 +1445,7 @@ sem_member_value_time_t(struct json const *node, unsigned int depth, struct json
 	return NULL;
     }
     inum = &(value->item.number);
+    (void) json_number_convert(inum);	/* convert if parsed in lazy mode */
     if (!VALID_JSON_NODE(inum)) {
 	if (val_err != NULL) {
 	    *val_err = werr_sem_val(73, node, depth, sem, name, "node value JTYPE_NUMBER converted is false");
@@ -1855,54 +1862,88 @@ json_sem_count_chk(struct json_sem *sem, struct dyn_array *count_err)
 
 
 /*
- * json_sem_find - given JSON node, find first match in JSON semantic table
+ * sem_node_info - obtain the type, and for a JTYPE_MEMBER the name, of a JSON node
  *
  * given:
  *	node		pointer to a JSON parse tree
  *	depth		depth of node in the JSON parse tree (0 ==> tree root)
  *	sem		pointer to a JSON semantic table (ends with a JTYPE_UNSET JSON type)
+ *	name		where to store the name of a JTYPE_MEMBER node, or NULL
+ *	caller		name of the calling function
  *
  * returns:
- *	>=0 ==> index into JSON semantic table for first match
- *	-1  ==> no JSON semantic table match found
- *	< -1 ==> invalid JSON node, or NULL ptr, or internal error
+ *	0 ==> *name is set (to NULL if node is not a named JTYPE_MEMBER)
+ *	< -1 ==> invalid JSON node, or NULL ptr
  */
-int
-json_sem_find(struct json *node, unsigned int depth, struct json_sem *sem)
+static int
+sem_node_info(struct json *node, unsigned int depth, struct json_sem *sem, char **name, char const *caller)
 {
     bool test = false;		/* JSON node test result */
-    char *name = NULL;		/* name of JTYPE_MEMBER node or NULL */
-    enum item_type type;	/* type of JSON node */
-    int i;
 
     /*
      * firewall - args
      */
     if (node == NULL) {
-	warn(__func__, "node is NULL");
+	warn(caller, "node is NULL");
 	return -2;
     }
     if (sem == NULL) {
-	warn(__func__, "sem is NULL");
+	warn(caller, "sem is NULL");
 	return -3;
     }
 
     /*
      * obtain information about the JSON node
      */
-    type = node->type;
-    if (type == JTYPE_MEMBER) {
+    *name = NULL;
+    if (node->type == JTYPE_MEMBER) {
         /* sem_member_name_decoded_str() call checks args via sem_chk_null_args() */
 	/* sem_member_name_decoded_str() also calls sem_node_valid() */
 	/* determine name of JTYPE_MEMBER or return NULL */
-	name = sem_member_name_decoded_str(node, depth, sem, __func__, NULL);
+	*name = sem_member_name_decoded_str(node, depth, sem, caller, NULL);
     } else {
-	test = sem_node_valid(node, depth, sem, __func__, NULL);
+	test = sem_node_valid(node, depth, sem, caller, NULL);
 	if (test == false) {
-	    warn(__func__, "JSON node is invalid");
+	    warn(caller, "JSON node is invalid");
 	    return -4;
 	}
     }
+    return 0;
+}
+
+
+/*
+ * json_sem_find - given JSON node, find first match in JSON semantic table
+ *
+ * This function scans the JSON semantic table.  See json_sem_index_find()
+ * for a lookup that finds the same match without a scan.
+ *
+ * given:
+ *	node		pointer to a JSON parse tree
+ *	depth		depth of node in the JSON parse tree (0 ==> tree root)
+ *	sem		pointer to a JSON semantic table (ends with a JTYPE_UNSET JSON type)
+ *
+ * returns:
+ *	>=0 ==> index into JSON semantic table for first match
+ *	-1  ==> no JSON semantic table match found
+ *	< -1 ==> invalid JSON node, or NULL ptr, or internal error
+ */
+int
+json_sem_find(struct json *node, unsigned int depth, struct json_sem *sem)
+{
+    char *name = NULL;		/* name of JTYPE_MEMBER node or NULL */
+    enum item_type type;	/* type of JSON node */
+    int ret;
+    int i;
+
+    /*
+     * obtain information about the JSON node
+     */
+    ret = sem_node_info(node, depth, sem, &name, __func__);
+    if (ret < 0) {
+	return ret;
+    }
+    type = node->type;
 
     /*
      * search the JSON semantic table
@@ -1945,6 +1986,264 @@ json_sem_find(struct json *node, unsigned int depth, struct json_sem *sem)
 }
 
 
+/*
+ * sem_hash - hash a JSON semantic index key
+ *
+ * This is a 32-bit FNV-1a hash of the depth, type and name.
+ *
+ * given:
+ *	depth		JSON parse tree node depth
+ *	type		type of JSON node
+ *	name		JTYPE_MEMBER name or NULL ==> any name
+ *	name_len	length of name (not including final NUL) or 0
+ *
+ * returns:
+ *	hash of the key
+ */
+static uint32_t
+sem_hash(unsigned int depth, enum item_type type, char const *name, size_t name_len)
+{
+    uint32_t hash = 2166136261U;	/* FNV-1a 32-bit offset basis */
+    size_t i;
+
+    hash = (hash ^ (uint32_t)depth) * 16777619U;
+    hash = (hash ^ (uint32_t)type) * 16777619U;
+    hash = (hash ^ (uint32_t)(name != NULL)) * 16777619U;
+    for (i=0; i < name_len; ++i) {
+	hash = (hash ^ (uint8_t)name[i]) * 16777619U;
+    }
+    return hash;
+}
+
+
+/*
+ * sem_slot - find the JSON semantic index slot for a key
+ *
+ * given:
+ *	index		pointer to a JSON semantic index
+ *	depth		JSON parse tree node depth
+ *	type		type of JSON node
+ *	name		JTYPE_MEMBER name or NULL ==> any name
+ *	name_len	length of name (not including final NUL) or 0
+ *
+ * returns:
+ *	pointer to the slot holding the key, or to the empty slot where it belongs
+ */
+static struct json_sem_slot *
+sem_slot(struct json_sem_index *index, unsigned int depth, enum item_type type, char const *name, size_t name_len)
+{
+    struct json_sem_slot *slot;	/* slot being probed */
+    uint32_t hash;		/* hash of the key */
+    size_t i;
+
+    /*
+     * linear probe from the hashed slot
+     *
+     * NOTE: json_sem_index_create() keeps at least half of the slots empty.
+     */
+    hash = sem_hash(depth, type, name, name_len);
+    for (i = (size_t)hash & index->mask; ; i = (i+1) & index->mask) {
+	slot = &(index->slot[i]);
+	if (slot->first < 0) {
+	    break;	/* empty slot */
+	}
+	if (slot->hash == hash && slot->depth == depth && slot->type == type &&
+	    (slot->name == NULL) == (name == NULL) && slot->name_len == name_len &&
+	    (name == NULL || memcmp(slot->name, name, name_len) == 0)) {
+	    break;	/* key found */
+	}
+    }
+    return slot;
+}
+
+
+/*
+ * json_sem_index_create - index a JSON semantic table
+ *
+ * The index depends on the depth, type and name of each JSON semantic node,
+ * but not on the counts, so it remains valid after json_sem_zero_count().
+ *
+ * given:
+ *	sem		pointer to a JSON semantic table (ends with a JTYPE_UNSET JSON type)
+ *
+ * returns:
+ *	malloced JSON semantic index, or NULL ==> NULL sem or calloc failure
+ *
+ * NOTE: Use json_sem_index_free() to free the returned index.
+ */
+struct json_sem_index *
+json_sem_index_create(struct json_sem *sem)
+{
+    struct json_sem_index *index = NULL;	/* JSON semantic index */
+    struct json_sem_slot *slot = NULL;		/* slot of a key */
+    size_t len = 0;				/* length of sem[i].name */
+    size_t slots;				/* number of slots */
+    int i;
+
+    /*
+     * firewall - args
+     */
+    if (sem == NULL) {
+	warn(__func__, "sem is NULL");
+	return NULL;
+    }
+
+    /*
+     * size the hash table: each JSON semantic node adds at most 2 keys,
+     * and we keep at least half of the slots empty
+     */
+    for (i=0; sem[i].type != JTYPE_UNSET; ++i) {
+	/* count JSON semantic nodes */
+    }
+    for (slots = 16; slots < (size_t)i * 4; slots <<= 1) {
+	/* round up to a power of 2 */
+    }
+
+    /*
+     * allocate the index
+     */
+    index = calloc(1, sizeof(*index));
+    if (index == NULL) {
+	warnp(__func__, "calloc of JSON semantic index failed");
+	return NULL;
+    }
+    index->slot = calloc(slots, sizeof(*(index->slot)));
+    if (index->slot == NULL) {
+	warnp(__func__, "calloc of %zu JSON semantic index slots failed", slots);
+	free(index);
+	return NULL;
+    }
+    index->sem = sem;
+    index->mask = slots - 1;
+    for (i=0; (size_t)i < slots; ++i) {
+	index->slot[i].first = -1;
+	index->slot[i].wild = -1;
+    }
+
+    /*
+     * index the JSON semantic table, keeping the first match of each key
+     */
+    for (i=0; sem[i].type != JTYPE_UNSET; ++i) {
+
+	/*
+	 * key: any node of this depth and type
+	 */
+	slot = sem_slot(index, sem[i].depth, sem[i].type, NULL, 0);
+	if (slot->first < 0) {
+	    slot->first = i;
+	    slot->depth = sem[i].depth;
+	    slot->type = sem[i].type;
+	    slot->hash = sem_hash(sem[i].depth, sem[i].type, NULL, 0);
+	}
+	if (sem[i].type == JTYPE_MEMBER && sem[i].name_len == 0 && slot->wild < 0) {
+	    slot->wild = i;
+	}
+
+	/*
+	 * key: JTYPE_MEMBER of this depth with this name
+	 */
+	if (sem[i].type == JTYPE_MEMBER && sem[i].name_len > 0 && sem[i].name != NULL) {
+	    len = strlen(sem[i].name);
+	    slot = sem_slot(index, sem[i].depth, sem[i].type, sem[i].name, len);
+	    if (slot->first < 0) {
+		slot->first = i;
+		slot->depth = sem[i].depth;
+		slot->type = sem[i].type;
+		slot->name = sem[i].name;
+		slot->name_len = len;
+		slot->hash = sem_hash(sem[i].depth, sem[i].type, sem[i].name, len);
+	    }
+	}
+    }
+    return index;
+}
+
+
+/*
+ * json_sem_index_free - free a JSON semantic index
+ *
+ * given:
+ *	index		JSON semantic index from json_sem_index_create() or NULL
+ *
+ * NOTE: This function does nothing if index == NULL.
+ */
+void
+json_sem_index_free(struct json_sem_index *index)
+{
+    if (index == NULL) {
+	return;
+    }
+    if (index->slot != NULL) {
+	free(index->slot);
+	index->slot = NULL;
+    }
+    free(index);
+    return;
+}
+
+
+/*
+ * json_sem_index_find - given JSON node, find first match in an indexed JSON semantic table
+ *
+ * This function finds the same match as json_sem_find(), using the index
+ * instead of scanning the JSON semantic table.
+ *
+ * given:
+ *	node		pointer to a JSON parse tree
+ *	depth		depth of node in the JSON parse tree (0 ==> tree root)
+ *	index		JSON semantic index from json_sem_index_create()
+ *
+ * returns:
+ *	>=0 ==> index into JSON semantic table for first match
+ *	-1  ==> no JSON semantic table match found
+ *	< -1 ==> invalid JSON node, or NULL ptr, or internal error
+ */
+int
+json_sem_index_find(struct json *node, unsigned int depth, struct json_sem_index *index)
+{
+    struct json_sem_slot *any = NULL;	/* slot for any node of this depth and type */
+    struct json_sem_slot *named = NULL;	/* slot for JTYPE_MEMBER of this depth and name */
+    char *name = NULL;			/* name of JTYPE_MEMBER node or NULL */
+    int ret;
+
+    /*
+     * firewall - args
+     */
+    if (index == NULL) {
+	warn(__func__, "index is NULL");
+	return -5;
+    }
+
+    /*
+     * obtain information about the JSON node
+     */
+    ret = sem_node_info(node, depth, index->sem, &name, __func__);
+    if (ret < 0) {
+	return ret;
+    }
+
+    /*
+     * case: non-JTYPE_MEMBER or JTYPE_MEMBER w/o name - first node of this depth and type
+     */
+    any = sem_slot(index, depth, node->type, NULL, 0);
+    if (node->type != JTYPE_MEMBER || name == NULL || any->first < 0) {
+	return any->first;
+    }
+
+    /*
+     * case: JTYPE_MEMBER - the earlier of the first name match and the first unnamed JTYPE_MEMBER
+     */
+    named = sem_slot(index, depth, JTYPE_MEMBER, name, strlen(name));
+    if (named->first < 0) {
+	return any->wild;
+    }
+    if (any->wild >= 0 && any->wild < named->first) {
+	return any->wild;
+    }
+    return named->first;
+}
+
+
 /*
  * sem_walk - JSON parse tree semantic tree check walk
  *
@@ -1956,6 +2255,7 @@ json_sem_find(struct json *node, unsigned int depth, struct json_sem *sem)
  *		sem		JSON semantic table (ends with a JTYPE_UNSET JSON type)
  *		count_err	dynamic array of JSON semantic count errors
  *		val_err		dynamic array of JSON semantic validation errors
+ *		index		JSON semantic index of sem, or NULL ==> scan sem
  *
  * NOTE: This function does nothing if node == NULL.
  *
@@ -1968,6 +2268,7 @@ sem_walk(struct json *node, unsigned int depth, va_list ap)
     struct json_sem *sem = NULL;	/* JSON semantic table (ends with a JTYPE_UNSET JSON type) */
     struct dyn_array *count_err = NULL;	/* dynamic array of JSON semantic count errors */
     struct dyn_array *val_err = NULL;	/* dynamic array of JSON semantic validation errors */
+    struct json_sem_index *sem_index = NULL; /* JSON semantic index of sem or NULL */
     bool test = false;			/* validation test result */
     struct json_sem_val_err *error = NULL;/* pointer to semantic validation error */
     struct json_sem_count_err count;	/* semantic count error */
@@ -2003,11 +2304,16 @@ sem_walk(struct json *node, unsigned int depth, va_list ap)
 	va_end(ap2); /* stdarg variable argument list cleanup */
 	return;
     }
+    sem_index = va_arg(ap2, struct json_sem_index *);
 
     /*
      * search for node match in the semantic table
      */
-    index = json_sem_find(node, depth, sem);
+    if (sem_index != NULL) {
+	index = json_sem_index_find(node, depth, sem_index);
+    } else {
+	index = json_sem_find(node, depth, sem);
+    }
 
     /*
      * process search result
@@ -2143,6 +2449,7 @@ sem_walk(struct json *node, unsigned int depth, va_list ap)
  * is used.
  *
  * We then walk the JSON parse tree and check each node against the JSON semantic table,
+ * using a json_sem_index_create() index of the table,
  * counting as nodes on the first match found in the JSON semantic table,
  * or appending a JSON semantic count error to the *pcount_err dynamic array
  * when an unknown JSON node is found.
@@ -2190,6 +2497,7 @@ json_sem_check(struct json *node, unsigned int max_depth, struct json_sem *sem,
 {
     struct dyn_array *count_err = NULL;		/* JSON semantic count errors */
     struct dyn_array *val_err = NULL;		/* JSON semantic validation errors */
+    struct json_sem_index *index = NULL;	/* JSON semantic index of sem */
     uintmax_t errors = 0;			/* number of errors (count+validation+internal) */
 
     /*
@@ -2266,10 +2574,19 @@ json_sem_check(struct json *node, unsigned int max_depth, struct json_sem *sem,
      */
     sem->data = data;
 
+    /*
+     * index the semantic table so that each JSON node is found without a table scan
+     *
+     * NOTE: If the index cannot be created, sem_walk() scans the table instead.
+     */
+    index = json_sem_index_create(sem);
+
     /*
      * perform a semantic scan of the JSON parse tree
      */
-    json_tree_walk(node, max_depth, 0, true, sem_walk, sem, count_err, val_err);
+    json_tree_walk(node, max_depth, 0, true, sem_walk, sem, count_err, val_err, index);
+    json_sem_index_free(index);
+    index = NULL;
 
     /*
      * check semantic table counts
@@ -2403,7 +2720,8 @@ fprint_count_err(FILE *stream, char const *prefix, struct json_sem_count_err *se
 	warn(__func__, "stream is NULL");
 	return;
     }
-    if (fd_is_ready(__func__, true, fileno(stream)) == false) {
+    /* a stream without a file descriptor, such as from open_memstream(3), is always ready */
+    if (fileno(stream) >= 0 && fd_is_ready(__func__, true, fileno(stream)) == false) {
 	warn(__func__, "stream is is not an open FILE *stream");
 	return;
     }
@@ -2548,7 +2866,8 @@ fprint_val_err(FILE *stream, char const *prefix, struct json_sem_val_err *sem_va
 	warn(__func__, "stream is NULL");
 	return;
     }
-    if (fd_is_ready(__func__, true, fileno(stream)) == false) {
+    /* a stream without a file descriptor, such as from open_memstream(3), is always ready */
+    if (fileno(stream) >= 0 && fd_is_ready(__func__, true, fileno(stream)) == false) {
 	warn(__func__, "stream is is not an open FILE *stream");
 	return;
     }
@@ -141,6 +141,39 @@ struct json_sem
 };
 
 
+/*
+ * JSON semantic table index slot
+ *
+ * A slot with a NULL name covers every JSON semantic node of a given
+ * depth and type.  A slot with a non-NULL name covers the JTYPE_MEMBER
+ * JSON semantic nodes of a given depth with that name.
+ */
+struct json_sem_slot
+{
+    int first;			/* index of first matching JSON semantic node, -1 ==> empty slot */
+    int wild;			/* if name == NULL, index of first JTYPE_MEMBER w/o a name, or -1 */
+    unsigned int depth;		/* JSON parse tree node depth */
+    enum item_type type;	/* type of JSON node */
+    uint32_t hash;		/* hash of depth, type and name */
+    char const *name;		/* JTYPE_MEMBER name or NULL ==> any name */
+    size_t name_len;		/* length of name (not including final NUL) or 0 */
+};
+
+/*
+ * JSON semantic table index
+ *
+ * An open addressing hash index over a JSON semantic table, keyed by
+ * (depth, type, name), that finds the same match as a json_sem_find()
+ * scan of the table without scanning the table.
+ */
+struct json_sem_index
+{
+    struct json_sem *sem;	/* indexed JSON semantic table */
+    size_t mask;		/* number of slots - 1 (number of slots is a power of 2) */
+    struct json_sem_slot *slot;	/* hash table of slots */
+};
+
+
 /*
  * str_or_null - report if a JSON JTYPE_MEMBER value is a valid JSON_STRING or a valid JSON_NULL
  *
@@ -196,6 +229,9 @@ extern struct json *sem_object_find_name(struct json const *node, unsigned int d
 				         char const *memname);
 extern void json_sem_zero_count(struct json_sem *sem);
 extern int json_sem_find(struct json *node, unsigned int depth, struct json_sem *sem);
+extern struct json_sem_index *json_sem_index_create(struct json_sem *sem);
+extern void json_sem_index_free(struct json_sem_index *index);
+extern int json_sem_index_find(struct json *node, unsigned int depth, struct json_sem_index *index);
 extern void json_sem_count_chk(struct json_sem *sem, struct dyn_array *count_err);
 extern uintmax_t json_sem_check(struct json *node, unsigned int max_depth, struct json_sem *sem,
 				struct dyn_array **pcount_err, struct dyn_array **pval_err, void *data);
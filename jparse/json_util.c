@@ -115,9 +115,9 @@ static void fprstring(FILE *stream, struct json_string *item);
 static void fprboolean(FILE *stream, struct json_boolean *item);
 static void fprnull(FILE *stream, struct json_null *item);
 static void fprmember(FILE *stream, struct json_member *item);
-static void fprobject(FILE *stream, struct json_object *item);
-static void fprarray(FILE *stream, struct json_array *item);
-static void fprelements(FILE *stream, struct json_elements *item);
+static void fprobject(FILE *stream, struct json_object *item, bool arena);
+static void fprarray(FILE *stream, struct json_array *item, bool arena);
+static void fprelements(FILE *stream, struct json_elements *item, bool arena);
 
 
 /*
@@ -1172,6 +1172,9 @@ vjson_free(struct json *node, unsigned int depth, va_list ap)
 
     /*
      * free internals based in node type
+     *
+     * NOTE: The internals of a node in a JSON parse tree arena belong to the
+     *	     arena, so they are only zeroized.
      */
     switch (node->type) {
 
@@ -1186,7 +1189,7 @@ vjson_free(struct json *node, unsigned int depth, va_list ap)
 	    struct json_number *item = &(node->item.number);
 
 	    /* free internal storage */
-	    if (item->as_str != NULL) {
+	    if (item->as_str != NULL && node->arena == NULL) {
 		free(item->as_str);
 		item->as_str = NULL;
 	    }
@@ -1203,11 +1206,11 @@ vjson_free(struct json *node, unsigned int depth, va_list ap)
 	    struct json_string *item = &(node->item.string);
 
 	    /* free internal storage */
-	    if (item->as_str != NULL) {
+	    if (item->as_str != NULL && node->arena == NULL) {
 		free(item->as_str);
 		item->as_str = NULL;
 	    }
-	    if (item->str != NULL) {
+	    if (item->str != NULL && node->arena == NULL) {
 		free(item->str);
 		item->str = NULL;
 	    }
@@ -1224,7 +1227,7 @@ vjson_free(struct json *node, unsigned int depth, va_list ap)
 	    struct json_boolean *item = &(node->item.boolean);
 
 	    /* free internal storage */
-	    if (item->as_str != NULL) {
+	    if (item->as_str != NULL && node->arena == NULL) {
 		free(item->as_str);
 		item->as_str = NULL;
 	    }
@@ -1241,7 +1244,7 @@ vjson_free(struct json *node, unsigned int depth, va_list ap)
 	    struct json_null *item = &(node->item.null);
 
 	    /* free internal storage */
-	    if (item->as_str != NULL) {
+	    if (item->as_str != NULL && node->arena == NULL) {
 		free(item->as_str);
 		item->as_str = NULL;
 	    }
@@ -1355,6 +1358,11 @@ vjson_free(struct json *node, unsigned int depth, va_list ap)
  * NOTE: This function will free the internals of a JSON parser tree node.
  *	 It is up to the caller to free the top level struct json if needed.
  *
+ * NOTE: When node is the root of a JSON parse tree in an arena (see
+ *	 json_tree_arena), the arena is freed instead of walking the tree.
+ *	 For any other node in an arena this function does nothing: its
+ *	 storage is freed with the arena.
+ *
  * NOTE: If the pointer to allocated storage == NULL,
  *	 this function does nothing.
  *
@@ -1366,6 +1374,7 @@ void
 json_tree_free(struct json *node, unsigned int max_depth, ...)
 {
     va_list ap;		/* variable argument list */
+    struct json_arena *arena = NULL;	/* JSON parse tree arena of node */
 
     /*
      * firewall - nothing to do for a NULL node
@@ -1374,6 +1383,24 @@ json_tree_free(struct json *node, unsigned int max_depth, ...)
 	return;
     }
 
+    /*
+     * case: JSON parse tree in an arena
+     *
+     * The tree is freed by releasing its arena, without walking the tree.
+     * Nodes below the root belong to the arena and are not freed on their own.
+     */
+    if (node->arena != NULL) {
+	arena = node->arena;
+	if (arena->root == node) {
+	    memset(&(node->item), 0, sizeof(node->item));
+	    node->type = JTYPE_UNSET;
+	    node->parent = NULL;
+	    node->arena = NULL;
+	    json_arena_free(arena);
+	}
+	return;
+    }
+
     /*
      * stdarg variable argument list setup
      */
@@ -1502,6 +1529,11 @@ fprnumber(FILE *stream, char *prestr, struct json_number *item, char *midstr, ch
 	poststr = "((NULL poststr))";
     }
 
+    /*
+     * convert the JSON number if it was parsed in lazy mode
+     */
+    (void) json_number_convert(item);
+
     /*
      * print the first prestr
      */
@@ -1887,9 +1919,10 @@ fprmember(FILE *stream, struct json_member *item)
  * given:
  *	stream	    open stream on which to print information about a json_object
  *	item	    pointer to struct json_object for which to print in stream
+ *	arena	    true ==> item is in a JSON parse tree arena, so it has no dynamic array
  */
 static void
-fprobject(FILE *stream, struct json_object *item)
+fprobject(FILE *stream, struct json_object *item, bool arena)
 {
     /*
      * firewall
@@ -1915,7 +1948,7 @@ fprobject(FILE *stream, struct json_object *item)
         if (item->set == NULL) {
             fprstr(stream, "\tWarning: set == NULL");
         }
-        if (item->s == NULL) {
+        if (item->s == NULL && !arena) {
             fprstr(stream, "\tWarning: s == NULL");
         }
 
@@ -1945,9 +1978,10 @@ fprobject(FILE *stream, struct json_object *item)
  * given:
  *	stream	    open stream on which to print information about a json_array
  *	item	    pointer to struct json_array for which to print in stream
+ *	arena	    true ==> item is in a JSON parse tree arena, so it has no dynamic array
  */
 static void
-fprarray(FILE *stream, struct json_array *item)
+fprarray(FILE *stream, struct json_array *item, bool arena)
 {
     /*
      * firewall
@@ -1973,7 +2007,7 @@ fprarray(FILE *stream, struct json_array *item)
         if (item->set == NULL) {
             fprstr(stream, "\tWarning: set == NULL");
         }
-        if (item->s == NULL) {
+        if (item->s == NULL && !arena) {
             fprstr(stream, "\tWarning: s == NULL");
         }
 
@@ -2004,9 +2038,10 @@ fprarray(FILE *stream, struct json_array *item)
  * given:
  *	stream	    open stream on which to print information about a json_element
  *	item	    pointer to struct json_element for which to print in stream
+ *	arena	    true ==> item is in a JSON parse tree arena, so it has no dynamic array
  */
 static void
-fprelements(FILE *stream, struct json_elements *item)
+fprelements(FILE *stream, struct json_elements *item, bool arena)
 {
     /*
      * firewall
@@ -2032,7 +2067,7 @@ fprelements(FILE *stream, struct json_elements *item)
         if (item->set == NULL) {
             fprstr(stream, "\tWarning: set == NULL");
         }
-        if (item->s == NULL) {
+        if (item->s == NULL && !arena) {
             fprstr(stream, "\tWarning: s == NULL");
         }
 
@@ -2125,6 +2160,13 @@ vjson_fprint(struct json *node, unsigned int depth, va_list ap)
 	return;
     }
 
+    /*
+     * convert a number parsed in lazy mode before printing any of the node
+     */
+    if (node->type == JTYPE_NUMBER) {
+	(void) json_number_convert(&(node->item.number));
+    }
+
     /*
      * print debug header
      */
@@ -2215,7 +2257,7 @@ vjson_fprint(struct json *node, unsigned int depth, va_list ap)
 	{
 	    struct json_object *item = &(node->item.object);
 
-            fprobject(stream, item);
+            fprobject(stream, item, node->arena != NULL);
 	}
 	break;
 
@@ -2223,7 +2265,7 @@ vjson_fprint(struct json *node, unsigned int depth, va_list ap)
 	{
 	    struct json_array *item = &(node->item.array);
 
-            fprarray(stream, item);
+            fprarray(stream, item, node->arena != NULL);
 	}
 	break;
 
@@ -2231,7 +2273,7 @@ vjson_fprint(struct json *node, unsigned int depth, va_list ap)
 	{
 	    struct json_elements *item = &(node->item.elements);
 
-            fprelements(stream, item);
+            fprelements(stream, item, node->arena != NULL);
 	}
 	break;
 
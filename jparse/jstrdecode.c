@@ -49,6 +49,7 @@
 #include <unistd.h>
 #include <string.h>
 #include <locale.h>
+#include <time.h>
 
 /*
  * jstrdecode - tool to JSON decode JSON encoded strings
@@ -60,6 +61,8 @@
  * definitions
  */
 #define REQUIRED_ARGS (0)	/* number of required arguments on the command line */
+#define BENCH_ROUNDS (4)	/* -B: number of times each corpus is decoded */
+#define BENCH_MAX_MIB (1024)	/* -B: maximum MiB per corpus */
 
 /*
  * usage message
@@ -67,7 +70,7 @@
  * Use the usage() function to print the usage_msg([0-9]?)+ strings.
  */
 static const char * const usage_msg =
-    "usage: %s [-h] [-v level] [-j] [-J level] [-q] [-V] [-t] [-n] [-N] [-Q] [-e] [-d] [-E level] [arg ...]\n"
+    "usage: %s [-h] [-v level] [-j] [-J level] [-q] [-V] [-t] [-B mib] [-n] [-N] [-Q] [-e] [-d] [-E level] [arg ...]\n"
     "\n"
     "\t-h\t\tprint help message and exit\n"
     "\t-v level\tset verbosity level (def level: %d)\n"
@@ -77,6 +80,7 @@ static const char * const usage_msg =
     "\t-q\t\tquiet mode: silence msg(), warn(), warnp() if -v 0 (def: loud :-) )\n"
     "\t-V\t\tprint version string and exit\n"
     "\t-t\t\tperform tests of JSON decode/encode functionality\n"
+    "\t-B mib\t\tbenchmark decoding of escape-dense and ASCII-only corpora of mib MiB each, and exit\n"
     "\t-n\t\tdo not output newline after decode output\n"
     "\t-N\t\tignore all newline characters in input\n"
     "\t-Q\t\tenclose output in double quotes (def: do not)\n"
@@ -107,6 +111,8 @@ static const char * const usage_msg =
 static void usage(int exitcode, char const *prog, char const *str) __attribute__((noreturn));
 static struct jstring *jstrdecode_stream(FILE *in_stream, bool ignore_nl, bool quote, bool json_parse);
 static struct jstring *add_decoded_string(char *string, size_t bufsiz);
+static void bench_corpus(char const *prog, char const *name, char const *pattern, size_t size);
+static void jstrdecode_bench(char const *prog, size_t mib);
 
 /*
  * decoded string list
@@ -358,6 +364,112 @@ jstrdecode_stream(FILE *in_stream, bool ignore_nl, bool quote, bool json_parse)
 }
 
 
+/*
+ * bench_corpus - benchmark json_decode() on a corpus
+ *
+ * The corpus is filled by repeating a JSON encoded pattern, then decoded
+ * BENCH_ROUNDS times.  The decode rate, in MB/s of encoded input, is printed.
+ *
+ * given:
+ *	prog	    - program name
+ *	name	    - name of the corpus
+ *	pattern	    - JSON encoded pattern to repeat
+ *	size	    - size of the corpus in bytes
+ *
+ * NOTE: This function does not return on error.
+ */
+static void
+bench_corpus(char const *prog, char const *name, char const *pattern, size_t size)
+{
+    struct timespec start;	/* time before decoding */
+    struct timespec stop;	/* time after decoding */
+    char *corpus = NULL;	/* JSON encoded corpus */
+    char *buf = NULL;		/* decoded corpus */
+    size_t patlen;		/* length of pattern */
+    size_t len;			/* length of the corpus, a multiple of patlen */
+    size_t bufsiz = 0;		/* length of decoded corpus */
+    size_t off;			/* offset of the next pattern copy */
+    double secs;		/* seconds spent decoding */
+    int round;
+
+    /*
+     * firewall
+     */
+    if (prog == NULL || name == NULL || pattern == NULL) {
+	err(15, __func__, "called with NULL arg(s)");
+	not_reached();
+    }
+
+    /*
+     * form the corpus from whole copies of the pattern
+     */
+    patlen = strlen(pattern);
+    len = size - (size % patlen);
+    if (len == 0) {
+	len = patlen;
+    }
+    errno = 0;			/* pre-clear errno for errp() */
+    corpus = malloc(len + 1);
+    if (corpus == NULL) {
+	errp(16, __func__, "malloc of %zu bytes failed", len + 1);
+	not_reached();
+    }
+    for (off = 0; off < len; off += patlen) {
+	memcpy(corpus + off, pattern, patlen);
+    }
+    corpus[len] = '\0';
+
+    /*
+     * decode the corpus
+     */
+    (void) clock_gettime(CLOCK_MONOTONIC, &start);
+    for (round = 0; round < BENCH_ROUNDS; ++round) {
+	buf = json_decode(corpus, len, false, &bufsiz);
+	if (buf == NULL) {
+	    err(17, __func__, "json_decode of the %s corpus failed", name);
+	    not_reached();
+	}
+	free(buf);
+	buf = NULL;
+    }
+    (void) clock_gettime(CLOCK_MONOTONIC, &stop);
+    secs = (double)(stop.tv_sec - start.tv_sec) + (double)(stop.tv_nsec - start.tv_nsec) / 1e9;
+
+    /*
+     * report the decode rate
+     */
+    print("%s: %s corpus: %zu bytes decoded into %zu bytes %d times in %.6f sec: %.1f MB/s\n",
+	  prog, name, len, bufsiz, BENCH_ROUNDS, secs,
+	  (secs > 0.0) ? ((double)len * BENCH_ROUNDS / secs / 1e6) : 0.0);
+    free(corpus);
+    corpus = NULL;
+    return;
+}
+
+
+/*
+ * jstrdecode_bench - benchmark json_decode()
+ *
+ * given:
+ *	prog	    - program name
+ *	mib	    - size of each corpus in MiB
+ *
+ * NOTE: This function does not return on error.
+ */
+static void
+jstrdecode_bench(char const *prog, size_t mib)
+{
+    /*
+     * every byte of the escape-dense pattern is part of a \-escape
+     */
+    bench_corpus(prog, "escape-dense",
+		 "\\n\\t\\\"\\\\\\/\\u00e9\\u20ac\\ud83d\\udd25\\r\\u0041", mib * 1024 * 1024);
+    bench_corpus(prog, "ASCII-only",
+		 "The quick brown fox jumps over the lazy dog. 0123456789 ", mib * 1024 * 1024);
+    return;
+}
+
+
 int
 main(int argc, char **argv)
 {
@@ -384,6 +496,7 @@ main(int argc, char **argv)
     struct jstring *jstr = NULL;    /* decoded string */
     char *dup_input = NULL;	/* duplicate of arg string */
     bool opt_error = false;	/* fchk_inval_opt() return */
+    size_t bench_mib = 0;	/* -B: MiB per benchmark corpus, 0 ==> do not benchmark */
 
     /*
      * use default locale based on LANG
@@ -394,7 +507,7 @@ main(int argc, char **argv)
      * parse args
      */
     program = argv[0];
-    while ((i = getopt(argc, argv, ":hv:jJ:qVtnNQedE:")) != -1) {
+    while ((i = getopt(argc, argv, ":hv:jJ:qVtB:nNQedE:")) != -1) {
 	switch (i) {
 	case 'h':		/* -h - print help to stderr and exit 2 */
 	    usage(2, program, ""); /*ooo*/
@@ -460,6 +573,13 @@ main(int argc, char **argv)
 	    exit(0); /*ooo*/
 	    not_reached();
 	    break;
+	case 'B':		/* -B mib - benchmark json_decode() */
+	    bench_mib = (size_t)strtoul(optarg, NULL, 10);
+	    if (bench_mib == 0 || bench_mib > BENCH_MAX_MIB) {
+		usage(3, program, "invalid -B mib"); /*ooo*/
+		not_reached();
+	    }
+	    break;
 	case 'n':
 	    nloutput = false;
 	    break;
@@ -494,6 +614,15 @@ main(int argc, char **argv)
         usage(3, program, "-j and -d cannot be used together"); /*ooo*/
         not_reached();
     }
+
+    /*
+     * case: -B benchmark
+     */
+    if (bench_mib > 0) {
+	jstrdecode_bench(program, bench_mib);
+	exit(0); /*ooo*/
+	not_reached();
+    }
     dbg(DBG_LOW, "argc: %d", argc);
     dbg(DBG_LOW, "optind: %d", optind);
     dbg(DBG_LOW, "arg count: %d", argc - optind);
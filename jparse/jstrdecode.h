@@ -106,7 +106,7 @@
 /*
  * official jstrdecode version
  */
-#define JSTRDECODE_VERSION "2.2.3 2025-06-26"	/* format: major.minor YYYY-MM-DD */
+#define JSTRDECODE_VERSION "2.2.4 2026-10-18"	/* format: major.minor YYYY-MM-DD */
 
 
 /*
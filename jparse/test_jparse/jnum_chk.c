@@ -70,7 +70,7 @@
  * Use the usage() function to print the usage_msg([0-9]?)+ strings.
  */
 static const char * const usage_msg =
-    "usage: %s [-h] [-v level] [-J level] [-V] [-q] [-S]\n"
+    "usage: %s [-h] [-v level] [-J level] [-V] [-q] [-S] [-L]\n"
     "\n"
     "\t-h\t\tprint help message and exit\n"
     "\t-v level\tset verbosity level (def level: %d)\n"
@@ -81,6 +81,8 @@ static const char * const usage_msg =
     "\t-S\t\tstrict testing for all struct json_number elements\n"
     "\t\t\t    (def: test only 8, 16, 32, 64 bit and max size signed and unsigned integer types)\n"
     "\t\t\t    (def: test floating point with match to only 1 part in 4.1943E+06)\n"
+    "\t-L\t\tlazy mode: defer conversion, then convert with json_number_convert() before testing\n"
+    "\t\t\t    (def: eager mode: convert when the JSON number is parsed)\n"
     "\n"
     "\tNOTE: the -S mode is for informational purposes only, and may fail\n"
     "\t      on your system due to hardware and/or other system differences.\n"
@@ -130,7 +132,7 @@ main(int argc, char *argv[])
      * parse args
      */
     program = argv[0];
-    while ((i = getopt(argc, argv, ":hv:J:VqS")) != -1) {
+    while ((i = getopt(argc, argv, ":hv:J:VqSL")) != -1) {
 	switch (i) {
 	case 'h':		/* -h - print help to stderr and exit 0 */
 	    usage(2, program, ""); /*ooo*/
@@ -171,6 +173,9 @@ main(int argc, char *argv[])
 	case 'S':		/* -S - strict mode */
 	    strict = true;
 	    break;
+	case 'L':		/* -L - lazy conversion mode */
+	    json_number_lazy = true;
+	    break;
 	case ':':   /* option requires an argument */
 	case '?':   /* illegal option */
 	default:    /* anything else but should not actually happen */
@@ -189,6 +194,7 @@ main(int argc, char *argv[])
 	usage(3, program, "wrong number of arguments"); /*ooo*/
     }
     dbg(DBG_MED, "strict mode: %s", (strict == true) ? "enabled" : "disabled");
+    dbg(DBG_MED, "lazy mode: %s", (json_number_lazy == true) ? "enabled" : "disabled");
 
     /*
      * process each test case
@@ -212,6 +218,18 @@ main(int argc, char *argv[])
 	}
 	item = &(node->item.number);
 
+	/*
+	 * if -L, the C values are converted by json_number_convert()
+	 */
+	if (json_number_lazy) {
+	    if (item->lazy == false && item->first != NULL) {
+		warn(__func__, "test %zu: lazy mode JSON number was converted when parsed: <%s>",
+			       testnum, test_set[testnum]);
+		error = true;
+	    }
+	    (void) json_number_convert(item);
+	}
+
 	/*
 	 * compare conversion with test case
 	 */
@@ -87,7 +87,7 @@
 /*
  * official jnum_chk version
  */
-#define JNUM_CHK_VERSION "2.0.2 2025-10-02"      /* format: major.minor YYYY-MM-DD */
+#define JNUM_CHK_VERSION "2.0.3 2026-10-18"      /* format: major.minor YYYY-MM-DD */
 
 
 /*
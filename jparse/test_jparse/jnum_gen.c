@@ -751,6 +751,14 @@ fpr_number(FILE *stream, struct json_number *item)
 	   "true ==> converted JSON floating point to C long double",
 	   "JSON floating point value in long double form",
 	   "if float_sized == true, true ==> as_float is an integer", "L");
+
+    /*
+     * print bool lazy
+     */
+    fprstr(stream, "\n");
+    fprint(stream, "\t%s,\t"
+		   "\t/* true ==> C values not yet converted, see json_number_convert() */\n",
+		   booltostr(item->lazy));
 }
 
 
@@ -620,6 +620,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[1]: -1e1000000000 */
@@ -711,6 +713,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[2]: -1.0e1000000000 */
@@ -802,6 +806,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[3]: -8589934594.0 */
@@ -893,6 +899,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-8589934594L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[4]: -8589934594.1 */
@@ -984,6 +992,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-8589934594.099999999627L,	/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[5]: -8589934594.2e2 */
@@ -1075,6 +1085,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-858993459420L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[6]: -8589934594.2E-4 */
@@ -1166,6 +1178,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-858993.4594200000000228L,	/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[7]: -8589934593.0 */
@@ -1257,6 +1271,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-8589934593L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[8]: -8589934593.1 */
@@ -1348,6 +1364,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-8589934593.099999999627L,	/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[9]: -8589934593.2e2 */
@@ -1439,6 +1457,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-858993459320L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[10]: -8589934593.2E-4 */
@@ -1530,6 +1550,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-858993.4593199999999911L,	/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[11]: -8589934592.0 */
@@ -1621,6 +1643,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-8589934592L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[12]: -8589934592.1 */
@@ -1712,6 +1736,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-8589934592.099999999627L,	/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[13]: -8589934592.2e2 */
@@ -1803,6 +1829,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-858993459220L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[14]: -8589934592.2E-4 */
@@ -1894,6 +1922,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-858993.4592200000000162L,	/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[15]: -8589934591.0 */
@@ -1985,6 +2015,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-8589934591L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[16]: -8589934591.1 */
@@ -2076,6 +2108,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-8589934591.100000000093L,	/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[17]: -8589934591.2e2 */
@@ -2167,6 +2201,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-858993459120L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[18]: -8589934591.2E-4 */
@@ -2258,6 +2294,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-858993.4591199999999844L,	/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[19]: -8589934590.0 */
@@ -2349,6 +2387,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-8589934590L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[20]: -8589934590.1 */
@@ -2440,6 +2480,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-8589934590.100000000093L,	/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[21]: -8589934590.2e2 */
@@ -2531,6 +2573,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-858993459020L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[22]: -8589934590.2E-4 */
@@ -2622,6 +2666,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-858993.4590200000000095L,	/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[23]: -4294967298.0 */
@@ -2713,6 +2759,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-4294967298L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[24]: -4294967298.1 */
@@ -2804,6 +2852,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-4294967298.100000000093L,	/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[25]: -4294967298.2e2 */
@@ -2895,6 +2945,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-429496729820L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[26]: -4294967298.2E-4 */
@@ -2986,6 +3038,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-429496.7298199999999895L,	/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[27]: -4294967297.0 */
@@ -3077,6 +3131,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-4294967297L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[28]: -4294967297.1 */
@@ -3168,6 +3224,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-4294967297.100000000093L,	/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[29]: -4294967297.2e2 */
@@ -3259,6 +3317,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-429496729720L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[30]: -4294967297.2E-4 */
@@ -3350,6 +3410,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-429496.7297199999999862L,	/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[31]: -4294967296.0 */
@@ -3441,6 +3503,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-4294967296L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[32]: -4294967296.1 */
@@ -3532,6 +3596,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-4294967296.100000000093L,	/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[33]: -4294967296.2e2 */
@@ -3623,6 +3689,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-429496729620L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[34]: -4294967296.2E-4 */
@@ -3714,6 +3782,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-429496.7296200000000113L,	/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[35]: -4294967295.0 */
@@ -3805,6 +3875,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-4294967295L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[36]: -4294967295.1 */
@@ -3896,6 +3968,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-4294967295.100000000093L,	/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[37]: -4294967295.2e2 */
@@ -3987,6 +4061,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-429496729520L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[38]: -4294967295.2E-4 */
@@ -4078,6 +4154,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-429496.7295200000000079L,	/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[39]: -4294967294.0 */
@@ -4169,6 +4247,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-4294967294L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[40]: -4294967294.1 */
@@ -4260,6 +4340,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-4294967294.100000000093L,	/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[41]: -4294967294.2e2 */
@@ -4351,6 +4433,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-429496729420L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[42]: -4294967294.2E-4 */
@@ -4442,6 +4526,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-429496.7294200000000046L,	/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[43]: -2147483650.0 */
@@ -4533,6 +4619,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-2147483650L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[44]: -2147483650.1 */
@@ -4624,6 +4712,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-2147483650.100000000093L,	/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[45]: -2147483650.2e2 */
@@ -4715,6 +4805,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-214748365020L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[46]: -2147483650.2E-4 */
@@ -4806,6 +4898,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-214748.3650200000000012L,	/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[47]: -2147483649.0 */
@@ -4897,6 +4991,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-2147483649L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[48]: -2147483649.1 */
@@ -4988,6 +5084,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-2147483649.100000000093L,	/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[49]: -2147483649.2e2 */
@@ -5079,6 +5177,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-214748364920L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[50]: -2147483649.2E-4 */
@@ -5170,6 +5270,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-214748.3649199999999979L,	/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[51]: -2147483648.0 */
@@ -5261,6 +5363,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-2147483648L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[52]: -2147483648.1 */
@@ -5352,6 +5456,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-2147483648.100000000093L,	/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[53]: -2147483648.2e2 */
@@ -5443,6 +5549,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-214748364820L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[54]: -2147483648.2E-4 */
@@ -5534,6 +5642,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-214748.3648199999999946L,	/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[55]: -2147483647.0 */
@@ -5625,6 +5735,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-2147483647L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[56]: -2147483647.1 */
@@ -5716,6 +5828,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-2147483647.099999999977L,	/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[57]: -2147483647.2e2 */
@@ -5807,6 +5921,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-214748364720L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[58]: -2147483647.2E-4 */
@@ -5898,6 +6014,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-214748.3647200000000055L,	/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[59]: -2147483646.0 */
@@ -5989,6 +6107,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-2147483646L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[60]: -2147483646.1 */
@@ -6080,6 +6200,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-2147483646.099999999977L,	/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[61]: -2147483646.2e2 */
@@ -6171,6 +6293,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-214748364620L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[62]: -2147483646.2E-4 */
@@ -6262,6 +6386,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-214748.3646200000000022L,	/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[63]: -131074.0 */
@@ -6353,6 +6479,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-131074L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[64]: -131074 */
@@ -6444,6 +6572,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[65]: -131074.1 */
@@ -6535,6 +6665,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-131074.0999999999999943L,	/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[66]: -131074.2e2 */
@@ -6626,6 +6758,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-13107420L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[67]: -131074.2E-4 */
@@ -6717,6 +6851,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-13.10741999999999999986L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[68]: -131073.0 */
@@ -6808,6 +6944,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-131073L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[69]: -131073 */
@@ -6899,6 +7037,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[70]: -131073.1 */
@@ -6990,6 +7130,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-131073.0999999999999943L,	/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[71]: -131073.2e2 */
@@ -7081,6 +7223,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-13107320L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[72]: -131073.2E-4 */
@@ -7172,6 +7316,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-13.1073199999999999996L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[73]: -131072.0 */
@@ -7263,6 +7409,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-131072L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[74]: -131072 */
@@ -7354,6 +7502,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[75]: -131072.1 */
@@ -7445,6 +7595,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-131072.0999999999999943L,	/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[76]: -131072.2e2 */
@@ -7536,6 +7688,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-13107220L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[77]: -131072.2E-4 */
@@ -7627,6 +7781,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-13.1072200000000000002L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[78]: -131071.0 */
@@ -7718,6 +7874,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-131071L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[79]: -131071 */
@@ -7809,6 +7967,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[80]: -131071.1 */
@@ -7900,6 +8060,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-131071.1000000000000014L,	/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[81]: -131071.2e2 */
@@ -7991,6 +8153,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-13107120L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[82]: -131071.2E-4 */
@@ -8082,6 +8246,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-13.10711999999999999994L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[83]: -131070.0 */
@@ -8173,6 +8339,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-131070L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[84]: -131070 */
@@ -8264,6 +8432,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[85]: -131070.1 */
@@ -8355,6 +8525,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-131070.1000000000000014L,	/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[86]: -131070.2e2 */
@@ -8446,6 +8618,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-13107020L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[87]: -131070.2E-4 */
@@ -8537,6 +8711,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-13.10701999999999999968L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[88]: -65538.0 */
@@ -8628,6 +8804,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-65538L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[89]: -65538 */
@@ -8719,6 +8897,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[90]: -65538.1 */
@@ -8810,6 +8990,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-65538.10000000000000142L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[91]: -65538.2e2 */
@@ -8901,6 +9083,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-6553820L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[92]: -65538.2E-4 */
@@ -8992,6 +9176,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-6.553819999999999999785L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[93]: -65537.0 */
@@ -9083,6 +9269,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-65537L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[94]: -65537 */
@@ -9174,6 +9362,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[95]: -65537.1 */
@@ -9265,6 +9455,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-65537.10000000000000142L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[96]: -65537.2e2 */
@@ -9356,6 +9548,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-6553720L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[97]: -65537.2E-4 */
@@ -9447,6 +9641,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-6.553719999999999999956L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[98]: -65536.0 */
@@ -9538,6 +9734,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-65536L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[99]: -65536 */
@@ -9629,6 +9827,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[100]: -65536.1 */
@@ -9720,6 +9920,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-65536.10000000000000142L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[101]: -65536.2e2 */
@@ -9811,6 +10013,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-6553620L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[102]: -65536.2E-4 */
@@ -9902,6 +10106,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-6.553620000000000000127L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[103]: -65535.0 */
@@ -9993,6 +10199,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-65535L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[104]: -65535 */
@@ -10084,6 +10292,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[105]: -65535.1 */
@@ -10175,6 +10385,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-65535.10000000000000142L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[106]: -65535.2e2 */
@@ -10266,6 +10478,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-6553520L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[107]: -65535.2E-4 */
@@ -10357,6 +10571,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-6.553519999999999999865L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[108]: -65534.0 */
@@ -10448,6 +10664,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-65534L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[109]: -65534 */
@@ -10539,6 +10757,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[110]: -65534.1 */
@@ -10630,6 +10850,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-65534.10000000000000142L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[111]: -65534.2e2 */
@@ -10721,6 +10943,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-6553420L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[112]: -65534.2E-4 */
@@ -10812,6 +11036,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-6.553420000000000000036L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[113]: -32770.0 */
@@ -10903,6 +11129,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-32770L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[114]: -32770 */
@@ -10994,6 +11222,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[115]: -32770.1 */
@@ -11085,6 +11315,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-32770.10000000000000142L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[116]: -32770.2e2 */
@@ -11176,6 +11408,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-3277020L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[117]: -32770.2E-4 */
@@ -11267,6 +11501,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-3.277019999999999999964L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[118]: -32769.0 */
@@ -11358,6 +11594,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-32769L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[119]: -32769 */
@@ -11449,6 +11687,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[120]: -32769.1 */
@@ -11540,6 +11780,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-32769.10000000000000142L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[121]: -32769.2e2 */
@@ -11631,6 +11873,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-3276920L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[122]: -32769.2E-4 */
@@ -11722,6 +11966,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-3.276919999999999999919L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[123]: -32768.0 */
@@ -11813,6 +12059,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-32768L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[124]: -32768 */
@@ -11904,6 +12152,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[125]: -32768.1 */
@@ -11995,6 +12245,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-32768.10000000000000142L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[126]: -32768.2e2 */
@@ -12086,6 +12338,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-3276820L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[127]: -32768.2E-4 */
@@ -12177,6 +12431,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-3.27682000000000000009L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[128]: -32767.0 */
@@ -12268,6 +12524,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-32767L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[129]: -32767 */
@@ -12359,6 +12617,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[130]: -32767.1 */
@@ -12450,6 +12710,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-32767.09999999999999964L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[131]: -32767.2e2 */
@@ -12541,6 +12803,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-3276720L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[132]: -32767.2E-4 */
@@ -12632,6 +12896,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-3.276720000000000000044L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[133]: -32766.0 */
@@ -12723,6 +12989,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-32766L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[134]: -32766 */
@@ -12814,6 +13082,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[135]: -32766.1 */
@@ -12905,6 +13175,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-32766.09999999999999964L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[136]: -32766.2e2 */
@@ -12996,6 +13268,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-3276620L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[137]: -32766.2E-4 */
@@ -13087,6 +13361,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-3.276619999999999999999L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[138]: -514.0 */
@@ -13178,6 +13454,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-514L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[139]: -514 */
@@ -13269,6 +13547,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[140]: -514.1 */
@@ -13360,6 +13640,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-514.0999999999999999778L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[141]: -514.2e2 */
@@ -13451,6 +13733,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-51420L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[142]: -514.2E-4 */
@@ -13542,6 +13826,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-0.05142000000000000000164L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[143]: -513.0 */
@@ -13633,6 +13919,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-513L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[144]: -513 */
@@ -13724,6 +14012,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[145]: -513.1 */
@@ -13815,6 +14105,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-513.0999999999999999778L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[146]: -513.2e2 */
@@ -13906,6 +14198,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-51320L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[147]: -513.2E-4 */
@@ -13997,6 +14291,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-0.05132000000000000000024L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[148]: -512.0 */
@@ -14088,6 +14384,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-512L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[149]: -512 */
@@ -14179,6 +14477,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[150]: -512.1 */
@@ -14270,6 +14570,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-512.0999999999999999778L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[151]: -512.2e2 */
@@ -14361,6 +14663,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-51220L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[152]: -512.2E-4 */
@@ -14452,6 +14756,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-0.05121999999999999999883L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[153]: -511.0 */
@@ -14543,6 +14849,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-511L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[154]: -511 */
@@ -14634,6 +14942,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[155]: -511.1 */
@@ -14725,6 +15035,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-511.1000000000000000056L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[156]: -511.2e2 */
@@ -14816,6 +15128,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-51120L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[157]: -511.2E-4 */
@@ -14907,6 +15221,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-0.05112000000000000000082L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[158]: -510.0 */
@@ -14998,6 +15314,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-510L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[159]: -510 */
@@ -15089,6 +15407,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[160]: -510.1 */
@@ -15180,6 +15500,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-510.1000000000000000056L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[161]: -510.2e2 */
@@ -15271,6 +15593,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-51020L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[162]: -510.2E-4 */
@@ -15362,6 +15686,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-0.05101999999999999999941L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[163]: -258.0 */
@@ -15453,6 +15779,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-258L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[164]: -258 */
@@ -15544,6 +15872,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[165]: -258.1 */
@@ -15635,6 +15965,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-258.1000000000000000056L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[166]: -258.2e2 */
@@ -15726,6 +16058,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-25820L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[167]: -258.2E-4 */
@@ -15817,6 +16151,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-0.02581999999999999999965L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[168]: -257.0 */
@@ -15908,6 +16244,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-257L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[169]: -257 */
@@ -15999,6 +16337,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[170]: -257.1 */
@@ -16090,6 +16430,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-257.1000000000000000056L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[171]: -257.2e2 */
@@ -16181,6 +16523,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-25720L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[172]: -257.2E-4 */
@@ -16272,6 +16616,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-0.02571999999999999999994L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[173]: -256.0 */
@@ -16363,6 +16709,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-256L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[174]: -256 */
@@ -16454,6 +16802,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[175]: -256.1 */
@@ -16545,6 +16895,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-256.1000000000000000056L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[176]: -256.2e2 */
@@ -16636,6 +16988,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-25620L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[177]: -256.2E-4 */
@@ -16727,6 +17081,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-0.02562000000000000000023L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[178]: -255.0 */
@@ -16818,6 +17174,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-255L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[179]: -255 */
@@ -16909,6 +17267,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[180]: -255.1 */
@@ -17000,6 +17360,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-255.1000000000000000056L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[181]: -255.2e2 */
@@ -17091,6 +17453,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-25520L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[182]: -255.2E-4 */
@@ -17182,6 +17546,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-0.02552000000000000000052L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[183]: -254.0 */
@@ -17273,6 +17639,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-254L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[184]: -254 */
@@ -17364,6 +17732,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[185]: -254.1 */
@@ -17455,6 +17825,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-254.1000000000000000056L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[186]: -254.2e2 */
@@ -17546,6 +17918,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-25420L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[187]: -254.2E-4 */
@@ -17637,6 +18011,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-0.02542000000000000000081L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[188]: -130.0 */
@@ -17728,6 +18104,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-130L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[189]: -130 */
@@ -17819,6 +18197,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[190]: -130.1 */
@@ -17910,6 +18290,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-130.1000000000000000056L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[191]: -130.2e2 */
@@ -18001,6 +18383,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-13020L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[192]: -130.2E-4 */
@@ -18092,6 +18476,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-0.01302000000000000000036L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[193]: -129.0 */
@@ -18183,6 +18569,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-129L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[194]: -129 */
@@ -18274,6 +18662,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[195]: -129.1 */
@@ -18365,6 +18755,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-129.1000000000000000056L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[196]: -129.2e2 */
@@ -18456,6 +18848,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-12920L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[197]: -129.2E-4 */
@@ -18547,6 +18941,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-0.0129199999999999999998L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[198]: -128.0 */
@@ -18638,6 +19034,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-128L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[199]: -128 */
@@ -18729,6 +19127,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[200]: -128.1 */
@@ -18820,6 +19220,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-128.1000000000000000056L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[201]: -128.2e2 */
@@ -18911,6 +19313,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-12820L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[202]: -128.2E-4 */
@@ -19002,6 +19406,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-0.01282000000000000000009L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[203]: -127.0 */
@@ -19093,6 +19499,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-127L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[204]: -127 */
@@ -19184,6 +19592,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[205]: -127.1 */
@@ -19275,6 +19685,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-127.0999999999999999986L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[206]: -127.2e2 */
@@ -19366,6 +19778,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-12720L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[207]: -127.2E-4 */
@@ -19457,6 +19871,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-0.01272000000000000000038L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[208]: -126.0 */
@@ -19548,6 +19964,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-126L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[209]: -126 */
@@ -19639,6 +20057,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[210]: -126.1 */
@@ -19730,6 +20150,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-126.0999999999999999986L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[211]: -126.2e2 */
@@ -19821,6 +20243,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-12620L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[212]: -126.2E-4 */
@@ -19912,6 +20336,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-0.01261999999999999999982L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[213]: -2.0 */
@@ -20003,6 +20429,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-2L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[214]: -2 */
@@ -20094,6 +20522,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[215]: -2.1 */
@@ -20185,6 +20615,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-2.099999999999999999913L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[216]: -2.2e2 */
@@ -20276,6 +20708,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-220L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[217]: -2.2E-4 */
@@ -20367,6 +20801,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-0.0002199999999999999999972L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[218]: -1.0 */
@@ -20458,6 +20894,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-1L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[219]: -1 */
@@ -20549,6 +20987,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[220]: -1.1 */
@@ -20640,6 +21080,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-1.100000000000000000022L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[221]: -1.2e2 */
@@ -20731,6 +21173,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-120L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[222]: -1.2E-4 */
@@ -20822,6 +21266,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	-0.0001200000000000000000027L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[223]: 0.0 */
@@ -20913,6 +21359,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	0L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[224]: 0 */
@@ -21004,6 +21452,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[225]: 0.1 */
@@ -21095,6 +21545,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	0.1000000000000000000014L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[226]: 0.2e2 */
@@ -21186,6 +21638,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	20L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[227]: 0.2E-4 */
@@ -21277,6 +21731,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	1.99999999999999999999e-05L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[228]: 1.0 */
@@ -21368,6 +21824,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	1L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[229]: 1 */
@@ -21459,6 +21917,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[230]: 1.1 */
@@ -21550,6 +22010,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	1.100000000000000000022L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[231]: 1.2e2 */
@@ -21641,6 +22103,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	120L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[232]: 1.2E-4 */
@@ -21732,6 +22196,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	0.0001200000000000000000027L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[233]: 2.0 */
@@ -21823,6 +22289,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	2L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[234]: 2 */
@@ -21914,6 +22382,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[235]: 2.1 */
@@ -22005,6 +22475,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	2.099999999999999999913L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[236]: 2.2e2 */
@@ -22096,6 +22568,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	220L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[237]: 2.2E-4 */
@@ -22187,6 +22661,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	0.0002199999999999999999972L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[238]: 126.0 */
@@ -22278,6 +22754,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	126L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[239]: 126 */
@@ -22369,6 +22847,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[240]: 126.1 */
@@ -22460,6 +22940,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	126.0999999999999999986L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[241]: 126.2e2 */
@@ -22551,6 +23033,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	12620L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[242]: 126.2E-4 */
@@ -22642,6 +23126,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	0.01261999999999999999982L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[243]: 127.0 */
@@ -22733,6 +23219,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	127L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[244]: 127 */
@@ -22824,6 +23312,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[245]: 127.1 */
@@ -22915,6 +23405,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	127.0999999999999999986L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[246]: 127.2e2 */
@@ -23006,6 +23498,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	12720L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[247]: 127.2E-4 */
@@ -23097,6 +23591,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	0.01272000000000000000038L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[248]: 128.0 */
@@ -23188,6 +23684,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	128L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[249]: 128 */
@@ -23279,6 +23777,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[250]: 128.1 */
@@ -23370,6 +23870,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	128.1000000000000000056L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[251]: 128.2e2 */
@@ -23461,6 +23963,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	12820L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[252]: 128.2E-4 */
@@ -23552,6 +24056,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	0.01282000000000000000009L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[253]: 129.0 */
@@ -23643,6 +24149,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	129L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[254]: 129 */
@@ -23734,6 +24242,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[255]: 129.1 */
@@ -23825,6 +24335,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	129.1000000000000000056L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[256]: 129.2e2 */
@@ -23916,6 +24428,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	12920L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[257]: 129.2E-4 */
@@ -24007,6 +24521,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	0.0129199999999999999998L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[258]: 130.0 */
@@ -24098,6 +24614,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	130L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[259]: 130 */
@@ -24189,6 +24707,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[260]: 130.1 */
@@ -24280,6 +24800,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	130.1000000000000000056L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[261]: 130.2e2 */
@@ -24371,6 +24893,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	13020L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[262]: 130.2E-4 */
@@ -24462,6 +24986,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	0.01302000000000000000036L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[263]: 254.0 */
@@ -24553,6 +25079,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	254L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[264]: 254 */
@@ -24644,6 +25172,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[265]: 254.1 */
@@ -24735,6 +25265,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	254.1000000000000000056L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[266]: 254.2e2 */
@@ -24826,6 +25358,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	25420L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[267]: 254.2E-4 */
@@ -24917,6 +25451,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	0.02542000000000000000081L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[268]: 255.0 */
@@ -25008,6 +25544,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	255L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[269]: 255 */
@@ -25099,6 +25637,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[270]: 255.1 */
@@ -25190,6 +25730,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	255.1000000000000000056L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[271]: 255.2e2 */
@@ -25281,6 +25823,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	25520L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[272]: 255.2E-4 */
@@ -25372,6 +25916,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	0.02552000000000000000052L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[273]: 256.0 */
@@ -25463,6 +26009,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	256L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[274]: 256 */
@@ -25554,6 +26102,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[275]: 256.1 */
@@ -25645,6 +26195,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	256.1000000000000000056L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[276]: 256.2e2 */
@@ -25736,6 +26288,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	25620L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[277]: 256.2E-4 */
@@ -25827,6 +26381,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	0.02562000000000000000023L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[278]: 257.0 */
@@ -25918,6 +26474,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	257L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[279]: 257 */
@@ -26009,6 +26567,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[280]: 257.1 */
@@ -26100,6 +26660,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	257.1000000000000000056L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[281]: 257.2e2 */
@@ -26191,6 +26753,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	25720L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[282]: 257.2E-4 */
@@ -26282,6 +26846,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	0.02571999999999999999994L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[283]: 258.0 */
@@ -26373,6 +26939,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	258L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[284]: 258 */
@@ -26464,6 +27032,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[285]: 258.1 */
@@ -26555,6 +27125,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	258.1000000000000000056L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[286]: 258.2e2 */
@@ -26646,6 +27218,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	25820L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[287]: 258.2E-4 */
@@ -26737,6 +27311,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	0.02581999999999999999965L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[288]: 510.0 */
@@ -26828,6 +27404,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	510L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[289]: 510 */
@@ -26919,6 +27497,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[290]: 510.1 */
@@ -27010,6 +27590,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	510.1000000000000000056L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[291]: 510.2e2 */
@@ -27101,6 +27683,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	51020L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[292]: 510.2E-4 */
@@ -27192,6 +27776,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	0.05101999999999999999941L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[293]: 511.0 */
@@ -27283,6 +27869,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	511L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[294]: 511 */
@@ -27374,6 +27962,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[295]: 511.1 */
@@ -27465,6 +28055,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	511.1000000000000000056L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[296]: 511.2e2 */
@@ -27556,6 +28148,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	51120L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[297]: 511.2E-4 */
@@ -27647,6 +28241,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	0.05112000000000000000082L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[298]: 512.0 */
@@ -27738,6 +28334,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	512L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[299]: 512 */
@@ -27829,6 +28427,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[300]: 512.1 */
@@ -27920,6 +28520,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	512.0999999999999999778L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[301]: 512.2e2 */
@@ -28011,6 +28613,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	51220L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[302]: 512.2E-4 */
@@ -28102,6 +28706,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	0.05121999999999999999883L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[303]: 513.0 */
@@ -28193,6 +28799,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	513L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[304]: 513 */
@@ -28284,6 +28892,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[305]: 513.1 */
@@ -28375,6 +28985,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	513.0999999999999999778L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[306]: 513.2e2 */
@@ -28466,6 +29078,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	51320L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[307]: 513.2E-4 */
@@ -28557,6 +29171,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	0.05132000000000000000024L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[308]: 514.0 */
@@ -28648,6 +29264,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	514L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[309]: 514 */
@@ -28739,6 +29357,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[310]: 514.1 */
@@ -28830,6 +29450,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	514.0999999999999999778L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[311]: 514.2e2 */
@@ -28921,6 +29543,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	51420L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[312]: 514.2E-4 */
@@ -29012,6 +29636,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	0.05142000000000000000164L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[313]: 32766.0 */
@@ -29103,6 +29729,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	32766L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[314]: 32766 */
@@ -29194,6 +29822,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[315]: 32766.1 */
@@ -29285,6 +29915,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	32766.09999999999999964L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[316]: 32766.2e2 */
@@ -29376,6 +30008,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	3276620L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[317]: 32766.2E-4 */
@@ -29467,6 +30101,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	3.276619999999999999999L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[318]: 32767.0 */
@@ -29558,6 +30194,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	32767L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[319]: 32767 */
@@ -29649,6 +30287,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[320]: 32767.1 */
@@ -29740,6 +30380,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	32767.09999999999999964L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[321]: 32767.2e2 */
@@ -29831,6 +30473,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	3276720L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[322]: 32767.2E-4 */
@@ -29922,6 +30566,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	3.276720000000000000044L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[323]: 32768.0 */
@@ -30013,6 +30659,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	32768L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[324]: 32768 */
@@ -30104,6 +30752,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[325]: 32768.1 */
@@ -30195,6 +30845,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	32768.10000000000000142L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[326]: 32768.2e2 */
@@ -30286,6 +30938,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	3276820L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[327]: 32768.2E-4 */
@@ -30377,6 +31031,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	3.27682000000000000009L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[328]: 32769.0 */
@@ -30468,6 +31124,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	32769L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[329]: 32769 */
@@ -30559,6 +31217,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[330]: 32769.1 */
@@ -30650,6 +31310,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	32769.10000000000000142L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[331]: 32769.2e2 */
@@ -30741,6 +31403,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	3276920L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[332]: 32769.2E-4 */
@@ -30832,6 +31496,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	3.276919999999999999919L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[333]: 32770.0 */
@@ -30923,6 +31589,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	32770L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[334]: 32770 */
@@ -31014,6 +31682,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[335]: 32770.1 */
@@ -31105,6 +31775,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	32770.10000000000000142L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[336]: 32770.2e2 */
@@ -31196,6 +31868,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	3277020L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[337]: 32770.2E-4 */
@@ -31287,6 +31961,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	3.277019999999999999964L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[338]: 65534.0 */
@@ -31378,6 +32054,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	65534L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[339]: 65534 */
@@ -31469,6 +32147,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[340]: 65534.1 */
@@ -31560,6 +32240,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	65534.10000000000000142L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[341]: 65534.2e2 */
@@ -31651,6 +32333,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	6553420L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[342]: 65534.2E-4 */
@@ -31742,6 +32426,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	6.553420000000000000036L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[343]: 65535.0 */
@@ -31833,6 +32519,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	65535L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[344]: 65535 */
@@ -31924,6 +32612,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[345]: 65535.1 */
@@ -32015,6 +32705,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	65535.10000000000000142L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[346]: 65535.2e2 */
@@ -32106,6 +32798,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	6553520L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[347]: 65535.2E-4 */
@@ -32197,6 +32891,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	6.553519999999999999865L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[348]: 65536.0 */
@@ -32288,6 +32984,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	65536L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[349]: 65536 */
@@ -32379,6 +33077,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[350]: 65536.1 */
@@ -32470,6 +33170,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	65536.10000000000000142L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[351]: 65536.2e2 */
@@ -32561,6 +33263,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	6553620L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[352]: 65536.2E-4 */
@@ -32652,6 +33356,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	6.553620000000000000127L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[353]: 65537.0 */
@@ -32743,6 +33449,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	65537L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[354]: 65537 */
@@ -32834,6 +33542,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[355]: 65537.1 */
@@ -32925,6 +33635,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	65537.10000000000000142L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[356]: 65537.2e2 */
@@ -33016,6 +33728,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	6553720L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[357]: 65537.2E-4 */
@@ -33107,6 +33821,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	6.553719999999999999956L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[358]: 65538.0 */
@@ -33198,6 +33914,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	65538L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[359]: 65538 */
@@ -33289,6 +34007,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[360]: 65538.1 */
@@ -33380,6 +34100,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	65538.10000000000000142L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[361]: 65538.2e2 */
@@ -33471,6 +34193,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	6553820L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[362]: 65538.2E-4 */
@@ -33562,6 +34286,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	6.553819999999999999785L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[363]: 131070.0 */
@@ -33653,6 +34379,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	131070L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[364]: 131070 */
@@ -33744,6 +34472,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[365]: 131070.1 */
@@ -33835,6 +34565,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	131070.1000000000000014L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[366]: 131070.2e2 */
@@ -33926,6 +34658,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	13107020L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[367]: 131070.2E-4 */
@@ -34017,6 +34751,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	13.10701999999999999968L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[368]: 131071.0 */
@@ -34108,6 +34844,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	131071L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[369]: 131071 */
@@ -34199,6 +34937,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[370]: 131071.1 */
@@ -34290,6 +35030,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	131071.1000000000000014L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[371]: 131071.2e2 */
@@ -34381,6 +35123,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	13107120L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[372]: 131071.2E-4 */
@@ -34472,6 +35216,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	13.10711999999999999994L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[373]: 131072.0 */
@@ -34563,6 +35309,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	131072L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[374]: 131072 */
@@ -34654,6 +35402,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[375]: 131072.1 */
@@ -34745,6 +35495,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	131072.0999999999999943L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[376]: 131072.2e2 */
@@ -34836,6 +35588,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	13107220L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[377]: 131072.2E-4 */
@@ -34927,6 +35681,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	13.1072200000000000002L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[378]: 131073.0 */
@@ -35018,6 +35774,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	131073L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[379]: 131073 */
@@ -35109,6 +35867,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[380]: 131073.1 */
@@ -35200,6 +35960,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	131073.0999999999999943L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[381]: 131073.2e2 */
@@ -35291,6 +36053,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	13107320L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[382]: 131073.2E-4 */
@@ -35382,6 +36146,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	13.1073199999999999996L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[383]: 131074.0 */
@@ -35473,6 +36239,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	131074L,		/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[384]: 131074 */
@@ -35564,6 +36332,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[385]: 131074.1 */
@@ -35655,6 +36425,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	131074.0999999999999943L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[386]: 131074.2e2 */
@@ -35746,6 +36518,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	13107420L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[387]: 131074.2E-4 */
@@ -35837,6 +36611,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	13.10741999999999999986L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[388]: 2147483646.0 */
@@ -35928,6 +36704,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	2147483646L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[389]: 2147483646.1 */
@@ -36019,6 +36797,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	2147483646.099999999977L,	/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[390]: 2147483646.2e2 */
@@ -36110,6 +36890,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	214748364620L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[391]: 2147483646.2E-4 */
@@ -36201,6 +36983,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	214748.3646200000000022L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[392]: 2147483647.0 */
@@ -36292,6 +37076,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	2147483647L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[393]: 2147483647.1 */
@@ -36383,6 +37169,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	2147483647.099999999977L,	/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[394]: 2147483647.2e2 */
@@ -36474,6 +37262,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	214748364720L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[395]: 2147483647.2E-4 */
@@ -36565,6 +37355,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	214748.3647200000000055L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[396]: 2147483648.0 */
@@ -36656,6 +37448,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	2147483648L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[397]: 2147483648.1 */
@@ -36747,6 +37541,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	2147483648.100000000093L,	/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[398]: 2147483648.2e2 */
@@ -36838,6 +37634,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	214748364820L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[399]: 2147483648.2E-4 */
@@ -36929,6 +37727,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	214748.3648199999999946L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[400]: 2147483649.0 */
@@ -37020,6 +37820,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	2147483649L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[401]: 2147483649.1 */
@@ -37111,6 +37913,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	2147483649.100000000093L,	/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[402]: 2147483649.2e2 */
@@ -37202,6 +38006,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	214748364920L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[403]: 2147483649.2E-4 */
@@ -37293,6 +38099,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	214748.3649199999999979L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[404]: 2147483650.0 */
@@ -37384,6 +38192,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	2147483650L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[405]: 2147483650.1 */
@@ -37475,6 +38285,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	2147483650.100000000093L,	/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[406]: 2147483650.2e2 */
@@ -37566,6 +38378,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	214748365020L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[407]: 2147483650.2E-4 */
@@ -37657,6 +38471,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	214748.3650200000000012L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[408]: 4294967294.0 */
@@ -37748,6 +38564,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	4294967294L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[409]: 4294967294.1 */
@@ -37839,6 +38657,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	4294967294.100000000093L,	/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[410]: 4294967294.2e2 */
@@ -37930,6 +38750,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	429496729420L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[411]: 4294967294.2E-4 */
@@ -38021,6 +38843,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	429496.7294200000000046L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[412]: 4294967295.0 */
@@ -38112,6 +38936,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	4294967295L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[413]: 4294967295.1 */
@@ -38203,6 +39029,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	4294967295.100000000093L,	/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[414]: 4294967295.2e2 */
@@ -38294,6 +39122,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	429496729520L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[415]: 4294967295.2E-4 */
@@ -38385,6 +39215,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	429496.7295200000000079L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[416]: 4294967296.0 */
@@ -38476,6 +39308,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	4294967296L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[417]: 4294967296.1 */
@@ -38567,6 +39401,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	4294967296.100000000093L,	/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[418]: 4294967296.2e2 */
@@ -38658,6 +39494,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	429496729620L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[419]: 4294967296.2E-4 */
@@ -38749,6 +39587,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	429496.7296200000000113L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[420]: 4294967297.0 */
@@ -38840,6 +39680,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	4294967297L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[421]: 4294967297.1 */
@@ -38931,6 +39773,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	4294967297.100000000093L,	/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[422]: 4294967297.2e2 */
@@ -39022,6 +39866,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	429496729720L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[423]: 4294967297.2E-4 */
@@ -39113,6 +39959,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	429496.7297199999999862L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[424]: 4294967298.0 */
@@ -39204,6 +40052,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	4294967298L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[425]: 4294967298.1 */
@@ -39295,6 +40145,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	4294967298.100000000093L,	/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[426]: 4294967298.2e2 */
@@ -39386,6 +40238,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	429496729820L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[427]: 4294967298.2E-4 */
@@ -39477,6 +40331,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	429496.7298199999999895L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[428]: 8589934590.0 */
@@ -39568,6 +40424,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	8589934590L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[429]: 8589934590.1 */
@@ -39659,6 +40517,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	8589934590.100000000093L,	/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[430]: 8589934590.2e2 */
@@ -39750,6 +40610,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	858993459020L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[431]: 8589934590.2E-4 */
@@ -39841,6 +40703,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	858993.4590200000000095L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[432]: 8589934591.0 */
@@ -39932,6 +40796,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	8589934591L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[433]: 8589934591.1 */
@@ -40023,6 +40889,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	8589934591.100000000093L,	/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[434]: 8589934591.2e2 */
@@ -40114,6 +40982,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	858993459120L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[435]: 8589934591.2E-4 */
@@ -40205,6 +41075,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	858993.4591199999999844L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[436]: 8589934592.0 */
@@ -40296,6 +41168,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	8589934592L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[437]: 8589934592.1 */
@@ -40387,6 +41261,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	8589934592.099999999627L,	/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[438]: 8589934592.2e2 */
@@ -40478,6 +41354,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	858993459220L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[439]: 8589934592.2E-4 */
@@ -40569,6 +41447,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	858993.4592200000000162L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[440]: 8589934593.0 */
@@ -40660,6 +41540,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	8589934593L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[441]: 8589934593.1 */
@@ -40751,6 +41633,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	8589934593.099999999627L,	/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[442]: 8589934593.2e2 */
@@ -40842,6 +41726,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	858993459320L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[443]: 8589934593.2E-4 */
@@ -40933,6 +41819,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	858993.4593199999999911L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[444]: 8589934594.0 */
@@ -41024,6 +41912,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	8589934594L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[445]: 8589934594.1 */
@@ -41115,6 +42005,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	8589934594.099999999627L,	/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[446]: 8589934594.2e2 */
@@ -41206,6 +42098,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	858993459420L,	/* JSON floating point value in long double form */
 	true,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[447]: 8589934594.2E-4 */
@@ -41297,6 +42191,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	true,		/* true ==> converted JSON floating point to C long double */
 	858993.4594200000000228L,		/* JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[448]: 1e1000000000 */
@@ -41388,6 +42284,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[449]: 1.0e1000000000 */
@@ -41479,6 +42377,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* test_result[450]: 1e10000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000 */
@@ -41570,6 +42470,8 @@ struct json_number test_result[TEST_COUNT+1] = {
 	false,		/* true ==> converted JSON floating point to C long double */
 	0,		/* no JSON floating point value in long double form */
 	false,		/* if float_sized == true, true ==> as_float is an integer */
+
+	false,		/* true ==> C values not yet converted, see json_number_convert() */
     },
 
     /* MUST BE LAST */
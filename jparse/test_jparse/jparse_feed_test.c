@@ -0,0 +1,466 @@
+/*
+ * jparse_feed_test - test the push mode JSON parser against the scanner
+ *
+ * Each JSON file is parsed with parse_json_mmap() and then given to a push
+ * mode parser with jparse_feed() in chunks of several sizes.  The validity,
+ * the scanner and parser errors and the JSON parse tree must be the same
+ * however the file is chunked.
+ *
+ * "Because a JSON document should not care how it was sliced." :-)
+ *
+ * Copyright (c) 2022-2025 by Cody Boone Ferguson and Landon Curt Noll. All
+ * rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software and
+ * its documentation for any purpose and without fee is hereby granted,
+ * provided that the above copyright, this permission notice and text
+ * this comment, and the disclaimer below appear in all of the following:
+ *
+ *       supporting documentation
+ *       source copies
+ *       source works derived from this source
+ *       binaries derived from this source or from derived source
+ *
+ * THE AUTHORS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE, INCLUDING
+ * ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHORS BE LIABLE FOR ANY SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES OR ANY
+ * DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE OR JSON.
+ *
+ * This JSON parser, library and tools were co-developed in 2022-2025 by Cody Boone
+ * Ferguson and Landon Curt Noll:
+ *
+ *  @xexyl
+ *	https://xexyl.net		Cody Boone Ferguson
+ *	https://ioccc.xexyl.net
+ * and:
+ *	chongo (Landon Curt Noll, http://www.isthe.com/chongo/index.html) /\oo/\
+ *
+ * "Because sometimes even the IOCCC Judges need some help." :-)
+ *
+ * "Share and Enjoy!"
+ *     --  Sirius Cybernetics Corporation Complaints Division, JSON spec department. :-)
+ */
+
+
+/* special comments for the seqcexit tool */
+/* exit code out of numerical order - ignore in sequencing - ooo */
+/* exit code change of order - use new value in sequencing - coo */
+
+#include <stdio.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <locale.h>
+
+/*
+ * jparse_feed_test - test the push mode JSON parser against the scanner
+ */
+#include "jparse_feed_test.h"
+
+/*
+ * definitions
+ */
+#define REQUIRED_ARGS (1)	/* number of required arguments on the command line */
+
+/*
+ * chunk sizes to feed, 0 ==> the whole file at once
+ */
+static size_t const chunk_sizes[] = { 1, 2, 3, 7, 64, 0 };
+
+
+/*
+ * usage message
+ *
+ * Use the usage() function to print the usage_msg([0-9]?)+ strings.
+ */
+static const char * const usage_msg =
+    "usage: %s [-h] [-v level] [-V] file.json ...\n"
+    "\n"
+    "\t-h\t\tprint help message and exit\n"
+    "\t-v level\tset verbosity level (def level: %d)\n"
+    "\t-V\t\tprint version strings and exit\n"
+    "\n"
+    "\tfile.json\tJSON file to parse, valid or not\n"
+    "\n"
+    "Exit codes:\n"
+    "\t0\t\tall is OK\n"
+    "\t1\t\tjparse_feed() and parse_json_mmap() differ on some file\n"
+    "\t2\t\t-h and help string printed or -V and version strings printed\n"
+    "\t3\t\tcommand line error\n"
+    "\t>=10\t\tinternal error\n"
+    "\n"
+    "%s version: %s\n"
+    "jparse utils version: %s\n"
+    "jparse library version: %s";
+
+
+/*
+ * forward declarations
+ */
+static void quiet_parse(bool quiet);
+static void parse_result(struct json *tree, bool valid, FILE *err_stream, char **errors,
+			 char **dump, size_t *dump_len);
+static int feed_test(char const *filename);
+static void usage(int exitcode, char const *prog, char const *str) __attribute__((noreturn));
+
+
+int
+main(int argc, char *argv[])
+{
+    char const *program = NULL;	/* our name */
+    extern char *optarg;	/* option argument */
+    extern int optind;		/* argv index of the next arg */
+    int arg_count = 0;		/* number of args to process */
+    int err_cnt = 0;		/* number of files where the parsers differ */
+    bool opt_error = false;	/* fchk_inval_opt() return */
+    int i;
+
+    /*
+     * use default locale based on LANG
+     */
+    (void) setlocale(LC_ALL, "");
+
+    /*
+     * parse args
+     */
+    program = argv[0];
+    while ((i = getopt(argc, argv, ":hv:V")) != -1) {
+	switch (i) {
+	case 'h':		/* -h - print help to stderr and exit 0 */
+	    usage(2, program, ""); /*ooo*/
+	    not_reached();
+	    break;
+	case 'v':		/* -v verbosity */
+	    /*
+	     * parse verbosity
+	     */
+	    verbosity_level = parse_verbosity(optarg);
+	    if (verbosity_level < 0) {
+		usage(3, program, "invalid -v verbosity"); /*ooo*/
+		not_reached();
+	    }
+	    break;
+	case 'V':		/* -V - print version strings and exit */
+	    print("jparse_feed_test version %s\n", JPARSE_FEED_TEST_VERSION);
+	    print("jparse utils version: %s\n", JPARSE_UTILS_VERSION);
+	    print("jparse library version: %s\n", JPARSE_LIBRARY_VERSION);
+	    exit(2); /*ooo*/
+	    not_reached();
+	    break;
+	case ':':   /* option requires an argument */
+	case '?':   /* illegal option */
+	default:    /* anything else but should not actually happen */
+	    opt_error = fchk_inval_opt(stderr, program, i, optopt);
+	    if (opt_error) {
+		usage(3, program, ""); /*ooo*/
+		not_reached();
+	    } else {
+		fwarn(stderr, __func__, "getopt() return: %c optopt: %c", (char)i, (char)optopt);
+	    }
+	    break;
+	}
+    }
+    arg_count = argc - optind;
+    if (arg_count < REQUIRED_ARGS) {
+	usage(3, program, "wrong number of arguments"); /*ooo*/
+	not_reached();
+    }
+
+    /*
+     * a JSON string that cannot be decoded makes the JSON invalid instead of
+     * ending this process, so that every file can be compared
+     */
+    json_string_err_invalid = true;
+
+    /*
+     * compare the parsers on each file
+     */
+    for (i=optind; i < argc; ++i) {
+	err_cnt += feed_test(argv[i]);
+    }
+
+    /*
+     * exit depending on error count
+     */
+    if (err_cnt > 0) {
+	fdbg(stderr, DBG_LOW, "jparse_feed() differs from parse_json_mmap() on %d file%s",
+	     err_cnt, err_cnt == 1 ? "" : "s");
+	exit(1); /*ooo*/
+    }
+    fdbg(stderr, DBG_LOW, "All tests PASSED");
+    exit(0); /*ooo*/
+}
+
+
+/*
+ * quiet_parse - silence the messages that both parsers write on stderr
+ *
+ * The warnings of the JSON string decoder and the low byte errors are written
+ * on stderr, not on jparse_err_stream, so only jparse_err_stream is compared.
+ * Unless debugging, they are silenced while parsing.
+ *
+ * given:
+ *	quiet	true ==> silence warnings and errors, false ==> restore them
+ */
+static void
+quiet_parse(bool quiet)
+{
+    static bool warn_allowed_saved = true;	/* warn_output_allowed before quiet */
+    static bool err_allowed_saved = true;	/* err_output_allowed before quiet */
+
+    if (verbosity_level > DBG_NONE) {
+	return;
+    }
+    if (quiet == true) {
+	warn_allowed_saved = warn_output_allowed;
+	err_allowed_saved = err_output_allowed;
+	warn_output_allowed = false;
+	err_output_allowed = false;
+    } else {
+	warn_output_allowed = warn_allowed_saved;
+	err_output_allowed = err_allowed_saved;
+    }
+    return;
+}
+
+
+/*
+ * parse_result - collect the result of a parse
+ *
+ * The scanner and parser errors written on err_stream are returned, along with
+ * the validity and, for valid JSON, the JSON parse tree as json_tree_print()
+ * prints it.  The tree is then freed.
+ *
+ * NOTE: The scanner may return a partial JSON parse tree for invalid JSON, such
+ *	 as when the error follows a complete top level value, while the push
+ *	 mode parser does not, so partial trees are not compared.
+ *
+ * given:
+ *	tree		JSON parse tree, or NULL
+ *	valid		true ==> JSON is valid
+ *	err_stream	open_memstream() stream the errors were written on
+ *	errors		pointer to the open_memstream() buffer of err_stream
+ *	dump		pointer to the tree dump, free()d by the caller
+ *	dump_len	pointer to the length of the tree dump
+ *
+ * NOTE: This function does not return on NULL pointers or open_memstream() error.
+ */
+static void
+parse_result(struct json *tree, bool valid, FILE *err_stream, char **errors, char **dump, size_t *dump_len)
+{
+    FILE *dump_stream = NULL;	/* stream the tree is printed on */
+
+    /*
+     * firewall
+     */
+    if (err_stream == NULL || errors == NULL || dump == NULL || dump_len == NULL) {
+	err(10, __func__, "NULL arg(s)");
+	not_reached();
+    }
+
+    /*
+     * close the error stream so that errors is NUL terminated
+     */
+    (void) fclose(err_stream);
+    jparse_err_stream = NULL;
+
+    /*
+     * print and free the JSON parse tree
+     */
+    errno = 0;			/* pre-clear errno for errp() */
+    dump_stream = open_memstream(dump, dump_len);
+    if (dump_stream == NULL) {
+	errp(11, __func__, "open_memstream failed");
+	not_reached();
+    }
+    fprint(dump_stream, "valid: %s\n", valid ? "true" : "false");
+    if (valid == true) {
+	json_tree_print(tree, JSON_INFINITE_DEPTH, dump_stream, JSON_DBG_FORCED);
+    }
+    if (tree != NULL) {
+	json_tree_free(tree, JSON_INFINITE_DEPTH);
+	free(tree);
+	tree = NULL;
+    }
+    (void) fclose(dump_stream);
+    return;
+}
+
+
+/*
+ * feed_test - compare jparse_feed() with parse_json_mmap() on a file
+ *
+ * given:
+ *	filename	JSON file to parse
+ *
+ * returns:
+ *	0 ==> the parsers agree for every chunk size, 1 ==> they differ
+ *
+ * NOTE: This function does not return on NULL filename, I/O or memory errors.
+ */
+static int
+feed_test(char const *filename)
+{
+    FILE *stream = NULL;		/* JSON file */
+    char *data = NULL;			/* contents of the JSON file */
+    size_t len = 0;			/* length of data */
+    struct jparse_push *ctx = NULL;	/* push mode parser state */
+    struct json *tree = NULL;		/* JSON parse tree */
+    bool valid = false;			/* true ==> JSON is valid */
+    FILE *err_stream = NULL;		/* stream errors are written on */
+    char *ref_errors = NULL;		/* errors of parse_json_mmap() */
+    size_t ref_errors_len = 0;		/* length of ref_errors */
+    char *ref_dump = NULL;		/* JSON parse tree of parse_json_mmap() */
+    size_t ref_dump_len = 0;		/* length of ref_dump */
+    char *errors = NULL;		/* errors of jparse_feed() */
+    size_t errors_len = 0;		/* length of errors */
+    char *dump = NULL;			/* JSON parse tree of jparse_feed() */
+    size_t dump_len = 0;		/* length of dump */
+    size_t chunk;			/* bytes to feed at a time */
+    size_t off;				/* bytes fed so far */
+    size_t n;
+    int ret = 0;
+
+    /*
+     * firewall
+     */
+    if (filename == NULL) {
+	err(12, __func__, "filename is NULL");
+	not_reached();
+    }
+
+    /*
+     * read the JSON file
+     */
+    errno = 0;			/* pre-clear errno for errp() */
+    stream = fopen(filename, "r");
+    if (stream == NULL) {
+	errp(13, __func__, "cannot open: %s", filename);
+	not_reached();
+    }
+    data = read_all(stream, &len);
+    if (data == NULL) {
+	err(14, __func__, "error reading: %s", filename);
+	not_reached();
+    }
+    (void) fclose(stream);
+    stream = NULL;
+
+    /*
+     * parse the file with the scanner
+     */
+    errno = 0;			/* pre-clear errno for errp() */
+    err_stream = open_memstream(&ref_errors, &ref_errors_len);
+    if (err_stream == NULL) {
+	errp(15, __func__, "open_memstream failed");
+	not_reached();
+    }
+    jparse_err_stream = err_stream;
+    quiet_parse(true);
+    tree = parse_json_mmap(filename, &valid);
+    quiet_parse(false);
+    parse_result(tree, valid, err_stream, &ref_errors, &ref_dump, &ref_dump_len);
+    tree = NULL;
+
+    /*
+     * feed the file to a push mode parser in chunks of each size
+     */
+    for (n=0; n < sizeof(chunk_sizes)/sizeof(chunk_sizes[0]); ++n) {
+	chunk = (chunk_sizes[n] > 0) ? chunk_sizes[n] : len;
+
+	errno = 0;		/* pre-clear errno for errp() */
+	err_stream = open_memstream(&errors, &errors_len);
+	if (err_stream == NULL) {
+	    errp(16, __func__, "open_memstream failed");
+	    not_reached();
+	}
+	jparse_err_stream = err_stream;
+	ctx = jparse_push_create(filename);
+	quiet_parse(true);
+	for (off=0; off < len; off += chunk) {
+	    (void) jparse_feed(ctx, data+off, (len-off < chunk) ? len-off : chunk);
+	}
+	tree = jparse_finish(ctx, &valid);
+	quiet_parse(false);
+	jparse_push_free(ctx);
+	ctx = NULL;
+	parse_result(tree, valid, err_stream, &errors, &dump, &dump_len);
+	tree = NULL;
+
+	/*
+	 * compare with the scanner
+	 */
+	if (errors_len != ref_errors_len || memcmp(errors, ref_errors, errors_len) != 0) {
+	    fwarn(stderr, __func__, "%s: chunk size %zu: errors differ:\nparse_json_mmap:\n%s"
+				    "jparse_feed:\n%s", filename, chunk, ref_errors, errors);
+	    ret = 1;
+	} else if (dump_len != ref_dump_len || memcmp(dump, ref_dump, dump_len) != 0) {
+	    fwarn(stderr, __func__, "%s: chunk size %zu: JSON parse trees differ:\nparse_json_mmap:\n%s"
+				    "jparse_feed:\n%s", filename, chunk, ref_dump, dump);
+	    ret = 1;
+	} else {
+	    fdbg(stderr, DBG_MED, "%s: chunk size %zu: OK", filename, chunk);
+	}
+	free(errors);
+	errors = NULL;
+	free(dump);
+	dump = NULL;
+    }
+    /*
+     * free storage
+     */
+    free(ref_errors);
+    ref_errors = NULL;
+    free(ref_dump);
+    ref_dump = NULL;
+    free(data);
+    data = NULL;
+    return ret;
+}
+
+
+/*
+ * usage - print usage to stderr
+ *
+ * Example:
+ *      usage(3, program, "wrong number of arguments");
+ *
+ * given:
+ *	exitcode        value to exit with
+ *	prog		our program name
+ *	str		top level usage message
+ *
+ * NOTE: We warn with extra newlines to help internal fault messages stand out.
+ *       Normally one should NOT include newlines in warn messages.
+ *
+ * This function does not return.
+ */
+static void
+usage(int exitcode, char const *prog, char const *str)
+{
+    /*
+     * firewall
+     */
+    if (prog == NULL) {
+	prog = JPARSE_FEED_TEST_BASENAME;
+	fwarn(stderr, __func__, "\nin usage(): program was NULL, forcing it to be: %s\n", prog);
+    }
+    if (str == NULL) {
+	str = "((NULL str))";
+	fwarn(stderr, __func__, "\nin usage(): program was NULL, forcing it to be: %s\n", str);
+    }
+
+    /*
+     * print the formatted usage stream
+     */
+    if (*str != '\0') {
+	fprintf_usage(DO_NOT_EXIT, stderr, "%s\n", str);
+    }
+    fprintf_usage(exitcode, stderr, usage_msg, prog, DBG_DEFAULT, JPARSE_FEED_TEST_BASENAME,
+	    JPARSE_FEED_TEST_VERSION, JPARSE_UTILS_VERSION, JPARSE_LIBRARY_VERSION);
+    exit(exitcode); /*ooo*/
+    not_reached();
+}
@@ -93,7 +93,7 @@
 #
 # setup
 #
-export JPARSE_TEST_VERSION="2.0.0 2025-02-28"	    # version format: major.minor YYYY-MM-DD */
+export JPARSE_TEST_VERSION="2.0.3 2026-10-18"	    # version format: major.minor YYYY-MM-DD */
 export CHK_TEST_FILE="./test_jparse/json_teststr.txt"
 export CHK_INVALID_TEST_FILE="./test_jparse/json_teststr_fail.txt"
 export JPARSE="./jparse"
@@ -537,6 +537,7 @@ run_location_err_test()
     fi
 
     "$JPARSE" -- "$jparse_test_file" 2>"$TMP_STDERR_FILE" | tee -a -- "${LOGFILE}"
+    status="${PIPESTATUS[0]}"
 
     if [[ $V_FLAG -ge 7 ]]; then
 	echo "$0: debug[7]: in run_location_err_test: jparse exit code: $status" 1>&2
@@ -560,6 +561,40 @@ run_location_err_test()
 	echo "$0: debug[1]: fail test OK, $JPARSE -- $jparse_test_file matches error file" | tee -a -- "$LOGFILE"
     fi
 
+    # the same JSON read from stdin must give the same errors, with - as the
+    # filename, and the same exit code
+    #
+    declare expected_err
+    declare stdin_err
+    declare stdin_status
+    expected_err="$(< "$jparse_err_file")"
+    expected_err="${expected_err//"$jparse_test_file"/-}"
+
+    if [[ $V_FLAG -ge 3 ]]; then
+	echo "$0: debug[3]: about to run test that must FAIL: $JPARSE - < $jparse_test_file >> ${LOGFILE} 2>$TMP_STDERR_FILE" 1>&2
+    fi
+
+    "$JPARSE" - < "$jparse_test_file" 2>"$TMP_STDERR_FILE" | tee -a -- "${LOGFILE}"
+    stdin_status="${PIPESTATUS[0]}"
+    stdin_err="$(< "$TMP_STDERR_FILE")"
+
+    if [[ $V_FLAG -ge 7 ]]; then
+	echo "$0: debug[7]: in run_location_err_test: jparse exit code for stdin: $stdin_status" 1>&2
+    fi
+
+    if [[ "$stdin_err" != "$expected_err" ]]; then
+	echo "$0: Warning: in run_location_err_test: FAIL: $JPARSE - < $jparse_test_file 2>$TMP_STDERR_FILE | tee -a -- ${LOGFILE}" 2>&1
+	echo "$0: Warning: in run_location_err_test: expected errors: $jparse_err_file with - as the filename do not match result of test: $TMP_STDERR_FILE" 1>&2
+	echo | tee -a -- "${LOGFILE}" 1>&2
+	EXIT_CODE=1
+    elif [[ "$stdin_status" -ne "$status" ]]; then
+	echo "$0: Warning: in run_location_err_test: FAIL: $JPARSE - < $jparse_test_file exit code: $stdin_status != $status" 1>&2
+	echo | tee -a -- "${LOGFILE}" 1>&2
+	EXIT_CODE=1
+    elif [[ "$V_FLAG" -ge 1 ]]; then
+	echo "$0: debug[1]: fail test OK, $JPARSE - < $jparse_test_file matches error file" | tee -a -- "$LOGFILE"
+    fi
+
     # return
     #
     return
@@ -664,6 +699,71 @@ run_file_test()
 	    fi
 	fi
     fi
+
+    # stream validate (jparse -S) must agree with the JSON parse tree
+    #
+    echo "$0: debug[3]: about to run stream validate test: $jparse -q -S -- $json_doc_file >> ${LOGFILE} 2>&1" >> "${LOGFILE}"
+    "$jparse" -q -S -- "$json_doc_file" >> "${LOGFILE}" 2>&1
+    sax_status="$?"
+    if [[ $status -eq 0 && $sax_status -ne 0 ]] || [[ $status -ne 0 && $sax_status -eq 0 ]]; then
+	echo "$0: in stream validate test: jparse -S exit code: $sax_status != jparse exit code: $status" 1>&2 >> "${LOGFILE}"
+	update_file_summary "$json_doc_file"
+	EXIT_CODE=1
+    fi
+    echo >> "${LOGFILE}"
+
+    # return
+    #
+    return
+}
+
+# run_parallel_test - run jparse -j on many JSON files
+#
+# usage:
+#	run_parallel_test jparse json_doc_file...
+#
+#	jparse			path to the jparse program
+#	json_doc_file...	JSON documents to check
+#
+# jparse -j must write "valid: json_doc_file" for each file that is not under
+# the JSON_BAD_TREE and "invalid: json_doc_file" for each file that is, in the
+# order the files were given.  It must exit 0 if all files are valid, else 1.
+#
+run_parallel_test()
+{
+    # parse args
+    #
+    if [[ $# -lt 2 ]]; then
+	echo "$0: ERROR: expected at least 2 args to run_parallel_test, found $#" 1>&2
+	exit 10
+    fi
+    declare jparse="$1"
+    shift
+
+    # form the expected output and exit code
+    #
+    declare expected_out=""
+    declare expected_status=0
+    declare file
+    for file in "$@"; do
+	if [[ $file == "$JSON_BAD_TREE"/* ]]; then
+	    expected_out+="invalid: $file"$'\n'
+	    expected_status=1
+	else
+	    expected_out+="valid: $file"$'\n'
+	fi
+    done
+
+    echo "$0: debug[3]: about to run parallel test: $jparse -q -j 4 -- $# files >> ${LOGFILE} 2>&1" >> "${LOGFILE}"
+    parallel_out=$("$jparse" -q -j 4 -- "$@" 2>> "${LOGFILE}")
+    status="$?"
+    if [[ $status -ne $expected_status ]]; then
+	echo "$0: in parallel test: jparse -j exit code: $status != $expected_status" 1>&2 >> "${LOGFILE}"
+	EXIT_CODE=1
+    elif [[ "$parallel_out"$'\n' != "$expected_out" ]]; then
+	echo "$0: in parallel test: jparse -j did not report each file as expected, in order" 1>&2 >> "${LOGFILE}"
+	EXIT_CODE=1
+    fi
     echo >> "${LOGFILE}"
 
     # return
@@ -671,6 +771,7 @@ run_file_test()
     return
 }
 
+
 # run_print_test - run print_test tool, making sure it passes
 #
 # usage:
@@ -942,6 +1043,25 @@ if [[ -n "$D_FLAG" ]]; then
 	run_file_test "$JPARSE" "$DBG_LEVEL" "$JSON_DBG_LEVEL" "$Q_FLAG" "$file" pass
     done < <(find "$JSON_GOOD_TREE" -type f -name '*.json' -print)
 
+    # run the tests that must PASS again, all at once, with jparse -j
+    #
+    GOOD_FILES=()
+    while read -r file; do
+	GOOD_FILES+=("$file")
+    done < <(find "$JSON_GOOD_TREE" -type f -name '*.json' -print)
+    if [[ ${#GOOD_FILES[@]} -gt 0 ]]; then
+	run_parallel_test "$JPARSE" "${GOOD_FILES[@]}"
+
+	# mix in a syntax error and JSON strings that cannot be decoded:
+	# each must be reported invalid without ending the batch
+	#
+	run_parallel_test "$JPARSE" "${GOOD_FILES[0]}" \
+	    "$JSON_BAD_TREE/n_string_lone_high_surrogate.json" \
+	    "$JSON_BAD_TREE/n_array_comma_and_number.json" \
+	    "${GOOD_FILES[@]: -1}" \
+	    "$JSON_BAD_TREE/n_object_lone_surrogate_name.json" \
+	    "$JSON_BAD_TREE/n_string_reversed_surrogate_pair.json"
+    fi
 
     # run tests that must FAIL
     #
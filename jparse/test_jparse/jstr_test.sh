@@ -46,7 +46,7 @@ export JSTRENCODE="./jstrencode"
 export TEST_FILE="./test_jparse/jstr_test.out"
 export TEST_FILE2="./test_jparse/jstr_test2.out"
 export JSTR_TEST_TXT="./test_jparse/jstr_test.txt"
-export JSTR_TEST_VERSION="2.0.1 2025-07-04" # version format: major.minor YYYY-MM-DD
+export JSTR_TEST_VERSION="2.0.2 2026-10-18" # version format: major.minor YYYY-MM-DD
 export TOPDIR=
 
 export USAGE="usage: $0 [-h] [-V] [-v level] [-e jstrencode] [-d jstrdecode] [-Z topdir]
@@ -431,6 +431,43 @@ else
     EXIT_CODE=4
 fi
 
+echo "$0: about to run test #14" 1>&2
+echo "$JSTRDECODE -B 1"
+if $JSTRDECODE -B 1 >/dev/null; then
+    echo "$0: test #14 passed" 1>&2
+else
+    echo "$0: test #14 failed" 1>&2
+    EXIT_CODE=4
+fi
+
+echo "$0: about to run test #15" 1>&2
+echo "$JSTRDECODE -d -n '\ud83d\udd25\u00e9'"
+EXPECTED="$(printf '\360\237\224\245\303\251')"
+RESULT="$($JSTRDECODE -d -n '\ud83d\udd25\u00e9')"
+if [[ "$RESULT" = "$EXPECTED" ]]; then
+    echo "$0: test #15 passed" 1>&2
+else
+    echo "$0: test #15 failed" 1>&2
+    echo "$0: test #15 EXPECTED: $EXPECTED"  1>&2
+    echo "$0: test #15 RESULT: $RESULT" 1>&2
+    EXIT_CODE=4
+fi
+
+echo "$0: about to run test #16" 1>&2
+# lone surrogates and \u escapes with fewer than 4 hex digits must not decode
+ERROR=
+for arg in '\ud800' '\udc00' '\ud800\u0041' '\udc00\ud800' '\u12' '\u12zz'; do
+    echo "$JSTRDECODE -q -d -n '$arg'"
+    if "$JSTRDECODE" -q -d -n "$arg" >/dev/null 2>&1; then
+	echo "$0: test #16 failed: decoded invalid: $arg" 1>&2
+	EXIT_CODE=4
+	ERROR=1
+    fi
+done
+if [[ -z "$ERROR" ]]; then
+    echo "$0: test #16 passed" 1>&2
+fi
+
 # All Done!!! All Done!!! -- Jessica Noll, Age 2
 #
 if [[ $EXIT_CODE == 0 ]]; then
@@ -39,8 +39,8 @@
 
 # setup
 #
-export RUN_JPARSE_TESTS_VERSION="2.0.1 2025-09-01"
-export USAGE="usage: $0 [-h] [-V] [-v level] [-D dbg_level] [-J json_level] [-j jparse] [-p pr_jparse_test] [-c jnum_chk] [-Z topdir]
+export RUN_JPARSE_TESTS_VERSION="2.0.3 2026-10-18"
+export USAGE="usage: $0 [-h] [-V] [-v level] [-D dbg_level] [-J json_level] [-j jparse] [-p pr_jparse_test] [-c jnum_chk] [-f jparse_feed_test] [-Z topdir]
 
     -h			print help and exit
     -V			print version and exit
@@ -50,6 +50,7 @@ export USAGE="usage: $0 [-h] [-V] [-v level] [-D dbg_level] [-J json_level] [-j
     -j jparse		path to jparse
     -p pr_jparse_test	path to pr_jparse_test
     -c jnum_chk		path to jnum_chk
+    -f jparse_feed_test	path to jparse_feed_test
     -Z topdir		top level build directory (def: try . or ..)
 
 Exit codes:
@@ -72,11 +73,12 @@ export TOPDIR=
 export JPARSE="./jparse"
 export PR_JPARSE_TEST="./test_jparse/pr_jparse_test"
 export JNUM_CHK="./test_jparse/jnum_chk"
+export JPARSE_FEED_TEST="./test_jparse/jparse_feed_test"
 
 
 # parse args
 #
-while getopts :hVv:D:J:j:p:c:Z: flag; do
+while getopts :hVv:D:J:j:p:c:f:Z: flag; do
     case "$flag" in
     h)	echo "$USAGE" 1>&2
 	exit 2
@@ -91,6 +93,8 @@ while getopts :hVv:D:J:j:p:c:Z: flag; do
 	;;
     c)	JNUM_CHK="$OPTARG";
 	;;
+    f)	JPARSE_FEED_TEST="$OPTARG";
+	;;
     J)	J_FLAG="$OPTARG";
 	;;
     V)	echo "$RUN_JPARSE_TESTS_VERSION"
@@ -254,6 +258,22 @@ elif [[ ! -x "$JNUM_CHK" ]]; then
     EXIT_CODE="5"
 fi
 
+# jparse_feed_test
+#
+if [[ -z "$JPARSE_FEED_TEST" ]]; then
+    echo "$0: ERROR: \$JPARSE_FEED_TEST empty, try a non-empty string for -f option" | tee -a -- "${LOGFILE}"
+    EXIT_CODE="5"
+elif [[ ! -e "$JPARSE_FEED_TEST" ]]; then
+    echo "$0: ERROR: $JPARSE_FEED_TEST file not found" | tee -a -- "$LOGFILE"
+    EXIT_CODE="5"
+elif [[ ! -f "$JPARSE_FEED_TEST" ]]; then
+    echo "$0: ERROR: $JPARSE_FEED_TEST is not a regular file" | tee -a -- "$LOGFILE"
+    EXIT_CODE="5"
+elif [[ ! -x "$JPARSE_FEED_TEST" ]]; then
+    echo "$0: ERROR: $JPARSE_FEED_TEST is not executable" | tee -a -- "$LOGFILE"
+    EXIT_CODE="5"
+fi
+
 
 # test_jparse/jparse_test.sh
 # #
@@ -419,6 +439,45 @@ else
 fi
 
 
+# jnum_chk -L
+#
+echo | tee -a -- "$LOGFILE"
+echo "RUNNING: $JNUM_CHK" -L -J "$J_FLAG" -v "$V_FLAG" | tee -a -- "$LOGFILE"
+echo "$JNUM_CHK" -L -J "$J_FLAG" -v "$V_FLAG" | tee -a -- "$LOGFILE"
+"$JNUM_CHK" -L -J "${J_FLAG}" -v "$V_FLAG" | tee -a -- "$LOGFILE"
+status="${PIPESTATUS[0]}"
+if [[ $status -ne 0 ]]; then
+    echo "$0: ERROR: $JNUM_CHK -L non-zero exit code: $status" 1>&2 | tee -a -- "$LOGFILE"
+    FAILURE_SUMMARY="$FAILURE_SUMMARY
+    $JNUM_CHK -L non-zero exit code: $status"
+    EXIT_CODE="28"
+    echo | tee -a -- "$LOGFILE"
+    echo "EXIT_CODE set to: $EXIT_CODE" | tee -a -- "$LOGFILE"
+    echo "FAILED: $JNUM_CHK -L -J ${J_FLAG}" -v "$V_FLAG" | tee -a -- "$LOGFILE"
+else
+    echo "PASSED: $JNUM_CHK -L -J ${J_FLAG}" -v "$V_FLAG" | tee -a -- "$LOGFILE"
+fi
+
+
+# jparse_feed_test: jparse_feed() in chunks must agree with parse_json_mmap()
+#
+echo | tee -a -- "$LOGFILE"
+echo "RUNNING: $JPARSE_FEED_TEST -v $V_FLAG test_jparse/test_JSON/*/*.json" | tee -a -- "$LOGFILE"
+"$JPARSE_FEED_TEST" -v "$V_FLAG" test_jparse/test_JSON/*/*.json 2>&1 | tee -a -- "$LOGFILE"
+status="${PIPESTATUS[0]}"
+if [[ $status -ne 0 ]]; then
+    echo "$0: ERROR: $JPARSE_FEED_TEST non-zero exit code: $status" 1>&2 | tee -a -- "$LOGFILE"
+    FAILURE_SUMMARY="$FAILURE_SUMMARY
+    $JPARSE_FEED_TEST non-zero exit code: $status"
+    EXIT_CODE="29"
+    echo | tee -a -- "$LOGFILE"
+    echo "EXIT_CODE set to: $EXIT_CODE" | tee -a -- "$LOGFILE"
+    echo "FAILED: $JPARSE_FEED_TEST -v $V_FLAG test_jparse/test_JSON/*/*.json" | tee -a -- "$LOGFILE"
+else
+    echo "PASSED: $JPARSE_FEED_TEST -v $V_FLAG test_jparse/test_JSON/*/*.json" | tee -a -- "$LOGFILE"
+fi
+
+
 # report overall status
 #
 if [[ $EXIT_CODE -ne 0 ]]; then
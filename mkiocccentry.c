@@ -751,7 +751,7 @@ main(int argc, char *argv[])
     init_walk_stat(&wstat,
 		   topdir_path, wset_p, context,
 		   MAX_PATH_LEN, MAX_FILENAME_LEN, MAX_PATH_DEPTH,
-		   false);
+		   false, false);
 
     /*
      * if -I or -X. We have to do this because in order to initialise the walk_stat we
@@ -1810,14 +1810,14 @@ show_copy_list(struct walk_stat *wstat, char const *context, struct info *infop,
     /*
      * we need to show the user the list of ignored paths, if any
      */
-    if (wstat->prune != NULL) {
-        len = dyn_array_tell(wstat->prune);
+    if (walk_view(wstat, WALK_CAT_PRUNE) != NULL) {
+        len = dyn_array_tell(walk_view(wstat, WALK_CAT_PRUNE));
         if (len > 0) {
             para("The following is a list of paths that will be ignored:",
                  "",
                  NULL);
             for (i = 0; i < len; ++i) {
-                p = dyn_array_value(wstat->prune, struct item *, i);
+                p = dyn_array_value(walk_view(wstat, WALK_CAT_PRUNE), struct item *, i);
                 if (p == NULL) {
                     err(58, __func__, "found NULL pointer in ignored paths list, element: %jd", i);
                     not_reached();
@@ -1849,8 +1849,8 @@ show_copy_list(struct walk_stat *wstat, char const *context, struct info *infop,
      * we need to show the user the list of symlinks (ignored as they are not
      * allowed), if any
      */
-    if (wstat->symlink != NULL) {
-        len = dyn_array_tell(wstat->symlink);
+    if (walk_view(wstat, WALK_CAT_SYMLINK) != NULL) {
+        len = dyn_array_tell(walk_view(wstat, WALK_CAT_SYMLINK));
         if (len > 0) {
             if (need_hints) {
                 para("",
@@ -1863,7 +1863,7 @@ show_copy_list(struct walk_stat *wstat, char const *context, struct info *infop,
                     NULL);
 
             for (i = 0; i < len; ++i) {
-                p = dyn_array_value(wstat->symlink, struct item *, i);
+                p = dyn_array_value(walk_view(wstat, WALK_CAT_SYMLINK), struct item *, i);
                 if (p == NULL) {
                     err(60, __func__, "found NULL pointer in ignored symlinks list, element: %jd", i);
                     not_reached();
@@ -1892,8 +1892,8 @@ show_copy_list(struct walk_stat *wstat, char const *context, struct info *infop,
     /*
      * we need to show the user the list of directories we will create, if any
      */
-    if (wstat->counted_dir != NULL) {
-        len = dyn_array_tell(wstat->counted_dir);
+    if (walk_view(wstat, WALK_CAT_COUNTED_DIR) != NULL) {
+        len = dyn_array_tell(walk_view(wstat, WALK_CAT_COUNTED_DIR));
         if (len > 0) {
             para("",
                     "The following is a list of directories that will be created:",
@@ -1904,14 +1904,14 @@ show_copy_list(struct walk_stat *wstat, char const *context, struct info *infop,
              * show directories list
              */
             for (i = 0; i < len; ++i) {
-                p = dyn_array_value(wstat->counted_dir, struct item *, i);
+                p = dyn_array_value(walk_view(wstat, WALK_CAT_COUNTED_DIR), struct item *, i);
                 if (p == NULL) {
                     err(62, __func__, "found NULL pointer in directories list, element: %jd", i);
                     not_reached();
                 } else if (p->fts_path == NULL) {
                     err(63, __func__, "found NULL path in directories list, element: %jd", i);
                     not_reached();
-                } else if (path_in_item_array(wstat->prune, p->fts_path) != NULL) {
+                } else if (path_in_walk_array(wstat, walk_view(wstat, WALK_CAT_PRUNE), p->fts_path) != NULL) {
                     continue;
                 }
                 print("%s\n", p->fts_path);
@@ -1935,11 +1935,11 @@ show_copy_list(struct walk_stat *wstat, char const *context, struct info *infop,
     /*
      * we need to show the user the list of all files
      */
-    if (wstat->file == NULL) {
+    if (walk_view(wstat, WALK_CAT_FILE) == NULL) {
         err(4, __func__, "files list is NULL"); /*ooo*/
         not_reached();
     } else {
-        len = dyn_array_tell(wstat->file);
+        len = dyn_array_tell(walk_view(wstat, WALK_CAT_FILE));
         total_file_size = 0; /* paranoia reset */
         if (len <= 0) {
             err(4, __func__, "list of files is empty"); /*ooo*/
@@ -1956,14 +1956,14 @@ show_copy_list(struct walk_stat *wstat, char const *context, struct info *infop,
              * show required files list
              */
             for (i = 0; i < len; ++i) {
-                p = dyn_array_value(wstat->file, struct item *, i);
+                p = dyn_array_value(walk_view(wstat, WALK_CAT_FILE), struct item *, i);
                 if (p == NULL) {
                     err(64, __func__, "found NULL pointer in files list, element: %jd", i);
                     not_reached();
                 } else if (p->fts_path == NULL) {
                     err(65, __func__, "found NULL path in files list, element: %jd", i);
                     not_reached();
-                } else if (path_in_item_array(wstat->prune, p->fts_path) != NULL) {
+                } else if (path_in_walk_array(wstat, walk_view(wstat, WALK_CAT_PRUNE), p->fts_path) != NULL) {
                     continue;
                 }
                 total_file_size += p->st_size;
@@ -2052,8 +2052,8 @@ copy_topdir(struct walk_stat *wstat, char const *context, struct info *infop, ch
     /*
      * make the necessary subdirectories, if any
      */
-    if (wstat->counted_dir != NULL) {
-        len = dyn_array_tell(wstat->counted_dir);
+    if (walk_view(wstat, WALK_CAT_COUNTED_DIR) != NULL) {
+        len = dyn_array_tell(walk_view(wstat, WALK_CAT_COUNTED_DIR));
         if (len > 0) {
             /*
              * we have to get to the submission dir before we can make
@@ -2069,14 +2069,14 @@ copy_topdir(struct walk_stat *wstat, char const *context, struct info *infop, ch
                 /*
                  * make the directories under the submission directory
                  */
-                p = dyn_array_value(wstat->counted_dir, struct item *, i);
+                p = dyn_array_value(walk_view(wstat, WALK_CAT_COUNTED_DIR), struct item *, i);
                 if (p == NULL) {
                     err(66, __func__, "found NULL pointer in directories list, element: %jd", i);
                     not_reached();
                 } else if (p->fts_path == NULL) {
                     err(67, __func__, "found NULL path in directories list, element: %jd", i);
                     not_reached();
-                } else if (path_in_item_array(wstat->prune, p->fts_path) != NULL) {
+                } else if (path_in_walk_array(wstat, walk_view(wstat, WALK_CAT_PRUNE), p->fts_path) != NULL) {
                     continue;
                 }
 
@@ -2101,24 +2101,24 @@ copy_topdir(struct walk_stat *wstat, char const *context, struct info *infop, ch
     /*
      * copy every file to correct location
      */
-    if (wstat->file == NULL) {
+    if (walk_view(wstat, WALK_CAT_FILE) == NULL) {
         err(69, __func__, "file set is NULL");
         not_reached();
     }
-    len = dyn_array_tell(wstat->file);
+    len = dyn_array_tell(walk_view(wstat, WALK_CAT_FILE));
     if (len <= 0) {
         err(70, __func__, "list of files is empty");
         not_reached();
     }
     for (i = 0; i < len; ++i) {
-        p = dyn_array_value(wstat->file, struct item *, i);
+        p = dyn_array_value(walk_view(wstat, WALK_CAT_FILE), struct item *, i);
         if (p == NULL) {
             err(71, __func__, "found NULL pointer in files list, element: %jd", i);
             not_reached();
         } else if (p->fts_path == NULL) {
             err(72, __func__, "found NULL path in files list, element: %jd", i);
             not_reached();
-        } else if (path_in_item_array(wstat->prune, p->fts_path) != NULL) {
+        } else if (path_in_walk_array(wstat, walk_view(wstat, WALK_CAT_PRUNE), p->fts_path) != NULL) {
             continue;
         }
 
@@ -2316,7 +2316,7 @@ check_submission_dir(struct walk_stat *wstat, char const *context, struct info *
     init_walk_stat(wstat2,
 		   submit_path, wset_p2, context2,
 		   MAX_PATH_LEN, MAX_FILENAME_LEN, MAX_PATH_DEPTH,
-		   false);
+		   false, false);
 
     /*
      * climb a file system tree, recording steps
@@ -2352,17 +2352,17 @@ check_submission_dir(struct walk_stat *wstat, char const *context, struct info *
     /*
      * check we have the same files
      */
-    if (wstat2->file == NULL) {
+    if (walk_view(wstat2, WALK_CAT_FILE) == NULL) {
         err(80, __func__, "submission directory has empty file set");
         not_reached();
     } else {
-        if (wstat->file == NULL) {
+        if (walk_view(wstat, WALK_CAT_FILE) == NULL) {
             err(81, __func__, "topdir was empty but submission directory not");
             not_reached();
         }
-        len = dyn_array_tell(wstat2->file);
+        len = dyn_array_tell(walk_view(wstat2, WALK_CAT_FILE));
         for (i = 0; i < len; ++i) {
-            p2 = dyn_array_value(wstat2->file, struct item *, i);
+            p2 = dyn_array_value(walk_view(wstat2, WALK_CAT_FILE), struct item *, i);
             if (p2 == NULL) {
                 err(4, __func__, "found NULL element in file list, element: %jd", i);/*ooo*/
                 not_reached();
@@ -2414,8 +2414,8 @@ check_submission_dir(struct walk_stat *wstat, char const *context, struct info *
      * show list of directories in the directory list of the submission
      * directory and ask user to verify all is OK
      */
-    if (wstat2->counted_dir != NULL) {
-        len = dyn_array_tell(wstat2->counted_dir);
+    if (walk_view(wstat2, WALK_CAT_COUNTED_DIR) != NULL) {
+        len = dyn_array_tell(walk_view(wstat2, WALK_CAT_COUNTED_DIR));
         if (len > 0) {
             para("",
                     "The following is a list of directories in your submission:",
@@ -2426,7 +2426,7 @@ check_submission_dir(struct walk_stat *wstat, char const *context, struct info *
              * show directories list
              */
             for (i = 0; i < len; ++i) {
-                p = dyn_array_value(wstat2->counted_dir, struct item *, i);
+                p = dyn_array_value(walk_view(wstat2, WALK_CAT_COUNTED_DIR), struct item *, i);
                 if (p == NULL) {
                     err(83, __func__, "found NULL pointer in directories list, element: %jd", i);
                     not_reached();
@@ -2456,11 +2456,11 @@ check_submission_dir(struct walk_stat *wstat, char const *context, struct info *
     /*
      * show user final submission directory listing and verify it is OK
      */
-    if (wstat2->file == NULL) {
+    if (walk_view(wstat2, WALK_CAT_FILE) == NULL) {
         err(85, __func__, "files list in submission directory is NULL");
         not_reached();
     }
-    len = dyn_array_tell(wstat2->file);
+    len = dyn_array_tell(walk_view(wstat2, WALK_CAT_FILE));
     if (len <= 0) {
         err(4, __func__, "list files in submission directory is empty"); /*ooo*/
         not_reached();
@@ -2475,7 +2475,7 @@ check_submission_dir(struct walk_stat *wstat, char const *context, struct info *
          * show required files list
          */
         for (i = 0; i < len; ++i) {
-            p = dyn_array_value(wstat2->file, struct item *, i);
+            p = dyn_array_value(walk_view(wstat2, WALK_CAT_FILE), struct item *, i);
             if (p == NULL) {
                 err(86, __func__, "found NULL pointer in files list, element: %jd", i);
                 not_reached();
@@ -6709,7 +6709,7 @@ write_json_files(struct walk_stat *wstat, struct auth *authp, struct info *infop
         not_reached();
     }
 
-    if (wstat->file == NULL) {
+    if (walk_view(wstat, WALK_CAT_FILE) == NULL) {
         err(243, __func__, "called with NULL file list");
         not_reached();
     }
@@ -6930,12 +6930,12 @@ write_json_files(struct walk_stat *wstat, struct auth *authp, struct info *infop
      * if we subtract by three it means that we'll skip some (and can result in
      * invalid JSON).
      */
-    file_count = dyn_array_tell(wstat->file);
+    file_count = dyn_array_tell(walk_view(wstat, WALK_CAT_FILE));
 
     /*
      * Set mark values
      *
-     * NOTE: This has the side effect of validating that all items in wstat->file are non-NULL
+     * NOTE: This has the side effect of validating that all items in walk_view(wstat, WALK_CAT_FILE) are non-NULL
      *	     and have non-NULL fts_name pointers.
      */
     for (j = 0; j < file_count; ++j) {
@@ -6943,7 +6943,7 @@ write_json_files(struct walk_stat *wstat, struct auth *authp, struct info *infop
 	/*
 	 * obtain the next item
 	 */
-	p = dyn_array_value(wstat->file, struct item *, j);
+	p = dyn_array_value(walk_view(wstat, WALK_CAT_FILE), struct item *, j);
 
 	/*
 	 * firewall
@@ -7019,7 +7019,7 @@ write_json_files(struct walk_stat *wstat, struct auth *authp, struct info *infop
 	/*
 	 * obtain the next item
 	 */
-	p = dyn_array_value(wstat->file, struct item *, j);
+	p = dyn_array_value(walk_view(wstat, WALK_CAT_FILE), struct item *, j);
 
 	ret =                   fprintf(info_stream, "        {\n") > 0 &&
 	      json_fprintf_value_string(info_stream, "            ", (char *)p->mark_ptr, " : ", p->orig_path, "\n") &&
@@ -785,6 +785,9 @@ readline_dup(char **linep, bool strip, size_t *lenp, FILE *stream)
  *
  * If no data is read, the calloc buffer will still be NUL terminated.
  *
+ * When stream is a regular file, room for the rest of the file is reserved
+ * before reading, so the buffer is not repeatedly reallocated.
+ *
  * If one is using is_string() to check if the data read is a string,
  * one should check for ONE EXTRA BYTE!  That is:
  *
@@ -822,6 +825,8 @@ read_all(FILE *stream, size_t *psize)
     intmax_t used = 0;		        /* amount of data read into the buffer */
     uint8_t *ret = NULL;		/* buffer containing the while file to return */
     int fread_errno = 0;		/* errno after fread() call */
+    struct stat st;			/* stream status */
+    off_t pos = 0;			/* current stream position */
 
     /*
      * firewall
@@ -854,6 +859,22 @@ read_all(FILE *stream, size_t *psize)
     array = dyn_array_create(sizeof(uint8_t), READ_ALL_CHUNK, INITIAL_BUF_SIZE, true);
     ++dyn_array_seek_cycle;
 
+    /*
+     * grow geometrically, and reserve room for the rest of a regular file
+     *
+     * The extra READ_ALL_CHUNK is room for the final fread() that finds EOF.
+     */
+    dyn_array_set_growth(array, DYN_ARRAY_GROW_GEOMETRIC);
+    if (fstat(fileno(stream), &st) == 0 && S_ISREG(st.st_mode)) {
+	pos = ftello(stream);
+	if (pos >= 0 && st.st_size > pos) {
+	    if (dyn_array_reserve(array, (intmax_t)(st.st_size - pos) + READ_ALL_CHUNK) == true) {
+		++move_cycle;
+	    }
+	    dbg(DBG_VVHIGH, "%s: reserved %jd bytes for regular file", __func__, (intmax_t)(st.st_size - pos));
+	}
+    }
+
     /*
      * read until stream EOF or ERROR
      */
@@ -2002,6 +2002,9 @@ chk_location_code(struct json const *node,
 /*
  * chk_manifest - JSON semantic check for manifest
  *
+ * The files of the manifest are looked for in the submission directory named by
+ * sem->data, or if sem->data is NULL, in the current directory.
+ *
  * given:
  *	node	JSON parse node being checked
  *	depth	depth of node in the JSON parse tree (0 ==> tree root)
@@ -2083,7 +2086,7 @@ chk_manifest(struct json const *node,
     /*
      * validate manifest
      */
-    test = test_manifest(&man, ".");
+    test = test_manifest(&man, (sem->data != NULL) ? (char *)sem->data : ".");
     if (test == false) {
 	if (val_err != NULL) {
 	    *val_err = werr_sem_val(148, node, depth, sem, __func__,
@@ -56,6 +56,7 @@
 #include <sys/time.h>
 #include <unistd.h>
 #include <ctype.h>
+#include <limits.h>
 
 
 /*
@@ -1561,6 +1562,18 @@ static bool default_handle_map_checked = false;	/* true ==> check_default_handle
 static bool seeded = false;			/* true ==> default_handle() was seeded for random() */
 static char state[STATE_LEN+1];			/* random() state */
 
+/*
+ * first byte index of hmap[]
+ *
+ * The hmap[] entries whose utf8_str starts with the byte c are
+ * hmap_byte[hmap_first[c]] through hmap_byte[hmap_first[c+1]-1], in the order
+ * they are in hmap[].  Thus only the entries that can match at a given byte of
+ * a name are scanned, and the first match is the same hmap[] entry that a scan
+ * of all of hmap[] would find.
+ */
+static struct default_handle_map *hmap_byte[TBLLEN(hmap)];	/* hmap[] entries sorted by first byte */
+static size_t hmap_first[UCHAR_MAX+2];		/* index of the first hmap_byte[] entry for each byte */
+
 /*
  * static functions
  */
@@ -1574,12 +1587,16 @@ static void check_default_handle_map(void);
  * last element: if it's not there or there's another NULL element it's a
  * problem that has to be fixed. It also checks that the table is not empty and
  * additionally it sets the length of each utf8_str and posix_str in the table.
+ *
+ * Once hmap[] is found to be sane, the first byte index of hmap[] is formed.
  */
 static void
 check_default_handle_map(void)
 {
     size_t max = 0;		/* number of elements in hmap[] */
     bool safe = true;		/* if path is safe */
+    size_t next[UCHAR_MAX+1];	/* next hmap_byte[] entry to fill for each first byte */
+    unsigned char c;		/* first byte of a utf8_str */
     size_t i;
 
     /*
@@ -1637,6 +1654,30 @@ check_default_handle_map(void)
 	err(14, __func__, "no final NULL element at hmap[%zu]; fix table in %s and recompile", (max-1), __FILE__);
 	not_reached();
     }
+
+    /*
+     * form the first byte index of hmap[], keeping the hmap[] order of the
+     * entries for each byte
+     *
+     * NOTE: Special cases (utf8_str_len <= 0) never match, so they are not indexed.
+     */
+    memset(hmap_first, 0, sizeof(hmap_first));
+    for (i = 0; i < max - 1; ++i) {
+	if (hmap[i].utf8_str_len > 0) {
+	    c = (unsigned char)hmap[i].utf8_str[0];
+	    ++hmap_first[c+1];
+	}
+    }
+    for (i = 1; i < TBLLEN(hmap_first); ++i) {
+	hmap_first[i] += hmap_first[i-1];
+    }
+    memcpy(next, hmap_first, sizeof(next));
+    for (i = 0; i < max - 1; ++i) {
+	if (hmap[i].utf8_str_len > 0) {
+	    c = (unsigned char)hmap[i].utf8_str[0];
+	    hmap_byte[next[c]++] = &hmap[i];
+	}
+    }
     default_handle_map_checked = true;
     dbg(DBG_VVHIGH, "hmap[0..%zu] sane and ready in %s", (max-1), __FILE__);
     return;
@@ -1672,6 +1713,8 @@ default_handle(char const *name)
     size_t namelen = 0;		/* length of name */
     char *ret = NULL;		/* calloc string to return */
     struct default_handle_map *m;	/* pointer into hmap[] table */
+    unsigned char c;		/* byte of name at which hmap[] is searched */
+    size_t j;			/* index into hmap_byte[] */
     bool safe = false;		/* true ==> default handle has safe characters */
     size_t cur_len = 0;		/* current default handle length that is bring formed */
     size_t len = 0;		/* string length of computed default handle */
@@ -1705,9 +1748,11 @@ default_handle(char const *name)
     while (i < namelen) {
 
 	/*
-	 * search for a hmap[] match
+	 * search for a hmap[] match among the entries that start with this byte
 	 */
-	for (m=hmap; m->utf8_str != NULL; ++m) {
+	c = (unsigned char)name[i];
+	for (j = hmap_first[c]; j < hmap_first[c+1]; ++j) {
+	    m = hmap_byte[j];
 
 	    /* skip special cases */
 	    if (m->utf8_str_len <= 0) {
@@ -1777,7 +1822,7 @@ default_handle(char const *name)
 	/*
 	 * if no hmap[] match was found, skip this string byte
 	 */
-        if (m->utf8_str == NULL) {
+        if (j >= hmap_first[c+1]) {
 	    ++i;
 	}
     }
@@ -1892,9 +1937,11 @@ default_handle(char const *name)
 	while (i < namelen) {
 
 	    /*
-	     * search for a hmap[] match
+	     * search for a hmap[] match among the entries that start with this byte
 	     */
-	    for (m=hmap; m->utf8_str != NULL; ++m) {
+	    c = (unsigned char)name[i];
+	    for (j = hmap_first[c]; j < hmap_first[c+1]; ++j) {
+		m = hmap_byte[j];
 
 		/* skip special cases */
 		if (m->utf8_str_len <= 0) {
@@ -1991,7 +2038,7 @@ default_handle(char const *name)
 	    /*
 	     * if no hmap[] match was found, skip this string byte
 	     */
-	    if (m->utf8_str == NULL) {
+	    if (j >= hmap_first[c+1]) {
 		++i;
 	    }
 	}
@@ -3321,6 +3321,8 @@ test_extra_filename(char const *str)
 {
     enum path_sanity sanity = PATH_OK;  /* canon_path path_sanity error, or PATH_OK */
     size_t len = 0;                     /* length of str */
+    char buf[MAX_PATH_LEN+1+1];		/* canon_path_r() buffer for a canonicalized str */
+    char *cpath = NULL;			/* malloced canon_path() result when str does not fit in buf */
 
     /*
      * firewall
@@ -3342,8 +3344,17 @@ test_extra_filename(char const *str)
      * validate that the filename is POSIX portable safe plus + chars
      */
     /* IMPORTANT: canon_path() MUST use a false "lower_case" arg!  See the path_in_item_array() function. */
-    (void) canon_path(str, MAX_PATH_LEN, MAX_FILENAME_LEN, MAX_PATH_DEPTH,
-		      &sanity, NULL, NULL, true, false, true, true, NULL);
+    if (len < sizeof(buf)) {
+	(void) canon_path_r(str, buf, sizeof(buf), MAX_PATH_LEN, MAX_FILENAME_LEN, MAX_PATH_DEPTH,
+			    &sanity, NULL, NULL, true, false, true, true, NULL);
+    } else {
+	cpath = canon_path(str, MAX_PATH_LEN, MAX_FILENAME_LEN, MAX_PATH_DEPTH,
+			   &sanity, NULL, NULL, true, false, true, true, NULL);
+	if (cpath != NULL) {
+	    free(cpath);
+	    cpath = NULL;
+	}
+    }
     if (sanity != PATH_OK) {
 	json_dbg(JSON_DBG_MED, __func__,
 		 "invalid: canon_path safety check on extra_file failed");
@@ -4027,20 +4038,23 @@ test_manifest(struct manifest *manp, char *submission_dir)
 
     /*
      * initialize the walk_stat structure
+     *
+     * NOTE: We walk a copy of walk_anything so that more than one thread may
+     *	     test a manifest at the same time.
      */
     memset(&wstat, 0, sizeof(wstat));
-    wset_p = &walk_anything;
+    wset_p = dup_walk_set(&walk_anything);
     context = __func__;
     init_walk_stat(&wstat,
-                   ".", wset_p, context,
+                   submission_dir, wset_p, context,
                    0, 0, 0,
-                   false);
+                   false, false);
     /*
      * walk a file system tree, recording steps
      */
     walk_ok = fts_walk(&wstat);
     if (!walk_ok) {
-        err(4, __func__, "failed to scan: %s", "."); /*ooo*/
+        err(4, __func__, "failed to scan: %s", submission_dir); /*ooo*/
         not_reached();
     }
 
@@ -4065,6 +4079,7 @@ test_manifest(struct manifest *manp, char *submission_dir)
 	/* report failure to find the pathname */
 	warn(__func__, "path_in_walk_stat did not find: %s", pathname);
 	free_walk_stat(&wstat);
+	free_dup_walk_set(wset_p);
 	return false;
 
     } else {
@@ -4075,11 +4090,13 @@ test_manifest(struct manifest *manp, char *submission_dir)
 	if (ITEM_IS_NOT_FILE(i_p->st_mode)) {
 	    warn(__func__, "not a file: %s", pathname);
 	    free_walk_stat(&wstat);
+	    free_dup_walk_set(wset_p);
 	    return false;
 	} else if (ITEM_PERM(i_p->st_mode) != ITEM_PERM_0444) {
 	    warn(__func__, "permission: %04o != %04o file: %s",
 				   i_p->st_mode, ITEM_PERM_0444, pathname);
 	    free_walk_stat(&wstat);
+	    free_dup_walk_set(wset_p);
 	    return false;
 	}
     }
@@ -4094,6 +4111,7 @@ test_manifest(struct manifest *manp, char *submission_dir)
 	/* report failure to find the pathname */
 	warn(__func__, "path_in_walk_stat did not find: %s", pathname);
 	free_walk_stat(&wstat);
+	free_dup_walk_set(wset_p);
 	return false;
 
     } else {
@@ -4104,11 +4122,13 @@ test_manifest(struct manifest *manp, char *submission_dir)
 	if (ITEM_IS_NOT_FILE(i_p->st_mode)) {
 	    warn(__func__, "not a file: %s", pathname);
 	    free_walk_stat(&wstat);
+	    free_dup_walk_set(wset_p);
 	    return false;
 	} else if (ITEM_PERM(i_p->st_mode) != ITEM_PERM_0444) {
 	    warn(__func__, "permission: %04o != %04o file: %s",
 				   i_p->st_mode, ITEM_PERM_0444, pathname);
 	    free_walk_stat(&wstat);
+	    free_dup_walk_set(wset_p);
 	    return false;
 	}
     }
@@ -4123,6 +4143,7 @@ test_manifest(struct manifest *manp, char *submission_dir)
 	/* report failure to find the pathname */
 	warn(__func__, "path_in_walk_stat did not find: %s", pathname);
 	free_walk_stat(&wstat);
+	free_dup_walk_set(wset_p);
 	return false;
 
     } else {
@@ -4133,11 +4154,13 @@ test_manifest(struct manifest *manp, char *submission_dir)
 	if (ITEM_IS_NOT_FILE(i_p->st_mode)) {
 	    warn(__func__, "not a file: %s", pathname);
 	    free_walk_stat(&wstat);
+	    free_dup_walk_set(wset_p);
 	    return false;
 	} else if (ITEM_PERM(i_p->st_mode) != ITEM_PERM_0444) {
 	    warn(__func__, "permission: %04o != %04o file: %s",
 				   i_p->st_mode, ITEM_PERM_0444, pathname);
 	    free_walk_stat(&wstat);
+	    free_dup_walk_set(wset_p);
 	    return false;
 	}
     }
@@ -4152,6 +4175,7 @@ test_manifest(struct manifest *manp, char *submission_dir)
 	/* report failure to find the pathname */
 	warn(__func__, "path_in_walk_stat not found: %s", pathname);
 	free_walk_stat(&wstat);
+	free_dup_walk_set(wset_p);
 	return false;
 
     } else {
@@ -4162,11 +4186,13 @@ test_manifest(struct manifest *manp, char *submission_dir)
 	if (ITEM_IS_NOT_FILE(i_p->st_mode)) {
 	    warn(__func__, "not a file: %s", pathname);
 	    free_walk_stat(&wstat);
+	    free_dup_walk_set(wset_p);
 	    return false;
 	} else if (ITEM_PERM(i_p->st_mode) != ITEM_PERM_0444) {
 	    warn(__func__, "permission: %04o != %04o file: %s",
 				   i_p->st_mode, ITEM_PERM_0444, pathname);
 	    free_walk_stat(&wstat);
+	    free_dup_walk_set(wset_p);
 	    return false;
 	}
     }
@@ -4181,6 +4207,7 @@ test_manifest(struct manifest *manp, char *submission_dir)
 	/* report failure to find the pathname */
 	warn(__func__, "path_in_walk_stat did not find: %s", pathname);
 	free_walk_stat(&wstat);
+	free_dup_walk_set(wset_p);
 	return false;
 
     } else {
@@ -4191,11 +4218,13 @@ test_manifest(struct manifest *manp, char *submission_dir)
 	if (ITEM_IS_NOT_FILE(i_p->st_mode)) {
 	    warn(__func__, "not a file: %s", pathname);
 	    free_walk_stat(&wstat);
+	    free_dup_walk_set(wset_p);
 	    return false;
 	} else if (ITEM_PERM(i_p->st_mode) != ITEM_PERM_0444) {
 	    warn(__func__, "permission: %04o != %04o file: %s",
 				   i_p->st_mode, ITEM_PERM_0444, pathname);
 	    free_walk_stat(&wstat);
+	    free_dup_walk_set(wset_p);
 	    return false;
 	}
     }
@@ -4206,6 +4235,7 @@ test_manifest(struct manifest *manp, char *submission_dir)
     if (count_extra_file == 0 && count_shell_script == 0) {
 	warn(__func__, "manifest is complete with no extra files and no shell scripts");
 	free_walk_stat(&wstat);
+	free_dup_walk_set(wset_p);
 	return true;
     }
 
@@ -4231,6 +4261,7 @@ test_manifest(struct manifest *manp, char *submission_dir)
 	    /* report failure to find the pathname */
 	    warn(__func__, "path_in_walk_stat did not find extra file: %s", extra_filename);
 	    free_walk_stat(&wstat);
+	    free_dup_walk_set(wset_p);
 	    return false;
 
 	} else {
@@ -4242,15 +4273,18 @@ test_manifest(struct manifest *manp, char *submission_dir)
 	    if (ITEM_IS_NOT_FILE(i_p->st_mode)) {
 		warn(__func__, "not a file: %s", pathname);
 		free_walk_stat(&wstat);
+		free_dup_walk_set(wset_p);
 		return false;
 	    } else if (is_executable_filename(extra_filename)) {
                 warn(__func__, "extra_file is an executable filename: %s", pathname);
                 free_walk_stat(&wstat);
+                free_dup_walk_set(wset_p);
                 return false;
 	    } else if (ITEM_PERM(i_p->st_mode) != ITEM_PERM_0444) {
                 warn(__func__, "permission: %04o != %04o file: %s",
                                        i_p->st_mode, ITEM_PERM_0444, pathname);
                 free_walk_stat(&wstat);
+                free_dup_walk_set(wset_p);
                 return false;
             }
         }
@@ -4278,6 +4312,7 @@ test_manifest(struct manifest *manp, char *submission_dir)
 	    /* report failure to find the pathname */
 	    warn(__func__, "path_in_walk_stat did not find shell_script file: %s", shell_filename);
 	    free_walk_stat(&wstat);
+	    free_dup_walk_set(wset_p);
 	    return false;
 
 	} else {
@@ -4288,18 +4323,21 @@ test_manifest(struct manifest *manp, char *submission_dir)
 	    if (ITEM_IS_NOT_FILE(i_p->st_mode)) {
 		warn(__func__, "not a file: %s", pathname);
 		free_walk_stat(&wstat);
+		free_dup_walk_set(wset_p);
 		return false;
 	    } else if (!is_executable_filename(shell_filename)) {
 		if (ITEM_PERM(i_p->st_mode) != ITEM_PERM_0555) {
 		    warn(__func__, "permission: %04o != %04o file: %s",
 					   i_p->st_mode, ITEM_PERM_0555, pathname);
 		    free_walk_stat(&wstat);
+		    free_dup_walk_set(wset_p);
 		    return false;
 		}
 	    } else if (ITEM_PERM(i_p->st_mode) != ITEM_PERM_0555) {
                 warn(__func__, "permission: %04o != %04o file: %s",
                                        i_p->st_mode, ITEM_PERM_0555, pathname);
                 free_walk_stat(&wstat);
+                free_dup_walk_set(wset_p);
                 return false;
             }
         }
@@ -4312,6 +4350,7 @@ test_manifest(struct manifest *manp, char *submission_dir)
 	json_dbg(JSON_DBG_MED, __func__, "manifest is complete with only 1 valid extra filename or 1 shell script filename");
 
 	free_walk_stat(&wstat);
+	free_dup_walk_set(wset_p);
 	return true;
     }
 
@@ -4328,6 +4367,7 @@ test_manifest(struct manifest *manp, char *submission_dir)
 	if (extra_filename == NULL) {
 	    err(4, __func__, "invalid: manifest extra[i = %jd] is NULL", i);/*ooo*/
 	    free_walk_stat(&wstat);
+	    free_dup_walk_set(wset_p);
 	    return false;
 	}
 
@@ -4340,6 +4380,7 @@ test_manifest(struct manifest *manp, char *submission_dir)
                      "invalid: manifest extra[%jd] filename: <%s> matches a mandatory filename",
                      i, extra_filename);
             free_walk_stat(&wstat);
+            free_dup_walk_set(wset_p);
             return false;
         }
         /*
@@ -4351,6 +4392,7 @@ test_manifest(struct manifest *manp, char *submission_dir)
                      "invalid: manifest extra[%jd] filename: <%s> matches an executable filename",
                      i, extra_filename);
             free_walk_stat(&wstat);
+            free_dup_walk_set(wset_p);
             return false;
         }
 
@@ -4374,6 +4416,7 @@ test_manifest(struct manifest *manp, char *submission_dir)
 			 "invalid: manifest extra[%jd] filename: <%s> matches manifest extra[%jd] filename: <%s>",
 			 i, extra_filename, j, extra_filename2);
 		free_walk_stat(&wstat);
+		free_dup_walk_set(wset_p);
 		return false;
 	    }
 	}
@@ -4398,6 +4441,7 @@ test_manifest(struct manifest *manp, char *submission_dir)
 			 "invalid: manifest extra[%jd] filename: <%s> matches manifest shell[%jd] filename: <%s>",
 			 i, extra_filename, j, shell_filename);
 		free_walk_stat(&wstat);
+		free_dup_walk_set(wset_p);
 		return false;
 	    }
 	}
@@ -4425,6 +4469,7 @@ test_manifest(struct manifest *manp, char *submission_dir)
                      "invalid: manifest shell[%jd] filename: <%s> matches a mandatory filename",
                      i, shell_filename);
             free_walk_stat(&wstat);
+            free_dup_walk_set(wset_p);
             return false;
         }
         /*
@@ -4437,6 +4482,7 @@ test_manifest(struct manifest *manp, char *submission_dir)
                      "invalid: manifest shell[%jd] filename: <%s> is NOT an executable filename",
                      i, shell_filename);
             free_walk_stat(&wstat);
+            free_dup_walk_set(wset_p);
             return false;
         }
 
@@ -4461,6 +4507,7 @@ test_manifest(struct manifest *manp, char *submission_dir)
 			 "invalid: manifest shell[%jd] filename: <%s> matches manifest shell[%jd] filename: <%s>",
 			 i, shell_filename, j, shell_filename2);
 		free_walk_stat(&wstat);
+		free_dup_walk_set(wset_p);
 		return false;
 	    }
 	}
@@ -4484,6 +4531,7 @@ test_manifest(struct manifest *manp, char *submission_dir)
 			 "invalid: manifest extra[%jd] filename: <%s> matches manifest shell[%jd] filename: <%s>",
 			 i, shell_filename, j, extra_filename);
 		free_walk_stat(&wstat);
+		free_dup_walk_set(wset_p);
 		return false;
 	    }
 	}
@@ -4492,6 +4540,7 @@ test_manifest(struct manifest *manp, char *submission_dir)
     json_dbg(JSON_DBG_MED, __func__, "manifest is complete with valid unique extra filenames and shell script filenames");
 
     free_walk_stat(&wstat);
+    free_dup_walk_set(wset_p);
     return true;
 }
 
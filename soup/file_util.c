@@ -46,11 +46,17 @@
 /* exit code change of order - use new value in sequencing - coo */
 
 
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+  #define _GNU_SOURCE		/* for copy_file_range(2) */
+#endif
 #include <stdio.h>
 #include <stdlib.h>
 #include <ctype.h>
 #include <unistd.h>
 #include <sys/stat.h>
+#if defined(__linux__)
+  #include <sys/sendfile.h>	/* for sendfile(2) */
+#endif
 #include <stdint.h>
 #include <limits.h>
 #include <errno.h>
@@ -93,6 +99,13 @@
 #define PATH_CHUNK_SIZE (8)	/* grow dynamic array by this many pointers at a time */
 
 
+/*
+ * static functions
+ */
+static bool copy_fd_data(int infd, int outfd, size_t *copied, char const **method);
+static int cmp_fd_data(int fd1, int fd2);
+
+
 /*
  * base_name - determine the final portion of a path
  *
@@ -274,6 +287,7 @@ dir_name(char const *path)
     case PATH_ERR_NOT_SAFE:
     case PATH_ERR_NULL_COMPONENT:
     case PATH_ERR_WRONG_LEN:
+    case PATH_ERR_BUF_TOO_SMALL:
 	/* this should never happen */
 	dbg(DBG_HIGH, "%s: will return \".\" due to unexpected canon_path error: %s (%s) for: %s",
 	     __func__, path_sanity_name(sanity), path_sanity_error(sanity), path);
@@ -1422,6 +1436,158 @@ resolve_path(char const *cmd)
 }
 
 
+/*
+ * copy_fd_data - copy the rest of an open file to another open file
+ *
+ * Data is copied from the current offset of infd to the current offset of outfd
+ * until end of file on infd.  On Linux, copy_file_range(2) is tried first so that
+ * the kernel (or file system) may copy without passing data through user space,
+ * then sendfile(2).  If neither can be used, data is copied via a buffer of
+ * COPYFILE_BUFSIZ bytes.  A fallback resumes where the previous method stopped.
+ *
+ * given:
+ *      infd        - open file descriptor to copy from
+ *      outfd       - open file descriptor to copy to
+ *      copied      - pointer to the number of bytes copied
+ *      method      - pointer to the name of the last copy method used
+ *
+ * returns:
+ *      true ==> all data copied, *copied and *method set
+ *      false ==> copy error, errno set, *copied is the number of bytes copied before the error
+ */
+static bool
+copy_fd_data(int infd, int outfd, size_t *copied, char const **method)
+{
+    char buf[COPYFILE_BUFSIZ];  /* fallback copy buffer */
+    ssize_t inbytes;            /* bytes read, or copied by the kernel */
+    ssize_t outbytes;           /* bytes written */
+    ssize_t done;               /* bytes of buf written so far */
+
+    *copied = 0;
+
+#if defined(__linux__)
+    /*
+     * try copy_file_range(2)
+     */
+    *method = "copy_file_range";
+    do {
+        inbytes = copy_file_range(infd, NULL, outfd, NULL, COPYFILE_CHUNK, 0);
+        if (inbytes > 0) {
+            *copied += (size_t)inbytes;
+        }
+    } while (inbytes > 0 || (inbytes < 0 && errno == EINTR));
+    if (inbytes == 0) {
+        return true;
+    } else if (errno != ENOSYS && errno != EXDEV && errno != EINVAL && errno != EOPNOTSUPP && errno != EPERM) {
+        return false;
+    }
+
+    /*
+     * try sendfile(2)
+     */
+    *method = "sendfile";
+    do {
+        inbytes = sendfile(outfd, infd, NULL, COPYFILE_CHUNK);
+        if (inbytes > 0) {
+            *copied += (size_t)inbytes;
+        }
+    } while (inbytes > 0 || (inbytes < 0 && errno == EINTR));
+    if (inbytes == 0) {
+        return true;
+    } else if (errno != ENOSYS && errno != EINVAL && errno != EOPNOTSUPP) {
+        return false;
+    }
+#endif /* __linux__ */
+
+    /*
+     * copy via a fixed size buffer
+     */
+    *method = "read/write";
+    for (;;) {
+        inbytes = read(infd, buf, sizeof(buf));
+        if (inbytes < 0 && errno == EINTR) {
+            continue;
+        } else if (inbytes < 0) {
+            return false;
+        } else if (inbytes == 0) {
+            break;
+        }
+        for (done = 0; done < inbytes; done += outbytes) {
+            outbytes = write(outfd, buf + done, (size_t)(inbytes - done));
+            if (outbytes < 0 && errno == EINTR) {
+                outbytes = 0;
+            } else if (outbytes <= 0) {
+                return false;
+            }
+        }
+        *copied += (size_t)inbytes;
+    }
+    return true;
+}
+
+
+/*
+ * cmp_fd_data - compare the contents of two open files
+ *
+ * The files are compared from offset 0 one COPYFILE_BUFSIZ chunk at a time,
+ * using pread(2), so the file offsets are not changed.
+ *
+ * given:
+ *      fd1         - open file descriptor of 1st file
+ *      fd2         - open file descriptor of 2nd file
+ *
+ * returns:
+ *      0 ==> both files have the same length and contents
+ *      1 ==> the files differ in length or contents
+ *      -1 ==> read error, errno set
+ */
+static int
+cmp_fd_data(int fd1, int fd2)
+{
+    char buf1[COPYFILE_BUFSIZ];         /* chunk of 1st file */
+    char buf2[COPYFILE_BUFSIZ];         /* chunk of 2nd file */
+    ssize_t len1;                       /* bytes read from 1st file */
+    ssize_t len2;                       /* bytes read from 2nd file */
+    ssize_t ret;                        /* pread(2) return */
+    off_t offset = 0;                   /* file offset of chunk */
+
+    do {
+        /*
+         * read the next chunk of each file, allowing for short reads
+         */
+        for (len1 = 0; len1 < (ssize_t)sizeof(buf1); len1 += ret) {
+            ret = pread(fd1, buf1 + len1, sizeof(buf1) - (size_t)len1, offset + len1);
+            if (ret < 0 && errno == EINTR) {
+                ret = 0;
+            } else if (ret < 0) {
+                return -1;
+            } else if (ret == 0) {
+                break;
+            }
+        }
+        for (len2 = 0; len2 < (ssize_t)sizeof(buf2); len2 += ret) {
+            ret = pread(fd2, buf2 + len2, sizeof(buf2) - (size_t)len2, offset + len2);
+            if (ret < 0 && errno == EINTR) {
+                ret = 0;
+            } else if (ret < 0) {
+                return -1;
+            } else if (ret == 0) {
+                break;
+            }
+        }
+
+        /*
+         * compare the chunks
+         */
+        if (len1 != len2 || memcmp(buf1, buf2, (size_t)len1) != 0) {
+            return 1;
+        }
+        offset += len1;
+    } while (len1 == (ssize_t)sizeof(buf1));
+    return 0;
+}
+
+
 /*
  * copyfile - copy src file (path) to dest file (path)
  *
@@ -1433,11 +1599,13 @@ resolve_path(char const *cmd)
  *
  * This function does not return on NULL pointers.
  *
- * This function will not return on an allocation error.
- *
  * This function will NOT overwrite an existing file.
  *
- * If the number of bytes written is not the same as the number of bytes read it
+ * The file is copied by copy_fd_data() without reading it into memory, and then
+ * verified by comparing the dest file with the src file one chunk at a time.
+ * Memory use does not depend on the size of the file.
+ *
+ * If the number of bytes written is not the same as the size of the source file it
  * is an error. If the copied contents is not the same (in the written file) as
  * the source file it is an error.
  *
@@ -1447,12 +1615,8 @@ resolve_path(char const *cmd)
 size_t
 copyfile(char const *src, char const *dest, bool copy_mode, mode_t mode)
 {
-    size_t inbytes = 0;         /* bytes read in from src file */
     size_t outbytes = 0;        /* bytes written to dest file */
-    FILE *in_file = NULL;       /* source file stream */
-    FILE *out_file = NULL;      /* output file stream */
-    void *buf = NULL;           /* src file contents */
-    void *copy = NULL;          /* to verify copied buffer is the same */
+    char const *method = NULL;  /* copy method used by copy_fd_data() */
     int infd = -1;              /* input file file descriptor */
     int outfd = -1;             /* output file file descriptor */
     int ret = -1;               /* libc return value */
@@ -1503,20 +1667,10 @@ copyfile(char const *src, char const *dest, bool copy_mode, mode_t mode)
     /*
      * open src file for reading
      */
-    errno = 0;      /* pre-clear errno for errp() */
-    in_file = fopen(src, "rb");
-    if (in_file == NULL) {
-        errp(42, __func__, "couldn't open src file %s for reading: %s", src, strerror(errno));
-        not_reached();
-    }
-
-    /*
-     * obtain file descriptor of src file
-     */
     errno = 0; /* pre-clear errno for errp() */
-    infd = open(src, O_RDONLY|O_CLOEXEC, S_IRWXU);
+    infd = open(src, O_RDONLY|O_CLOEXEC);
     if (infd < 0) {
-        errp(43, __func__, "failed to obtain file descriptor for %s: %s", src, strerror(errno));
+        errp(42, __func__, "couldn't open src file %s for reading: %s", src, strerror(errno));
         not_reached();
     }
 
@@ -1526,160 +1680,65 @@ copyfile(char const *src, char const *dest, bool copy_mode, mode_t mode)
     errno = 0;      /* pre-clear errno for errp() */
     ret = fstat(infd, &in_st);
     if (ret < 0) {
-	errp(44, __func__, "failed to get stat info for %s, stat returned: %s", src, strerror(errno));
-        not_reached();
-    }
-
-
-    /*
-     * ensure inbytes is 0 before we read anything in
-     */
-    inbytes = 0;
-    /*
-     * read in entire source file
-     */
-    buf = read_all(in_file, &inbytes);
-    if (buf == NULL) {
-        err(45, __func__, "couldn't read in src file: %s", src);
-        not_reached();
-    }
-
-    dbg(DBG_HIGH, "read %zu bytes from src file %s", inbytes, src);
-
-    /*
-     * close the src file
-     */
-    errno = 0;			/* pre-clear errno for errp() */
-    ret = fclose(in_file);
-    if (ret < 0) {
-	errp(46, __func__, "fclose error for %s: %s", src, strerror(errno));
-	not_reached();
-    }
-
-    /*
-     * open dest file for writing
-     */
-    errno = 0;          /* pre-clear errno for errp() */
-    out_file = fopen(dest, "wb");
-    if (out_file == NULL) {
-        if (buf != NULL) {
-            free(buf);
-            buf = NULL;
-        }
-        errp(47, __func__, "couldn't open dest file %s for writing: %s", dest, strerror(errno));
+	errp(43, __func__, "failed to get stat info for %s, stat returned: %s", src, strerror(errno));
         not_reached();
     }
 
     /*
-     * obtain file descriptor of dest file
+     * create dest file for reading and writing
+     *
+     * NOTE: O_EXCL ensures that we do not overwrite a file that was created
+     *       after the above exists() check.
      */
     errno = 0; /* pre-clear errno for errp() */
-    outfd = open(dest, O_WRONLY|O_CLOEXEC, S_IRWXU);
+    outfd = open(dest, O_RDWR|O_CREAT|O_EXCL|O_CLOEXEC, S_IRUSR|S_IWUSR);
     if (outfd < 0) {
-        errp(48, __func__, "failed to obtain file descriptor for %s: %s", dest, strerror(errno));
-        not_reached();
-    }
-
-
-    /*
-     * write buffer into the dest file
-     */
-    errno = 0;		/* pre-clear errno for warnp() */
-    outbytes = fwrite(buf, 1, inbytes, out_file);
-    if (outbytes != inbytes) {
-        errp(49, __func__, "error: wrote %zu bytes out of expected %zu bytes", outbytes, inbytes);
+        errp(44, __func__, "couldn't open dest file %s for writing: %s", dest, strerror(errno));
         not_reached();
-    } else {
-        dbg(DBG_HIGH, "wrote %zu bytes to dest file %s == %zu read bytes", outbytes, src, inbytes);
     }
 
     /*
-     * close the dest file
+     * copy the src file to the dest file
      */
-    errno = 0;			/* pre-clear errno for errp() */
-    ret = fclose(out_file);
-    if (ret < 0) {
-	errp(50, __func__, "fclose error for %s: %s", dest, strerror(errno));
-	not_reached();
-    }
-
-    /*
-     * we need to open the file for reading, to verify that it's the same as the
-     * src file buffer
-     */
-    errno = 0;          /* pre-clear errno for errp() */
-    out_file = fopen(dest, "rb");
-    if (out_file == NULL) {
-        if (buf != NULL) {
-            free(buf);
-            buf = NULL;
-        }
-        err(51, __func__, "couldn't open dest file for reading: %s: %s", dest, strerror(errno));
+    errno = 0; /* pre-clear errno for errp() */
+    if (!copy_fd_data(infd, outfd, &outbytes, &method)) {
+        errp(45, __func__, "%s failed after copying %zu bytes from %s to %s: %s",
+                method, outbytes, src, dest, strerror(errno));
         not_reached();
     }
+    dbg(DBG_HIGH, "%s copied %zu bytes from src file %s to dest file %s", method, outbytes, src, dest);
 
     /*
-     * now that we have the copied file open for reading, we need to read in the
-     * contents, to compare it to the source file's contents
-     */
-
-    /*
-     * ensure inbytes is 0 before we read anything in
-     */
-    inbytes = 0;
-    /*
-     * read in entire source file
+     * check that the bytes written is the same as the size of the src file
      */
-    copy = read_all(out_file, &inbytes);
-    if (copy == NULL) {
-        err(52, __func__, "couldn't read in dest file: %s", dest);
+    if ((off_t)outbytes != in_st.st_size) {
+        err(46, __func__, "error: wrote %zu bytes out of expected %jd bytes", outbytes, (intmax_t)in_st.st_size);
         not_reached();
     }
 
-    dbg(DBG_HIGH, "read %zu bytes from dest file %s", inbytes, src);
-
     /*
-     * close the dest file
+     * we need to check that the dest file (copy of src file) is the same as the src file
      */
-    errno = 0;			/* pre-clear errno for errp() */
-    ret = fclose(out_file);
+    errno = 0; /* pre-clear errno for errp() */
+    ret = cmp_fd_data(infd, outfd);
     if (ret < 0) {
-	errp(53, __func__, "fclose error for %s: %s", dest, strerror(errno));
-	not_reached();
-    }
-
-    /*
-     * first check that the bytes read in is the same as the bytes written
-     */
-    if (outbytes != inbytes) {
-        err(54, __func__, "error: read %zu bytes out of expected %zu bytes", inbytes, outbytes);
+        errp(47, __func__, "error reading %s or %s to verify the copy: %s", src, dest, strerror(errno));
         not_reached();
-    } else {
-        dbg(DBG_HIGH, "read in %zu bytes from dest file %s out of expected %zu bytes from src file %s",
-                inbytes, dest, outbytes, src);
-    }
-
-    /*
-     * we need to check that the buffer read from src file is the same as the
-     * buffer from the dest file (copy of src file)
-     */
-    if (memcmp(copy, buf, inbytes) != 0) {
-        err(55, __func__, "copy of src file %s is not the same as the contents of the dest file %s", src, dest);
+    } else if (ret != 0) {
+        err(48, __func__, "copy of src file %s is not the same as the contents of the dest file %s", src, dest);
         not_reached();
     } else {
         dbg(DBG_HIGH, "copy of src file %s is identical to dest file %s", src, dest);
     }
 
     /*
-     * now we need to free the read in data (buf and copy)
+     * close the src file
      */
-    if (buf != NULL) {
-        free(buf);
-        buf = NULL;
-    }
-    if (copy != NULL) {
-        free(copy);
-        copy = NULL;
+    errno = 0;			/* pre-clear errno for errp() */
+    ret = close(infd);
+    if (ret < 0) {
+	errp(49, __func__, "close error for %s: %s", src, strerror(errno));
+	not_reached();
     }
 
     /*
@@ -95,6 +95,12 @@
 #define EXIT_FFLUSH_FAILED (-4)		/* invalid exit code - fflush() failed */
 #define EXIT_NULL_ARGS (-5)		/* invalid exit code - function called with a NULL arg */
 
+/*
+ * copyfile() buffer sizes
+ */
+#define COPYFILE_BUFSIZ (64*1024)	/* read/write copy and verify chunk size */
+#define COPYFILE_CHUNK (1024*1024*1024)	/* max bytes per copy_file_range(2) or sendfile(2) call */
+
 /*
  * st_mode related convenience macros
  *
@@ -28,6 +28,8 @@ extern "C" {
 
 #define iocccsize_warnx(...)	warn(__func__, __VA_ARGS__)
 
+#define iocccsize_warnx_name(name, ...)	warn((name), __VA_ARGS__)
+
 #define iocccsize_errx(ex, ...) { \
 	err((ex), __func__, __VA_ARGS__); \
 }
@@ -85,6 +87,12 @@ extern "C" {
 	(void) fputc('\n', stderr); \
 }
 
+#define iocccsize_warnx_name(name, ...) { \
+	(void) (name); \
+	(void) fprintf(stderr, __VA_ARGS__); \
+	(void) fputc('\n', stderr); \
+}
+
 #define iocccsize_errx(ex, ...) { \
 	(void) fprintf(stderr, __VA_ARGS__); \
 	(void) fputc('\n', stderr); \
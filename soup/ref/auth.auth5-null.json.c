@@ -0,0 +1,82 @@
+/*
+ * chk_sem_auth - check .auth.json semantics
+ *
+ * "Because grammar and syntax alone do not make a complete language." :-)
+ *
+ * The concept of this file was developed by:
+ *
+ *	chongo (Landon Curt Noll, http://www.isthe.com/chongo/index.html) /\oo/\
+ *
+ * and it was auto-generated by:
+ *
+ *	make mkchk_sem
+ *
+ * The JSON parser was co-developed in 2022 by:
+ *
+ *	@xexyl
+ *	https://xexyl.net		Cody Boone Ferguson
+ *	https://ioccc.xexyl.net
+ * and:
+ *	chongo (Landon Curt Noll, http://www.isthe.com/chongo/index.html) /\oo/\
+ *
+ * "Because sometimes even the IOCCC Judges need some help." :-)
+ *
+ * "Share and Enjoy!"
+ *     --  Sirius Cybernetics Corporation Complaints Division, JSON spec department. :-)
+ */
+
+
+/* special comments for the seqcexit tool */
+/* exit code out of numerical order - ignore in sequencing - ooo */
+/* exit code change of order - use new value in sequencing - coo */
+
+
+/*
+ * chk_sem_auth - check .auth.json semantics
+ */
+#include "chk_sem_auth.h"
+
+
+struct json_sem sem_auth[SEM_AUTH_LEN+1] = {
+/* depth    type        min     max   count   index  name_len validate  name    data */
+  { 5,	JTYPE_NUMBER,	1,	5,	5,	0,	0,	NULL,	NULL,	NULL },
+  { 5,	JTYPE_STRING,	1,	75,	75,	1,	0,	NULL,	NULL,	NULL },
+  { 5,	JTYPE_BOOL,	1,	10,	10,	2,	0,	NULL,	NULL,	NULL },
+  { 5,	JTYPE_NULL,	1,	30,	30,	3,	0,	NULL,	NULL,	NULL },
+  { 4,	JTYPE_MEMBER,	1,	5,	5,	4,	11,	chk_affiliation,	"affiliation",	NULL },
+  { 4,	JTYPE_MEMBER,	1,	5,	5,	5,	7,	chk_alt_url,	"alt_url",	NULL },
+  { 4,	JTYPE_MEMBER,	1,	5,	5,	6,	13,	chk_author_handle,	"author_handle",	NULL },
+  { 4,	JTYPE_MEMBER,	1,	5,	5,	7,	13,	chk_author_number,	"author_number",	NULL },
+  { 4,	JTYPE_MEMBER,	1,	5,	5,	8,	14,	chk_default_handle,	"default_handle",	NULL },
+  { 4,	JTYPE_MEMBER,	1,	5,	5,	9,	5,	chk_email,	"email",	NULL },
+  { 4,	JTYPE_MEMBER,	1,	5,	5,	10,	6,	chk_github,	"github",	NULL },
+  { 4,	JTYPE_MEMBER,	1,	5,	5,	11,	13,	chk_location_code,	"location_code",	NULL },
+  { 4,	JTYPE_MEMBER,	1,	5,	5,	12,	8,	chk_mastodon,	"mastodon",	NULL },
+  { 4,	JTYPE_MEMBER,	1,	5,	5,	13,	4,	chk_name,	"name",	NULL },
+  { 4,	JTYPE_MEMBER,	1,	5,	5,	14,	19,	chk_past_winning_author,	"past_winning_author",	NULL },
+  { 4,	JTYPE_MEMBER,	1,	5,	5,	15,	3,	chk_url,	"url",	NULL },
+  { 3,	JTYPE_OBJECT,	1,	5,	5,	16,	0,	NULL,	NULL,	NULL },
+  { 2,	JTYPE_NUMBER,	1,	6,	6,	17,	0,	NULL,	NULL,	NULL },
+  { 2,	JTYPE_STRING,	1,	26,	26,	18,	0,	NULL,	NULL,	NULL },
+  { 2,	JTYPE_BOOL,	1,	1,	1,	19,	0,	NULL,	NULL,	NULL },
+  { 2,	JTYPE_ARRAY,	1,	1,	1,	20,	0,	NULL,	NULL,	NULL },
+  { 1,	JTYPE_MEMBER,	1,	1,	1,	21,	18,	chk_IOCCC_auth_version,	"IOCCC_auth_version",	NULL },
+  { 1,	JTYPE_MEMBER,	1,	1,	1,	22,	13,	chk_IOCCC_contest,	"IOCCC_contest",	NULL },
+  { 1,	JTYPE_MEMBER,	1,	1,	1,	23,	16,	chk_IOCCC_contest_id,	"IOCCC_contest_id",	NULL },
+  { 1,	JTYPE_MEMBER,	1,	1,	1,	24,	10,	chk_IOCCC_year,	"IOCCC_year",	NULL },
+  { 1,	JTYPE_MEMBER,	1,	1,	1,	25,	12,	chk_author_count,	"author_count",	NULL },
+  { 1,	JTYPE_MEMBER,	1,	1,	1,	26,	7,	chk_authors,	"authors",	NULL },
+  { 1,	JTYPE_MEMBER,	1,	1,	1,	27,	17,	chk_chksubmit_version,	"chksubmit_version",	NULL },
+  { 1,	JTYPE_MEMBER,	1,	1,	1,	28,	15,	chk_fnamchk_version,	"fnamchk_version",	NULL },
+  { 1,	JTYPE_MEMBER,	1,	1,	1,	29,	16,	chk_formed_timestamp,	"formed_timestamp",	NULL },
+  { 1,	JTYPE_MEMBER,	1,	1,	1,	30,	21,	chk_formed_timestamp_usec,	"formed_timestamp_usec",	NULL },
+  { 1,	JTYPE_MEMBER,	1,	1,	1,	31,	13,	chk_min_timestamp,	"min_timestamp",	NULL },
+  { 1,	JTYPE_MEMBER,	1,	1,	1,	32,	20,	chk_mkiocccentry_version,	"mkiocccentry_version",	NULL },
+  { 1,	JTYPE_MEMBER,	1,	1,	1,	33,	10,	chk_no_comment,	"no_comment",	NULL },
+  { 1,	JTYPE_MEMBER,	1,	1,	1,	34,	11,	chk_submit_slot,	"submit_slot",	NULL },
+  { 1,	JTYPE_MEMBER,	1,	1,	1,	35,	7,	chk_tarball,	"tarball",	NULL },
+  { 1,	JTYPE_MEMBER,	1,	1,	1,	36,	9,	chk_test_mode,	"test_mode",	NULL },
+  { 1,	JTYPE_MEMBER,	1,	1,	1,	37,	15,	chk_timestamp_epoch,	"timestamp_epoch",	NULL },
+  { 0,	JTYPE_OBJECT,	1,	1,	1,	38,	0,	NULL,	NULL,	NULL },
+  { 0,	JTYPE_UNSET,	0,	0,	0,	-1,	0,	NULL,	NULL,	NULL }
+};
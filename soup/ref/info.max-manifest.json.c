@@ -0,0 +1,93 @@
+/*
+ * chk_sem_info - check .info.json semantics
+ *
+ * "Because grammar and syntax alone do not make a complete language." :-)
+ *
+ * The concept of this file was developed by:
+ *
+ *	chongo (Landon Curt Noll, http://www.isthe.com/chongo/index.html) /\oo/\
+ *
+ * and it was was auto-generated by:
+ *
+ *	make mkchk_sem
+ *
+ * The JSON parser was co-developed in 2022 by:
+ *
+ *	@xexyl
+ *	https://xexyl.net		Cody Boone Ferguson
+ *	https://ioccc.xexyl.net
+ * and:
+ *	chongo (Landon Curt Noll, http://www.isthe.com/chongo/index.html) /\oo/\
+ *
+ * "Because sometimes even the IOCCC Judges need some help." :-)
+ *
+ * "Share and Enjoy!"
+ *     --  Sirius Cybernetics Corporation Complaints Division, JSON spec department. :-)
+ */
+
+
+/* special comments for the seqcexit tool */
+/* exit code out of numerical order - ignore in sequencing - ooo */
+/* exit code change of order - use new value in sequencing - coo */
+
+
+/*
+ * chk_sem_info - check .info.json semantics
+ */
+#include "chk_sem_info.h"
+
+
+struct json_sem sem_info[SEM_INFO_LEN+1] = {
+/* depth    type        min     max   count   index  name_len validate  name    data */
+  { 5,	JTYPE_STRING,	1,	80,	80,	0,	0,	NULL,	NULL,	NULL },
+  { 4,	JTYPE_MEMBER,	1,	1,	1,	1,	8,	chk_Makefile,	"Makefile",	NULL },
+  { 4,	JTYPE_MEMBER,	1,	1,	1,	2,	9,	chk_auth_JSON,	"auth_JSON",	NULL },
+  { 4,	JTYPE_MEMBER,	1,	1,	1,	3,	9,	chk_c_alt_src,	"c_alt_src",	NULL },
+  { 4,	JTYPE_MEMBER,	1,	1,	1,	4,	5,	chk_c_src,	"c_src",	NULL },
+  { 4,	JTYPE_MEMBER,	1,	31,	31,	5,	10,	chk_extra_file,	"extra_file",	NULL },
+  { 4,	JTYPE_MEMBER,	1,	1,	1,	6,	9,	chk_info_JSON,	"info_JSON",	NULL },
+  { 4,	JTYPE_MEMBER,	1,	1,	1,	7,	7,	chk_remarks,	"remarks",	NULL },
+  { 4,	JTYPE_MEMBER,	1,	1,	1,	8,	12,	chk_shell_script,	"shell_script",	NULL },
+  { 4,	JTYPE_MEMBER,	1,	1,	1,	9,	10,	chk_try_alt_sh,	"try_alt_sh",	NULL },
+  { 4,	JTYPE_MEMBER,	1,	1,	1,	10,	6,	chk_try_sh,	"try_sh",	NULL },
+  { 3,	JTYPE_OBJECT,	1,	40,	40,	11,	0,	NULL,	NULL,	NULL },
+  { 2,	JTYPE_NUMBER,	1,	7,	7,	12,	0,	NULL,	NULL,	NULL },
+  { 2,	JTYPE_STRING,	1,	46,	46,	13,	0,	NULL,	NULL,	NULL },
+  { 2,	JTYPE_BOOL,	1,	12,	12,	14,	0,	NULL,	NULL,	NULL },
+  { 2,	JTYPE_ARRAY,	1,	1,	1,	15,	0,	NULL,	NULL,	NULL },
+  { 1,	JTYPE_MEMBER,	1,	1,	1,	16,	13,	chk_IOCCC_contest,	"IOCCC_contest",	NULL },
+  { 1,	JTYPE_MEMBER,	1,	1,	1,	17,	16,	chk_IOCCC_contest_id,	"IOCCC_contest_id",	NULL },
+  { 1,	JTYPE_MEMBER,	1,	1,	1,	18,	18,	chk_IOCCC_info_version,	"IOCCC_info_version",	NULL },
+  { 1,	JTYPE_MEMBER,	1,	1,	1,	19,	10,	chk_IOCCC_year,	"IOCCC_year",	NULL },
+  { 1,	JTYPE_MEMBER,	1,	1,	1,	20,	17,	chk_Makefile_override,	"Makefile_override",	NULL },
+  { 1,	JTYPE_MEMBER,	1,	1,	1,	21,	8,	chk_abstract,	"abstract",	NULL },
+  { 1,	JTYPE_MEMBER,	1,	1,	1,	22,	17,	chk_chksubmit_version,	"chksubmit_version",	NULL },
+  { 1,	JTYPE_MEMBER,	1,	1,	1,	23,	14,	chk_empty_override,	"empty_override",	NULL },
+  { 1,	JTYPE_MEMBER,	1,	1,	1,	24,	15,	chk_fnamchk_version,	"fnamchk_version",	NULL },
+  { 1,	JTYPE_MEMBER,	1,	1,	1,	25,	16,	chk_formed_timestamp,	"formed_timestamp",	NULL },
+  { 1,	JTYPE_MEMBER,	1,	1,	1,	26,	21,	chk_formed_timestamp_usec,	"formed_timestamp_usec",	NULL },
+  { 1,	JTYPE_MEMBER,	1,	1,	1,	27,	14,	chk_found_all_rule,	"found_all_rule",	NULL },
+  { 1,	JTYPE_MEMBER,	1,	1,	1,	28,	16,	chk_found_clean_rule,	"found_clean_rule",	NULL },
+  { 1,	JTYPE_MEMBER,	1,	1,	1,	29,	18,	chk_found_clobber_rule,	"found_clobber_rule",	NULL },
+  { 1,	JTYPE_MEMBER,	1,	1,	1,	30,	14,	chk_found_try_rule,	"found_try_rule",	NULL },
+  { 1,	JTYPE_MEMBER,	1,	1,	1,	31,	17,	chk_iocccsize_version,	"iocccsize_version",	NULL },
+  { 1,	JTYPE_MEMBER,	1,	1,	1,	32,	8,	chk_manifest,	"manifest",	NULL },
+  { 1,	JTYPE_MEMBER,	1,	1,	1,	33,	13,	chk_min_timestamp,	"min_timestamp",	NULL },
+  { 1,	JTYPE_MEMBER,	1,	1,	1,	34,	20,	chk_mkiocccentry_version,	"mkiocccentry_version",	NULL },
+  { 1,	JTYPE_MEMBER,	1,	1,	1,	35,	10,	chk_no_comment,	"no_comment",	NULL },
+  { 1,	JTYPE_MEMBER,	1,	1,	1,	36,	16,	chk_rule_2a_mismatch,	"rule_2a_mismatch",	NULL },
+  { 1,	JTYPE_MEMBER,	1,	1,	1,	37,	16,	chk_rule_2a_override,	"rule_2a_override",	NULL },
+  { 1,	JTYPE_MEMBER,	1,	1,	1,	38,	12,	chk_rule_2a_size,	"rule_2a_size",	NULL },
+  { 1,	JTYPE_MEMBER,	1,	1,	1,	39,	16,	chk_rule_2b_override,	"rule_2b_override",	NULL },
+  { 1,	JTYPE_MEMBER,	1,	1,	1,	40,	12,	chk_rule_2b_size,	"rule_2b_size",	NULL },
+  { 1,	JTYPE_MEMBER,	1,	1,	1,	41,	11,	chk_submit_slot,	"submit_slot",	NULL },
+  { 1,	JTYPE_MEMBER,	1,	1,	1,	42,	7,	chk_tarball,	"tarball",	NULL },
+  { 1,	JTYPE_MEMBER,	1,	1,	1,	43,	9,	chk_test_mode,	"test_mode",	NULL },
+  { 1,	JTYPE_MEMBER,	1,	1,	1,	44,	15,	chk_timestamp_epoch,	"timestamp_epoch",	NULL },
+  { 1,	JTYPE_MEMBER,	1,	1,	1,	45,	5,	chk_title,	"title",	NULL },
+  { 1,	JTYPE_MEMBER,	1,	1,	1,	46,	16,	chk_trigraph_warning,	"trigraph_warning",	NULL },
+  { 1,	JTYPE_MEMBER,	1,	1,	1,	47,	14,	chk_txzchk_version,	"txzchk_version",	NULL },
+  { 1,	JTYPE_MEMBER,	1,	1,	1,	48,	14,	chk_ungetc_warning,	"ungetc_warning",	NULL },
+  { 0,	JTYPE_OBJECT,	1,	1,	1,	49,	0,	NULL,	NULL,	NULL },
+  { 0,	JTYPE_UNSET,	0,	0,	0,	-1,	0,	NULL,	NULL,	NULL }
+};
@@ -55,12 +55,17 @@
 #include "iocccsize_err.h"
 #include "limit_ioccc.h"
 #include "../iocccsize.h"
+/*
+ * c_reserved - C reserved words, plus a few #preprocessor tokens
+ */
+#include "../jparse/c_reserved.h"
 #else /* MKIOCCCENTRY_USE */
 #include "iocccsize_err.h"
 #include "iocccsize.h"
+#include "c_reserved.h"
 #endif /* MKIOCCCENTRY_USE */
 
-#define STRLEN(s)		(sizeof (s)-1)
+#define RULE_COUNT_BLOCK	(64*1024)	/* initial rule_count() read block size */
 
 #define NO_STRING		0
 #define NO_COMMENT		0
@@ -79,7 +84,7 @@ char const * const iocccsize_version = IOCCCSIZE_VERSION;
  * IOCCC judges. It may not represent the opinion of all those involved
  * with this code nor the International Obfuscated C Code Contest as a whole:
  *
- * The long list of reserved words below should be a source
+ * The long list of reserved words in c_reserved.h should be a source
  * of embarrassment to some of those involved in standardizing C.
  * The growing list of reserved words, along with an expanding set of
  * linguistic inventions has the appearance of feature
@@ -100,145 +105,17 @@ char const * const iocccsize_version = IOCCCSIZE_VERSION;
  */
 
 /*
- * C reserved words, plus a few #preprocessor tokens, that count as 1
- *
- * NOTE: For a good list of reserved words in C, see:
- *
- *	http://www.bezem.de/pdf/ReservedWordsInC.pdf
- *
- * by Johan Bezem of JB Enterprises:
- *
- *	See http://www.bezem.de/en/
+ * C reserved words, plus a few #preprocessor tokens, that count as 1,
+ * are recognized by c_reserved() from c_reserved.h.
  */
-typedef struct {
-	size_t length;
-	const char *word;
-} Word;
-
-static Word cwords[] = {
-	/* Yes Virginia, we left #define off the list on purpose!  K&R */
-	{ STRLEN("#elif"), "#elif" } ,				/* K&R */
-	{ STRLEN("#elifdef"), "#elifdef" } ,			/* +C23 */
-	{ STRLEN("#elifndef"), "#elifndef" } ,			/* +C23 */
-	{ STRLEN("#else"), "#else" } ,				/* K&R */
-	{ STRLEN("#embed"), "#embed" } ,			/* +C23 */
-	{ STRLEN("#endif"), "#endif" } ,			/* K&R */
-	{ STRLEN("#error"), "#error" } ,			/* +C89 */
-	{ STRLEN("#ident"), "#ident" } ,			/* gcc */
-	{ STRLEN("#if"), "#if" } ,				/* K&R */
-	{ STRLEN("#ifdef"), "#ifdef" } ,			/* K&R */
-	{ STRLEN("#ifndef"), "#ifndef" } ,			/* K&R */
-	{ STRLEN("#include"), "#include" } ,			/* K&R */
-	{ STRLEN("#line"), "#line" } ,				/* K*R */
-	{ STRLEN("#pragma"), "#pragma" } ,			/* +C89 */
-	{ STRLEN("#sccs"), "#sccs" } ,				/* gcc */
-	{ STRLEN("#warning"), "#warning" } ,			/* +C23 */
-	{ STRLEN("#undef"), "#undef" } ,			/* K&R */
-
-	{ STRLEN("_Alignas"), "_Alignas" } ,			/* +C11 */
-	{ STRLEN("_Alignof"), "_Alignof" } ,			/* +C11 */
-	{ STRLEN("_Atomic"), "_Atomic" } ,			/* +C11 */
-	{ STRLEN("_BitInt"), "_BitInt" } ,			/* +C23 */
-	{ STRLEN("_Bool"), "_Bool" } ,				/* +C99 */
-	{ STRLEN("_Complex"), "_Complex" } ,			/* +C99 */
-	{ STRLEN("_Decimal128"), "_Decimal128" } ,		/* +C23 */
-	{ STRLEN("_Decimal64"), "_Decimal64" } ,		/* +C23 */
-	{ STRLEN("_Decimal32"), "_Decimal32" } ,		/* +C23 */
-	{ STRLEN("_Generic"), "_Generic" } ,			/* +C11 */
-	{ STRLEN("_Imaginary"), "_Imaginary" } ,		/* +C99 */
-	{ STRLEN("_Noreturn"), "_Noreturn" } ,			/* +C11 */
-	{ STRLEN("_Pragma"), "_Pragma" } ,			/* +C99 */
-	{ STRLEN("_Static_assert"), "_Static_assert" } ,	/* +C11 */
-	{ STRLEN("_Thread_local"), "_Thread_local" } ,		/* +C11 */
-
-	{ STRLEN("alignas"), "alignas" } ,			/* +C23 */
-	{ STRLEN("alignof"), "alignof" } ,			/* +C23 */
-	{ STRLEN("and"), "and" } ,				/* +C89 iso646.h */
-	{ STRLEN("and_eq"), "and_eq" } ,			/* +C89 iso646.h */
-	{ STRLEN("auto"), "auto" } ,				/* K&R */
-	{ STRLEN("bitand"), "bitand" } ,			/* +C89 iso646.h */
-	{ STRLEN("bitor"), "bitor" } ,				/* +C89 iso646.h */
-	{ STRLEN("bool"), "bool" } ,				/* +C23 */
-	{ STRLEN("break"), "break" } ,				/* K&R */
-	{ STRLEN("case"), "case" } ,				/* K&R */
-	{ STRLEN("char"), "char" } ,				/* K&R */
-	{ STRLEN("compl"), "compl" } ,				/* +C89 iso646.h */
-	{ STRLEN("const"), "const" } ,				/* +C89 */
-	{ STRLEN("constexpr"), "constexpr" } ,			/* +C23 */
-	{ STRLEN("continue"), "continue" } ,			/* K&R */
-	{ STRLEN("default"), "default" } ,			/* K&R */
-	{ STRLEN("do"), "do" } ,				/* K&R */
-	{ STRLEN("double"), "double" } ,			/* K&R */
-	{ STRLEN("else"), "else" } ,				/* K&R */
-	{ STRLEN("enum"), "enum" } ,				/* +C89 */
-	{ STRLEN("extern"), "extern" } ,			/* K&R */
-	{ STRLEN("false"), "false" } ,				/* +C23 */
-	{ STRLEN("float"), "float" } ,				/* K&R */
-	{ STRLEN("for"), "for" } ,				/* K&R */
-	{ STRLEN("goto"), "goto" } ,				/* K&R */
-	{ STRLEN("if"), "if" } ,				/* K&R */
-	{ STRLEN("inline"), "inline" } ,			/* +C99 */
-	{ STRLEN("int"), "int" } ,				/* K&R */
-	{ STRLEN("long"), "long" } ,				/* K&R */
-	{ STRLEN("noreturn"), "noreturn" } ,			/* +C23 */
-	{ STRLEN("not"), "not" } ,				/* +C89 iso646.h */
-	{ STRLEN("not_eq"), "not_eq" } ,			/* +C89 iso646.h */
-	{ STRLEN("nullptr"), "nullptr" } ,			/* +C23 */
-	{ STRLEN("or"), "or" } ,				/* +C89 iso646.h */
-	{ STRLEN("or_eq"), "or_eq" } ,				/* +C89 iso646.h */
-	{ STRLEN("register"), "register" } ,			/* K&R */
-	{ STRLEN("restrict"), "restrict" } ,			/* +C99 */
-	{ STRLEN("return"), "return" } ,			/* K&R */
-	{ STRLEN("short"), "short" } ,				/* K&R */
-	{ STRLEN("signed"), "signed" } ,			/* K&R */
-	{ STRLEN("sizeof"), "sizeof" } ,			/* K&R */
-	{ STRLEN("static"), "static" } ,			/* K&R */
-	{ STRLEN("static_assert"), "static_assert" } ,		/* +C23 */
-	{ STRLEN("struct"), "struct" } ,			/* K&R */
-	{ STRLEN("switch"), "switch" } ,			/* K&R */
-	{ STRLEN("thread_local"), "thread_local" } ,		/* +C23 */
-	{ STRLEN("true"), "true" } ,				/* +C23 */
-	{ STRLEN("typedef"), "typedef" } ,			/* K&R */
-	{ STRLEN("typeof"), "typeof" } ,			/* +C23 */
-	{ STRLEN("typeof_unequal"), "typeof_unequal" } ,	/* +C23 */
-	{ STRLEN("union"), "union" } ,				/* K&R */
-	{ STRLEN("unsigned"), "unsigned" } ,			/* K&R */
-	{ STRLEN("void"), "void" } ,				/* +C89 */
-	{ STRLEN("volatile"), "volatile" } ,			/* +C89 */
-	{ STRLEN("while"), "while" } ,				/* K&R */
-	{ STRLEN("xor"), "xor" } ,				/* +C89 iso646.h */
-	{ STRLEN("xor_eq"), "xor_eq" } ,			/* +C89 iso646.h */
-
-	{ 0, NULL }
-};
 
 
 /*
- * find_member - find an entry in a word table
+ * rule_count_stream - count data on file stream, according to Rule 2a and Rule 2b
  *
- * given:
- *	table		table of words to scan
- *	string		word to find in the table
- *
- * returns:
- *	NULL ==> string is not in the table,
- *	!= NULL ==> table entry that matches string
- */
-static Word *
-find_member(Word *table, const char *string)
-{
-	Word *w;
-	for (w = table; w->length != 0; w++) {
-		if (strcmp(string, w->word) == 0) {
-			return w;
-		}
-	}
-	return NULL;
-}
-
-
-/*
- * rule_count - count data on file stream, according to Rule 2a and Rule 2b
+ * This is the legacy byte-at-a-time engine that pulls every byte through
+ * fgetc() and uses ungetc() for lookahead.  It is retained as a reference
+ * for rule_count_buf() and for benchmarking.
  *
  * In addition to the Rule 2a and Rule 2b counting, count keywords.
  * We also warn about various situations such found high-bit or non-ASCII character,
@@ -252,7 +129,7 @@ find_member(Word *table, const char *string)
  *	RuleCount information
  */
 RuleCount
-rule_count(FILE *fp_in)
+rule_count_stream(FILE *fp_in)
 {
 	size_t wordi = 0;
 	char word[WORD_BUFFER_SIZE];
@@ -423,7 +300,7 @@ rule_count(FILE *fp_in)
 		 * be whitespace or comments between # and word.
 		 */
 		if ((word[0] != '#' || 1 < wordi) && !isalnum(ch) && ch != '_' && ch != '#') {
-			if (find_member(cwords, word) != NULL) {
+			if (c_reserved(word, wordi)) {
 				/* Count keyword as 1. */
 				counts.rule_2b_size = counts.rule_2b_size - wordi + 1;
 				counts.keywords++;
@@ -469,6 +346,680 @@ rule_count(FILE *fp_in)
 }
 
 
+/*
+ * Bulk classifier for rule_count_buf()
+ *
+ * Outside of the interesting places (comment, string and keyword boundaries,
+ * trigraphs, digraphs, backslash newlines, CR and NUL), every byte has one of
+ * only three effects:
+ *
+ *	whitespace			counts toward Rule 2a only
+ *	'{', ';' or '}' before space	counts toward Rule 2a only
+ *	anything else			counts toward Rule 2a and Rule 2b
+ *
+ * provided that the byte cannot change the word being collected and cannot
+ * change the string or comment state.  The classifier finds the longest run
+ * of such "plain" bytes, so that rule_count_buf() may account for the whole
+ * run at once and drop back to the state machine at the first "stop" byte.
+ *
+ * The stop bytes depend on the state:
+ *
+ *	code		alphanumerics, '_', '#', '/', '\'', '"', '\\'
+ *	string		'\\' and the closing quote
+ *	block comment	'*' and '\\'
+ *	EOL comment	'\n' and '\\'
+ *
+ * and in all states CR, NUL, non-ASCII bytes, '?' (with TRIGRAPHS), the
+ * digraph punctuators in code (with DIGRAPHS), and a '{', ';' or '}' that is
+ * followed by CR or by the end of the buffer.
+ *
+ * Non-ASCII bytes stop the run so that the locale dependent isspace() and
+ * isalnum() of the state machine are never second guessed.
+ */
+
+/*
+ * rc_stop - determine if a byte stops a run of plain bytes
+ *
+ * given:
+ *	b		byte to classify
+ *	quote		NO_STRING or the open quote character
+ *	is_comment	NO_COMMENT, COMMENT_EOL or COMMENT_BLOCK
+ *
+ * returns:
+ *	true ==> b must be processed by the state machine
+ *	false ==> b is a plain byte
+ */
+static inline bool
+rc_stop(int b, int quote, int is_comment)
+{
+	if (b >= 0x80 || b == '\r' || b == '\0' || b == '\\') {
+		return true;
+	}
+#ifdef TRIGRAPHS
+	if (b == '?') {
+		return true;
+	}
+#endif
+	if (quote != NO_STRING) {
+		return b == quote;
+	}
+	if (is_comment == COMMENT_BLOCK) {
+		return b == '*';
+	}
+	if (is_comment == COMMENT_EOL) {
+		return b == '\n';
+	}
+#ifdef DIGRAPHS
+	if (b == '<' || b == ':' || b == '%' || b == '>') {
+		return true;
+	}
+#endif
+	return isalnum(b) || b == '_' || b == '#' || b == '/' || b == '\'' || b == '"';
+}
+
+
+/*
+ * rc_space - ASCII whitespace other than CR, i.e. isspace() in the C locale
+ */
+#define rc_space(b)	((b) == ' ' || ((b) >= '\t' && (b) <= '\f'))
+/*
+ * rc_brace - '{', ';' or '}'
+ */
+#define rc_brace(b)	((b) == '{' || (b) == ';' || (b) == '}')
+
+
+/*
+ * rc_skip_scalar - find a run of plain bytes, one byte at a time
+ *
+ * given:
+ *	p		buffer being counted
+ *	i		offset in p where the run starts
+ *	len		length of p
+ *	quote		NO_STRING or the open quote character
+ *	is_comment	NO_COMMENT, COMMENT_EOL or COMMENT_BLOCK
+ *	skip2b		number of bytes in the run that do not count toward Rule 2b
+ *
+ * returns:
+ *	length of the run of plain bytes starting at offset i
+ */
+static size_t
+rc_skip_scalar(const unsigned char *p, size_t i, size_t len, int quote, int is_comment, size_t *skip2b)
+{
+	size_t start = i;
+	size_t skip = 0;
+	int b;
+
+	for (; i < len; ++i) {
+		b = p[i];
+		if (rc_stop(b, quote, is_comment)) {
+			break;
+		}
+		if (rc_space(b)) {
+			++skip;
+		} else if (rc_brace(b)) {
+			if (i+1 >= len || p[i+1] == '\r') {
+				break;
+			}
+			if (rc_space(p[i+1])) {
+				++skip;
+			}
+		}
+	}
+	*skip2b = skip;
+	return i - start;
+}
+
+
+#if defined(__SSE2__) && defined(__GNUC__)
+#include <emmintrin.h>
+/*
+ * The AVX2 classifier is compiled for the avx2 target whatever the -march,
+ * and used only if the CPU that runs it has AVX2.
+ */
+#if defined(__x86_64__) || defined(__i386__)
+#define RC_AVX2
+#include <immintrin.h>
+#endif
+
+/*
+ * RC_SSE2_IN - SSE2 lanes where lo <= byte <= hi (unsigned)
+ */
+#define RC_SSE2_IN(v, lo, hi) \
+	_mm_cmpeq_epi8(_mm_min_epu8(_mm_sub_epi8((v), _mm_set1_epi8((char)(lo))), \
+				    _mm_set1_epi8((char)((hi)-(lo)))), \
+		       _mm_sub_epi8((v), _mm_set1_epi8((char)(lo))))
+#define RC_SSE2_EQ(v, c)	_mm_cmpeq_epi8((v), _mm_set1_epi8((char)(c)))
+
+
+/*
+ * rc_stop_sse2 - SSE2 lanes holding stop bytes, see rc_stop()
+ */
+static inline __m128i
+rc_stop_sse2(__m128i v, int quote, int is_comment)
+{
+	__m128i stop;
+
+	/* non-ASCII, CR, NUL and backslash stop in all states */
+	stop = _mm_cmplt_epi8(v, _mm_setzero_si128());
+	stop = _mm_or_si128(stop, RC_SSE2_EQ(v, '\r'));
+	stop = _mm_or_si128(stop, RC_SSE2_EQ(v, '\0'));
+	stop = _mm_or_si128(stop, RC_SSE2_EQ(v, '\\'));
+#ifdef TRIGRAPHS
+	stop = _mm_or_si128(stop, RC_SSE2_EQ(v, '?'));
+#endif
+	if (quote != NO_STRING) {
+		return _mm_or_si128(stop, RC_SSE2_EQ(v, quote));
+	}
+	if (is_comment == COMMENT_BLOCK) {
+		return _mm_or_si128(stop, RC_SSE2_EQ(v, '*'));
+	}
+	if (is_comment == COMMENT_EOL) {
+		return _mm_or_si128(stop, RC_SSE2_EQ(v, '\n'));
+	}
+#ifdef DIGRAPHS
+	stop = _mm_or_si128(stop, RC_SSE2_EQ(v, '<'));
+	stop = _mm_or_si128(stop, RC_SSE2_EQ(v, ':'));
+	stop = _mm_or_si128(stop, RC_SSE2_EQ(v, '%'));
+	stop = _mm_or_si128(stop, RC_SSE2_EQ(v, '>'));
+#endif
+	stop = _mm_or_si128(stop, RC_SSE2_IN(v, '0', '9'));
+	stop = _mm_or_si128(stop, RC_SSE2_IN(v, 'A', 'Z'));
+	stop = _mm_or_si128(stop, RC_SSE2_IN(v, 'a', 'z'));
+	stop = _mm_or_si128(stop, RC_SSE2_EQ(v, '_'));
+	stop = _mm_or_si128(stop, RC_SSE2_EQ(v, '#'));
+	stop = _mm_or_si128(stop, RC_SSE2_EQ(v, '/'));
+	stop = _mm_or_si128(stop, RC_SSE2_EQ(v, '\''));
+	return _mm_or_si128(stop, RC_SSE2_EQ(v, '"'));
+}
+
+
+/*
+ * rc_skip_sse2 - find a run of plain bytes, 16 bytes at a time
+ *
+ * Blocks are only examined while the byte after the block is within the
+ * buffer, so that a '{', ';' or '}' in the last lane can see what follows.
+ * The tail of a run is finished by rc_skip_scalar().
+ *
+ * given:
+ *	see rc_skip_scalar()
+ *
+ * returns:
+ *	length of the run of plain bytes starting at offset i
+ */
+static size_t
+rc_skip_sse2(const unsigned char *p, size_t i, size_t len, int quote, int is_comment, size_t *skip2b)
+{
+	size_t start = i;
+	size_t skip = 0;
+	size_t tail;
+	__m128i v, nv, space, nspace, brace, stop;
+	unsigned int m_stop, m_skip, keep;
+
+	while (i + 16 < len) {
+		v = _mm_loadu_si128((const __m128i *) (p + i));
+		nv = _mm_loadu_si128((const __m128i *) (p + i + 1));
+
+		space = _mm_or_si128(RC_SSE2_EQ(v, ' '), RC_SSE2_IN(v, '\t', '\f'));
+		nspace = _mm_or_si128(RC_SSE2_EQ(nv, ' '), RC_SSE2_IN(nv, '\t', '\f'));
+		brace = _mm_or_si128(_mm_or_si128(RC_SSE2_EQ(v, '{'), RC_SSE2_EQ(v, ';')), RC_SSE2_EQ(v, '}'));
+
+		stop = rc_stop_sse2(v, quote, is_comment);
+		stop = _mm_or_si128(stop, _mm_and_si128(brace, RC_SSE2_EQ(nv, '\r')));
+
+		m_stop = (unsigned int) _mm_movemask_epi8(stop);
+		m_skip = (unsigned int) _mm_movemask_epi8(_mm_or_si128(space, _mm_and_si128(brace, nspace)));
+		if (m_stop == 0) {
+			skip += (size_t) __builtin_popcount(m_skip);
+			i += 16;
+			continue;
+		}
+		keep = (1U << __builtin_ctz(m_stop)) - 1;
+		skip += (size_t) __builtin_popcount(m_skip & keep);
+		*skip2b = skip;
+		return i + (size_t) __builtin_ctz(m_stop) - start;
+	}
+
+	i += rc_skip_scalar(p, i, len, quote, is_comment, &tail);
+	*skip2b = skip + tail;
+	return i - start;
+}
+
+
+#if defined(RC_AVX2)
+/*
+ * RC_AVX2_IN - AVX2 lanes where lo <= byte <= hi (unsigned)
+ */
+#define RC_AVX2_IN(v, lo, hi) \
+	_mm256_cmpeq_epi8(_mm256_min_epu8(_mm256_sub_epi8((v), _mm256_set1_epi8((char)(lo))), \
+					  _mm256_set1_epi8((char)((hi)-(lo)))), \
+			  _mm256_sub_epi8((v), _mm256_set1_epi8((char)(lo))))
+#define RC_AVX2_EQ(v, c)	_mm256_cmpeq_epi8((v), _mm256_set1_epi8((char)(c)))
+
+
+/*
+ * rc_stop_avx2 - AVX2 lanes holding stop bytes, see rc_stop()
+ */
+static inline __attribute__((target("avx2"))) __m256i
+rc_stop_avx2(__m256i v, int quote, int is_comment)
+{
+	__m256i stop;
+
+	/* non-ASCII, CR, NUL and backslash stop in all states */
+	stop = _mm256_cmpgt_epi8(_mm256_setzero_si256(), v);
+	stop = _mm256_or_si256(stop, RC_AVX2_EQ(v, '\r'));
+	stop = _mm256_or_si256(stop, RC_AVX2_EQ(v, '\0'));
+	stop = _mm256_or_si256(stop, RC_AVX2_EQ(v, '\\'));
+#ifdef TRIGRAPHS
+	stop = _mm256_or_si256(stop, RC_AVX2_EQ(v, '?'));
+#endif
+	if (quote != NO_STRING) {
+		return _mm256_or_si256(stop, RC_AVX2_EQ(v, quote));
+	}
+	if (is_comment == COMMENT_BLOCK) {
+		return _mm256_or_si256(stop, RC_AVX2_EQ(v, '*'));
+	}
+	if (is_comment == COMMENT_EOL) {
+		return _mm256_or_si256(stop, RC_AVX2_EQ(v, '\n'));
+	}
+#ifdef DIGRAPHS
+	stop = _mm256_or_si256(stop, RC_AVX2_EQ(v, '<'));
+	stop = _mm256_or_si256(stop, RC_AVX2_EQ(v, ':'));
+	stop = _mm256_or_si256(stop, RC_AVX2_EQ(v, '%'));
+	stop = _mm256_or_si256(stop, RC_AVX2_EQ(v, '>'));
+#endif
+	stop = _mm256_or_si256(stop, RC_AVX2_IN(v, '0', '9'));
+	stop = _mm256_or_si256(stop, RC_AVX2_IN(v, 'A', 'Z'));
+	stop = _mm256_or_si256(stop, RC_AVX2_IN(v, 'a', 'z'));
+	stop = _mm256_or_si256(stop, RC_AVX2_EQ(v, '_'));
+	stop = _mm256_or_si256(stop, RC_AVX2_EQ(v, '#'));
+	stop = _mm256_or_si256(stop, RC_AVX2_EQ(v, '/'));
+	stop = _mm256_or_si256(stop, RC_AVX2_EQ(v, '\''));
+	return _mm256_or_si256(stop, RC_AVX2_EQ(v, '"'));
+}
+
+
+/*
+ * rc_skip_avx2 - find a run of plain bytes, 32 bytes at a time
+ *
+ * NOTE: Only call this function if __builtin_cpu_supports("avx2").
+ *
+ * given:
+ *	see rc_skip_scalar()
+ *
+ * returns:
+ *	length of the run of plain bytes starting at offset i
+ */
+static __attribute__((target("avx2"))) size_t
+rc_skip_avx2(const unsigned char *p, size_t i, size_t len, int quote, int is_comment, size_t *skip2b)
+{
+	size_t start = i;
+	size_t skip = 0;
+	size_t tail;
+	__m256i v, nv, space, nspace, brace, stop;
+	unsigned int m_stop, m_skip, keep;
+
+	while (i + 32 < len) {
+		v = _mm256_loadu_si256((const __m256i *) (p + i));
+		nv = _mm256_loadu_si256((const __m256i *) (p + i + 1));
+
+		space = _mm256_or_si256(RC_AVX2_EQ(v, ' '), RC_AVX2_IN(v, '\t', '\f'));
+		nspace = _mm256_or_si256(RC_AVX2_EQ(nv, ' '), RC_AVX2_IN(nv, '\t', '\f'));
+		brace = _mm256_or_si256(_mm256_or_si256(RC_AVX2_EQ(v, '{'), RC_AVX2_EQ(v, ';')), RC_AVX2_EQ(v, '}'));
+
+		stop = rc_stop_avx2(v, quote, is_comment);
+		stop = _mm256_or_si256(stop, _mm256_and_si256(brace, RC_AVX2_EQ(nv, '\r')));
+
+		m_stop = (unsigned int) _mm256_movemask_epi8(stop);
+		m_skip = (unsigned int) _mm256_movemask_epi8(_mm256_or_si256(space, _mm256_and_si256(brace, nspace)));
+		if (m_stop == 0) {
+			skip += (size_t) __builtin_popcount(m_skip);
+			i += 32;
+			continue;
+		}
+		keep = (1U << __builtin_ctz(m_stop)) - 1;
+		skip += (size_t) __builtin_popcount(m_skip & keep);
+		*skip2b = skip;
+		return i + (size_t) __builtin_ctz(m_stop) - start;
+	}
+
+	i += rc_skip_sse2(p, i, len, quote, is_comment, &tail);
+	*skip2b = skip + tail;
+	return i - start;
+}
+#endif /* RC_AVX2 */
+#endif /* __SSE2__ && __GNUC__ */
+
+
+/*
+ * rc_skip - find a run of plain bytes with the requested bulk classifier
+ *
+ * given:
+ *	mode		RULE_COUNT_FAST_SCALAR, RULE_COUNT_FAST_SSE2 or RULE_COUNT_FAST_AVX2
+ *	see rc_skip_scalar() for the other args
+ *
+ * returns:
+ *	length of the run of plain bytes starting at offset i
+ */
+static size_t
+rc_skip(int mode, const unsigned char *p, size_t i, size_t len, int quote, int is_comment, size_t *skip2b)
+{
+#if defined(__SSE2__) && defined(__GNUC__)
+#if defined(RC_AVX2)
+	if (mode == RULE_COUNT_FAST_AVX2 && __builtin_cpu_supports("avx2")) {
+		return rc_skip_avx2(p, i, len, quote, is_comment, skip2b);
+	}
+#endif
+	if (mode == RULE_COUNT_FAST_SSE2 || mode == RULE_COUNT_FAST_AVX2) {
+		return rc_skip_sse2(p, i, len, quote, is_comment, skip2b);
+	}
+#endif
+	return rc_skip_scalar(p, i, len, quote, is_comment, skip2b);
+}
+
+
+/*
+ * rule_count_buf_mode - count data in a memory buffer, according to Rule 2a and Rule 2b
+ *
+ * This is the block-at-a-time engine behind rule_count().  Because the
+ * entire source is in memory, lookahead is simply an index into the buffer
+ * and no ungetc() pushback is needed.  The RuleCount results are identical
+ * to those of the legacy byte-at-a-time rule_count_stream() engine.
+ *
+ * Unless mode is RULE_COUNT_FAST_NONE, runs of plain bytes are accounted
+ * for in bulk by the rc_skip() classifier and the state machine below only
+ * sees the bytes that can change its state.
+ *
+ * given:
+ *	buf		buffer holding the source to count
+ *	len		length of buf in bytes
+ *	mode		RULE_COUNT_FAST_NONE, RULE_COUNT_FAST_SCALAR, RULE_COUNT_FAST_SSE2,
+ *			RULE_COUNT_FAST_AVX2 or RULE_COUNT_FAST_SIMD
+ *
+ * returns:
+ *	RuleCount information
+ */
+RuleCount
+rule_count_buf_mode(const char *buf, size_t len, int mode)
+{
+	const unsigned char *p = (const unsigned char *) buf;
+	size_t i = 0;
+	size_t run, skip2b;
+	size_t wordi = 0;
+	char word[WORD_BUFFER_SIZE];
+	RuleCount counts = { 0, 0, 0, false, false, false, false, false };
+	int ch, next_ch, quote = NO_STRING, escape = 0, is_comment = NO_COMMENT;
+
+/* Byte at offset j or EOF when beyond the end of the buffer. */
+#define BUF_CH(j)	((j) < len ? (int) p[(j)] : EOF)
+
+	/* Paranoia and to keep valgrind happy. */
+	(void) memset(word, 0, sizeof (word));
+
+	if (p == NULL) {
+		return counts;
+	}
+
+	while (i < len) {
+		/*
+		 * Bulk account for plain bytes.  This is only allowed when
+		 * no escape is pending and the word being collected is empty
+		 * or a lone '#' so that a plain byte cannot change it.
+		 */
+		if (mode != RULE_COUNT_FAST_NONE && escape == 0 &&
+		    (wordi == 0 || (wordi == 1 && word[0] == '#')) &&
+		    !rc_stop(p[i], quote, is_comment)) {
+			run = rc_skip(mode, p, i, len, quote, is_comment, &skip2b);
+			counts.rule_2a_size += run;
+			counts.rule_2b_size += run - skip2b;
+			i += run;
+			if (i >= len) {
+				break;
+			}
+		}
+
+		ch = p[i++];
+		if (ch == '\r') {
+			/* Discard bare CR and those part of CRLF. */
+			counts.rule_2a_size++;
+			continue;
+		}
+		if (ch == '\0') {
+			counts.nul_warning = true;
+			counts.rule_2a_size++;
+			continue;
+		}
+
+		/* Future gazing: next_ch is peeked, not consumed. */
+		while (i < len && p[i] == '\r') {
+			/* Discard bare CR and those part of CRLF. */
+			counts.rule_2a_size++;
+			i++;
+		}
+		next_ch = BUF_CH(i);
+#ifdef ASCII_ONLY
+		if (!isascii(ch) || (ch >= 0x80)) {
+			counts.char_warning = true;
+			counts.rule_2a_size++;
+			continue;
+		}
+#endif
+
+#ifdef TRIGRAPHS
+		if (ch == '?' && next_ch == '?') {
+			/* ISO C11 section 5.2.1.1 Trigraph Sequences */
+			const char *t;
+			static const char trigraphs[] = "=#([)]'^<{!|>}-~/\\";
+			int third = BUF_CH(i+1);
+
+			for (t = trigraphs; *t != '\0'; t += 2) {
+				if (third == t[0]) {
+					/* Mapped trigraphs count as 1 byte. */
+					i += 2;
+					next_ch = BUF_CH(i);
+					counts.rule_2a_size += 2;
+					ch = t[1];
+					break;
+				}
+			}
+			/* Unknown trigraph, the second '?' is simply next_ch. */
+		}
+#endif
+		if (ch == '\\' && next_ch == '\n') {
+			/*
+			 * ISO C11 section 5.1.1.2 Translation Phases
+			 * point 2 discards backslash newlines.
+			 */
+			i++;
+			counts.rule_2a_size += 2;
+			continue;
+		}
+
+		/* Within quoted string? */
+		if (quote != NO_STRING) {
+			/* Escape _this_ character. */
+			if (escape) {
+				escape = 0;
+			}
+
+			/* Escape next character. */
+			else if (ch == '\\') {
+				escape = 1;
+			}
+
+			/* Close matching quote? */
+			else if (ch == quote) {
+				quote = NO_STRING;
+			}
+		}
+
+		/* Within comment to end of line? */
+		else if (is_comment == COMMENT_EOL && ch == '\n') {
+			iocccsize_dbg(1, "~~NO_COMMENT");
+			is_comment = NO_COMMENT;
+		}
+
+		/* Within comment block? */
+		else if (is_comment == COMMENT_BLOCK && ch == '*' && next_ch == '/') {
+			iocccsize_dbg(1, "~~NO_COMMENT");
+			is_comment = NO_COMMENT;
+		}
+
+		/* Start of comment to end of line? */
+		else if (is_comment == NO_COMMENT && ch == '/' && next_ch == '/') {
+			iocccsize_dbg(1, "~~COMMENT_EOL");
+			is_comment = COMMENT_EOL;
+
+			/* Consume next_ch. */
+			ch = p[i++];
+			counts.rule_2a_size++;
+			counts.rule_2b_size++;
+		}
+
+		/* Start of comment block? */
+		else if (is_comment == NO_COMMENT && ch == '/' && next_ch == '*') {
+			iocccsize_dbg(1, "~~COMMENT_BLOCK");
+			is_comment = COMMENT_BLOCK;
+
+			/* Consume next_ch. */
+			ch = p[i++];
+			counts.rule_2a_size++;
+			counts.rule_2b_size++;
+		}
+
+		/* Open single or double quote? */
+		else if (is_comment == NO_COMMENT && (ch == '\'' || ch == '"')) {
+			quote = ch;
+		}
+
+#ifdef DIGRAPHS
+		/*
+		 * ISO C11 section 6.4.6 Punctuators, digraphs handled during
+		 * tokenization, but map here and count as 1 byte, like their
+		 * ASCII counter parts.
+		 */
+		if (IS_CODE) {
+			const char *d;
+			static const char digraphs[] = "[<:]:>{<%}%>#%:";
+			for (d = digraphs; *d != '\0'; d += 3) {
+				if (ch == d[1] && next_ch == d[2]) {
+					i++;
+					counts.rule_2a_size++;
+					ch = d[0];
+					break;
+				}
+			}
+		}
+#endif
+		/* Sanity check against file size and wc(1) byte count. */
+		counts.rule_2a_size++;
+
+		/*
+		 * End of possible keyword?  Care with #word as there can
+		 * be whitespace or comments between # and word.
+		 */
+		if ((word[0] != '#' || 1 < wordi) && !isalnum(ch) && ch != '_' && ch != '#') {
+			if (c_reserved(word, wordi)) {
+				/* Count keyword as 1. */
+				counts.rule_2b_size = counts.rule_2b_size - wordi + 1;
+				counts.keywords++;
+				iocccsize_dbg(1, "~~keyword %zu \"%s\"", counts.keywords, word);
+			}
+			word[wordi = 0] = '\0';
+		}
+
+		/* Ignore all whitespace. */
+		if (isspace(ch)) {
+			iocccsize_dbg(2, "~~ignore whitespace %#02x", ch);
+			continue;
+		}
+
+		/* Ignore begin/end block and end of statement. */
+		if ((ch == '{' || ch == ';' || ch == '}') && (isspace(next_ch) || next_ch == EOF)) {
+			iocccsize_dbg(2, "~~ignore %c", ch);
+			continue;
+		}
+
+		/* Collect next word not in a string or comment. */
+		if (IS_CODE && (isalnum(ch) || ch == '_' || ch == '#')) {
+			word[wordi++] = (char) ch;
+			if (sizeof (word) <= wordi) {
+				/* See rule_count_stream() on translation limits. */
+				wordi = 0;
+			}
+			word[wordi] = '\0';
+		}
+
+		counts.rule_2b_size++;
+	}
+#undef BUF_CH
+
+	return counts;
+}
+
+
+/*
+ * rule_count_buf - count data in a memory buffer, according to Rule 2a and Rule 2b
+ *
+ * Counts with the fastest bulk classifier available.
+ *
+ * given:
+ *	buf		buffer holding the source to count
+ *	len		length of buf in bytes
+ *
+ * returns:
+ *	RuleCount information
+ */
+RuleCount
+rule_count_buf(const char *buf, size_t len)
+{
+	return rule_count_buf_mode(buf, len, RULE_COUNT_FAST_SIMD);
+}
+
+
+/*
+ * rule_count - count data on file stream, according to Rule 2a and Rule 2b
+ *
+ * The stream is read into memory in large blocks and handed to
+ * rule_count_buf() for counting.
+ *
+ * given:
+ *	fp_in		open file stream to count data on
+ *
+ * returns:
+ *	RuleCount information
+ */
+RuleCount
+rule_count(FILE *fp_in)
+{
+	char *buf = NULL;
+	char *new_buf;
+	size_t size = 0;
+	size_t len = 0;
+	size_t got;
+	RuleCount counts;
+
+	do {
+		if (len == size) {
+			size = (size == 0) ? RULE_COUNT_BLOCK : size * 2;
+			new_buf = realloc(buf, size);
+			if (new_buf == NULL) {
+				free(buf);
+				iocccsize_errx(10, "realloc of %zu bytes failed", size);
+				not_reached();
+			}
+			buf = new_buf;
+		}
+		got = fread(buf + len, 1, size - len, fp_in);
+		len += got;
+	} while (got > 0);
+
+	counts = rule_count_buf(buf, len);
+	free(buf);
+
+	return counts;
+}
+
+
 /*
  * is_reserved - if string is a reserved word in C
  *
@@ -482,8 +1033,6 @@ rule_count(FILE *fp_in)
 bool
 is_reserved(const char *string)
 {
-    static Word *found = NULL;
-
     /*
      * firewall
      */
@@ -493,13 +1042,7 @@ is_reserved(const char *string)
     }
 
     /*
-     * search the reserved word table
+     * search the reserved words
      */
-    found = find_member(cwords, string);
-    if (found == NULL) {
-	/* case: string is not a reserved word */
-	return false;
-    }
-    /* case: string is a reserved word */
-    return true;
+    return c_reserved(string, strlen(string));
 }
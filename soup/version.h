@@ -84,17 +84,17 @@
  *
  * NOTE: This should match the latest Release string in CHANGES.md
  */
-#define MKIOCCCENTRY_REPO_VERSION "2.11.0 2015-11-30"	/* special release format: major.minor[.patch] YYYY-MM-DD */
+#define MKIOCCCENTRY_REPO_VERSION "2.11.1 2026-10-18"	/* special release format: major.minor[.patch] YYYY-MM-DD */
 
 /*
  * official soup version (aka recipe :-) )
  */
-#define SOUP_VERSION "2.4.0 2015-11-30"		/* format: major.minor[.patch] YYYY-MM-DD */
+#define SOUP_VERSION "2.4.1 2026-10-18"		/* format: major.minor[.patch] YYYY-MM-DD */
 
 /*
  * official iocccsize version
  */
-#define IOCCCSIZE_VERSION "29.1.0 2025-11-18"	/* format: major.minor[.patch] YYYY-MM-DD */
+#define IOCCCSIZE_VERSION "29.2.0 2026-10-18"	/* format: major.minor[.patch] YYYY-MM-DD */
 #define MIN_IOCCCSIZE_VERSION IOCCCSIZE_VERSION
 
 /*
@@ -131,13 +131,13 @@
 /*
  * official txzchk version
  */
-#define TXZCHK_VERSION "2.1.0 2025-11-18"	/* format: major.minor[.patch] YYYY-MM-DD */
+#define TXZCHK_VERSION "2.2.0 2026-10-18"	/* format: major.minor[.patch] YYYY-MM-DD */
 #define MIN_TXZCHK_VERSION TXZCHK_VERSION
 
 /*
  * official chkentry version
  */
-#define CHKENTRY_VERSION "2.3.0 2015-11-30"	/* format: major.minor[.patch] YYYY-MM-DD */
+#define CHKENTRY_VERSION "2.3.1 2026-10-18"	/* format: major.minor[.patch] YYYY-MM-DD */
 #define MIN_CHKENTRY_VERSION CHKENTRY_VERSION
 
 /*
@@ -166,13 +166,38 @@
  /*
   * try_fts_walk - walk a directory tree using one of the static walk_rule sets
   */
-#define TRY_FTS_WALK_VERSION "2.0.0 2025-11-18"	/* version format: major.minor[.patch] YYYY-MM-DD */
+#define TRY_FTS_WALK_VERSION "2.1.0 2026-10-18"	/* version format: major.minor[.patch] YYYY-MM-DD */
 
  /*
   * try_walk_set - try using one of the static walk_rule sets
   */
 #define TRY_WALK_SET_VERSION "2.0.0 2025-11-18"	/* version format: major.minor[.patch] YYYY-MM-DD */
 
+ /*
+  * bench_rule_count - compare the rule_count_stream() and rule_count_buf() engines
+  */
+#define BENCH_RULE_COUNT_VERSION "1.0.0 2026-10-18"	/* version format: major.minor[.patch] YYYY-MM-DD */
+
+ /*
+  * bench_walk - compare indexed and linear path lookups in a struct walk_stat
+  */
+#define BENCH_WALK_VERSION "1.1.0 2026-10-18"	/* version format: major.minor[.patch] YYYY-MM-DD */
+
+ /*
+  * bench_walk_set - compare compiled and linear walk_set rule matching
+  */
+#define BENCH_WALK_SET_VERSION "1.0.0 2026-10-18"	/* version format: major.minor[.patch] YYYY-MM-DD */
+
+ /*
+  * bench_default_handle - time default_handle() over international author names
+  */
+#define BENCH_DEFAULT_HANDLE_VERSION "1.0.0 2026-10-18"	/* version format: major.minor[.patch] YYYY-MM-DD */
+
+ /*
+  * bench_canon_path - compare canon_path() with canon_path_r() and canon_path_batch()
+  */
+#define BENCH_CANON_PATH_VERSION "1.0.0 2026-10-18"	/* version format: major.minor[.patch] YYYY-MM-DD */
+
 
 /*
  * debug version
@@ -54,6 +54,9 @@
 #include <regex.h>	    /* needed for regex(3) related functions */
 #include <sys/stat.h>	    /* for st_mode and st_size types from stat(2) */
 #include <fts.h>	    /* for fts – traverse a file hierarchy */
+#include <pthread.h>	    /* for the parallel fts_walk() worker threads */
+#include <limits.h>	    /* for UCHAR_MAX */
+#include <stddef.h>	    /* for max_align_t */
 
 /*
  * needed for fnmatch(3) related functions and for the FNM_CASEFOLD symbol
@@ -82,11 +85,10 @@
 
 
 /*
- * item_count - count the number of items in a given dyn_array pointer in the struct walk_stat
+ * item_count - count the number of items of a given category in the struct walk_stat
  *
- * We pay attention to the ready element is true in the struct walk_stat as well as to of the
- * dyn_array pointer in struct walk_stat is non-NULL.  If any of those are false, a count of 0
- * is returned.  I.e., if the struct walk_stat is not setup, or if the dyn_array is not setup, 0 is returned.
+ * We pay attention to the ready element is true in the struct walk_stat.  If the struct walk_stat
+ * is not setup, 0 is returned.  Counting does not materialize the dynamic array of the category.
  *
  * Example, the following will determine the number of file and directory items recorded in struct walk_stat wstat:
  *
@@ -94,11 +96,26 @@
  *	intmax_t file_count;
  *	intmax_t dir_count;
  *
- *	file_count = item_count(&wstat, file);
- *	dir_count = item_count(&wstat, dir);
+ *	file_count = item_count(&wstat, WALK_CAT_FILE);
+ *	dir_count = item_count(&wstat, WALK_CAT_DIR);
  */
-#define item_count(wptr, dptr) \
-    ((((wptr) == NULL || (wptr)->ready == false || (wptr)->(dptr) == NULL)) ? 0 : dyn_array_tell((wptr)->(dptr)))
+#define item_count(wptr, cat) \
+    ((((wptr) == NULL || (wptr)->ready == false)) ? 0 : (wptr)->cat_count[(cat)])
+
+/*
+ * initial number of slots in a struct path_index
+ *
+ * NOTE: This must be a power of 2.
+ */
+#define PATH_INDEX_MIN_SLOTS (64)
+
+/*
+ * number of worker threads used by a parallel fts_walk()
+ *
+ * Reading directories and stat-ing paths is latency bound on network filesystems,
+ * so we use more worker threads than there are likely to be CPUs.
+ */
+#define WALK_THREADS (8)
 
 /*
  * For functions such as chk_walk(), these COUNTED defines may be used
@@ -184,6 +201,88 @@ enum allowed_level {
 };
 
 
+/*
+ * walk_cat - categories of items recorded in a struct walk_stat
+ *
+ * An item may belong to many categories.  Each struct item records its categories
+ * as a bitmask (see WALK_CAT_BIT()) rather than being appended to a dynamic array
+ * per category.  The walk_view() function materializes the dynamic array of item
+ * pointers for a category on first use.
+ */
+enum walk_cat {
+    /* items by type - See enum allowed_type */
+    WALK_CAT_FILE = 0,		/* file items */
+    WALK_CAT_DIR,		/* directory items */
+    WALK_CAT_SYMLINK,		/* symlink items */
+    /**/
+    WALK_CAT_NOT_FILE,		/* NOT file items */
+    WALK_CAT_NOT_DIR,		/* NOT directory items */
+    WALK_CAT_NOT_SYMLINK,	/* NOT symlink items */
+    /**/
+    WALK_CAT_FILEDIR,		/* file, or directory items */
+    WALK_CAT_FILESYM,		/* file, or symlink items */
+    WALK_CAT_DIRSYM,		/* directory, or symlink items */
+    WALK_CAT_FILEDIRSYM,	/* file, or directory, or symlink items */
+    /**/
+    WALK_CAT_NOT_FILEDIR,	/* an item that is neither a file, nor a directory */
+    WALK_CAT_NOT_FILESYM,	/* an item that is neither a file, nor a symlink */
+    WALK_CAT_NOT_DIRSYM,	/* an item that is neither a directory, nor a symlink */
+    WALK_CAT_NOT_FILEDIRSYM,	/* an item that is neither a file, nor a directory, nor a symlink */
+
+    /* items by level - See enum level */
+    WALK_CAT_TOP,		/* items directly found in the topdir directory */
+    WALK_CAT_SHALLOW,		/* items at or below the topdir directory but NOT deeper than the depth limit */
+    WALK_CAT_TOO_DEEP,		/* items deeper than the depth limit */
+    WALK_CAT_BELOW,		/* items below but NOT in topdir (i.e., not directly found in the topdir directory) */
+    /**/
+    WALK_CAT_ANY_LEVEL,		/* items at or below topdir at any level (i.e., at or below topdir) */
+    WALK_CAT_UNKNOWN_LEVEL,	/* items of an unknown level or above the topdir directory */
+
+    /* items by walk_rule - see booleans in struct walk_rule */
+    WALK_CAT_REQUIRED,		/* item matching a walk_rule that is required */
+    WALK_CAT_OPTIONAL,		/* item matching a walk_rule that is NOT required (i.e., optional) */
+    /**/
+    WALK_CAT_NON_EMPTY,		/* item matching a walk_rule must have st_size > 0 */
+    WALK_CAT_EMPTY,		/* item matching a walk_rule and st_size is 0 */
+    /**/
+    WALK_CAT_FREE,		/* item matching a walk_rule that is free (i.e., not counted) */
+    WALK_CAT_COUNTED,		/* item matching a walk_rule that is NOT free (i.e., counted) */
+    /**/
+    WALK_CAT_COUNTED_FILE,	/* file item matching a walk_rule that is counted */
+    WALK_CAT_COUNTED_DIR,	/* directory item matching a walk_rule that is counted */
+    WALK_CAT_COUNTED_SYM,	/* symlink item matching a walk_rule that is counted */
+    WALK_CAT_COUNTED_OTHER,	/* non-file/dir/symlink item matching a walk_rule that is counted */
+    /**/
+    WALK_CAT_IGNORE,		/* item matching a walk_rule that is ignore */
+    WALK_CAT_NOT_IGNORE,	/* item matching a walk_rule that is NOT ignore (i.e., processed) */
+    /**/
+    WALK_CAT_PROHIBIT,		/* item matching a walk_rule that is prohibit */
+    WALK_CAT_NOT_PROHIBIT,	/* item matching a walk_rule that is NOT prohibit (i.e., allowed) */
+    /**/
+    WALK_CAT_UNMATCHED,		/* item that did not match any walk_rule */
+
+    /* items by path problem */
+    WALK_CAT_UNSAFE,		/* path contains unsafe path elements, or .. (dot-dot) over topdir error */
+    WALK_CAT_ABS,		/* path is absolute, not a relative path */
+    WALK_CAT_TOO_LONG_PATH,	/* path is too long */
+    WALK_CAT_TOO_LONG_NAME,	/* element in path is too long */
+    /**/
+    WALK_CAT_FTS_ERR,		/* caused an fts(3) error e.g., cannot read dir, cannot stat(2), etc. */
+    WALK_CAT_SAFE,		/* all path elements are safe */
+
+    /* item descendant state */
+    WALK_CAT_VISIT,		/* OK to visit descendants */
+    WALK_CAT_PRUNE,		/* don't visit descendants, prune any walk at item */
+
+    WALK_CAT_COUNT,		/* number of categories - must be last */
+};
+
+/*
+ * WALK_CAT_BIT - bit of a walk_cat category in the category bitmask of a struct item
+ */
+#define WALK_CAT_BIT(cat) (((uint64_t)1) << (cat))
+
+
 /*
  * item - describe a file, directory or other file system member
  */
@@ -195,6 +294,7 @@ struct item {
     int_least32_t fts_level;	/* fts_path depth, 0 ==> topdir, 1 ==> directly under topdir, 2 ==> in sub-dir under topdir */
     off_t st_size;              /* file size, in bytes in struct stat st_size form */
     mode_t st_mode;             /* inode protection mode in struct stat st_mode form */
+    uint64_t category;		/* bitmask of walk_cat categories of the item, see WALK_CAT_BIT() */
 
     /*
      * pre-canonicalization information
@@ -369,6 +469,163 @@ struct walk_set {
     char *context;		    /* malloced string describing context (tool + options) for debugging purposes */
     int count;			    /* length of set NOT counting the final NULL walk_rule.pattern */
     struct walk_rule * const rule;  /* array of walk rules, ending with a NULL walk_rule.pattern */
+    struct walk_match *match;	    /* compiled first-match matcher, NULL ==> walk_set not ready */
+};
+
+
+/*
+ * walk_match - a walk_set compiled by init_walk_set() for fast first-match lookup
+ *
+ * Each walk_rule is placed in exactly one list by how its pattern can match an item name:
+ *
+ *	name[]	    - MATCH_STR and MATCH_STR_ANYCASE, and fnmatch(3) patterns with no
+ *		      special characters: an open addressing hash table of lists keyed by
+ *		      the case-folded pattern
+ *	prefix[c]   - MATCH_PREFIX and MATCH_PREFIX_ANYCASE, and fnmatch(3) patterns of the
+ *		      form "literal*": keyed by the case-folded first byte of the pattern
+ *	suffix[c]   - MATCH_SUFFIX and MATCH_SUFFIX_ANYCASE, and fnmatch(3) patterns of the
+ *		      form "*literal": keyed by the case-folded last byte of the pattern
+ *	other	    - everything else: MATCH_ANY, regex(3), other fnmatch(3) patterns, empty patterns
+ *
+ * An item name can only match the walk_rules in its name[] list, in prefix[] of its first byte,
+ * in suffix[] of its last byte, and in other.  Each list holds walk_rule indexes in ascending
+ * order, so merging these 4 lists visits candidate walk_rules in walk_set order, and the first
+ * candidate that match_walk_rule() accepts is the walk_rule a linear scan would have found.
+ */
+struct walk_rule_list {
+    size_t count;		/* number of walk_rule indexes in the list */
+    int *indx;			/* malloced array of walk_rule indexes in ascending order */
+};
+
+struct walk_name_slot {
+    char const *pattern;	/* pattern of the walk_rules in this slot, NULL ==> empty slot */
+    uint32_t hash;		/* case-folded hash of pattern */
+    struct walk_rule_list list;	/* walk_rules with a pattern that matches the same names without regard to case */
+};
+
+struct walk_match {
+    size_t mask;				/* number of name slots - 1 (number of slots is a power of 2) */
+    struct walk_name_slot *name;		/* hash table of exact name walk_rules */
+    struct walk_rule_list prefix[UCHAR_MAX+1];	/* prefix walk_rules by case-folded first byte */
+    struct walk_rule_list suffix[UCHAR_MAX+1];	/* suffix walk_rules by case-folded last byte */
+    struct walk_rule_list other;		/* walk_rules that must be tried for every item */
+};
+
+
+/*
+ * path_index - hash index of struct item pointers by canonicalized path
+ *
+ * An open addressing hash table, with linear probing, of struct item pointers
+ * keyed by their fts_path.  A case-folded index (fold == true) matches paths
+ * the same way that path_in_item_array() does: without regard to case.
+ * An exact index (fold == false) matches paths with regard to case.
+ *
+ * When two items have the same key, the index holds the one added first,
+ * just as a scan of a dynamic array in the order items were appended finds
+ * the first one.
+ */
+struct path_slot {
+    uint32_t hash;		/* hash of fts_path, case-folded if the index is case-folded */
+    struct item *i_p;		/* item in this slot, NULL ==> empty slot */
+};
+
+struct path_index {
+    bool fold;			/* true ==> compare paths without regard to case, false ==> exact compare */
+    size_t count;		/* number of items in the index */
+    size_t mask;		/* number of slots - 1 (number of slots is a power of 2) */
+    struct path_slot *slot;	/* array of slots */
+};
+
+
+/*
+ * walk_arena - bump allocator that owns the items and path strings of a walk_stat
+ *
+ * Items, and the path and name strings they point to, are carved out of large
+ * calloced chunks.  They are never freed one at a time: free_walk_stat() frees
+ * every chunk at once.  Strings are interned: a string equal to one already in
+ * the arena is not stored again, so that an original path and its canonical form,
+ * or the same path in the all and skip_set dynamic arrays, share one copy.
+ * The basename of a path without a trailing slash points into the path itself.
+ *
+ * Arena strings are read-only and must not be modified.
+ *
+ * The arena also keeps one scratch buffer, grown as needed and reused for every
+ * path, in which record_step() and skip_add() canonicalize a path before it is
+ * interned.
+ */
+#define WALK_ARENA_CHUNK (256*1024)	/* minimum number of bytes of a walk_arena_chunk */
+
+struct walk_arena_chunk {
+    struct walk_arena_chunk *next;	/* previously filled chunk, NULL ==> first chunk */
+    size_t size;			/* number of bytes of data */
+    size_t used;			/* number of bytes of data given out */
+    max_align_t data[];			/* chunk data, zeroized by calloc(3) */
+};
+
+struct walk_intern_slot {
+    uint32_t hash;			/* exact hash of the string */
+    size_t len;				/* length of the string */
+    char *str;				/* interned string in the arena, NULL ==> empty slot */
+};
+
+struct walk_arena {
+    struct walk_arena_chunk *chunk;	/* chunk being filled, NULL ==> no chunk yet */
+    size_t chunks;			/* number of chunks */
+    size_t bytes;			/* number of bytes given out */
+    size_t strings;			/* number of strings interned */
+    size_t shared;			/* number of times an interned string was found and shared */
+    size_t mask;			/* number of intern slots - 1 (number of slots is a power of 2) */
+    struct walk_intern_slot *slot;	/* intern hash table, NULL ==> no strings yet */
+    char *scratch;			/* malloced buffer for canonicalize_path_r(), NULL ==> none yet */
+    size_t scratch_size;		/* size of scratch in bytes */
+};
+
+
+/*
+ * walk_node - a path found by a parallel fts_walk()
+ *
+ * Worker threads read directories, in no particular order, into a tree of walk_nodes.
+ * The kids of a directory are sorted in fts_cmp() order before the directory is marked
+ * as read.  A single merge stage then visits the tree in the same pre-order that fts(3)
+ * would use, and records each path with record_step() or record_fts_err().
+ *
+ * Once a walk_node has been linked into the kid array of its parent, only the read,
+ * dnr, pruned, count and kid elements change, and only while the walk_pool lock is held.
+ */
+struct walk_node {
+    char *path;			/* malloced path below topdir, empty string ==> topdir */
+    char const *name;		/* basename of path (points into path) */
+    int_least32_t level;	/* path depth, 0 ==> topdir, 1 ==> directly under topdir */
+    int info;			/* fts(3) style info: FTS_D, FTS_DC, FTS_F, FTS_SL, FTS_DEFAULT or FTS_NS */
+    off_t st_size;		/* file size, in bytes in struct stat st_size form */
+    mode_t st_mode;		/* inode protection mode in struct stat st_mode form */
+    dev_t st_dev;		/* device of the inode, for directory cycle detection */
+    ino_t st_ino;		/* inode number, for directory cycle detection */
+    struct walk_node *parent;	/* directory that holds this path, NULL ==> topdir */
+    struct walk_node *next;	/* next directory in the walk_pool work queue */
+
+    bool read;			/* true ==> directory read (or pruned), kid array is valid */
+    bool dnr;			/* true ==> directory could not be read */
+    bool pruned;		/* true ==> merge stage pruned the walk below this directory */
+    size_t count;		/* number of kids */
+    struct walk_node **kid;	/* malloced array of kids in fts_cmp() order, or NULL */
+};
+
+/*
+ * walk_pool - worker threads and work queue of a parallel fts_walk()
+ *
+ * Worker threads pop a directory from the queue, read it relative to the topdir
+ * file descriptor, and push the sub-directories they find back onto the queue.
+ * The queue is a LIFO stack so that, like the merge stage, the workers tend to
+ * proceed in a depth first pre-order.
+ */
+struct walk_pool {
+    int topfd;			/* open file descriptor of topdir */
+    pthread_mutex_t lock;	/* protects the queue, done, and the walk_node read state */
+    pthread_cond_t work;	/* broadcast when a directory is queued, or when done is set */
+    pthread_cond_t ready;	/* broadcast when a directory has been read */
+    struct walk_node *queue;	/* stack of directories to read, NULL ==> empty */
+    bool done;			/* true ==> worker threads should exit */
 };
 
 
@@ -381,11 +638,14 @@ struct walk_set {
  * The topdir may be am empty string when there is no identifiable topdir, such as what
  * might happen when "walking" a tarball listing.
  *
- * The many struct dyn_array pointers are intended to record walk information for a given item category.
- * These are in the form of paths relative topdir.  The "tell" macros may be used to determine the count,
- * i.e., the number of items that belonging to that given category.  In some cases the application may
- * wish to use a non-zero category as an indication of an error (such as prohibited items found) and
- * throw a fatal error if/as needed.
+ * Every recorded item is appended to the all dynamic array, and the item category bitmask records
+ * the walk information for each enum walk_cat item category.  The walk_view() function returns a
+ * dynamic array of the items of a given category, in the form of paths relative topdir.  Such a
+ * dynamic array is materialized from the all dynamic array on first use, and is kept up to date by
+ * later walk steps.  The item_count() macro, or the walk_count() function, may be used to determine
+ * the count, i.e., the number of items that belonging to that given category, without materializing
+ * the dynamic array.  In some cases the application may wish to use a non-zero category as an
+ * indication of an error (such as prohibited items found) and throw a fatal error if/as needed.
  *
  * The main "walk" functions record items in order that they were found.  No attempt is made
  * to prevent an item from being recorded multiple times.  The fts(3) traverse a file hierarchy,
@@ -420,6 +680,13 @@ struct walk_set {
  * always re-access/re-acquire referenced data between each step, or make independent duplicate copies of
  * such data (that won't be subject to realloc(3) facility moving data), or wait until the walk is complete.
  * For this reason, the walking boolean was added.
+ *
+ * The optional path_index pointers index the items of the all and skip_set dynamic arrays, and
+ * of the prune item category, by canonicalized path, so that path_in_walk_stat() and path_in_walk_array() need not scan
+ * those dynamic arrays.  When a path_index pointer is NULL, the dynamic array is scanned instead.
+ *
+ * The items of the all and skip_set dynamic arrays, and their path strings, are owned by the walk_arena.
+ * They remain valid until free_walk_stat() frees the whole arena.
  */
 struct walk_stat {
 
@@ -436,6 +703,7 @@ struct walk_stat {
     bool walking;			/* true ==> walk is in progress, false ==> walk is complete or no walk was ever started */
     bool skip;				/* true ==> some tree pruning was observed, false ==> no known tree pruning */
     bool tar_listing_used;		/* true ==> tarball listing walk, false ==> walk via fts(3) */
+    bool parallel_walk;			/* true ==> fts_walk() uses WALK_THREADS worker threads, false ==> fts(3) */
     int_least32_t max_path_len;		/* max canonicalized path length, 0 ==> no limit */
     int_least32_t max_filename_len;	/* max length of each component of path, 0 ==> no limit */
     int_least32_t max_depth;		/* max depth of subdirectory tree, 0 ==> no limit, <0 ==> reserved for future use */
@@ -444,72 +712,21 @@ struct walk_stat {
     /* skip certain canonicalized paths */
     struct dyn_array *skip_set;		/* skip processing any canonicalized path that matches a skip_set item */
 
-    /* items by type - See enum allowed_type */
-    struct dyn_array *file;		/* file items */
-    struct dyn_array *dir;		/* directory items */
-    struct dyn_array *symlink;		/* symlink items */
-    /**/
-    struct dyn_array *not_file;		/* NOT file items */
-    struct dyn_array *not_dir;		/* NOT directory items */
-    struct dyn_array *not_symlink;	/* NOT symlink items */
-    /**/
-    struct dyn_array *filedir;		/* file, or directory items */
-    struct dyn_array *filesym;		/* file, or symlink items */
-    struct dyn_array *dirsym;		/* directory, or symlink items */
-    struct dyn_array *filedirsym;	/* file, or directory, or symlink items */
-    /**/
-    struct dyn_array *not_filedir;	/* an item that is neither a file, nor a directory */
-    struct dyn_array *not_filesym;	/* an item that is neither a file, nor a symlink */
-    struct dyn_array *not_dirsym;	/* an item that is neither a directory, nor a symlink */
-    struct dyn_array *not_filedirsym;	/* an item that is neither a file, nor a directory, nor a symlink */
-
-    /* items by level - See enum level */
-    struct dyn_array *top;		/* items directly found in the topdir directory */
-    struct dyn_array *shallow;		/* items at or below the topdir directory but NOT deeper than the depth limit */
-    struct dyn_array *too_deep;		/* items deeper than the depth limit */
-    struct dyn_array *below;		/* items below but NOT in topdir (i.e., not directly found in the topdir directory) */
-    /**/
-    struct dyn_array *any_level;	/* items at or below topdir at any level (i.e., at or below topdir) */
-    struct dyn_array *unknown_level;	/* items of an unknown level or above the topdir directory */
-
-    /* items by walk_rule - see booleans in struct walk_rule */
-    struct dyn_array *required;	        /* item matching a walk_rule that is required */
-    struct dyn_array *optional;		/* item matching a walk_rule that is NOT required (i.e., optional) */
-    /**/
-    struct dyn_array *non_empty;	/* item matching a walk_rule must have st_size > 0 */
-    struct dyn_array *empty;		/* item matching a walk_rule and st_size is 0 */
-    /**/
-    struct dyn_array *free;		/* item matching a walk_rule that is free (i.e., not counted) */
-    struct dyn_array *counted;		/* item matching a walk_rule that is NOT free (i.e., counted) */
-    /**/
-    struct dyn_array *counted_file;	/* file item matching a walk_rule that is free (not-counted) */
-    struct dyn_array *counted_dir;	/* directory item matching a walk_rule that is free (not-counted) */
-    struct dyn_array *counted_sym;	/* symlink item matching a walk_rule that is free (not-counted) */
-    struct dyn_array *counted_other;	/* non-file/dir/symlink item matching a walk_rule that is free (not-counted) */
-    /**/
-    struct dyn_array *ignore;		/* item matching a walk_rule that is ignore */
-    struct dyn_array *not_ignore;	/* item matching a walk_rule that is NOT ignore (i.e., processed) */
-    /**/
-    struct dyn_array *prohibit;		/* item matching a walk_rule that is prohibit */
-    struct dyn_array *not_prohibit;	/* item matching a walk_rule that is NOT prohibit (i.e., allowed) */
-    /**/
-    struct dyn_array *unmatched;	/* item that did not match any walk_rule */
-
-    /* items by path problem */
-    struct dyn_array *unsafe;		/* path contains unsafe path elements, or .. (dot-dot) over topdir error */
-    struct dyn_array *abs;		/* path is absolute, not a relative path */
-    struct dyn_array *too_long_path;	/* path is too long */
-    struct dyn_array *too_long_name;	/* element in path is too long */
-    /**/
-    struct dyn_array *fts_err;		/* caused an fts(3) error e.g., cannot read dir, cannot stat(2), etc. */
-    struct dyn_array *safe;		/* all path elements are safe */
-
-    /* item descendant state */
-    struct dyn_array *visit;		/* OK to visit descendants */
-    struct dyn_array *prune;		/* don't visit descendants, prune any walk at item */
+    /* items by category - See enum walk_cat */
+    intmax_t cat_count[WALK_CAT_COUNT];	/* number of items in each category */
+    struct dyn_array *view[WALK_CAT_COUNT];	/* items in each category, NULL ==> not yet materialized by walk_view() */
 
     /* all items recorded */
     struct dyn_array *all;		/* all items - to allow them to be freed by free_walk_stat() */
+
+    /* optional indexes by canonicalized path, NULL ==> scan the dynamic array instead */
+    struct path_index *all_index;	/* case-folded index of the all items */
+    struct path_index *all_exact;	/* exact (case-sensitive) index of the all items */
+    struct path_index *prune_index;	/* case-folded index of the prune items */
+    struct path_index *skip_index;	/* case-folded index of the skip_set items */
+
+    /* storage of the items and their path strings */
+    struct walk_arena arena;		/* owns every item of the all and skip_set dynamic arrays */
 };
 
 
@@ -529,9 +746,13 @@ extern struct walk_set walk_anything;		/* anything goes walk_set */
  * walk_util.c external functions
  */
 extern void free_walk_stat(struct walk_stat *wstat_p);
+extern struct walk_set *dup_walk_set(struct walk_set const *wset_p);
+extern void free_dup_walk_set(struct walk_set *wset_p);
 extern void init_walk_stat(struct walk_stat *wstat_p, char const *topdir, struct walk_set *set, char const *context,
 			   size_t max_path_len, size_t max_filename_len, int_least32_t max_depth,
-			   bool tar_listing_used);
+			   bool tar_listing_used, bool parallel_walk);
+extern int match_walk_set(struct walk_set *wset_p, struct item *i_p);
+extern int scan_walk_set(struct walk_set *wset_p, struct item *i_p);
 extern bool record_step(struct walk_stat *wstat_p, char const *fts_path, off_t st_size, mode_t st_mode,
 		        bool *dup_p, char const **cpath_ret);
 extern void fprintf_walk_stat(FILE *stream, struct walk_stat *wstat_p);
@@ -549,9 +770,20 @@ extern int fts_icmp(const FTSENT **a, const FTSENT **b);
 extern bool fts_walk(struct walk_stat *wstat_p);
 extern char const *canonicalize_path(struct walk_stat *wstat_p, char const *fts_path,
                                      enum path_sanity *sanity_p, size_t *len_p, int_least32_t *depth_p);
+extern char const *canonicalize_path_r(struct walk_stat *wstat_p, char const *fts_path, char *buf, size_t bufsiz,
+				       enum path_sanity *sanity_p, size_t *len_p, int_least32_t *depth_p);
 extern bool skip_add(struct walk_stat *wstat_p, char const *fts_path);
 extern struct item *path_in_item_array(struct dyn_array *item_array, char const *c_path);
 extern struct item *path_in_walk_stat(struct walk_stat *wstat_p, char const *c_path);
+extern struct item *path_in_walk_stat_exact(struct walk_stat *wstat_p, char const *c_path);
+extern struct dyn_array *walk_view(struct walk_stat *wstat_p, enum walk_cat cat);
+extern intmax_t walk_count(struct walk_stat *wstat_p, enum walk_cat cat);
+extern char const *walk_cat_name(enum walk_cat cat);
+extern struct item *path_in_walk_array(struct walk_stat *wstat_p, struct dyn_array *item_array, char const *c_path);
+extern struct path_index *alloc_path_index(bool fold);
+extern void free_path_index(struct path_index *index);
+extern void path_index_add(struct path_index *index, struct item *i_p);
+extern struct item *path_index_find(struct path_index *index, char const *c_path);
 extern char const *allowed_type_str(enum allowed_type type);
 
 
@@ -483,7 +483,8 @@ struct walk_set walk_mkiocccentry = {
     false,				/* true ==> walk_set initialized and setup */
     NULL,				/* NUL terminated string describing context (tool + options) for debugging purposes */
     0,					/* length of set NOT counting the final NULL walk_rule.pattern */
-    walk_rule_set_mkiocccentry		/* array of walk rules, ending with a NULL walk_rule.pattern */
+    walk_rule_set_mkiocccentry,		/* array of walk rules, ending with a NULL walk_rule.pattern */
+    NULL				/* compiled first-match matcher, set by init_walk_set() */
 };
 
 
@@ -1017,7 +1018,8 @@ struct walk_set walk_txzchk = {
     false,				/* true ==> walk_set initialized and setup */
     NULL,				/* NUL terminated string describing context (tool + options) for debugging purposes */
     0,					/* length of set NOT counting the final NULL walk_rule.pattern */
-    walk_rule_set_txzchk		/* array of walk rules, ending with a NULL walk_rule.pattern */
+    walk_rule_set_txzchk,		/* array of walk rules, ending with a NULL walk_rule.pattern */
+    NULL				/* compiled first-match matcher, set by init_walk_set() */
 };
 
 
@@ -1038,7 +1040,8 @@ struct walk_set walk_chkentry_S = {
     false,				/* true ==> walk_set initialized and setup */
     NULL,				/* NUL terminated string describing context (tool + options) for debugging purposes */
     0,					/* length of set NOT counting the final NULL walk_rule.pattern */
-    walk_rule_set_txzchk		/* array of walk rules, ending with a NULL walk_rule.pattern */
+    walk_rule_set_txzchk,		/* array of walk rules, ending with a NULL walk_rule.pattern */
+    NULL				/* compiled first-match matcher, set by init_walk_set() */
 };
 
 
@@ -1556,7 +1559,8 @@ struct walk_set walk_chkentry_s = {
     false,				/* true ==> walk_set initialized and setup */
     NULL,				/* NUL terminated string describing context (tool + options) for debugging purposes */
     0,					/* length of set NOT counting the final NULL walk_rule.pattern */
-    walk_rule_set_chkentry_s		/* array of walk rules, ending with a NULL walk_rule.pattern */
+    walk_rule_set_chkentry_s,		/* array of walk rules, ending with a NULL walk_rule.pattern */
+    NULL				/* compiled first-match matcher, set by init_walk_set() */
 };
 
 
@@ -2092,7 +2096,8 @@ struct walk_set walk_chkentry_w = {
     false,				/* true ==> walk_set initialized and setup */
     NULL,				/* NUL terminated string describing context (tool + options) for debugging purposes */
     0,					/* length of set NOT counting the final NULL walk_rule.pattern */
-    walk_rule_set_chkentry_w		/* array of walk rules, ending with a NULL walk_rule.pattern */
+    walk_rule_set_chkentry_w,		/* array of walk rules, ending with a NULL walk_rule.pattern */
+    NULL				/* compiled first-match matcher, set by init_walk_set() */
 };
 
 
@@ -2147,5 +2152,6 @@ struct walk_set walk_anything = {
     false,				/* true ==> walk_set initialized and setup */
     NULL,				/* NUL terminated string describing context (tool + options) for debugging purposes */
     0,					/* length of set NOT counting the final NULL walk_rule.pattern */
-    walk_rule_set_anything		/* array of walk rules, ending with a NULL walk_rule.pattern */
+    walk_rule_set_anything,		/* array of walk rules, ending with a NULL walk_rule.pattern */
+    NULL				/* compiled first-match matcher, set by init_walk_set() */
 };
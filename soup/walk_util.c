@@ -47,6 +47,18 @@
  */
 #include "walk.h"
 
+/*
+ * system includes for the parallel fts_walk()
+ */
+#include <dirent.h>	    /* for fdopendir(3) and readdir(3) */
+#include <fcntl.h>	    /* for openat(2) and fstatat(2) */
+#include <unistd.h>	    /* for close(2) */
+
+/*
+ * system includes for the compiled walk_set matcher
+ */
+#include <ctype.h>	    /* for tolower(3) */
+
 
 /*
  * defines
@@ -61,14 +73,30 @@ static void free_walk_rule(struct walk_rule *wrule_p);
 static void init_walk_rule(struct walk_rule *wrule_p);
 static void free_walk_set(struct walk_set *wset_p);
 static void init_walk_set(struct walk_set *wset_p, char const *context);
-static void free_item(struct item *i_p);
-static struct item *alloc_item(char const *orig_path, char const *fts_path,
+static void add_walk_rule_list(struct walk_rule_list *list, int indx);
+static void free_walk_match(struct walk_match *match);
+static size_t fnmatch_literal_len(char const *pattern, size_t len);
+static struct walk_match *compile_walk_set(struct walk_set *wset_p);
+static void *walk_arena_alloc(struct walk_arena *arena, size_t size, size_t align);
+static char *walk_arena_intern(struct walk_arena *arena, char const *str, size_t len);
+static char *walk_arena_base_name(struct walk_arena *arena, char *path, size_t len, size_t *len_p);
+static char *walk_arena_scratch(struct walk_arena *arena, size_t size);
+static void free_walk_arena(struct walk_arena *arena);
+static struct item *alloc_item(struct walk_stat *wstat_p, char const *orig_path, char const *fts_path,
 			       off_t st_size, mode_t st_mode, int_least32_t fts_level);
-static void free_items_in_dyn_array(struct dyn_array *dyn_array_p);
 static bool chk_walk_stat(struct walk_stat *wstat_p);
 static bool match_walk_rule(struct walk_rule *rule_p, struct item *i_p, int indx);
 static void fprintf_dyn_array_item(FILE *stream, char const *element_name, struct dyn_array *dyn_array_p);
+static uint32_t path_hash(char const *path, size_t len, bool fold);
+static struct path_slot *path_slot_find(struct path_index *index, char const *path, size_t len, uint32_t hash);
+static void walk_cat_add(struct walk_stat *wstat_p, struct item *i_p, enum walk_cat cat);
 static void record_fts_err(struct walk_stat *wstat_p, char const *path, off_t st_size, mode_t st_mode, int_least32_t fts_level);
+static int walk_node_cmp(void const *a, void const *b);
+static void free_walk_node(struct walk_node *node);
+static struct walk_node **read_walk_dir(struct walk_pool *pool, struct walk_node *dir, size_t *count_p, bool *dnr_p);
+static void *walk_worker(void *arg);
+static void merge_walk_dir(struct walk_stat *wstat_p, struct walk_pool *pool, struct walk_node *dir);
+static bool fts_walk_parallel(struct walk_stat *wstat_p);
 
 
 /*
@@ -257,6 +285,12 @@ free_walk_set(struct walk_set *wset_p)
 	free_walk_rule(rule_p);
     }
 
+    /*
+     * free the compiled matcher
+     */
+    free_walk_match(wset_p->match);
+    wset_p->match = NULL;
+
     /*
      * declare walk_set not ready
      */
@@ -326,6 +360,11 @@ init_walk_set(struct walk_set *wset_p, char const *context)
     */
     wset_p->count = count;
 
+    /*
+     * compile the walk_rule set for first-match lookup
+     */
+    wset_p->match = compile_walk_set(wset_p);
+
     /*
      * declare walk_set ready
      */
@@ -336,515 +375,854 @@ init_walk_set(struct walk_set *wset_p, char const *context)
 
 
 /*
- * free_item - free and clear an item
+ * add_walk_rule_list - append a walk_rule index to a walk_rule_list
  *
  * given:
- *	i_p	    pointer to a calloced struct item
+ *	list	    pointer to a walk_rule_list
+ *	indx	    walk_rule index, larger than any index already in the list
  *
- * NOTE: This function does not return on an internal error.
+ * NOTE: This function does not return on error.
  */
 static void
-free_item(struct item *i_p)
+add_walk_rule_list(struct walk_rule_list *list, int indx)
 {
+    int *indx_p;		    /* reallocated array of walk_rule indexes */
+
     /*
      * firewall - catch NULL ptrs
      */
-    if (i_p == NULL) {
-	err(36, __func__, "called with NULL i_p");
+    if (list == NULL) {
+	err(139, __func__, "called with NULL list");
 	not_reached();
     }
 
     /*
-     * free orig_path
+     * grow the list by 1: walk_rule sets are short and compiled only once
      */
-    if (i_p->orig_path != NULL) {
-	free(i_p->orig_path);
-	i_p->orig_path = NULL;
+    errno = 0;	/* pre-clear errno for errp() */
+    indx_p = realloc(list->indx, (list->count + 1) * sizeof(int));
+    if (indx_p == NULL) {
+	errp(140, __func__, "realloc of %zu walk_rule indexes failed", list->count + 1);
+	not_reached();
     }
+    indx_p[list->count] = indx;
+    list->indx = indx_p;
+    ++list->count;
+    return;
+}
 
-    /*
-     * free orig_name
-     */
-    if (i_p->orig_name != NULL) {
-	free(i_p->orig_name);
-	i_p->orig_name = NULL;
+
+/*
+ * free_walk_match - free a walk_match compiled by compile_walk_set()
+ *
+ * given:
+ *	match	    pointer to a walk_match, or NULL
+ *
+ * NOTE: This function does nothing if match is NULL.
+ */
+static void
+free_walk_match(struct walk_match *match)
+{
+    size_t i;
+
+    if (match == NULL) {
+	return;
+    }
+    if (match->name != NULL) {
+	for (i = 0; i <= match->mask; ++i) {
+	    free(match->name[i].list.indx);
+	}
+	free(match->name);
+	match->name = NULL;
     }
+    for (i = 0; i <= UCHAR_MAX; ++i) {
+	free(match->prefix[i].indx);
+	free(match->suffix[i].indx);
+    }
+    free(match->other.indx);
+    free(match);
+    return;
+}
 
-    /*
-     * free fts_path
-     */
-    if (i_p->fts_path != NULL) {
-	free(i_p->fts_path);
-	i_p->fts_path = NULL;
+
+/*
+ * fnmatch_literal_len - length of the leading part of a fnmatch(3) pattern with no special characters
+ *
+ * A backslash is special because a walk_rule uses fnmatch(3) without FNM_NOESCAPE.
+ *
+ * given:
+ *	pattern	    fnmatch(3) pattern
+ *	len	    number of bytes of pattern to consider
+ *
+ * returns:
+ *	number of leading bytes that match only themselves (or, with FNM_CASEFOLD, their other case)
+ */
+static size_t
+fnmatch_literal_len(char const *pattern, size_t len)
+{
+    size_t i;
+
+    for (i = 0; i < len; ++i) {
+	if (strchr("*?[\\", pattern[i]) != NULL) {
+	    break;
+	}
     }
+    return i;
+}
+
+
+/*
+ * compile_walk_set - compile a walk_rule set into a walk_match for first-match lookup
+ *
+ * See the walk_match comment in walk.h for how walk_rules are classified.
+ *
+ * given:
+ *	wset_p	    pointer to a walk_set with count set
+ *
+ * returns:
+ *	malloced walk_match
+ *
+ * NOTE: This function does not return on error.
+ */
+static struct walk_match *
+compile_walk_set(struct walk_set *wset_p)
+{
+    struct walk_match *match = NULL;	/* compiled walk_rule set */
+    struct walk_rule *rule_p;		/* pointer to a walk rule */
+    struct walk_name_slot *slot;	/* name hash table slot */
+    size_t slots;			/* number of name hash table slots */
+    size_t len;				/* length of pattern */
+    size_t lit;				/* length of the literal start of a fnmatch(3) pattern */
+    uint32_t hash;			/* case-folded hash of pattern */
+    char const *name;			/* literal name, prefix or suffix of a walk_rule */
+    int indx;
 
     /*
-     * free fts_name
+     * firewall - catch NULL ptrs
      */
-    if (i_p->fts_name != NULL) {
-	free(i_p->fts_name);
-	i_p->fts_name = NULL;
+    if (wset_p == NULL || wset_p->rule == NULL) {
+	err(141, __func__, "called with NULL wset_p or NULL wset_p->rule");
+	not_reached();
     }
 
     /*
-     * zero the item
+     * allocate the walk_match with a name hash table at most half full
      */
-    memset(i_p, 0, sizeof(struct item));
+    errno = 0;	/* pre-clear errno for errp() */
+    match = calloc(1, sizeof(struct walk_match));
+    if (match == NULL) {
+	errp(142, __func__, "calloc of walk_match failed");
+	not_reached();
+    }
+    for (slots = 16; slots < 2 * (size_t)wset_p->count; slots *= 2) {
+	/* just grow */
+    }
+    errno = 0;	/* pre-clear errno for errp() */
+    match->name = calloc(slots, sizeof(struct walk_name_slot));
+    if (match->name == NULL) {
+	errp(143, __func__, "calloc of %zu walk_name_slot failed", slots);
+	not_reached();
+    }
+    match->mask = slots - 1;
 
     /*
-     * free the calloced struct item
+     * classify each walk_rule in walk_set order
      */
-    free(i_p);
-    return;
+    for (indx = 0, rule_p = wset_p->rule; rule_p->pattern != NULL; ++rule_p, ++indx) {
+	len = strlen(rule_p->pattern);
+	name = NULL;
+
+	switch (rule_p->match) {
+	case MATCH_STR:
+	case MATCH_STR_ANYCASE:
+	    name = rule_p->pattern;
+	    break;
+
+	case MATCH_PREFIX:
+	case MATCH_PREFIX_ANYCASE:
+	    if (len > 0) {
+		add_walk_rule_list(&match->prefix[tolower((unsigned char)rule_p->pattern[0])], indx);
+		continue;
+	    }
+	    break;
+
+	case MATCH_SUFFIX:
+	case MATCH_SUFFIX_ANYCASE:
+	    if (len > 0) {
+		add_walk_rule_list(&match->suffix[tolower((unsigned char)rule_p->pattern[len-1])], indx);
+		continue;
+	    }
+	    break;
+
+	case MATCH_FNMATCH:
+	case MATCH_FNMATCH_ANYCASE:
+	    lit = fnmatch_literal_len(rule_p->pattern, len);
+	    if (lit == len) {
+		/* no special characters: pattern matches only itself */
+		name = rule_p->pattern;
+	    } else if (lit > 0 && lit == len-1 && rule_p->pattern[lit] == '*') {
+		/* "literal*" */
+		add_walk_rule_list(&match->prefix[tolower((unsigned char)rule_p->pattern[0])], indx);
+		continue;
+	    } else if (len > 1 && rule_p->pattern[0] == '*' &&
+		       fnmatch_literal_len(rule_p->pattern+1, len-1) == len-1) {
+		/* "*literal" */
+		add_walk_rule_list(&match->suffix[tolower((unsigned char)rule_p->pattern[len-1])], indx);
+		continue;
+	    }
+	    break;
+
+	default:
+	    break;
+	}
+
+	/*
+	 * add an exact name walk_rule to the name hash table
+	 */
+	if (name != NULL) {
+	    hash = path_hash(name, len, true);
+	    for (slot = &match->name[hash & match->mask];
+		 slot->pattern != NULL && (slot->hash != hash || strcasecmp(slot->pattern, name) != 0);
+		 slot = &match->name[(size_t)(slot - match->name + 1) & match->mask]) {
+		/* linear probe */
+	    }
+	    if (slot->pattern == NULL) {
+		slot->pattern = name;
+		slot->hash = hash;
+	    }
+	    add_walk_rule_list(&slot->list, indx);
+
+	/*
+	 * everything else must be tried for every item
+	 */
+	} else {
+	    add_walk_rule_list(&match->other, indx);
+	}
+    }
+    return match;
 }
 
 
 /*
- * alloc_item - calloc a struct item
+ * dup_walk_set - copy a walk_set so that a walk may use it in its own thread
  *
- * One of the important side effects of this function is to use basename(3)
- * to obtain an allocated the basename of the original fts_path.
- *
- * All of the struct item are calloced, including the struct item itself, are calloced.
+ * A walk_set that init_walk_stat() is given is initialized, and its walk_rule
+ * match counts are updated as the tree is walked.  Two walks at the same time
+ * in different threads must therefore not share a walk_set.  The copy has its
+ * own walk_rule array, is not ready, and has the name of wset_p.
  *
  * given:
- *	orig_path   original pre-canonicalization path
- *	fts_path    "root path" from topdir of the item
- *	st_size	    size, in bytes in the form used by stat(2)
- *	st_mode	    inode protection mode in the form used b by stat(2)
- *	fts_level   fts_path depth, 0 ==> topdir, 1 ==> directly under topdir, 2 ==> in sub-dir under topdir
+ *	wset_p	    pointer to the walk_set to copy
  *
  * returns:
- *	pointer to an calloced and filled out struct item with independently calloced strings.
+ *	malloced walk_set to pass to init_walk_stat()
  *
- * NOTE: This function will NOT return NULL.
+ * NOTE: Use free_dup_walk_set() to free the copy once its walk_stat has been freed.
  *
- * NOTE: This function does not return on an internal error.
+ * NOTE: This function does not return on error.
  */
-static struct item *
-alloc_item(char const *orig_path, char const *fts_path,
-	   off_t st_size, mode_t st_mode, int_least32_t fts_level)
+struct walk_set *
+dup_walk_set(struct walk_set const *wset_p)
 {
-    struct item *i_p;		/* struct item pointer that has been calloced */
+    struct walk_set *dup_p = NULL;  /* copy of the walk_set */
+    struct walk_rule *rule = NULL;  /* copy of the walk_rule array */
+    size_t count;		    /* length of set counting the final NULL walk_rule.pattern */
+    size_t i;
 
     /*
      * firewall - catch NULL ptrs
      */
-    if (orig_path == NULL) {
-	err(37, __func__, "called with NULL orig_path");
+    if (wset_p == NULL) {
+	err(124, __func__, "called with NULL wset_p");
 	not_reached();
     }
-    if (fts_path == NULL) {
-	err(38, __func__, "called with NULL fts_path");
+    if (wset_p->rule == NULL) {
+	err(125, __func__, "called with NULL wset_p->rule");
 	not_reached();
     }
 
     /*
-     * allocate and zeroize a struct item
+     * copy the walk_rule array, including the final NULL walk_rule.pattern
      */
-    i_p = calloc(1, sizeof(struct item));
-    if (i_p == NULL) {
-	errp(39, __func__, "failed to calloc 1 struct item");
-	not_reached();
+    for (count = 1; wset_p->rule[count-1].pattern != NULL; ++count) {
+	/* just count */
     }
-
-    /*
-     * save orig_path information
-     */
-    i_p->orig_path = strdup(orig_path);
-    if (i_p->orig_path == NULL) {
-	errp(40, __func__, "failed strdup of orig_path");
+    errno = 0;	/* pre-clear errno for errp() */
+    rule = calloc(count, sizeof(struct walk_rule));
+    if (rule == NULL) {
+	errp(126, __func__, "calloc of %zu walk rules failed", count);
 	not_reached();
     }
-    i_p->orig_pathlen = strlen(i_p->orig_path);
-
-    /*
-     * obtain the basename of the original path
-     */
-    i_p->orig_name = base_name(i_p->orig_path);
-    i_p->orig_namelen = strlen(i_p->orig_name);
+    memcpy(rule, wset_p->rule, count * sizeof(struct walk_rule));
+    for (i = 0; i < count; ++i) {
+	rule[i].match_count = 0;
+	rule[i].p_preg = NULL;
+    }
 
     /*
-     * duplicate the fts_name
+     * form the walk_set
      */
-    i_p->fts_path = strdup(fts_path);
-    if (i_p->fts_path == NULL) {
-	errp(41, __func__, "failed strdup of fts_path");
+    errno = 0;	/* pre-clear errno for errp() */
+    dup_p = calloc(1, sizeof(struct walk_set));
+    if (dup_p == NULL) {
+	errp(127, __func__, "calloc of walk_set failed");
 	not_reached();
     }
-    i_p->fts_pathlen = strlen(i_p->fts_path);
+    memcpy(dup_p, &(struct walk_set){ .name = wset_p->name, .ready = false, .context = NULL, .count = 0, .rule = rule,
+				      .match = NULL },
+	   sizeof(struct walk_set));
+    return dup_p;
+}
 
-    /*
-     * obtain the basename of the path
-     */
-    i_p->fts_name = base_name(i_p->fts_path);
-    i_p->fts_namelen = strlen(i_p->fts_name);
 
-    /*
-     * save fts_level
-     */
-    i_p->fts_level = fts_level;
+/*
+ * free_dup_walk_set - free a walk_set copied by dup_walk_set()
+ *
+ * given:
+ *	wset_p	    pointer to a walk_set from dup_walk_set(), or NULL
+ *
+ * NOTE: This function does nothing if wset_p is NULL.
+ */
+void
+free_dup_walk_set(struct walk_set *wset_p)
+{
+    if (wset_p == NULL) {
+	return;
+    }
+    if (wset_p->ready) {
+	free_walk_set(wset_p);
+    }
+    free(wset_p->rule);
+    free(wset_p);
+    return;
+}
 
-    /*
-     * save st_size
-     */
-    i_p->st_size = st_size;
+/*
+ * walk_arena_alloc - give out zeroized storage from a walk_arena
+ *
+ * given:
+ *	arena	    pointer to a walk_arena
+ *	size	    number of bytes
+ *	align	    alignment of the storage, a power of 2 no larger than sizeof(max_align_t)
+ *
+ * returns:
+ *	pointer to size zeroized bytes owned by the arena
+ *
+ * NOTE: This function will NOT return NULL.
+ *
+ * NOTE: This function does not return on error.
+ */
+static void *
+walk_arena_alloc(struct walk_arena *arena, size_t size, size_t align)
+{
+    struct walk_arena_chunk *chunk;	/* chunk to give storage from */
+    size_t chunk_size;			/* number of bytes of data of a new chunk */
+    size_t offset;			/* aligned offset into the chunk data */
 
     /*
-     * save st_mode
+     * firewall - catch NULL ptrs
      */
-    i_p->st_mode = st_mode;
+    if (arena == NULL) {
+	err(148, __func__, "called with NULL arena");
+	not_reached();
+    }
 
     /*
-     * initialize marks
+     * start a new chunk if the current chunk is full
      *
-     * IMPORTANT: This is the ONLY place in the walk code that uses marks.
-     *		  These mark values are for the used by calling functions ONLY.
-     */
-    i_p->mark_bool = false;
-    i_p->mark_intmax = 0;
-    i_p->mark_size = 0;
-    i_p->mark_off = 0;
-    i_p->mark_mode = 0;
-    i_p->mark_ptr = NULL;
+     * NOTE: The unused end of the full chunk is abandoned.
+     */
+    chunk = arena->chunk;
+    offset = (chunk == NULL) ? 0 : ((chunk->used + align - 1) & ~(align - 1));
+    if (chunk == NULL || offset + size > chunk->size) {
+	chunk_size = (size > WALK_ARENA_CHUNK) ? size : WALK_ARENA_CHUNK;
+	errno = 0;	/* pre-clear errno for errp() */
+	chunk = calloc(1, sizeof(struct walk_arena_chunk) + chunk_size);
+	if (chunk == NULL) {
+	    errp(149, __func__, "calloc of walk_arena_chunk of %zu bytes failed", chunk_size);
+	    not_reached();
+	}
+	chunk->next = arena->chunk;
+	chunk->size = chunk_size;
+	chunk->used = 0;
+	arena->chunk = chunk;
+	++arena->chunks;
+	offset = 0;
+    }
 
     /*
-     * return calloced struct item
+     * give out storage
      */
-    return i_p;
+    chunk->used = offset + size;
+    arena->bytes += size;
+    return (char *)chunk->data + offset;
 }
 
 
 /*
- * free_items_in_dyn_array - free the array of allocated items in an dyn_array
+ * walk_arena_intern - find or add a string in a walk_arena
  *
  * given:
- *	dyn_array_p pointer to a dynamic array of item pointers
+ *	arena	    pointer to a walk_arena
+ *	str	    string to intern, need not be NUL terminated
+ *	len	    length of str
  *
- * NOTE: This function does not return on error due to invalid pointers.
+ * returns:
+ *	NUL terminated copy of str owned by the arena
+ *
+ * NOTE: This function will NOT return NULL.
+ *
+ * NOTE: This function does not return on error.
  */
-static void
-free_items_in_dyn_array(struct dyn_array *dyn_array_p)
+static char *
+walk_arena_intern(struct walk_arena *arena, char const *str, size_t len)
 {
-    struct item *i_p;	    /* pointer to an element in the dynamic array */
-    intmax_t len;	    /* number of elements in the dynamic array */
-    intmax_t i;
+    struct walk_intern_slot *slot;	/* intern hash table slot */
+    struct walk_intern_slot *old;	/* intern hash table being replaced */
+    size_t old_slots;			/* number of slots of the old intern hash table */
+    size_t slots;			/* number of slots of the intern hash table */
+    uint32_t hash;			/* exact hash of str */
+    char *copy;				/* arena copy of str */
+    size_t i;
 
     /*
      * firewall - catch NULL ptrs
      */
-    if (dyn_array_p == NULL) {
-	err(42, __func__, "called with NULL dyn_array_p");
+    if (arena == NULL) {
+	err(150, __func__, "called with NULL arena");
 	not_reached();
     }
-    if (dyn_array_p->data == NULL) {
-	err(43, __func__, "dyn_array_p->data is NULL");
+    if (str == NULL) {
+	err(151, __func__, "called with NULL str");
 	not_reached();
     }
 
     /*
-     * free each item
+     * keep the intern hash table at most half full
      */
-    len = dyn_array_tell(dyn_array_p);
-    for (i=0; i < len; ++i) {
-
-	/*
-	 * obtain the current item
-	 */
-	i_p = dyn_array_value(dyn_array_p, struct item *, i);
+    if (arena->slot == NULL || (arena->strings + 1) * 2 > arena->mask + 1) {
+	old = arena->slot;
+	old_slots = (old == NULL) ? 0 : arena->mask + 1;
+	slots = (old == NULL) ? 1024 : old_slots * 2;
+	errno = 0;	/* pre-clear errno for errp() */
+	arena->slot = calloc(slots, sizeof(struct walk_intern_slot));
+	if (arena->slot == NULL) {
+	    errp(152, __func__, "calloc of %zu walk_intern_slot failed", slots);
+	    not_reached();
+	}
+	arena->mask = slots - 1;
+	for (i = 0; i < old_slots; ++i) {
+	    if (old[i].str != NULL) {
+		for (slot = &arena->slot[old[i].hash & arena->mask]; slot->str != NULL;
+		     slot = &arena->slot[(size_t)(slot - arena->slot + 1) & arena->mask]) {
+		    /* linear probe */
+		}
+		*slot = old[i];
+	    }
+	}
+	free(old);
+    }
 
-	/*
-	 * free the current item
-	 */
-	if (i_p != NULL) {
-	    free_item(i_p);
+    /*
+     * look for the string
+     */
+    hash = path_hash(str, len, false);
+    for (slot = &arena->slot[hash & arena->mask]; slot->str != NULL;
+	 slot = &arena->slot[(size_t)(slot - arena->slot + 1) & arena->mask]) {
+	if (slot->hash == hash && slot->len == len && memcmp(slot->str, str, len) == 0) {
+	    ++arena->shared;
+	    return slot->str;
 	}
     }
-    return;
+
+    /*
+     * add the string
+     */
+    copy = walk_arena_alloc(arena, len + 1, 1);
+    memcpy(copy, str, len);
+    copy[len] = '\0';
+    slot->hash = hash;
+    slot->len = len;
+    slot->str = copy;
+    ++arena->strings;
+    return copy;
 }
 
 
 /*
- * free_walk_stat - free and clear a walk_stat
+ * walk_arena_base_name - basename of a path in a walk_arena
+ *
+ * This function returns the same basename as base_name(), without allocating
+ * storage outside of the arena.  When path has no trailing slash, the basename
+ * is the end of path itself.
  *
  * given:
- *	wstat_p	    pointer to a struct walk_stat
+ *	arena	    pointer to a walk_arena
+ *	path	    NUL terminated path owned by the arena
+ *	len	    length of path
+ *	len_p	    where to save the length of the basename
  *
- * NOTE: This function does not return on error due to invalid pointers.
+ * returns:
+ *	basename of path owned by the arena
+ *
+ * NOTE: This function does not return on error.
  */
-void
-free_walk_stat(struct walk_stat *wstat_p)
+static char *
+walk_arena_base_name(struct walk_arena *arena, char *path, size_t len, size_t *len_p)
 {
+    size_t start;		/* offset of the start of the basename */
+    size_t end;			/* offset just beyond the end of the basename */
+
     /*
      * firewall - catch NULL ptrs
      */
-    if (wstat_p == NULL) {
-	err(44, __func__, "called with NULL wstat_p");
+    if (path == NULL || len_p == NULL) {
+	err(153, __func__, "called with NULL path or NULL len_p");
 	not_reached();
     }
 
     /*
-     * free walk_set
+     * an empty path has a basename of . (dot)
      */
-    if (wstat_p->set != NULL) {
-	free_walk_set(wstat_p->set);
-	wstat_p->set = NULL;
+    if (len == 0) {
+	*len_p = 1;
+	return walk_arena_intern(arena, ".", 1);
     }
 
     /*
-     * free topdir
+     * ignore trailing slashes: a path of only slashes has a basename of / (slash)
      */
-    if (wstat_p->topdir != NULL) {
-	free(wstat_p->topdir);
-	wstat_p->topdir = NULL;
+    for (end = len; end > 0 && path[end-1] == '/'; --end) {
+	/* just find the end */
+    }
+    if (end == 0) {
+	*len_p = 1;
+	return walk_arena_intern(arena, "/", 1);
     }
 
     /*
-     * unset walked
+     * the basename follows the last slash
      */
-    wstat_p->walked = false;
+    for (start = end; start > 0 && path[start-1] != '/'; --start) {
+	/* just find the start */
+    }
+    *len_p = end - start;
+    if (end == len) {
+	return path + start;
+    }
+    return walk_arena_intern(arena, path + start, end - start);
+}
+
+
+/*
+ * walk_arena_scratch - obtain the scratch buffer of a walk_arena
+ *
+ * The scratch buffer is grown as needed and reused: its contents are valid only
+ * until the next call.  It is freed by free_walk_arena().
+ *
+ * given:
+ *	arena	    pointer to a walk_arena
+ *	size	    minimum size of the scratch buffer in bytes
+ *
+ * returns:
+ *	pointer to a scratch buffer of at least size bytes
+ *
+ * NOTE: This function does not return on error.
+ */
+static char *
+walk_arena_scratch(struct walk_arena *arena, size_t size)
+{
+    size_t new_size;			/* new scratch buffer size */
 
     /*
-     * unset walking
+     * firewall - catch NULL ptrs
      */
-    wstat_p->walking = false;
+    if (arena == NULL) {
+	err(155, __func__, "called with NULL arena");
+	not_reached();
+    }
 
     /*
-     * unset skip
+     * grow the scratch buffer if needed
      */
-    wstat_p->skip = false;
+    if (arena->scratch == NULL || arena->scratch_size < size) {
+	for (new_size = (arena->scratch_size > 0) ? arena->scratch_size : BUFSIZ; new_size < size; new_size *= 2) {
+	    ;
+	}
+	free(arena->scratch);
+	arena->scratch = malloc(new_size);
+	if (arena->scratch == NULL) {
+	    errp(156, __func__, "malloc of %zu byte scratch buffer failed", new_size);
+	    not_reached();
+	}
+	arena->scratch_size = new_size;
+    }
+    return arena->scratch;
+}
+
+
+/*
+ * free_walk_arena - free every chunk of a walk_arena
+ *
+ * All items and strings given out by the arena are freed.
+ *
+ * given:
+ *	arena	    pointer to a walk_arena
+ *
+ * NOTE: This function does not return on error.
+ */
+static void
+free_walk_arena(struct walk_arena *arena)
+{
+    struct walk_arena_chunk *chunk;	/* chunk to free */
 
     /*
-     * unset tar_listing_used
+     * firewall - catch NULL ptrs
      */
-    wstat_p->tar_listing_used = false;
+    if (arena == NULL) {
+	err(154, __func__, "called with NULL arena");
+	not_reached();
+    }
 
     /*
-     * clear step count
+     * free each chunk, the intern hash table and the scratch buffer
      */
-    wstat_p->steps = 0;
+    while (arena->chunk != NULL) {
+	chunk = arena->chunk;
+	arena->chunk = chunk->next;
+	free(chunk);
+    }
+    free(arena->slot);
+    free(arena->scratch);
+    memset(arena, 0, sizeof(struct walk_arena));
+    return;
+}
+
+
+/*
+ * alloc_item - allocate a struct item from the arena of a walk_stat
+ *
+ * One of the important side effects of this function is to obtain the
+ * basename of the original path and of fts_path, as base_name() would.
+ *
+ * The struct item and its strings are owned by the walk_stat arena, and are
+ * freed by free_walk_stat().  Equal strings share one copy in the arena.
+ *
+ * given:
+ *	wstat_p	    pointer to a struct walk_stat
+ *	orig_path   original pre-canonicalization path
+ *	fts_path    "root path" from topdir of the item
+ *	st_size	    size, in bytes in the form used by stat(2)
+ *	st_mode	    inode protection mode in the form used b by stat(2)
+ *	fts_level   fts_path depth, 0 ==> topdir, 1 ==> directly under topdir, 2 ==> in sub-dir under topdir
+ *
+ * returns:
+ *	pointer to a zeroized and filled out struct item owned by the walk_stat arena
+ *
+ * NOTE: This function will NOT return NULL.
+ *
+ * NOTE: This function does not return on an internal error.
+ */
+static struct item *
+alloc_item(struct walk_stat *wstat_p, char const *orig_path, char const *fts_path,
+	   off_t st_size, mode_t st_mode, int_least32_t fts_level)
+{
+    struct item *i_p;		/* struct item pointer from the arena */
 
     /*
-     * free the all items and the all dynamic array
+     * firewall - catch NULL ptrs
      */
-    if (wstat_p->all != NULL) {
+    if (wstat_p == NULL) {
+	err(36, __func__, "called with NULL wstat_p");
+	not_reached();
+    }
+    if (orig_path == NULL) {
+	err(37, __func__, "called with NULL orig_path");
+	not_reached();
+    }
+    if (fts_path == NULL) {
+	err(38, __func__, "called with NULL fts_path");
+	not_reached();
+    }
 
-	/* free all items pointed at by the dynamic array */
-	free_items_in_dyn_array(wstat_p->all);
+    /*
+     * obtain a zeroized struct item
+     */
+    i_p = walk_arena_alloc(&wstat_p->arena, sizeof(struct item), sizeof(max_align_t));
 
-	/* free the all dynamic array */
-	dyn_array_free(wstat_p->all);
-    }
+    /*
+     * save orig_path information
+     */
+    i_p->orig_pathlen = strlen(orig_path);
+    i_p->orig_path = walk_arena_intern(&wstat_p->arena, orig_path, i_p->orig_pathlen);
 
     /*
-     * free skip_set dynamic array
+     * obtain the basename of the original path
      */
-    if (wstat_p->skip_set != NULL) {
-	dyn_array_free(wstat_p->skip_set);
-	wstat_p->skip_set = NULL;
-    }
+    i_p->orig_name = walk_arena_base_name(&wstat_p->arena, i_p->orig_path, i_p->orig_pathlen, &i_p->orig_namelen);
 
     /*
-     * free dyn_array for items by type
+     * save fts_path information
      */
-    if (wstat_p->file != NULL) {
-	dyn_array_free(wstat_p->file);
-	wstat_p->file = NULL;
-    }
-    if (wstat_p->dir != NULL) {
-	dyn_array_free(wstat_p->dir);
-	wstat_p->dir = NULL;
-    }
-    if (wstat_p->symlink != NULL) {
-	dyn_array_free(wstat_p->symlink);
-	wstat_p->symlink = NULL;
-    }
-    if (wstat_p->not_file != NULL) {
-	dyn_array_free(wstat_p->not_file);
-	wstat_p->not_file = NULL;
-    }
-    if (wstat_p->not_dir != NULL) {
-	dyn_array_free(wstat_p->not_dir);
-	wstat_p->not_dir = NULL;
-    }
-    if (wstat_p->not_symlink != NULL) {
-	dyn_array_free(wstat_p->not_symlink);
-	wstat_p->not_symlink = NULL;
-    }
-    if (wstat_p->filedir != NULL) {
-	dyn_array_free(wstat_p->filedir);
-	wstat_p->filedir = NULL;
-    }
-    if (wstat_p->filesym != NULL) {
-	dyn_array_free(wstat_p->filesym);
-	wstat_p->filesym = NULL;
-    }
-    if (wstat_p->dirsym != NULL) {
-	dyn_array_free(wstat_p->dirsym);
-	wstat_p->dirsym = NULL;
-    }
-    if (wstat_p->filedirsym != NULL) {
-	dyn_array_free(wstat_p->filedirsym);
-	wstat_p->filedirsym = NULL;
-    }
-    if (wstat_p->not_filedir != NULL) {
-	dyn_array_free(wstat_p->not_filedir);
-	wstat_p->not_filedir = NULL;
-    }
-    if (wstat_p->not_filesym != NULL) {
-	dyn_array_free(wstat_p->not_filesym);
-	wstat_p->not_filesym = NULL;
-    }
-    if (wstat_p->not_dirsym != NULL) {
-	dyn_array_free(wstat_p->not_dirsym);
-	wstat_p->not_dirsym = NULL;
-    }
-    if (wstat_p->not_filedirsym != NULL) {
-	dyn_array_free(wstat_p->not_filedirsym);
-	wstat_p->not_filedirsym = NULL;
-    }
+    i_p->fts_pathlen = strlen(fts_path);
+    i_p->fts_path = walk_arena_intern(&wstat_p->arena, fts_path, i_p->fts_pathlen);
 
     /*
-     * free dyn_array for items by level
+     * obtain the basename of the path
      */
-    if (wstat_p->top != NULL) {
-	dyn_array_free(wstat_p->top);
-	wstat_p->top = NULL;
-    }
-    if (wstat_p->shallow != NULL) {
-	dyn_array_free(wstat_p->shallow);
-	wstat_p->shallow = NULL;
-    }
-    if (wstat_p->too_deep != NULL) {
-	dyn_array_free(wstat_p->too_deep);
-	wstat_p->too_deep = NULL;
-    }
-    if (wstat_p->below != NULL) {
-	dyn_array_free(wstat_p->below);
-	wstat_p->below = NULL;
-    }
-    /**/
-    if (wstat_p->any_level != NULL) {
-	dyn_array_free(wstat_p->any_level);
-	wstat_p->any_level = NULL;
-    }
-    if (wstat_p->unknown_level != NULL) {
-	dyn_array_free(wstat_p->unknown_level);
-	wstat_p->unknown_level = NULL;
-    }
+    i_p->fts_name = walk_arena_base_name(&wstat_p->arena, i_p->fts_path, i_p->fts_pathlen, &i_p->fts_namelen);
 
     /*
-     * free dyn_array for items by walk_rule
+     * save fts_level
      */
-    if (wstat_p->required != NULL) {
-	dyn_array_free(wstat_p->required);
-	wstat_p->required = NULL;
-    }
-    if (wstat_p->optional != NULL) {
-	dyn_array_free(wstat_p->optional);
-	wstat_p->optional = NULL;
-    }
-    /**/
-    if (wstat_p->non_empty != NULL) {
-	dyn_array_free(wstat_p->non_empty);
-	wstat_p->non_empty = NULL;
-    }
-    if (wstat_p->empty != NULL) {
-	dyn_array_free(wstat_p->empty);
-	wstat_p->empty = NULL;
-    }
-    /**/
-    if (wstat_p->free != NULL) {
-	dyn_array_free(wstat_p->free);
-	wstat_p->free = NULL;
-    }
-    if (wstat_p->counted != NULL) {
-	dyn_array_free(wstat_p->counted);
-	wstat_p->counted = NULL;
-    }
-    /**/
-    if (wstat_p->counted_file != NULL) {
-	dyn_array_free(wstat_p->counted_file);
-	wstat_p->counted_file = NULL;
-    }
-    if (wstat_p->counted_dir != NULL) {
-	dyn_array_free(wstat_p->counted_dir);
-	wstat_p->counted_dir = NULL;
-    }
-    if (wstat_p->counted_sym != NULL) {
-	dyn_array_free(wstat_p->counted_sym);
-	wstat_p->counted_sym = NULL;
-    }
-    if (wstat_p->counted_other != NULL) {
-	dyn_array_free(wstat_p->counted_other);
-	wstat_p->counted_other = NULL;
-    }
-    /**/
-    if (wstat_p->ignore != NULL) {
-	dyn_array_free(wstat_p->ignore);
-	wstat_p->ignore = NULL;
-    }
-    if (wstat_p->not_ignore != NULL) {
-	dyn_array_free(wstat_p->not_ignore);
-	wstat_p->not_ignore = NULL;
-    }
-    /**/
-    if (wstat_p->prohibit != NULL) {
-	dyn_array_free(wstat_p->prohibit);
-	wstat_p->prohibit = NULL;
-    }
-    if (wstat_p->not_prohibit != NULL) {
-	dyn_array_free(wstat_p->not_prohibit);
-	wstat_p->not_prohibit = NULL;
-    }
-    /**/
-    if (wstat_p->unmatched != NULL) {
-	/* free the dynamic array */
-	dyn_array_free(wstat_p->unmatched);
-	wstat_p->unmatched = NULL;
-    }
+    i_p->fts_level = fts_level;
 
     /*
-     * free dyn_array by path problem
+     * save st_size
      */
-    if (wstat_p->unsafe != NULL) {
-	dyn_array_free(wstat_p->unsafe);
-	wstat_p->unsafe = NULL;
-    }
-    if (wstat_p->abs != NULL) {
-	dyn_array_free(wstat_p->abs);
-	wstat_p->abs = NULL;
-    }
-    if (wstat_p->too_long_path != NULL) {
-	dyn_array_free(wstat_p->too_long_path);
-	wstat_p->too_long_path = NULL;
+    i_p->st_size = st_size;
+
+    /*
+     * save st_mode
+     */
+    i_p->st_mode = st_mode;
+
+    /*
+     * no categories yet
+     */
+    i_p->category = 0;
+
+    /*
+     * initialize marks
+     *
+     * IMPORTANT: This is the ONLY place in the walk code that uses marks.
+     *		  These mark values are for the used by calling functions ONLY.
+     */
+    i_p->mark_bool = false;
+    i_p->mark_intmax = 0;
+    i_p->mark_size = 0;
+    i_p->mark_off = 0;
+    i_p->mark_mode = 0;
+    i_p->mark_ptr = NULL;
+
+    /*
+     * return the arena struct item
+     */
+    return i_p;
+}
+
+
+/*
+ * free_walk_stat - free and clear a walk_stat
+ *
+ * given:
+ *	wstat_p	    pointer to a struct walk_stat
+ *
+ * NOTE: This function does not return on error due to invalid pointers.
+ */
+void
+free_walk_stat(struct walk_stat *wstat_p)
+{
+    int cat;
+
+    /*
+     * firewall - catch NULL ptrs
+     */
+    if (wstat_p == NULL) {
+	err(44, __func__, "called with NULL wstat_p");
+	not_reached();
     }
-    if (wstat_p->too_long_name != NULL) {
-	dyn_array_free(wstat_p->too_long_name);
-	wstat_p->too_long_name = NULL;
+
+    /*
+     * free walk_set
+     */
+    if (wstat_p->set != NULL) {
+	free_walk_set(wstat_p->set);
+	wstat_p->set = NULL;
     }
-    /**/
-    if (wstat_p->fts_err != NULL) {
-	dyn_array_free(wstat_p->fts_err);
-	wstat_p->fts_err = NULL;
+
+    /*
+     * free topdir
+     */
+    if (wstat_p->topdir != NULL) {
+	free(wstat_p->topdir);
+	wstat_p->topdir = NULL;
     }
-    if (wstat_p->safe != NULL) {
-	dyn_array_free(wstat_p->safe);
-	wstat_p->safe = NULL;
+
+    /*
+     * unset walked
+     */
+    wstat_p->walked = false;
+
+    /*
+     * unset walking
+     */
+    wstat_p->walking = false;
+
+    /*
+     * unset skip
+     */
+    wstat_p->skip = false;
+
+    /*
+     * unset tar_listing_used
+     */
+    wstat_p->tar_listing_used = false;
+
+    /*
+     * unset parallel_walk
+     */
+    wstat_p->parallel_walk = false;
+
+    /*
+     * clear step count
+     */
+    wstat_p->steps = 0;
+
+    /*
+     * free the path indexes
+     */
+    free_path_index(wstat_p->all_index);
+    wstat_p->all_index = NULL;
+    free_path_index(wstat_p->all_exact);
+    wstat_p->all_exact = NULL;
+    free_path_index(wstat_p->prune_index);
+    wstat_p->prune_index = NULL;
+    free_path_index(wstat_p->skip_index);
+    wstat_p->skip_index = NULL;
+
+    /*
+     * free the all dynamic array
+     */
+    if (wstat_p->all != NULL) {
+	dyn_array_free(wstat_p->all);
+	wstat_p->all = NULL;
     }
 
     /*
-     * free dyn_array for item descendant state
+     * free skip_set dynamic array
      */
-    if (wstat_p->visit != NULL) {
-	dyn_array_free(wstat_p->visit);
-	wstat_p->visit = NULL;
+    if (wstat_p->skip_set != NULL) {
+	dyn_array_free(wstat_p->skip_set);
+	wstat_p->skip_set = NULL;
     }
-    if (wstat_p->prune != NULL) {
-	dyn_array_free(wstat_p->prune);
-	wstat_p->prune = NULL;
+
+    /*
+     * free the dynamic arrays materialized for item categories
+     */
+    for (cat = 0; cat < WALK_CAT_COUNT; ++cat) {
+	if (wstat_p->view[cat] != NULL) {
+	    dyn_array_free(wstat_p->view[cat]);
+	    wstat_p->view[cat] = NULL;
+	}
+	wstat_p->cat_count[cat] = 0;
     }
 
+    /*
+     * free all items of the all and skip_set dynamic arrays, and their strings
+     */
+    free_walk_arena(&wstat_p->arena);
+
     /*
      * declare walk_stat not ready
      */
@@ -872,13 +1250,15 @@ free_walk_stat(struct walk_stat *wstat_p)
  *      max_depth           - max depth of subdirectory tree, 0 ==> no limit, <0 ==> reserved for future use
  *
  *	tar_listing_used    - true ==> tarball listing related walk, false ==> walk relating to fts(3) processing
+ *	parallel_walk	    - true ==> fts_walk() reads directories with WALK_THREADS worker threads,
+ *			      false ==> fts_walk() uses fts(3)
  *
  * NOTE: This function does not return on an internal error.
  */
 void
 init_walk_stat(struct walk_stat *wstat_p, char const *topdir, struct walk_set *set, char const *context,
 	       size_t max_path_len, size_t max_filename_len, int_least32_t max_depth,
-	       bool tar_listing_used)
+	       bool tar_listing_used, bool parallel_walk)
 {
     /*
      * firewall - catch NULL ptrs
@@ -941,6 +1321,11 @@ init_walk_stat(struct walk_stat *wstat_p, char const *topdir, struct walk_set *s
      */
     wstat_p->tar_listing_used = tar_listing_used;
 
+    /*
+     * set parallel_walk according to parallel_walk
+     */
+    wstat_p->parallel_walk = parallel_walk;
+
     /*
      * set max canonicalized path length
      */
@@ -967,84 +1352,23 @@ init_walk_stat(struct walk_stat *wstat_p, char const *topdir, struct walk_set *s
     wstat_p->skip_set = dyn_array_create(sizeof(struct item *), DEF_CHUNK, DEF_CHUNK, true);
 
     /*
-     * allocate dyn_array for items by type
-     */
-    wstat_p->file = dyn_array_create(sizeof(struct item *), DEF_CHUNK, DEF_CHUNK, true);
-    wstat_p->dir = dyn_array_create(sizeof(struct item *), DEF_CHUNK, DEF_CHUNK, true);
-    wstat_p->symlink = dyn_array_create(sizeof(struct item *), DEF_CHUNK, DEF_CHUNK, true);
-    /**/
-    wstat_p->not_file = dyn_array_create(sizeof(struct item *), DEF_CHUNK, DEF_CHUNK, true);
-    wstat_p->not_dir = dyn_array_create(sizeof(struct item *), DEF_CHUNK, DEF_CHUNK, true);
-    wstat_p->not_symlink = dyn_array_create(sizeof(struct item *), DEF_CHUNK, DEF_CHUNK, true);
-    /**/
-    wstat_p->filedir = dyn_array_create(sizeof(struct item *), DEF_CHUNK, DEF_CHUNK, true);
-    wstat_p->filesym = dyn_array_create(sizeof(struct item *), DEF_CHUNK, DEF_CHUNK, true);
-    wstat_p->dirsym = dyn_array_create(sizeof(struct item *), DEF_CHUNK, DEF_CHUNK, true);
-    wstat_p->filedirsym = dyn_array_create(sizeof(struct item *), DEF_CHUNK, DEF_CHUNK, true);
-    /**/
-    wstat_p->not_filedir = dyn_array_create(sizeof(struct item *), DEF_CHUNK, DEF_CHUNK, true);
-    wstat_p->not_filesym = dyn_array_create(sizeof(struct item *), DEF_CHUNK, DEF_CHUNK, true);
-    wstat_p->not_dirsym = dyn_array_create(sizeof(struct item *), DEF_CHUNK, DEF_CHUNK, true);
-    wstat_p->not_filedirsym = dyn_array_create(sizeof(struct item *), DEF_CHUNK, DEF_CHUNK, true);
-
-    /*
-     * allocate dyn_array for items by level
-     */
-    wstat_p->top = dyn_array_create(sizeof(struct item *), DEF_CHUNK, DEF_CHUNK, true);
-    wstat_p->shallow = dyn_array_create(sizeof(struct item *), DEF_CHUNK, DEF_CHUNK, true);
-    wstat_p->too_deep = dyn_array_create(sizeof(struct item *), DEF_CHUNK, DEF_CHUNK, true);
-    wstat_p->below = dyn_array_create(sizeof(struct item *), DEF_CHUNK, DEF_CHUNK, true);
-    /**/
-    wstat_p->any_level = dyn_array_create(sizeof(struct item *), DEF_CHUNK, DEF_CHUNK, true);
-    wstat_p->unknown_level = dyn_array_create(sizeof(struct item *), DEF_CHUNK, DEF_CHUNK, true);
-
-    /*
-     * allocate dyn_array for items by walk_rule
-     */
-    wstat_p->required = dyn_array_create(sizeof(struct item *), DEF_CHUNK, DEF_CHUNK, true);
-    wstat_p->optional = dyn_array_create(sizeof(struct item *), DEF_CHUNK, DEF_CHUNK, true);
-    /**/
-    wstat_p->non_empty = dyn_array_create(sizeof(struct item *), DEF_CHUNK, DEF_CHUNK, true);
-    wstat_p->empty = dyn_array_create(sizeof(struct item *), DEF_CHUNK, DEF_CHUNK, true);
-    /**/
-    wstat_p->free = dyn_array_create(sizeof(struct item *), DEF_CHUNK, DEF_CHUNK, true);
-    wstat_p->counted = dyn_array_create(sizeof(struct item *), DEF_CHUNK, DEF_CHUNK, true);
-    /**/
-    wstat_p->counted_file = dyn_array_create(sizeof(struct item *), DEF_CHUNK, DEF_CHUNK, true);
-    wstat_p->counted_dir = dyn_array_create(sizeof(struct item *), DEF_CHUNK, DEF_CHUNK, true);
-    wstat_p->counted_sym = dyn_array_create(sizeof(struct item *), DEF_CHUNK, DEF_CHUNK, true);
-    wstat_p->counted_other = dyn_array_create(sizeof(struct item *), DEF_CHUNK, DEF_CHUNK, true);
-    /**/
-    wstat_p->ignore = dyn_array_create(sizeof(struct item *), DEF_CHUNK, DEF_CHUNK, true);
-    wstat_p->not_ignore = dyn_array_create(sizeof(struct item *), DEF_CHUNK, DEF_CHUNK, true);
-    /**/
-    wstat_p->prohibit = dyn_array_create(sizeof(struct item *), DEF_CHUNK, DEF_CHUNK, true);
-    wstat_p->not_prohibit = dyn_array_create(sizeof(struct item *), DEF_CHUNK, DEF_CHUNK, true);
-    /**/
-    wstat_p->unmatched = dyn_array_create(sizeof(struct item *), DEF_CHUNK, DEF_CHUNK, true);
-
-    /*
-     * allocate dyn_array path problem
-     */
-    wstat_p->unsafe = dyn_array_create(sizeof(struct item *), DEF_CHUNK, DEF_CHUNK, true);
-    wstat_p->abs = dyn_array_create(sizeof(struct item *), DEF_CHUNK, DEF_CHUNK, true);
-    wstat_p->too_long_path = dyn_array_create(sizeof(struct item *), DEF_CHUNK, DEF_CHUNK, true);
-    wstat_p->too_long_name = dyn_array_create(sizeof(struct item *), DEF_CHUNK, DEF_CHUNK, true);
-    /**/
-    wstat_p->fts_err = dyn_array_create(sizeof(struct item *), DEF_CHUNK, DEF_CHUNK, true);
-    wstat_p->safe = dyn_array_create(sizeof(struct item *), DEF_CHUNK, DEF_CHUNK, true);
-
-    /*
-     * allocate dyn_array for item descendant state
-     */
-    wstat_p->visit = dyn_array_create(sizeof(struct item *), DEF_CHUNK, DEF_CHUNK, true);
-    wstat_p->prune = dyn_array_create(sizeof(struct item *), DEF_CHUNK, DEF_CHUNK, true);
+     * NOTE: The dynamic arrays of the item categories are materialized by walk_view()
+     *	     on first use, and the category counts were zeroized above.
+     */
 
     /*
      * allocate dyn_array for all items
      */
     wstat_p->all = dyn_array_create(sizeof(struct item *), DEF_CHUNK, DEF_CHUNK, true);
 
+    /*
+     * allocate path indexes
+     */
+    wstat_p->all_index = alloc_path_index(true);
+    wstat_p->all_exact = alloc_path_index(false);
+    wstat_p->prune_index = alloc_path_index(true);
+    wstat_p->skip_index = alloc_path_index(true);
+
     /*
      * declare walk_stat ready
      */
@@ -1132,234 +1456,34 @@ chk_walk_stat(struct walk_stat *wstat_p)
     }
 
     /*
-     * items by type dyn_array must be non-NULL
+     * all dyn_array must be non-NULL
      */
-    if (wstat_p->file == NULL) {
-	warn(__func__, "wstat_p file is NULL");
+    if (wstat_p->all == NULL) {
+	warn(__func__, "wstat_p all is NULL");
 	return false;
     }
-    if (wstat_p->dir == NULL) {
-	warn(__func__, "wstat_p dir is NULL");
+
+    /*
+     * topdir must be non-NULL
+     */
+    if (wstat_p->topdir == NULL) {
+	warn(__func__, "wstat_p->topdir is NULL");
 	return false;
     }
-    if (wstat_p->symlink == NULL) {
-	warn(__func__, "wstat_p symlink is NULL");
+
+    /*
+     * topdir must be non-empty string
+     */
+    if (wstat_p->topdir[0] == '\0') {
+	warn(__func__, "wstat_p->topdir is am empty string");
 	return false;
     }
-    if (wstat_p->not_file == NULL) {
-	warn(__func__, "wstat_p not_file is NULL");
-	return false;
-    }
-    if (wstat_p->not_dir == NULL) {
-	warn(__func__, "wstat_p not_dir is NULL");
-	return false;
-    }
-    if (wstat_p->not_symlink == NULL) {
-	warn(__func__, "wstat_p not_symlink is NULL");
-	return false;
-    }
-    if (wstat_p->filedir == NULL) {
-	warn(__func__, "wstat_p filedir is NULL");
-	return false;
-    }
-    if (wstat_p->filesym == NULL) {
-	warn(__func__, "wstat_p filesym is NULL");
-	return false;
-    }
-    if (wstat_p->dirsym == NULL) {
-	warn(__func__, "wstat_p dirsym is NULL");
-	return false;
-    }
-    if (wstat_p->filedirsym == NULL) {
-	warn(__func__, "wstat_p filedirsym is NULL");
-	return false;
-    }
-    if (wstat_p->not_filedir == NULL) {
-	warn(__func__, "wstat_p not_filedir is NULL");
-	return false;
-    }
-    if (wstat_p->not_filesym == NULL) {
-	warn(__func__, "wstat_p not_filesym is NULL");
-	return false;
-    }
-    if (wstat_p->not_dirsym == NULL) {
-	warn(__func__, "wstat_p not_dirsym is NULL");
-	return false;
-    }
-    if (wstat_p->not_filedirsym == NULL) {
-	warn(__func__, "wstat_p not_filedirsym is NULL");
-	return false;
-    }
-
-    /*
-     * items by level dyn_array must be non-NULL
-     */
-    if (wstat_p->top == NULL) {
-	warn(__func__, "wstat_p top is NULL");
-	return false;
-    }
-    if (wstat_p->shallow == NULL) {
-	warn(__func__, "wstat_p shallow is NULL");
-	return false;
-    }
-    if (wstat_p->too_deep == NULL) {
-	warn(__func__, "wstat_p too_deep is NULL");
-	return false;
-    }
-    if (wstat_p->below == NULL) {
-	warn(__func__, "wstat_p below is NULL");
-	return false;
-    }
-    /**/
-    if (wstat_p->any_level == NULL) {
-	warn(__func__, "wstat_p any_level is NULL");
-	return false;
-    }
-    if (wstat_p->unknown_level == NULL) {
-	warn(__func__, "wstat_p unknown_level is NULL");
-	return false;
-    }
-
-    /*
-     * items by walk_rule dyn_array must be non-NULL
-     */
-    if (wstat_p->required == NULL) {
-	warn(__func__, "wstat_p required is NULL");
-	return false;
-    }
-    if (wstat_p->optional == NULL) {
-	warn(__func__, "wstat_p optional is NULL");
-	return false;
-    }
-    /**/
-    if (wstat_p->non_empty == NULL) {
-	warn(__func__, "wstat_p non_empty is NULL");
-	return false;
-    }
-    if (wstat_p->empty == NULL) {
-	warn(__func__, "wstat_p empty is NULL");
-	return false;
-    }
-    /**/
-    if (wstat_p->free == NULL) {
-	warn(__func__, "wstat_p free is NULL");
-	return false;
-    }
-    if (wstat_p->counted == NULL) {
-	warn(__func__, "wstat_p counted is NULL");
-	return false;
-    }
-    /**/
-    if (wstat_p->counted_file == NULL) {
-	warn(__func__, "wstat_p counted_file is NULL");
-	return false;
-    }
-    if (wstat_p->counted_dir == NULL) {
-	warn(__func__, "wstat_p counted_dir is NULL");
-	return false;
-    }
-    if (wstat_p->counted_sym == NULL) {
-	warn(__func__, "wstat_p counted_sym is NULL");
-	return false;
-    }
-    if (wstat_p->counted_other == NULL) {
-	warn(__func__, "wstat_p counted_other is NULL");
-	return false;
-    }
-    /**/
-    if (wstat_p->ignore == NULL) {
-	warn(__func__, "wstat_p ignore is NULL");
-	return false;
-    }
-    if (wstat_p->not_ignore == NULL) {
-	warn(__func__, "wstat_p not_ignore is NULL");
-	return false;
-    }
-    /**/
-    if (wstat_p->prohibit == NULL) {
-	warn(__func__, "wstat_p prohibit is NULL");
-	return false;
-    }
-    if (wstat_p->not_prohibit == NULL) {
-	warn(__func__, "wstat_p not_prohibit is NULL");
-	return false;
-    }
-    /**/
-    if (wstat_p->unmatched == NULL) {
-	warn(__func__, "wstat_p unmatched is NULL");
-	return false;
-    }
-
-    /*
-     * items by path problem
-     */
-    if (wstat_p->unsafe == NULL) {
-	warn(__func__, "wstat_p unsafe is NULL");
-	return false;
-    }
-    if (wstat_p->abs == NULL) {
-	warn(__func__, "wstat_p abs is NULL");
-	return false;
-    }
-    if (wstat_p->too_long_path == NULL) {
-	warn(__func__, "wstat_p too_long_path is NULL");
-	return false;
-    }
-    if (wstat_p->too_long_name == NULL) {
-	warn(__func__, "wstat_p too_long_name is NULL");
-	return false;
-    }
-    /**/
-    if (wstat_p->fts_err == NULL) {
-	warn(__func__, "wstat_p fts_err is NULL");
-	return false;
-    }
-    if (wstat_p->safe == NULL) {
-	warn(__func__, "wstat_p safe is NULL");
-	return false;
-    }
-
-    /*
-     * item descendant state problem
-     */
-    if (wstat_p->visit == NULL) {
-	warn(__func__, "wstat_p visit is NULL");
-	return false;
-    }
-    if (wstat_p->prune == NULL) {
-	warn(__func__, "wstat_p prune is NULL");
-	return false;
-    }
-
-    /*
-     * all dyn_array must be non-NULL
-     */
-    if (wstat_p->all == NULL) {
-	warn(__func__, "wstat_p all is NULL");
-	return false;
-    }
-
-    /*
-     * topdir must be non-NULL
-     */
-    if (wstat_p->topdir == NULL) {
-	warn(__func__, "wstat_p->topdir is NULL");
-	return false;
-    }
-
-    /*
-     * topdir must be non-empty string
-     */
-    if (wstat_p->topdir[0] == '\0') {
-	warn(__func__, "wstat_p->topdir is am empty string");
-	return false;
-    }
-
-    /*
-     * topdir string length must match topdir_len
-     */
-    if (strlen(wstat_p->topdir) != wstat_p->topdir_len) {
-	warn(__func__, "wstat_p->topdir length: %zu != topdir_len: %zu", strlen(wstat_p->topdir), wstat_p->topdir_len);
+
+    /*
+     * topdir string length must match topdir_len
+     */
+    if (strlen(wstat_p->topdir) != wstat_p->topdir_len) {
+	warn(__func__, "wstat_p->topdir length: %zu != topdir_len: %zu", strlen(wstat_p->topdir), wstat_p->topdir_len);
 	return false;
     }
 
@@ -1629,6 +1753,7 @@ match_walk_rule(struct walk_rule *rule_p, struct item *i_p, int indx)
 	    strncmp(rule_p->pattern, i_p->fts_name + i_p->fts_namelen - patternlen, patternlen) != 0) {
 	    dbg(DBG_V3_HIGH, "%s: rule[%d]: match MATCH_SUFFIX: pattern: %s doesn't match fts_name: %s",
 			     __func__, indx, rule_p->pattern, i_p->fts_name);
+	    return false;
 	}
 	break;
 
@@ -1638,6 +1763,7 @@ match_walk_rule(struct walk_rule *rule_p, struct item *i_p, int indx)
 	    strncasecmp(rule_p->pattern, i_p->fts_name + i_p->fts_namelen - patternlen, patternlen) != 0) {
 	    dbg(DBG_V3_HIGH, "%s: rule[%d]: match MATCH_SUFFIX_ANYCASE: pattern: %s doesn't match fts_name: %s",
 			     __func__, indx, rule_p->pattern, i_p->fts_name);
+	    return false;
 	}
 	break;
 
@@ -1712,17 +1838,150 @@ match_walk_rule(struct walk_rule *rule_p, struct item *i_p, int indx)
 
 
 /*
- * canonicalize_path - canonicalize a path using limits from a struct walk_stat
+ * match_walk_set - find the first walk_rule of a walk_set that matches an item
+ *
+ * Only the walk_rules that the compiled walk_match says could match the item
+ * name are tried, in walk_set order.  See the walk_match comment in walk.h.
+ *
+ * given:
+ *	wset_p	    pointer to a walk_set
+ *	i_p	    item to match
+ *
+ * returns:
+ *	index of the first walk_rule that matches the item, or
+ *	wset_p->count (index of the final NULL walk_rule.pattern) if no walk_rule matches
+ *
+ * NOTE: If the walk_set has not been compiled, this function uses scan_walk_set().
+ *
+ * NOTE: This function does not return on error.
+ */
+int
+match_walk_set(struct walk_set *wset_p, struct item *i_p)
+{
+    struct walk_rule_list const *list[4];   /* candidate walk_rule lists */
+    size_t pos[4];			    /* next index of each candidate list */
+    struct walk_match *match;		    /* compiled walk_rule set */
+    struct walk_name_slot *slot;	    /* name hash table slot */
+    uint32_t hash;			    /* case-folded hash of the item name */
+    size_t lists = 0;			    /* number of candidate lists */
+    size_t best;			    /* candidate list with the lowest next walk_rule index */
+    size_t i;
+    int indx;
+
+    /*
+     * firewall - catch NULL ptrs
+     */
+    if (wset_p == NULL) {
+	err(144, __func__, "called with NULL wset_p");
+	not_reached();
+    }
+    if (i_p == NULL || i_p->fts_name == NULL) {
+	err(145, __func__, "called with NULL i_p or NULL i_p->fts_name");
+	not_reached();
+    }
+    match = wset_p->match;
+    if (match == NULL) {
+	return scan_walk_set(wset_p, i_p);
+    }
+
+    /*
+     * gather the candidate lists for the item name
+     */
+    hash = path_hash(i_p->fts_name, i_p->fts_namelen, true);
+    for (slot = &match->name[hash & match->mask]; slot->pattern != NULL;
+	 slot = &match->name[(size_t)(slot - match->name + 1) & match->mask]) {
+	if (slot->hash == hash && strcasecmp(slot->pattern, i_p->fts_name) == 0) {
+	    list[lists++] = &slot->list;
+	    break;
+	}
+    }
+    if (i_p->fts_namelen > 0) {
+	list[lists++] = &match->prefix[tolower((unsigned char)i_p->fts_name[0])];
+	list[lists++] = &match->suffix[tolower((unsigned char)i_p->fts_name[i_p->fts_namelen-1])];
+    }
+    list[lists++] = &match->other;
+    for (i = 0; i < lists; ++i) {
+	pos[i] = 0;
+    }
+
+    /*
+     * try candidates in walk_set order until one matches
+     */
+    for (;;) {
+	best = lists;
+	for (i = 0; i < lists; ++i) {
+	    if (pos[i] < list[i]->count &&
+		(best == lists || list[i]->indx[pos[i]] < list[best]->indx[pos[best]])) {
+		best = i;
+	    }
+	}
+	if (best == lists) {
+	    break;
+	}
+	indx = list[best]->indx[pos[best]++];
+	if (match_walk_rule(&wset_p->rule[indx], i_p, indx)) {
+	    return indx;
+	}
+    }
+    return wset_p->count;
+}
+
+
+/*
+ * scan_walk_set - find the first walk_rule of a walk_set that matches an item by trying each walk_rule
+ *
+ * given:
+ *	wset_p	    pointer to a walk_set
+ *	i_p	    item to match
+ *
+ * returns:
+ *	index of the first walk_rule that matches the item, or
+ *	index of the final NULL walk_rule.pattern if no walk_rule matches
+ *
+ * NOTE: This function gives the same answer as match_walk_set() without the compiled
+ *	 walk_match, and is used to check it.
+ *
+ * NOTE: This function does not return on error.
+ */
+int
+scan_walk_set(struct walk_set *wset_p, struct item *i_p)
+{
+    struct walk_rule *rule_p;	    /* pointer to a walk rule */
+    int indx;
+
+    /*
+     * firewall - catch NULL ptrs
+     */
+    if (wset_p == NULL || wset_p->rule == NULL) {
+	err(146, __func__, "called with NULL wset_p or NULL wset_p->rule");
+	not_reached();
+    }
+    if (i_p == NULL) {
+	err(147, __func__, "called with NULL i_p");
+	not_reached();
+    }
+
+    for (indx = 0, rule_p = wset_p->rule; rule_p->pattern != NULL; ++rule_p, ++indx) {
+	if (match_walk_rule(rule_p, i_p, indx)) {
+	    break;
+	}
+    }
+    return indx;
+}
+
+
+/*
+ * canonicalize_path_r - canonicalize a path into a buffer using limits from a struct walk_stat
  *
  * We canonicalize a path using the path length (wstat_p->max_path_len and wstat_p->max_filename_len) limits
  * and the depth (wstat_p->max_depth) limits from the a struct walk_stat.
  *
  * The *sanity_p, *len_p, and *depth_p pointers, if non-NULL, are updated with the
  * enum path_sanity error code (or PATH_OK), path length, and path depth as determined by
- * the canon_path() function.
+ * the canon_path_r() function.
  *
- * We use this canonicalize_path() function instead of just hard coding calls to the
- * the canon_path() function, in order to be sure that paths are canonicalized in the
+ * We use this canonicalize_path_r() function instead of just hard coding calls to the
+ * the canon_path_r() function, in order to be sure that paths are canonicalized in the
  * same way throughout this walk code.
  *
  * In the case of these canonicalization problems:
@@ -1734,17 +1993,19 @@ match_walk_rule(struct walk_rule *rule_p, struct item *i_p, int indx)
  *	PATH_ERR_NOT_SAFE
  *	PATH_ERR_DOTDOT_OVER_TOPDIR
  *
- * A malloced but unmodified copy of fts_path is returned.  Like other canon_path() function
+ * An unmodified copy of fts_path is formed in buf.  Like other canon_path() function
  * detected problems, *sanity_p will be set if non-NULL.
  *
- * It is the responsibility of the calling function to free any non-NULL return by this function,
- * after the calling function no longer needs the canonicalized path.
+ * No memory is allocated: the canonicalized path is formed in buf, which must be
+ * at least strlen(fts_path)+2 bytes long.
  *
  * IMPORTANT: canon_path() MUST use a false "lower_case" arg!  See the path_in_item_array() function.
  *
  * given:
  *	wstat_p	    pointer to a struct walk_stat
  *	fts_path    "root path" from topdir of the item
+ *	buf	    buffer in which to form the canonicalized path
+ *	bufsiz	    size of buf in bytes, must be >= strlen(fts_path)+2
  *
  *      sanity_p    NULL ==> don't save canon_path path_sanity error, or PATH_OK
  *                  != NULL ==> save enum path_sanity in *sanity_p
@@ -1754,15 +2015,15 @@ match_walk_rule(struct walk_rule *rule_p, struct item *i_p, int indx)
  *		    != NULL ==> record canonical depth in *depth_p
  *
  * returns:
- *      NULL ==> invalid path, internal error, critical canon_path() function error, or NULL pointer used
- *      != NULL ==> malloced canonicalized path
+ *      NULL ==> invalid path, internal error, critical canon_path() function error, buf too small, or NULL pointer used
+ *      != NULL ==> buf, holding the canonicalized path
  *
  * NOTE: When NULL is returned:
  *
  *	    if sanity_p is non-NULL, then
  *		*sanity_p will be set some value that is != PATH_OK
  *
- * NOTE: When a non-NULL malloced path is returned:
+ * NOTE: When a non-NULL path is returned:
  *
  *          if sanity_p is non-NULL, then
  *
@@ -1775,11 +2036,12 @@ match_walk_rule(struct walk_rule *rule_p, struct item *i_p, int indx)
  *	 In doing do, it will set values (*sanity_p, *len_p, *depth_p) as needed, and then return NULL.
  */
 char const *
-canonicalize_path(struct walk_stat *wstat_p, char const *fts_path,
-		  enum path_sanity *sanity_p, size_t *len_p, int_least32_t *depth_p)
+canonicalize_path_r(struct walk_stat *wstat_p, char const *fts_path, char *buf, size_t bufsiz,
+		    enum path_sanity *sanity_p, size_t *len_p, int_least32_t *depth_p)
 {
-    char const *cpath = NULL;	    /* canonicalized path arg as a string */
-    enum path_sanity sanity = PATH_ERR_UNSET;	    /* canon_path() error code, or PATH_ERR_UNSET, or PATH_OK */
+    char const *cpath = NULL;	    /* canonicalized path arg as a string in buf */
+    size_t fts_len = 0;		    /* length of fts_path */
+    enum path_sanity sanity = PATH_ERR_UNSET;	    /* canon_path_r() error code, or PATH_ERR_UNSET, or PATH_OK */
     size_t path_len = 0;	    /* canonicalized path length */
     int_least32_t deep = -1;	    /* canonicalized stack depth */
 
@@ -1816,6 +2078,22 @@ canonicalize_path(struct walk_stat *wstat_p, char const *fts_path,
 	}
 	return NULL;
     }
+    fts_len = strlen(fts_path);
+    if (buf == NULL || bufsiz < fts_len+2) {
+
+	/* warn about internal error, update non-NULL values and return NULL */
+	warn(__func__, "called with NULL buf or bufsiz: %zu < %zu", bufsiz, fts_len+2);
+	if (sanity_p != NULL) {
+	    *sanity_p = PATH_ERR_BUF_TOO_SMALL;
+	}
+	if (len_p != NULL) {
+	    *len_p = path_len;
+	}
+	if (depth_p != NULL) {
+	    *depth_p = deep;
+	}
+	return NULL;
+    }
 
     /*
      * if walk_stat check fails, abort
@@ -1844,8 +2122,8 @@ canonicalize_path(struct walk_stat *wstat_p, char const *fts_path,
      */
     dbg(DBG_HIGH, "%s: fts_path: %s", __func__, fts_path);
     /* IMPORTANT: canon_path() MUST use a false "lower_case" arg!  See the path_in_item_array() function. */
-    cpath = canon_path(fts_path, wstat_p->max_path_len, wstat_p->max_filename_len, wstat_p->max_depth,
-		       &sanity, &path_len, &deep, true, false, true, true, NULL);
+    cpath = canon_path_r(fts_path, buf, bufsiz, wstat_p->max_path_len, wstat_p->max_filename_len, wstat_p->max_depth,
+			 &sanity, &path_len, &deep, true, false, true, true, NULL);
     if (cpath == NULL || sanity != PATH_OK) {
 
 	/*
@@ -1854,7 +2132,7 @@ canonicalize_path(struct walk_stat *wstat_p, char const *fts_path,
 	 * In for some internal errors from the canon_path() function, we have to abort.
 	 *
 	 * In other cases we can process the original path as a "path problem".
-	 * We form a fake calloced canonicalized path so that we can later file
+	 * We form a fake canonicalized path in buf so that we can later file
 	 * a "path problem".
 	 */
 	switch (sanity) {
@@ -1876,22 +2154,9 @@ canonicalize_path(struct walk_stat *wstat_p, char const *fts_path,
 	case PATH_ERR_PATH_EMPTY:
 
 	    /* empty paths canonicalize to . (dot) */
-	    cpath = strdup(".");
-	    if (cpath == NULL) {
-
-		/* warn about internal error, update non-NULL values and return NULL */
-		warn(__func__, "strdup of . (dot) failed");
-		if (sanity_p != NULL) {
-		    *sanity_p = PATH_ERR_MALLOC;
-		}
-		if (len_p != NULL) {
-		    *len_p = path_len;
-		}
-		if (depth_p != NULL) {
-		    *depth_p = deep;
-		}
-		return NULL;
-	    }
+	    buf[0] = '.';
+	    buf[1] = '\0';
+	    cpath = buf;
 	    break;
 
 	case PATH_ERR_PATH_TOO_LONG:
@@ -1901,23 +2166,9 @@ canonicalize_path(struct walk_stat *wstat_p, char const *fts_path,
 	case PATH_ERR_NOT_SAFE:
 	case PATH_ERR_DOTDOT_OVER_TOPDIR:
 
-	    /* just duplicate fts_path unmodified due to path problems found by canon_path() */
-	    cpath = strdup(fts_path);
-	    if (cpath == NULL) {
-
-		/* warn about internal error, update non-NULL values and return NULL */
-		warn(__func__, "strdup of fts_path failed: %s", fts_path);
-		if (sanity_p != NULL) {
-		    *sanity_p = PATH_ERR_MALLOC;
-		}
-		if (len_p != NULL) {
-		    *len_p = path_len;
-		}
-		if (depth_p != NULL) {
-		    *depth_p = deep;
-		}
-		return NULL;
-	    }
+	    /* just copy fts_path unmodified due to path problems found by canon_path_r() */
+	    memcpy(buf, fts_path, fts_len+1);
+	    cpath = buf;
 	    break;
 
 	case PATH_ERR_UNSET:
@@ -1925,6 +2176,7 @@ canonicalize_path(struct walk_stat *wstat_p, char const *fts_path,
 	case PATH_ERR_MALLOC:
 	case PATH_ERR_NULL_COMPONENT:
 	case PATH_ERR_WRONG_LEN:
+	case PATH_ERR_BUF_TOO_SMALL:
 
 	    /* warn about critical canon_path() function error, update non-NULL values and return NULL */
 	    warn(__func__, "canon_path function reported critical error %s (%s) for: %s",
@@ -1997,38 +2249,108 @@ canonicalize_path(struct walk_stat *wstat_p, char const *fts_path,
 
 
 /*
- * skip_add - add a canonicalized path to skip_set dynamic array
+ * canonicalize_path - canonicalize a path using limits from a struct walk_stat
  *
- * For a given struct walk_stat, add canonicalized fts_path as an pointer to as
- * "fake" struct item to wstat_p->skip_set.  By "fake", the st_size and st_mode
- * will be set to 0.
+ * This function is canonicalize_path_r() with a malloced buffer: see that
+ * function for details.
  *
- * The skip_set dynamic array is used to skip record_step() processing for certain selected paths.
- * For more information about how the skip_set dynamic array is used,
- * see the comments in the record_step() function below.
+ * It is the responsibility of the calling function to free any non-NULL return by this function,
+ * after the calling function no longer needs the canonicalized path.
  *
  * given:
  *	wstat_p	    pointer to a struct walk_stat
  *	fts_path    "root path" from topdir of the item
  *
+ *      sanity_p    NULL ==> don't save canon_path path_sanity error, or PATH_OK
+ *                  != NULL ==> save enum path_sanity in *sanity_p
+ *      len_p       NULL ==> don't save canonical path length,
+ *                  != NULL ==> save canonical path length in *len_p
+ *      depth_p     NULL ==> don't save canonical depth,
+ *		    != NULL ==> record canonical depth in *depth_p
+ *
  * returns:
- *	true ==> canonicalized fts_path was added to the skip_set dynamic array
- *	false ==> canonicalized fts_path was already in the skip_set dynamic array
+ *      NULL ==> invalid path, internal error, critical canon_path() function error, or NULL pointer used
+ *      != NULL ==> malloced canonicalized path
  *
- * NOTE: This function does not return on an internal error.
+ * NOTE: This function will call warn(3) on internal errors and critical canon_path() function errors.
  */
-bool
-skip_add(struct walk_stat *wstat_p, char const *fts_path)
+char const *
+canonicalize_path(struct walk_stat *wstat_p, char const *fts_path,
+		  enum path_sanity *sanity_p, size_t *len_p, int_least32_t *depth_p)
 {
-    char const *cpath = NULL;	    /* canonicalized path arg as a string */
-    int_least32_t deep = -1;	    /* canonicalized stack depth */
-    struct item *i_p = NULL;	    /* allocated item */
+    char *buf = NULL;		    /* malloced buffer for the canonicalized path */
+    size_t bufsiz = 0;		    /* size of buf in bytes */
+    char const *cpath = NULL;	    /* canonicalized path in buf */
 
     /*
-     * firewall - catch NULL ptrs
+     * allocate a buffer large enough for the canonicalized path
      */
-    if (wstat_p == NULL) {
-	err(50, __func__, "called with NULL wstat_p");
+    bufsiz = ((fts_path == NULL) ? 0 : strlen(fts_path)) + 2;
+    buf = malloc(bufsiz);
+    if (buf == NULL) {
+
+	/* warn about internal error, update non-NULL values and return NULL */
+	warn(__func__, "malloc of %zu bytes failed", bufsiz);
+	if (sanity_p != NULL) {
+	    *sanity_p = PATH_ERR_MALLOC;
+	}
+	if (len_p != NULL) {
+	    *len_p = 0;
+	}
+	if (depth_p != NULL) {
+	    *depth_p = -1;
+	}
+	return NULL;
+    }
+
+    /*
+     * canonicalize path into buf
+     */
+    cpath = canonicalize_path_r(wstat_p, fts_path, buf, bufsiz, sanity_p, len_p, depth_p);
+    if (cpath == NULL) {
+	free(buf);
+	buf = NULL;
+    }
+    return cpath;
+}
+
+
+/*
+ * skip_add - add a canonicalized path to skip_set dynamic array
+ *
+ * For a given struct walk_stat, add canonicalized fts_path as an pointer to as
+ * "fake" struct item to wstat_p->skip_set.  By "fake", the st_size and st_mode
+ * will be set to 0.
+ *
+ * The skip_set dynamic array is used to skip record_step() processing for certain selected paths.
+ * For more information about how the skip_set dynamic array is used,
+ * see the comments in the record_step() function below.
+ *
+ * given:
+ *	wstat_p	    pointer to a struct walk_stat
+ *	fts_path    "root path" from topdir of the item
+ *
+ * returns:
+ *	true ==> canonicalized fts_path was added to the skip_set dynamic array
+ *	false ==> canonicalized fts_path was already in the skip_set dynamic array
+ *
+ * NOTE: This function does not return on an internal error.
+ */
+bool
+skip_add(struct walk_stat *wstat_p, char const *fts_path)
+{
+    char *buf = NULL;		    /* walk_stat arena scratch buffer */
+    size_t bufsiz = 0;		    /* size of buf in bytes needed for fts_path */
+    char const *canon = NULL;	    /* canonicalized path in buf from canonicalize_path_r() */
+    char const *cpath = NULL;	    /* canonicalized path arg as a string in the walk_stat arena */
+    int_least32_t deep = -1;	    /* canonicalized stack depth */
+    struct item *i_p = NULL;	    /* allocated item */
+
+    /*
+     * firewall - catch NULL ptrs
+     */
+    if (wstat_p == NULL) {
+	err(50, __func__, "called with NULL wstat_p");
 	not_reached();
     }
     if (fts_path == NULL) {
@@ -2051,17 +2373,20 @@ skip_add(struct walk_stat *wstat_p, char const *fts_path)
      * canonicalize path
      */
     dbg(DBG_MED, "%s: fts_path: %s", __func__, fts_path);
-    cpath = canonicalize_path(wstat_p, fts_path, NULL, NULL, &deep);
+    bufsiz = strlen(fts_path) + 2;
+    buf = walk_arena_scratch(&wstat_p->arena, bufsiz);
+    canon = canonicalize_path_r(wstat_p, fts_path, buf, bufsiz, NULL, NULL, &deep);
     /* paranoia */
-    if (cpath == NULL) {
-	err(53, __func__, "canonicalize_path had an internal failure and returned NULL");
+    if (canon == NULL) {
+	err(53, __func__, "canonicalize_path_r had an internal failure and returned NULL");
 	not_reached();
     }
+    cpath = walk_arena_intern(&wstat_p->arena, canon, strlen(canon));
 
     /*
      * see if canonicalized path is already in the skip_set dynamic array
      */
-    i_p = path_in_item_array(wstat_p->skip_set, cpath);
+    i_p = path_in_walk_array(wstat_p, wstat_p->skip_set, cpath);
     if (i_p != NULL) {
 	dbg(DBG_MED, "%s: fts_path already in skip_set: %s", __func__, fts_path);
 	return false;
@@ -2070,8 +2395,11 @@ skip_add(struct walk_stat *wstat_p, char const *fts_path)
     /*
      * form an allocated item
      */
-    i_p = alloc_item(fts_path, cpath, 0, 0, deep);
+    i_p = alloc_item(wstat_p, fts_path, cpath, 0, 0, deep);
     (void) dyn_array_append_value(wstat_p->skip_set, &i_p);
+    if (wstat_p->skip_index != NULL) {
+	path_index_add(wstat_p->skip_index, i_p);
+    }
 
     /*
      * canonicalized fts_path added to skip_set
@@ -2093,7 +2421,7 @@ skip_add(struct walk_stat *wstat_p, char const *fts_path)
  *	- err(3) WILL be called if wstat_p is NULL
  *	- err(3) WILL be called if fts_path is NULL
  *	- err(3) WILL be called if chk_walk_stat(wstat_p) returns false
- *	- canonicalize_path() WILL be called to canonicalized the fts_path
+ *	- canonicalize_path_r() WILL be called to canonicalized the fts_path
  *
  *	  NOTE: using length and depth restrictions that were set when init_walk_stat() was called
  *
@@ -2125,7 +2453,7 @@ skip_add(struct walk_stat *wstat_p, char const *fts_path)
  *
  *	dup_p       != NULL ==> set *dup_p according to if canonicalized was already recorded in struct walk_stat
  *		    NULL ==> do not check for duplicates
- *	cpath_ret   != NULL ==> update with pointer to the canonical path
+ *	cpath_ret   != NULL ==> update with pointer to the canonical path, owned by the walk_stat arena
  *		    NULL ==> ignore
  *	skip_set   != NULL ==> dynamic_array of canonicalized paths from topdir to ignore
  *		    NULL ==> ignore
@@ -2143,11 +2471,13 @@ record_step(struct walk_stat *wstat_p, char const *fts_path, off_t st_size, mode
     struct walk_rule *rule_p;	    /* pointer to a walk rule */
     struct walk_set *wset_p;	    /* pointer to a walk set */
     struct item *i_p = NULL;	    /* allocated item */
-    char const *cpath = NULL;	    /* canonicalized path arg as a string */
-    enum path_sanity sanity = PATH_ERR_UNSET;	    /* canonicalize_path() error code, or PATH_OK */
+    char *buf = NULL;		    /* walk_stat arena scratch buffer */
+    size_t bufsiz = 0;		    /* size of buf in bytes needed for fts_path */
+    char const *canon = NULL;	    /* canonicalized path in buf from canonicalize_path_r() */
+    char const *cpath = NULL;	    /* canonicalized path arg as a string in the walk_stat arena */
+    enum path_sanity sanity = PATH_ERR_UNSET;	    /* canonicalize_path_r() error code, or PATH_OK */
     size_t path_len = 0;	    /* canonicalized path length */
     int_least32_t deep = -1;	    /* canonicalized stack depth */
-    bool matched = false;	    /* true ==> walk rule matched */
     bool visit_descendants = true;  /* true ==> OK to visit descendants, false ==> do NOT visit descendants */
     int count;
 
@@ -2178,12 +2508,15 @@ record_step(struct walk_stat *wstat_p, char const *fts_path, off_t st_size, mode
      d canonicalize path
      */
     dbg(DBG_HIGH, "%s: fts_path: %s", __func__, fts_path);
-    cpath = canonicalize_path(wstat_p, fts_path, &sanity, &path_len, &deep);
+    bufsiz = strlen(fts_path) + 2;
+    buf = walk_arena_scratch(&wstat_p->arena, bufsiz);
+    canon = canonicalize_path_r(wstat_p, fts_path, buf, bufsiz, &sanity, &path_len, &deep);
     /* paranoia */
-    if (cpath == NULL) {
-	err(57, __func__, "canonicalize_path had an internal failure and returned NULL");
+    if (canon == NULL) {
+	err(57, __func__, "canonicalize_path_r had an internal failure and returned NULL");
 	not_reached();
     }
+    cpath = walk_arena_intern(&wstat_p->arena, canon, strlen(canon));
 
     /*
      * if requested, check for duplicates
@@ -2214,126 +2547,128 @@ record_step(struct walk_stat *wstat_p, char const *fts_path, off_t st_size, mode
     /*
      * check for a match with the skip_set
      */
-    i_p = path_in_item_array(wstat_p->skip_set, cpath);
+    i_p = path_in_walk_array(wstat_p, wstat_p->skip_set, cpath);
     if (i_p != NULL) {
 
 	/* canonicalized path is in the skip_set, skip any further processing and just return false */
 	dbg(DBG_MED, "%s: skipping path: %s", __func__, fts_path);
-	if (cpath != NULL) {
-	    free((void *)cpath);
-	    cpath = NULL;
-	}
 	return false;
     }
 
     /*
      * form an allocated item
      */
-    i_p = alloc_item(fts_path, cpath, st_size, st_mode, deep);
+    i_p = alloc_item(wstat_p, fts_path, cpath, st_size, st_mode, deep);
 
     /*
      * first, record every item in the all dynamic array
      *
-     * NOTE: This is how free_walk_stat() will free the above allocated item.
+     * NOTE: The item is owned by the walk_stat arena, and free_walk_stat() frees it.
      */
     (void) dyn_array_append_value(wstat_p->all, &i_p);
+    if (wstat_p->all_index != NULL) {
+	path_index_add(wstat_p->all_index, i_p);
+    }
+    if (wstat_p->all_exact != NULL) {
+	path_index_add(wstat_p->all_exact, i_p);
+    }
 
     /*
      * record regular files
      */
     if (ITEM_IS_FILE(st_mode)) {
-	(void) dyn_array_append_value(wstat_p->file, &i_p);
+	walk_cat_add(wstat_p, i_p, WALK_CAT_FILE);
     }
 
     /*
      * record directories
      */
     if (ITEM_IS_DIR(st_mode)) {
-	(void) dyn_array_append_value(wstat_p->dir, &i_p);
+	walk_cat_add(wstat_p, i_p, WALK_CAT_DIR);
     }
 
     /*
      * record symlinks
      */
     if (ITEM_IS_SYMLINK(st_mode)) {
-	(void) dyn_array_append_value(wstat_p->symlink, &i_p);
+	walk_cat_add(wstat_p, i_p, WALK_CAT_SYMLINK);
     }
 
     /*
      * record NOT regular files
      */
     if (ITEM_IS_NOT_FILE(st_mode)) {
-	(void) dyn_array_append_value(wstat_p->not_file, &i_p);
+	walk_cat_add(wstat_p, i_p, WALK_CAT_NOT_FILE);
     }
 
     /*
      * record NOT directories
      */
     if (ITEM_IS_NOT_DIR(st_mode)) {
-	(void) dyn_array_append_value(wstat_p->not_dir, &i_p);
+	walk_cat_add(wstat_p, i_p, WALK_CAT_NOT_DIR);
     }
 
     /*
      * record NOT symlinks
      */
     if (ITEM_IS_NOT_SYMLINK(st_mode)) {
-	(void) dyn_array_append_value(wstat_p->not_symlink, &i_p);
+	walk_cat_add(wstat_p, i_p, WALK_CAT_NOT_SYMLINK);
     }
 
     /*
      * record file and directory
      */
     if (ITEM_IS_FILEDIR(st_mode)) {
-	(void) dyn_array_append_value(wstat_p->filedir, &i_p);
+	walk_cat_add(wstat_p, i_p, WALK_CAT_FILEDIR);
     }
 
     /*
      * record file and symlink
      */
     if (ITEM_IS_FILESYM(st_mode)) {
-	(void) dyn_array_append_value(wstat_p->filesym, &i_p);
+	walk_cat_add(wstat_p, i_p, WALK_CAT_FILESYM);
     }
 
     /*
      * record directory and symlink
      */
     if (ITEM_IS_DIRSYM(st_mode)) {
-	(void) dyn_array_append_value(wstat_p->dirsym, &i_p);
+	walk_cat_add(wstat_p, i_p, WALK_CAT_DIRSYM);
     }
 
     /*
      * record file, directory and symlink
      */
     if (ITEM_IS_FILEDIRSYM(st_mode)) {
-	(void) dyn_array_append_value(wstat_p->filedirsym, &i_p);
+	walk_cat_add(wstat_p, i_p, WALK_CAT_FILEDIRSYM);
     }
 
     /*
      * record file and directory
      */
     if (ITEM_IS_NOT_FILEDIR(st_mode)) {
-	(void) dyn_array_append_value(wstat_p->not_filedir, &i_p);
+	walk_cat_add(wstat_p, i_p, WALK_CAT_NOT_FILEDIR);
     }
 
     /*
      * record file and symlink
      */
     if (ITEM_IS_NOT_FILESYM(st_mode)) {
-	(void) dyn_array_append_value(wstat_p->not_filesym, &i_p);
+	walk_cat_add(wstat_p, i_p, WALK_CAT_NOT_FILESYM);
     }
 
     /*
      * record directory and symlink
      */
     if (ITEM_IS_NOT_DIRSYM(st_mode)) {
-	(void) dyn_array_append_value(wstat_p->not_dirsym, &i_p);
+	walk_cat_add(wstat_p, i_p, WALK_CAT_NOT_DIRSYM);
     }
 
     /*
      * record file, directory and symlink
      */
     if (ITEM_IS_NOT_FILEDIRSYM(st_mode)) {
-	(void) dyn_array_append_value(wstat_p->not_filedirsym, &i_p);
+	walk_cat_add(wstat_p, i_p, WALK_CAT_NOT_FILEDIRSYM);
     }
 
     /*
@@ -2342,34 +2677,34 @@ record_step(struct walk_stat *wstat_p, char const *fts_path, off_t st_size, mode
     if (deep == 0) {
         /* We include the shallow vs too_deep check in case max_depth < 0 */
 	if (sanity == PATH_ERR_PATH_TOO_DEEP || (wstat_p->max_depth > 0 && deep > wstat_p->max_depth)) {
-	    (void) dyn_array_append_value(wstat_p->too_deep, &i_p);
+	    walk_cat_add(wstat_p, i_p, WALK_CAT_TOO_DEEP);
 	    dbg(DBG_HIGH, "too deep #0: fts_path: %s fts_name: %s", i_p->fts_path, i_p->fts_name);
 	    visit_descendants = false;
 	} else {
-	    (void) dyn_array_append_value(wstat_p->shallow, &i_p);
+	    walk_cat_add(wstat_p, i_p, WALK_CAT_SHALLOW);
 	}
-	(void) dyn_array_append_value(wstat_p->top, &i_p);
+	walk_cat_add(wstat_p, i_p, WALK_CAT_TOP);
 
     /*
      * record below top level
      */
     } else if (deep > 0) {
 	if (sanity == PATH_ERR_PATH_TOO_DEEP || (wstat_p->max_depth > 0 && deep > wstat_p->max_depth)) {
-	    (void) dyn_array_append_value(wstat_p->too_deep, &i_p);
+	    walk_cat_add(wstat_p, i_p, WALK_CAT_TOO_DEEP);
 	    dbg(DBG_HIGH, "too deep #1: fts_path: %s fts_name: %s", i_p->fts_path, i_p->fts_name);
 	    visit_descendants = false;
 	} else {
-	    (void) dyn_array_append_value(wstat_p->shallow, &i_p);
+	    walk_cat_add(wstat_p, i_p, WALK_CAT_SHALLOW);
 	}
-	(void) dyn_array_append_value(wstat_p->below, &i_p);
+	walk_cat_add(wstat_p, i_p, WALK_CAT_BELOW);
 
     /*
      * record unknown level or above topdir
      */
     } else {
-	(void) dyn_array_append_value(wstat_p->unknown_level, &i_p);
+	walk_cat_add(wstat_p, i_p, WALK_CAT_UNKNOWN_LEVEL);
     }
-    (void) dyn_array_append_value(wstat_p->any_level, &i_p);
+    walk_cat_add(wstat_p, i_p, WALK_CAT_ANY_LEVEL);
 
     /*
      * record that we have stepped
@@ -2378,33 +2713,26 @@ record_step(struct walk_stat *wstat_p, char const *fts_path, off_t st_size, mode
     wstat_p->walking = true;	/* note that we are walking */
 
     /*
-     * scan each rule until we find a match
+     * find the first rule that matches
      */
     wset_p = wstat_p->set;
-    rule_p = wset_p->rule;
-    for (count = 0; rule_p->pattern != NULL; ++rule_p, ++count) {
+    count = match_walk_set(wset_p, i_p);
+    rule_p = &wset_p->rule[count];
+    if (rule_p->pattern != NULL) {
 
 	/*
-	 * try to match
+	 * record that this rule has been matched
+	 *
+	 * This is especially important for rules that are required
+	 * because any required rule that was NOT matched by at
+	 * least 1 item is an error.
 	 */
-	matched = match_walk_rule(rule_p, i_p, count);
-	if (matched) {
-
-	    /*
-	     * record that this rule has been matched
-	     *
-	     * This is especially important for rules that are required
-	     * because any required rule that was NOT matched by at
-	     * least 1 item is an error.
-	     */
-	    ++rule_p->match_count;
-	    dbg(DBG_V1_HIGH, "%s: rule[%d]: %s matched item fts_path: %s fts_name: %s",
-			    __func__, count, rule_p->pattern, i_p->fts_path, i_p->fts_name);
-	    dbg(DBG_V1_HIGH, "%s: item fts_level: %d st_size: %lld st_mode: %07o (%s)",
-			    __func__, i_p->fts_level, (long long)i_p->st_size,
-			    (int)i_p->st_mode, file_type_name(i_p->st_mode));
-	    break;
-	}
+	++rule_p->match_count;
+	dbg(DBG_V1_HIGH, "%s: rule[%d]: %s matched item fts_path: %s fts_name: %s",
+			__func__, count, rule_p->pattern, i_p->fts_path, i_p->fts_name);
+	dbg(DBG_V1_HIGH, "%s: item fts_level: %d st_size: %lld st_mode: %07o (%s)",
+			__func__, i_p->fts_level, (long long)i_p->st_size,
+			(int)i_p->st_mode, file_type_name(i_p->st_mode));
     }
 
     /*
@@ -2432,7 +2760,7 @@ record_step(struct walk_stat *wstat_p, char const *fts_path, off_t st_size, mode
 	 *	    MATCH_ANY, TYPE_ANY, LEVEL_ANY,
 	 *	    0, NULL },
 	 */
-	(void) dyn_array_append_value(wstat_p->unmatched, &i_p);
+	walk_cat_add(wstat_p, i_p, WALK_CAT_UNMATCHED);
 
 	/*
 	 * report not pruning
@@ -2454,18 +2782,18 @@ record_step(struct walk_stat *wstat_p, char const *fts_path, off_t st_size, mode
      * record according to walk_rule required boolean
      */
     if (rule_p->required) {
-	(void) dyn_array_append_value(wstat_p->required, &i_p);
+	walk_cat_add(wstat_p, i_p, WALK_CAT_REQUIRED);
     } else {
-	(void) dyn_array_append_value(wstat_p->optional, &i_p);
+	walk_cat_add(wstat_p, i_p, WALK_CAT_OPTIONAL);
     }
 
     /*
      * record according to walk_rule non_empty boolean
      */
     if (rule_p->non_empty) {
-	(void) dyn_array_append_value(wstat_p->non_empty, &i_p);
+	walk_cat_add(wstat_p, i_p, WALK_CAT_NON_EMPTY);
     } else {
-	(void) dyn_array_append_value(wstat_p->empty, &i_p);
+	walk_cat_add(wstat_p, i_p, WALK_CAT_EMPTY);
     }
 
     /*
@@ -2475,20 +2803,20 @@ record_step(struct walk_stat *wstat_p, char const *fts_path, off_t st_size, mode
      * also count according to if the item is a file or a directory or otherwise.
      */
     if (rule_p->free) {
-	(void) dyn_array_append_value(wstat_p->free, &i_p);
+	walk_cat_add(wstat_p, i_p, WALK_CAT_FREE);
     } else {
-	(void) dyn_array_append_value(wstat_p->counted, &i_p);
+	walk_cat_add(wstat_p, i_p, WALK_CAT_COUNTED);
 	if (ITEM_IS_FILE(st_mode)) {
-	    (void) dyn_array_append_value(wstat_p->counted_file, &i_p);
+	    walk_cat_add(wstat_p, i_p, WALK_CAT_COUNTED_FILE);
 	}
 	if (ITEM_IS_DIR(st_mode)) {
-	    (void) dyn_array_append_value(wstat_p->counted_dir, &i_p);
+	    walk_cat_add(wstat_p, i_p, WALK_CAT_COUNTED_DIR);
 	}
 	if (ITEM_IS_SYMLINK(st_mode)) {
-	    (void) dyn_array_append_value(wstat_p->counted_sym, &i_p);
+	    walk_cat_add(wstat_p, i_p, WALK_CAT_COUNTED_SYM);
 	}
 	if (ITEM_IS_NOT_FILEDIRSYM(st_mode)) {
-	    (void) dyn_array_append_value(wstat_p->counted_other, &i_p);
+	    walk_cat_add(wstat_p, i_p, WALK_CAT_COUNTED_OTHER);
 	}
     }
 
@@ -2496,22 +2824,22 @@ record_step(struct walk_stat *wstat_p, char const *fts_path, off_t st_size, mode
      * record according to walk_rule prohibit boolean
      */
     if (rule_p->prohibit) {
-	(void) dyn_array_append_value(wstat_p->prohibit, &i_p);
+	walk_cat_add(wstat_p, i_p, WALK_CAT_PROHIBIT);
 	dbg(DBG_HIGH, "prohibit: fts_path: %s fts_name: %s", i_p->fts_path, i_p->fts_name);
 	visit_descendants = false;
     } else {
-	(void) dyn_array_append_value(wstat_p->not_prohibit, &i_p);
+	walk_cat_add(wstat_p, i_p, WALK_CAT_NOT_PROHIBIT);
     }
 
     /*
      * record according to walk_rule ignore boolean
      */
     if (rule_p->ignore) {
-	(void) dyn_array_append_value(wstat_p->ignore, &i_p);
+	walk_cat_add(wstat_p, i_p, WALK_CAT_IGNORE);
 	dbg(DBG_HIGH, "ignore: fts_path: %s fts_name: %s", i_p->fts_path, i_p->fts_name);
 	visit_descendants = false;
     } else {
-	(void) dyn_array_append_value(wstat_p->not_ignore, &i_p);
+	walk_cat_add(wstat_p, i_p, WALK_CAT_NOT_IGNORE);
     }
 
     /*
@@ -2519,31 +2847,31 @@ record_step(struct walk_stat *wstat_p, char const *fts_path, off_t st_size, mode
      */
     switch (sanity) {
     case PATH_OK:
-	(void) dyn_array_append_value(wstat_p->safe, &i_p);
+	walk_cat_add(wstat_p, i_p, WALK_CAT_SAFE);
 	break;
 
     case PATH_ERR_DOTDOT_OVER_TOPDIR:
     case PATH_ERR_NOT_SAFE:
 	dbg(DBG_HIGH, "not safe: fts_path: %s fts_name: %s", i_p->fts_path, i_p->fts_name);
-	(void) dyn_array_append_value(wstat_p->unsafe, &i_p);
+	walk_cat_add(wstat_p, i_p, WALK_CAT_UNSAFE);
 	visit_descendants = false;
 	break;
 
     case PATH_ERR_NOT_RELATIVE:
 	dbg(DBG_HIGH, "absolute path: fts_path: %s fts_name: %s", i_p->fts_path, i_p->fts_name);
-	(void) dyn_array_append_value(wstat_p->abs, &i_p);
+	walk_cat_add(wstat_p, i_p, WALK_CAT_ABS);
 	visit_descendants = false;
 	break;
 
     case PATH_ERR_PATH_TOO_LONG:
 	dbg(DBG_HIGH, "path too long: fts_path: %s fts_name: %s", i_p->fts_path, i_p->fts_name);
-	(void) dyn_array_append_value(wstat_p->too_long_path, &i_p);
+	walk_cat_add(wstat_p, i_p, WALK_CAT_TOO_LONG_PATH);
 	visit_descendants = false;
 	break;
 
     case PATH_ERR_NAME_TOO_LONG:
 	dbg(DBG_HIGH, "path with a too long element: fts_path: %s fts_name: %s", i_p->fts_path, i_p->fts_name);
-	(void) dyn_array_append_value(wstat_p->too_long_name, &i_p);
+	walk_cat_add(wstat_p, i_p, WALK_CAT_TOO_LONG_NAME);
 	visit_descendants = false;
 	break;
 
@@ -2555,10 +2883,13 @@ record_step(struct walk_stat *wstat_p, char const *fts_path, off_t st_size, mode
      * informing the calling application if it should ignore this item or not
      */
     if (visit_descendants) {
-	(void) dyn_array_append_value(wstat_p->visit, &i_p);
+	walk_cat_add(wstat_p, i_p, WALK_CAT_VISIT);
 	dbg(DBG_MED, "process: fts_path: %s fts_name: %s", i_p->fts_path, i_p->fts_name);
     } else {
-	(void) dyn_array_append_value(wstat_p->prune, &i_p);
+	walk_cat_add(wstat_p, i_p, WALK_CAT_PRUNE);
+	if (wstat_p->prune_index != NULL) {
+	    path_index_add(wstat_p->prune_index, i_p);
+	}
 	wstat_p->skip = true;	/* note that we skipped something */
 	dbg(DBG_MED, "prune and process: fts_path: %s fts_name: %s", i_p->fts_path, i_p->fts_name);
     }
@@ -2648,6 +2979,7 @@ void
 fprintf_walk_stat(FILE *stream, struct walk_stat *wstat_p)
 {
     struct walk_set *wset_p;	    /* pointer to a walk set */
+    int cat;
 
     /*
      * firewall - catch NULL ptrs
@@ -2692,6 +3024,7 @@ fprintf_walk_stat(FILE *stream, struct walk_stat *wstat_p)
     fprint(stream, "walking: %s\n", booltostr(wstat_p->walking));
     fprint(stream, "skip: %s\n", booltostr(wstat_p->skip));
     fprint(stream, "tar_listing_used: %s\n", booltostr(wstat_p->tar_listing_used));
+    fprint(stream, "parallel_walk: %s\n", booltostr(wstat_p->parallel_walk));
     if (wstat_p->max_path_len > 0) {
 	fprint(stream, "max_path_len: %d\n", wstat_p->max_path_len);
     } else {
@@ -2708,6 +3041,8 @@ fprintf_walk_stat(FILE *stream, struct walk_stat *wstat_p)
 	fprstr(stream, "max_depth: unlimited\n");
     }
     fprint(stream, "steps: %ju\n", wstat_p->steps);
+    fprint(stream, "arena: chunks: %zu bytes: %zu strings: %zu shared: %zu\n",
+		   wstat_p->arena.chunks, wstat_p->arena.bytes, wstat_p->arena.strings, wstat_p->arena.shared);
     fprstr(stream, "\n");
 
     /*
@@ -2716,78 +3051,13 @@ fprintf_walk_stat(FILE *stream, struct walk_stat *wstat_p)
     fprintf_dyn_array_item(stream, "skip_set", wstat_p->skip_set);
 
     /*
-     * items by type
-     */
-    fprintf_dyn_array_item(stream, "file", wstat_p->file);
-    fprintf_dyn_array_item(stream, "dir", wstat_p->dir);
-    fprintf_dyn_array_item(stream, "symlink", wstat_p->symlink);
-    /**/
-    fprintf_dyn_array_item(stream, "not_file", wstat_p->not_file);
-    fprintf_dyn_array_item(stream, "not_dir", wstat_p->not_dir);
-    fprintf_dyn_array_item(stream, "not_symlink", wstat_p->not_symlink);
-    /**/
-    fprintf_dyn_array_item(stream, "filedir", wstat_p->filedir);
-    fprintf_dyn_array_item(stream, "filesym", wstat_p->filesym);
-    fprintf_dyn_array_item(stream, "dirsym", wstat_p->dirsym);
-    fprintf_dyn_array_item(stream, "filedirsym", wstat_p->filedirsym);
-    /**/
-    fprintf_dyn_array_item(stream, "not_filedir", wstat_p->not_filedir);
-    fprintf_dyn_array_item(stream, "not_filesym", wstat_p->not_filesym);
-    fprintf_dyn_array_item(stream, "not_dirsym", wstat_p->not_dirsym);
-    fprintf_dyn_array_item(stream, "not_filedirsym", wstat_p->not_filedirsym);
-
-    /*
-     * items by level
-     */
-    fprintf_dyn_array_item(stream, "top", wstat_p->top);
-    fprintf_dyn_array_item(stream, "shallow", wstat_p->shallow);
-    fprintf_dyn_array_item(stream, "too_deep", wstat_p->too_deep);
-    fprintf_dyn_array_item(stream, "below", wstat_p->below);
-    /**/
-    fprintf_dyn_array_item(stream, "any_level", wstat_p->any_level);
-    fprintf_dyn_array_item(stream, "unknown_level", wstat_p->unknown_level);
-
-    /*
-     * items by walk_rule
-     */
-    fprintf_dyn_array_item(stream, "required", wstat_p->required);
-    fprintf_dyn_array_item(stream, "optional", wstat_p->optional);
-    /**/
-    fprintf_dyn_array_item(stream, "non_empty", wstat_p->non_empty);
-    fprintf_dyn_array_item(stream, "empty", wstat_p->empty);
-    /**/
-    fprintf_dyn_array_item(stream, "free", wstat_p->free);
-    fprintf_dyn_array_item(stream, "counted", wstat_p->counted);
-    /**/
-    fprintf_dyn_array_item(stream, "counted_file", wstat_p->counted_file);
-    fprintf_dyn_array_item(stream, "counted_dir", wstat_p->counted_dir);
-    fprintf_dyn_array_item(stream, "counted_sym", wstat_p->counted_sym);
-    fprintf_dyn_array_item(stream, "counted_other", wstat_p->counted_other);
-    /**/
-    fprintf_dyn_array_item(stream, "ignore", wstat_p->ignore);
-    fprintf_dyn_array_item(stream, "not_ignore", wstat_p->not_ignore);
-    /**/
-    fprintf_dyn_array_item(stream, "prohibit", wstat_p->prohibit);
-    fprintf_dyn_array_item(stream, "not_prohibit", wstat_p->not_prohibit);
-    /**/
-    fprintf_dyn_array_item(stream, "unmatched", wstat_p->unmatched);
-
-    /*
-     * items by level
-     */
-    fprintf_dyn_array_item(stream, "unsafe", wstat_p->unsafe);
-    fprintf_dyn_array_item(stream, "absolute", wstat_p->abs);
-    fprintf_dyn_array_item(stream, "too_long_path", wstat_p->too_long_path);
-    fprintf_dyn_array_item(stream, "too_long_name", wstat_p->too_long_name);
-    /**/
-    fprintf_dyn_array_item(stream, "fts_err", wstat_p->fts_err);
-    fprintf_dyn_array_item(stream, "safe", wstat_p->safe);
-
-    /*
-     * items by descendant state
-     */
-    fprintf_dyn_array_item(stream, "visit", wstat_p->visit);
-    fprintf_dyn_array_item(stream, "prune", wstat_p->prune);
+     * items by category
+     */
+    for (cat = 0; cat < WALK_CAT_COUNT; ++cat) {
+	if (wstat_p->cat_count[cat] > 0) {
+	    fprintf_dyn_array_item(stream, walk_cat_name(cat), walk_view(wstat_p, cat));
+	}
+    }
 
     /*
      * all items
@@ -3241,6 +3511,8 @@ item_icmp(void const *pa, void const *pb)
 void
 sort_walk_stat(struct walk_stat *wstat_p)
 {
+    int cat;
+
     /*
      * firewall - catch NULL ptrs
      */
@@ -3261,78 +3533,15 @@ sort_walk_stat(struct walk_stat *wstat_p)
     }
 
     /*
-     * sort by canonicalized paths, items by type - See enum allowed_type
-     */
-    dyn_array_qsort(wstat_p->file, item_cmp);
-    dyn_array_qsort(wstat_p->dir, item_cmp);
-    dyn_array_qsort(wstat_p->symlink, item_cmp);
-    /**/
-    dyn_array_qsort(wstat_p->not_file, item_cmp);
-    dyn_array_qsort(wstat_p->not_dir, item_cmp);
-    dyn_array_qsort(wstat_p->not_symlink, item_cmp);
-    /**/
-    dyn_array_qsort(wstat_p->filedir, item_cmp);
-    dyn_array_qsort(wstat_p->filesym, item_cmp);
-    dyn_array_qsort(wstat_p->dirsym, item_cmp);
-    dyn_array_qsort(wstat_p->filedirsym, item_cmp);
-    /**/
-    dyn_array_qsort(wstat_p->not_filedir, item_cmp);
-    dyn_array_qsort(wstat_p->not_filesym, item_cmp);
-    dyn_array_qsort(wstat_p->not_dirsym, item_cmp);
-    dyn_array_qsort(wstat_p->not_filedirsym, item_cmp);
-
-    /*
-     * sort by canonicalized paths, items by level - See enum level
-     */
-    dyn_array_qsort(wstat_p->top, item_cmp);
-    dyn_array_qsort(wstat_p->shallow, item_cmp);
-    dyn_array_qsort(wstat_p->too_deep, item_cmp);
-    dyn_array_qsort(wstat_p->below, item_cmp);
-    /**/
-    dyn_array_qsort(wstat_p->any_level, item_cmp);
-    dyn_array_qsort(wstat_p->unknown_level, item_cmp);
-
-    /*
-     * sort by canonicalized paths, items by walk_rule - see booleans in struct walk_rule
-     */
-    dyn_array_qsort(wstat_p->required, item_cmp);
-    dyn_array_qsort(wstat_p->optional, item_cmp);
-    /**/
-    dyn_array_qsort(wstat_p->non_empty, item_cmp);
-    dyn_array_qsort(wstat_p->empty, item_cmp);
-    /**/
-    dyn_array_qsort(wstat_p->free, item_cmp);
-    dyn_array_qsort(wstat_p->counted, item_cmp);
-    /**/
-    dyn_array_qsort(wstat_p->counted_file, item_cmp);
-    dyn_array_qsort(wstat_p->counted_dir, item_cmp);
-    dyn_array_qsort(wstat_p->counted_sym, item_cmp);
-    dyn_array_qsort(wstat_p->counted_other, item_cmp);
-    /**/
-    dyn_array_qsort(wstat_p->ignore, item_cmp);
-    dyn_array_qsort(wstat_p->not_ignore, item_cmp);
-    /**/
-    dyn_array_qsort(wstat_p->prohibit, item_cmp);
-    dyn_array_qsort(wstat_p->not_prohibit, item_cmp);
-    /**/
-    dyn_array_qsort(wstat_p->unmatched, item_cmp);
-
-    /*
-     * sort by path problem
-     */
-    dyn_array_qsort(wstat_p->unsafe, item_cmp);
-    dyn_array_qsort(wstat_p->abs, item_cmp);
-    dyn_array_qsort(wstat_p->too_long_path, item_cmp);
-    dyn_array_qsort(wstat_p->too_long_path, item_cmp);
-    /**/
-    dyn_array_qsort(wstat_p->fts_err, item_cmp);
-    dyn_array_qsort(wstat_p->safe, item_cmp);
-
-    /*
-     * sort by descendant state
-     */
-    dyn_array_qsort(wstat_p->visit, item_cmp);
-    dyn_array_qsort(wstat_p->prune, item_cmp);
+     * sort by canonicalized paths, each materialized item category
+     *
+     * NOTE: A category materialized later by walk_view() will be in the order of the all items.
+     */
+    for (cat = 0; cat < WALK_CAT_COUNT; ++cat) {
+	if (wstat_p->view[cat] != NULL) {
+	    dyn_array_qsort(wstat_p->view[cat], item_cmp);
+	}
+    }
 
     /*
      * sort by canonicalized paths, all items
@@ -3355,6 +3564,8 @@ sort_walk_stat(struct walk_stat *wstat_p)
 void
 sort_walk_istat(struct walk_stat *wstat_p)
 {
+    int cat;
+
     /*
      * firewall - catch NULL ptrs
      */
@@ -3375,78 +3586,15 @@ sort_walk_istat(struct walk_stat *wstat_p)
     }
 
     /*
-     * sort by canonicalized paths, items by type - See enum allowed_type
-     */
-    dyn_array_qsort(wstat_p->file, item_icmp);
-    dyn_array_qsort(wstat_p->dir, item_icmp);
-    dyn_array_qsort(wstat_p->symlink, item_icmp);
-    /**/
-    dyn_array_qsort(wstat_p->not_file, item_icmp);
-    dyn_array_qsort(wstat_p->not_dir, item_icmp);
-    dyn_array_qsort(wstat_p->not_symlink, item_icmp);
-    /**/
-    dyn_array_qsort(wstat_p->filedir, item_icmp);
-    dyn_array_qsort(wstat_p->filesym, item_icmp);
-    dyn_array_qsort(wstat_p->dirsym, item_icmp);
-    dyn_array_qsort(wstat_p->filedirsym, item_icmp);
-    /**/
-    dyn_array_qsort(wstat_p->not_filedir, item_icmp);
-    dyn_array_qsort(wstat_p->not_filesym, item_icmp);
-    dyn_array_qsort(wstat_p->not_dirsym, item_icmp);
-    dyn_array_qsort(wstat_p->not_filedirsym, item_icmp);
-
-    /*
-     * sort by canonicalized paths, items by level - See enum level
-     */
-    dyn_array_qsort(wstat_p->top, item_icmp);
-    dyn_array_qsort(wstat_p->shallow, item_icmp);
-    dyn_array_qsort(wstat_p->too_deep, item_icmp);
-    dyn_array_qsort(wstat_p->below, item_icmp);
-    /**/
-    dyn_array_qsort(wstat_p->any_level, item_icmp);
-    dyn_array_qsort(wstat_p->unknown_level, item_icmp);
-
-    /*
-     * sort by canonicalized paths, items by walk_rule - see booleans in struct walk_rule
-     */
-    dyn_array_qsort(wstat_p->required, item_icmp);
-    dyn_array_qsort(wstat_p->optional, item_icmp);
-    /**/
-    dyn_array_qsort(wstat_p->non_empty, item_icmp);
-    dyn_array_qsort(wstat_p->empty, item_icmp);
-    /**/
-    dyn_array_qsort(wstat_p->free, item_icmp);
-    dyn_array_qsort(wstat_p->counted, item_icmp);
-    /**/
-    dyn_array_qsort(wstat_p->counted_file, item_icmp);
-    dyn_array_qsort(wstat_p->counted_dir, item_icmp);
-    dyn_array_qsort(wstat_p->counted_sym, item_icmp);
-    dyn_array_qsort(wstat_p->counted_other, item_icmp);
-    /**/
-    dyn_array_qsort(wstat_p->ignore, item_icmp);
-    dyn_array_qsort(wstat_p->not_ignore, item_icmp);
-    /**/
-    dyn_array_qsort(wstat_p->prohibit, item_icmp);
-    dyn_array_qsort(wstat_p->not_prohibit, item_icmp);
-    /**/
-    dyn_array_qsort(wstat_p->unmatched, item_icmp);
-
-    /*
-     * sort by path problem
-     */
-    dyn_array_qsort(wstat_p->unsafe, item_icmp);
-    dyn_array_qsort(wstat_p->abs, item_icmp);
-    dyn_array_qsort(wstat_p->too_long_path, item_icmp);
-    dyn_array_qsort(wstat_p->too_long_path, item_icmp);
-    /**/
-    dyn_array_qsort(wstat_p->fts_err, item_icmp);
-    dyn_array_qsort(wstat_p->safe, item_icmp);
-
-    /*
-     * sort by descendant state
-     */
-    dyn_array_qsort(wstat_p->visit, item_icmp);
-    dyn_array_qsort(wstat_p->prune, item_icmp);
+     * sort by canonicalized paths, each materialized item category
+     *
+     * NOTE: A category materialized later by walk_view() will be in the order of the all items.
+     */
+    for (cat = 0; cat < WALK_CAT_COUNT; ++cat) {
+	if (wstat_p->view[cat] != NULL) {
+	    dyn_array_qsort(wstat_p->view[cat], item_icmp);
+	}
+    }
 
     /*
      * sort, by canonicalized paths, all items
@@ -3548,7 +3696,7 @@ chk_walk(struct walk_stat *wstat_p, FILE *stream,
     /*
      * scan for prohibited items
      */
-    prohibit_count = dyn_array_tell(wstat_p->prohibit);
+    prohibit_count = walk_count(wstat_p, WALK_CAT_PROHIBIT);
     if (prohibit_count > 0) {
 
 	/* NOTE: 1 or more prohibited items found */
@@ -3564,7 +3712,7 @@ chk_walk(struct walk_stat *wstat_p, FILE *stream,
 		/*
 		 * print the fts_path of the current item
 		 */
-		i_p = dyn_array_value(wstat_p->prohibit, struct item *, i);
+		i_p = dyn_array_value(walk_view(wstat_p, WALK_CAT_PROHIBIT), struct item *, i);
 		if (i_p != NULL) {
 		    fmsg(stream, "   prohibited %s%s: %s",
 				 empty_or_not(i_p->st_size), file_type_name(i_p->st_mode), i_p->fts_path);
@@ -3580,7 +3728,7 @@ chk_walk(struct walk_stat *wstat_p, FILE *stream,
     /*
      * scan for items too deep
      */
-    too_deep_count = dyn_array_tell(wstat_p->too_deep);
+    too_deep_count = walk_count(wstat_p, WALK_CAT_TOO_DEEP);
     if (too_deep_count > 0) {
 
 	/* NOTE: 1 or more items that are too deep was found */
@@ -3596,7 +3744,7 @@ chk_walk(struct walk_stat *wstat_p, FILE *stream,
 		/*
 		 * print the fts_path of the current item
 		 */
-		i_p = dyn_array_value(wstat_p->too_deep, struct item *, i);
+		i_p = dyn_array_value(walk_view(wstat_p, WALK_CAT_TOO_DEEP), struct item *, i);
 		if (i_p != NULL) {
 		    fmsg(stream, "   %s is too deep: %s", file_type_name(i_p->st_mode), i_p->fts_path);
 		} else {
@@ -3611,7 +3759,7 @@ chk_walk(struct walk_stat *wstat_p, FILE *stream,
     /*
      * scan for unsafe paths
      */
-    unsafe_count = dyn_array_tell(wstat_p->unsafe);
+    unsafe_count = walk_count(wstat_p, WALK_CAT_UNSAFE);
     if (unsafe_count > 0) {
 
 	/* NOTE: 1 or more paths that are unsafe */
@@ -3627,7 +3775,7 @@ chk_walk(struct walk_stat *wstat_p, FILE *stream,
 		/*
 		 * print the fts_path of the current item
 		 */
-		i_p = dyn_array_value(wstat_p->unsafe, struct item *, i);
+		i_p = dyn_array_value(walk_view(wstat_p, WALK_CAT_UNSAFE), struct item *, i);
 		if (i_p != NULL) {
 		    fmsg(stream, "   %s has an unsafe path: %s", file_type_name(i_p->st_mode), i_p->fts_path);
 		} else {
@@ -3642,7 +3790,7 @@ chk_walk(struct walk_stat *wstat_p, FILE *stream,
     /*
      * scan for absolute paths
      */
-    abs_count = dyn_array_tell(wstat_p->abs);
+    abs_count = walk_count(wstat_p, WALK_CAT_ABS);
     if (abs_count > 0) {
 
 	/* NOTE: 1 or more paths that are absolute (not relative) */
@@ -3658,7 +3806,7 @@ chk_walk(struct walk_stat *wstat_p, FILE *stream,
 		/*
 		 * print the fts_path of the current item
 		 */
-		i_p = dyn_array_value(wstat_p->abs, struct item *, i);
+		i_p = dyn_array_value(walk_view(wstat_p, WALK_CAT_ABS), struct item *, i);
 		if (i_p != NULL) {
 		    fmsg(stream, "   %s has an absolute path: %s", file_type_name(i_p->st_mode), i_p->fts_path);
 		} else {
@@ -3673,7 +3821,7 @@ chk_walk(struct walk_stat *wstat_p, FILE *stream,
     /*
      * scan for paths too long
      */
-    too_long_path_count = dyn_array_tell(wstat_p->too_long_path);
+    too_long_path_count = walk_count(wstat_p, WALK_CAT_TOO_LONG_PATH);
     if (too_long_path_count > 0) {
 
 	/* NOTE: 1 or more paths that are too long */
@@ -3690,7 +3838,7 @@ chk_walk(struct walk_stat *wstat_p, FILE *stream,
 		/*
 		 * print the fts_path of the current item
 		 */
-		i_p = dyn_array_value(wstat_p->too_long_path, struct item *, i);
+		i_p = dyn_array_value(walk_view(wstat_p, WALK_CAT_TOO_LONG_PATH), struct item *, i);
 		if (i_p != NULL) {
 		    fmsg(stream, "   %s path is too long: %s", file_type_name(i_p->st_mode), i_p->fts_path);
 		} else {
@@ -3705,7 +3853,7 @@ chk_walk(struct walk_stat *wstat_p, FILE *stream,
     /*
      * scan for path with a path element too long
      */
-    too_long_name_count = dyn_array_tell(wstat_p->too_long_name);
+    too_long_name_count = walk_count(wstat_p, WALK_CAT_TOO_LONG_NAME);
     if (too_long_name_count > 0) {
 
 	/* NOTE: 1 or more paths with path elements too long */
@@ -3721,7 +3869,7 @@ chk_walk(struct walk_stat *wstat_p, FILE *stream,
 		/*
 		 * print the fts_path of the current item
 		 */
-		i_p = dyn_array_value(wstat_p->too_long_name, struct item *, i);
+		i_p = dyn_array_value(walk_view(wstat_p, WALK_CAT_TOO_LONG_NAME), struct item *, i);
 		if (i_p != NULL) {
 		    fmsg(stream, "   %s has path element that is too long: %s", file_type_name(i_p->st_mode), i_p->fts_path);
 		} else {
@@ -3736,7 +3884,7 @@ chk_walk(struct walk_stat *wstat_p, FILE *stream,
     /*
      * scan for path with a item that caused an fts(3) error, e.g., cannot read dir, cannot stat(2), etc.
      */
-    fts_err_count = dyn_array_tell(wstat_p->fts_err);
+    fts_err_count = walk_count(wstat_p, WALK_CAT_FTS_ERR);
     if (fts_err_count > 0) {
 
 	/* NOTE: 1 or more paths with path elements too long */
@@ -3752,7 +3900,7 @@ chk_walk(struct walk_stat *wstat_p, FILE *stream,
 		/*
 		 * print the fts_path of the current item
 		 */
-		i_p = dyn_array_value(wstat_p->fts_err, struct item *, i);
+		i_p = dyn_array_value(walk_view(wstat_p, WALK_CAT_FTS_ERR), struct item *, i);
 		if (i_p != NULL) {
 		    fmsg(stream, "   %s causing a hierarchy traverse error: %s", file_type_name(i_p->st_mode), i_p->fts_path);
 		} else {
@@ -3767,7 +3915,7 @@ chk_walk(struct walk_stat *wstat_p, FILE *stream,
     /*
      * verify we do not have too many counted (non-free) files
      */
-    counted_file_count = dyn_array_tell(wstat_p->counted_file);
+    counted_file_count = walk_count(wstat_p, WALK_CAT_COUNTED_FILE);
     if (max_file > 0 && counted_file_count > max_file) {
 	fmsg(stream, "files: number of counted (non-free): %jd > maximum allowed counted: %d",
 		     counted_file_count, max_file);
@@ -3780,7 +3928,7 @@ chk_walk(struct walk_stat *wstat_p, FILE *stream,
     /*
      * verify we do not have too many counted (non-free) dirs
      */
-    counted_dir_count = dyn_array_tell(wstat_p->counted_dir);
+    counted_dir_count = walk_count(wstat_p, WALK_CAT_COUNTED_DIR);
     if (max_dir > 0 && counted_dir_count > max_dir) {
 	fmsg(stream, "directories: number of counted (non-free): %jd > maximum allowed counted: %d",
 		     counted_dir_count, max_dir);
@@ -3793,7 +3941,7 @@ chk_walk(struct walk_stat *wstat_p, FILE *stream,
     /*
      * verify we do not have too many counted (non-free) syms
      */
-    counted_sym_count = dyn_array_tell(wstat_p->counted_sym);
+    counted_sym_count = walk_count(wstat_p, WALK_CAT_COUNTED_SYM);
     if (max_sym > 0 && counted_sym_count > max_sym) {
 	fmsg(stream, "symlinks: number of counted (non-free): %jd > maximum allowed counted: %d",
 		     counted_sym_count, max_sym);
@@ -3806,7 +3954,7 @@ chk_walk(struct walk_stat *wstat_p, FILE *stream,
     /*
      * verify we do not have too many counted (non-free) others
      */
-    counted_other_count = dyn_array_tell(wstat_p->counted_other);
+    counted_other_count = walk_count(wstat_p, WALK_CAT_COUNTED_OTHER);
     if (max_other > 0 && counted_other_count > max_other) {
 	fmsg(stream, "non-files/dirs/symlinks: number of counted (non-free): %jd > maximum allowed counted: %d",
 		     counted_other_count, max_other);
@@ -4021,14 +4169,6 @@ record_fts_err(struct walk_stat *wstat_p, char const *path, off_t st_size, mode_
 	err(91, __func__, "called with NULL wstat_p");
 	not_reached();
     }
-    if (wstat_p->fts_err == NULL) {
-        err(92, __func__, "called with NULL wstat_p->fts_err");
-        not_reached();
-    }
-    if (wstat_p->prune == NULL) {
-        err(93, __func__, "called with NULL wstat_p->prune");
-        not_reached();
-    }
     if (wstat_p->all == NULL) {
         err(94, __func__, "called with NULL wstat_p->all");
         not_reached();
@@ -4041,22 +4181,31 @@ record_fts_err(struct walk_stat *wstat_p, char const *path, off_t st_size, mode_
     /*
      * form an allocated item
      */
-    i_p = alloc_item(path, path, st_size, st_mode, fts_level);
+    i_p = alloc_item(wstat_p, path, path, st_size, st_mode, fts_level);
 
     /*
      * add path to fts_err
      */
-    (void) dyn_array_append_value(wstat_p->fts_err, &i_p);
+    walk_cat_add(wstat_p, i_p, WALK_CAT_FTS_ERR);
 
     /*
-     * add path to fts_err
+     * add path to prune
      */
-    (void) dyn_array_append_value(wstat_p->prune, &i_p);
+    walk_cat_add(wstat_p, i_p, WALK_CAT_PRUNE);
+    if (wstat_p->prune_index != NULL) {
+	path_index_add(wstat_p->prune_index, i_p);
+    }
 
     /*
      * add path to all
      */
     (void) dyn_array_append_value(wstat_p->all, &i_p);
+    if (wstat_p->all_index != NULL) {
+	path_index_add(wstat_p->all_index, i_p);
+    }
+    if (wstat_p->all_exact != NULL) {
+	path_index_add(wstat_p->all_exact, i_p);
+    }
 
     /*
      * record that we have stepped
@@ -4076,6 +4225,11 @@ record_fts_err(struct walk_stat *wstat_p, char const *path, off_t st_size, mode_
  *
  * NOTE: You need to call init_walk_stat() first in order to setup the struct walk_stat first.
  *
+ * NOTE: If init_walk_stat() was called with parallel_walk true, fts_walk_parallel() is
+ *	 used instead of fts(3).  Both record the same items, in the same order.
+ *	 For now only test_ioccc/try_fts_walk walks in parallel, to test it against
+ *	 the fts(3) walk: the tools all use fts(3).
+ *
  * given:
  *	wstat_p		    - pointer to a struct walk_stat to create
  *
@@ -4115,6 +4269,13 @@ fts_walk(struct walk_stat *wstat_p)
 	not_reached();
     }
 
+    /*
+     * use the parallel walk if requested
+     */
+    if (wstat_p->parallel_walk) {
+	return fts_walk_parallel(wstat_p);
+    }
+
     /*
      * form a NULL terminated array of strings
      */
@@ -4818,232 +4979,1366 @@ fts_walk(struct walk_stat *wstat_p)
     return true;
 }
 
-
 /*
- * path_in_item_array - determine if path already in a dynamic array of struct item pointers
- *
- * Given a dynamic array of struct items for a struct item with an fts_path that is
- * the same as to c_path in a CASE INDEPENDENT way.
- *
- * IMPORTANT POINT about file case:
- *
- * Consider a compressed tarball for a submission that is created on a case dependent filesystem
- * that contains BOTH the file "foo", and the file "Foo".  Assume that submission becomes a
- * winning entry.  Now consider someone who downloads the winning entry tarball onto a filesystem
- * that is case dependent.  When that the "Foo" file will overwrite the previously extracted "foo".
- *
- * On the other hand, we CANNOT canonicalize with the "lower_case" arg to canon_path() as true.
- * Consider case dependent filesystem where a submission is being created.  Assume that submission
- * as a "Makefile".  If the "lower_case" arg to canon_path() were true, then the copyfile() function
- * would attempt to copy the lower case form of "makefile" and fail because the case dependent filesystem
- * has "Makefile" instead.
- *
- * So we must canonicalize WITHOUT changing case. I.e., call canon_path() with the "lower_case" arg as false.
- * However, we when we check for duplicate files, we MUST compare strings WITHOUT regards to case.
- *
- * NOTE: Because the functions such as record_step() work on canonicalized paths,
- *	 the c_path should be called with a canonicalized path using canonicalize_path():
- *
- *	    struct walk_stat wstat;
- *	    char const *c_path;
- *	    chat *path;
- *	    enum path_sanity sanity_p = PATH_ERR_UNSET;
- *	    size_t path_len = 0;
- *	    int_least32_t deep = -1;
- *	    struct item *i_p;
- *
- *	    ... call init_walk_stat() as needed ...
- *
- *	    memset(&wstat, 0, sizeof(wstat));
- *	    init_walk_stat(&wstat, ...);
- *
- *	    ... set path as needed ...
- *
- *	    c_path = canonicalize_path(&wstat, path, &sanity, &path_len, &deep);
- *	    if (cpath == NULL) {
- *		... report that canonicalize_path had an internal failure and returned NULL ...
- *	    }
- *
- *	    ... look canonicalized path in the file dynamic array of struct item pointers ...
- *
- *	    i_p = path_in_item_array(c_path->file, c_path);
- *	    if (i_p == NULL) {
- *		.. process c_path NOT found in the file items dynamic array ..
- *	    } else {
- *		.. process c_path found in the file items dynamic array ..
- *	    }
- *
- *	    if (c_path != NULL) {
- *		free(c_path);
- *		c_path = NULL;
- *	    }
+ * walk_node_cmp - compare walk_node names in the same way as fts_cmp()
  *
  * given:
- *	item_array	    - dynamic array of pointers to struct item
- *	c_path		    - canonicalized path to search for on the struct walk_stat all dynamic array
+ *	a	pointer to pointer to 1st struct walk_node to compare
+ *	b	pointer to pointer to 2nd struct walk_node to compare
  *
  * returns:
- *	!= NULL ==> struct item pointer where fts_path matches path
- *	NULL ==> path not found on the struct walk_stat all dynamic array, or internal error
+ *	-1 if  a < b
+ *	0  if  a == b
+ *	1  if  a > b
  *
  * NOTE: This function does not return on an internal error.
  */
-struct item *
-path_in_item_array(struct dyn_array *item_array, char const *c_path)
+static int
+walk_node_cmp(void const *a, void const *b)
 {
-    struct item *i_p;	    /* pointer to an element in the dynamic array */
-    size_t c_path_len;	    /* length of c_path */
-    intmax_t len;	    /* number of elements in the dynamic array */
-    intmax_t i;
+    struct walk_node const *na;	/* 1st walk_node */
+    struct walk_node const *nb;	/* 2nd walk_node */
+    int cmp = 0;		/* name comparison */
 
     /*
      * firewall
      */
-    if (item_array == NULL) {
-	err(98, __func__, "item_array is NULL");
-	not_reached();
-    }
-    if (c_path == NULL) {
-	err(99, __func__, "c_path is NULL");
+    if (a == NULL || b == NULL) {
+	err(128, __func__, "called with NULL arg(s)");
 	not_reached();
     }
-    if (item_array->elm_size != sizeof(struct item *)) {
-	err(100, __func__, "item_array->elm_size: %zu != sizeof(struct item *): %zu",
-			  item_array->elm_size, sizeof(struct item *));
+    na = *(struct walk_node const * const *)a;
+    nb = *(struct walk_node const * const *)b;
+    if (na == NULL || nb == NULL) {
+	err(129, __func__, "called with NULL walk_node(s)");
 	not_reached();
     }
 
     /*
-     * scan the all array
+     * empty names are sorted AFTER non-empty names, just as fts_cmp() does
      */
-    c_path_len = strlen(c_path);
-    len = dyn_array_tell(item_array);
-    for (i=0; i < len; ++i) {
-
-	/*
-	 * compare the fts_path of the current item
-	 */
-	i_p = dyn_array_value(item_array, struct item *, i);
-	if (i_p == NULL) {
-	    dbg(DBG_V1_HIGH, "%s: item_array[%zu] is NULL", __func__, i);
-	} else if (c_path_len == i_p->fts_pathlen && strcasecmp(c_path, i_p->fts_path) == 0) {
-	    /* report match found */
-	    dbg(DBG_V1_HIGH, "%s: item_array[%zu] matches: %s", __func__, i, c_path);
-	    return i_p;
-	}
+    if (*na->name == '\0') {
+	return (*nb->name == '\0') ? 0 : 1;
+    } else if (*nb->name == '\0') {
+	return -1;
     }
 
     /*
-     * report no match
+     * string compare names
      */
-    dbg(DBG_V1_HIGH, "%s: c_path not found: %s", __func__, c_path);
-    return NULL;
+    cmp = strcmp(na->name, nb->name);
+    return ((cmp <= -1) ? -1 : ((cmp == 0) ? 0 : 1));
 }
 
 
 /*
- * path_in_walk_stat
- *
- * Given a struct walk_stat *wstat_p, search the wstat_p->all dynamic array of struct items
- * for a struct item with an fts_path that is identical to c_path.  We can the wstat_p->all
- * dynamic array because functions such as record_step() stores all valid items on this
- * dynamic array, regardless of the type of path.
- *
- * NOTE: Because the functions such as record_step() work on canonicalized paths,
- *	 the c_path should be called with a canonicalized path using canonicalize_path():
- *
- *	    struct walk_stat wstat;
- *	    char const *c_path;
- *	    chat *path;
- *	    enum path_sanity sanity_p = PATH_ERR_UNSET;
- *	    size_t path_len = 0;
- *	    int_least32_t deep = -1;
- *
- *	    ... call init_walk_stat() as needed ...
- *
- *	    memset(&wstat, 0, sizeof(wstat));
- *	    init_walk_stat(&wstat, ...);
- *
- *	    ... set path as needed ...
- *
- *	    c_path = canonicalize_path(&wstat, path, &sanity, &path_len, &deep);
- *	    if (cpath == NULL) {
- *		... report that canonicalize_path had an internal failure and returned NULL ...
- *	    }
- *
- *	Do not forget that c_path is a calloced canonicalized path, so when finished
- *	calling this function, free c_path:
- *
- *	    struct item *i_p;
- *
- *	    ...
- *
- *	    i_p = path_in_walk_stat(&wstat, c_path);
- *	    if (i_p == NULL) {
- *		.. process c_path NOT found ..
- *	    } else {
- *		.. process c_path found ..
- *	    }
- *
- *	    if (c_path != NULL) {
- *		free(c_path);
- *		c_path = NULL;
- *	    }
+ * free_walk_node - free a walk_node and all of the walk_nodes below it
  *
  * given:
- *	wstat_p		    - pointer to a struct walk_stat to create
- *	c_path		    - canonicalized path to search for on the struct walk_stat all dynamic array
- *
- * returns:
- *	!= NULL ==> struct item pointer where fts_path matches path
- *	NULL ==> path not found on the struct walk_stat all dynamic array, or internal error
+ *	node	    - pointer to a struct walk_node to free, or NULL
  *
- * NOTE: This function does not return on an internal error.
+ * NOTE: The walk_pool worker threads must no longer be running.
  */
-struct item *
-path_in_walk_stat(struct walk_stat *wstat_p, char const *c_path)
+static void
+free_walk_node(struct walk_node *node)
 {
-    struct item *i_p;	    /* pointer to an element in the dynamic array */
+    size_t i;
 
     /*
      * firewall
      */
-    if (wstat_p == NULL) {
-	err(101, __func__, "wstat_p is NULL");
-	not_reached();
+    if (node == NULL) {
+	return;
     }
-    if (c_path == NULL) {
-	err(102, __func__, "c_path is NULL");
+
+    /*
+     * free kids, then ourselves
+     */
+    if (node->kid != NULL) {
+	for (i = 0; i < node->count; ++i) {
+	    free_walk_node(node->kid[i]);
+	    node->kid[i] = NULL;
+	}
+	free(node->kid);
+	node->kid = NULL;
+    }
+    if (node->path != NULL) {
+	free(node->path);
+	node->path = NULL;
+    }
+    free(node);
+    return;
+}
+
+
+/*
+ * read_walk_dir - read a directory of a parallel walk
+ *
+ * Read the directory relative to the topdir file descriptor, stat each path
+ * relative to the directory file descriptor, and sort the kids in fts_cmp() order.
+ * Like fts(3) with FTS_PHYSICAL, symlinks are not followed.
+ *
+ * given:
+ *	pool	    - pointer to a struct walk_pool
+ *	dir	    - pointer to a struct walk_node directory to read
+ *	count_p	    - pointer to the number of kids found
+ *	dnr_p	    - pointer to set true if the directory could not be read
+ *
+ * returns:
+ *	malloced array of *count_p kids in fts_cmp() order, or NULL
+ *
+ * NOTE: This function is called without the walk_pool lock held.  It only reads
+ *	 elements of dir, and of its parents, that do not change once dir was queued.
+ *
+ * NOTE: This function does not return on an internal error.
+ */
+static struct walk_node **
+read_walk_dir(struct walk_pool *pool, struct walk_node *dir, size_t *count_p, bool *dnr_p)
+{
+    struct walk_node **kid = NULL;	/* kids found */
+    struct walk_node *k;		/* kid being formed */
+    struct walk_node const *a;		/* ancestor being checked for a cycle */
+    size_t alloced = 0;			/* number of kid pointers allocated */
+    size_t count = 0;			/* number of kids found */
+    struct dirent *dp;			/* directory entry */
+    struct stat st;			/* stat of a directory entry */
+    DIR *dirp;				/* open directory */
+    size_t dirlen;			/* length of dir->path */
+    size_t namelen;			/* length of a directory entry name */
+    int fd;				/* directory file descriptor */
+
+    /*
+     * firewall
+     */
+    if (pool == NULL || dir == NULL || count_p == NULL || dnr_p == NULL) {
+	err(130, __func__, "called with NULL arg(s)");
+	not_reached();
+    }
+    *count_p = 0;
+    *dnr_p = false;
+
+    /*
+     * open the directory relative to topdir
+     */
+    errno = 0;	/* pre-clear errno for dbg() */
+    fd = openat(pool->topfd, (dir->path[0] == '\0') ? "." : dir->path, O_RDONLY | O_DIRECTORY | O_NOFOLLOW);
+    if (fd < 0) {
+	dbg(DBG_V1_HIGH, "%s: cannot open directory: %s: %s", __func__, dir->path, strerror(errno));
+	*dnr_p = true;
+	return NULL;
+    }
+    dirp = fdopendir(fd);
+    if (dirp == NULL) {
+	dbg(DBG_V1_HIGH, "%s: cannot fdopendir directory: %s: %s", __func__, dir->path, strerror(errno));
+	(void) close(fd);
+	*dnr_p = true;
+	return NULL;
+    }
+    dirlen = strlen(dir->path);
+
+    /*
+     * read the directory, as fts(3) does without FTS_SEEDOT
+     */
+    while ((dp = readdir(dirp)) != NULL) {
+
+	/* ignore . (dot) and .. (dot-dot) */
+	if (strcmp(dp->d_name, ".") == 0 || strcmp(dp->d_name, "..") == 0) {
+	    continue;
+	}
+
+	/*
+	 * grow the kid array as needed
+	 */
+	if (count >= alloced) {
+	    alloced = (alloced == 0) ? DEF_CHUNK : alloced * 2;
+	    errno = 0;	/* pre-clear for errp() */
+	    kid = realloc(kid, alloced * sizeof(kid[0]));
+	    if (kid == NULL) {
+		errp(131, __func__, "failed to realloc %zu walk_node pointers", alloced);
+		not_reached();
+	    }
+	}
+
+	/*
+	 * form the kid path below topdir
+	 */
+	errno = 0;	/* pre-clear for errp() */
+	k = calloc(1, sizeof(*k));
+	if (k == NULL) {
+	    errp(132, __func__, "failed to calloc a walk_node");
+	    not_reached();
+	}
+	namelen = strlen(dp->d_name);
+	errno = 0;	/* pre-clear for errp() */
+	k->path = malloc(dirlen + 1 + namelen + 1);
+	if (k->path == NULL) {
+	    errp(133, __func__, "failed to malloc path of %zu bytes", dirlen + 1 + namelen + 1);
+	    not_reached();
+	}
+	if (dirlen > 0) {
+	    memcpy(k->path, dir->path, dirlen);
+	    k->path[dirlen] = '/';
+	    memcpy(k->path + dirlen + 1, dp->d_name, namelen + 1);
+	    k->name = k->path + dirlen + 1;
+	} else {
+	    memcpy(k->path, dp->d_name, namelen + 1);
+	    k->name = k->path;
+	}
+	k->level = dir->level + 1;
+	k->parent = dir;
+
+	/*
+	 * stat the path relative to the directory, without following symlinks
+	 */
+	if (fstatat(dirfd(dirp), dp->d_name, &st, AT_SYMLINK_NOFOLLOW) != 0) {
+	    k->info = FTS_NS;
+	} else {
+	    k->st_size = st.st_size;
+	    k->st_mode = st.st_mode;
+	    k->st_dev = st.st_dev;
+	    k->st_ino = st.st_ino;
+	    if (S_ISDIR(st.st_mode)) {
+		k->info = FTS_D;
+		for (a = dir; a != NULL; a = a->parent) {
+		    if (a->st_dev == st.st_dev && a->st_ino == st.st_ino) {
+			k->info = FTS_DC;
+			break;
+		    }
+		}
+	    } else if (S_ISLNK(st.st_mode)) {
+		k->info = FTS_SL;
+	    } else if (S_ISREG(st.st_mode)) {
+		k->info = FTS_F;
+	    } else {
+		k->info = FTS_DEFAULT;
+	    }
+	}
+	kid[count++] = k;
+    }
+    (void) closedir(dirp);
+
+    /*
+     * sort kids in the same order that fts_cmp() would
+     */
+    if (count > 1) {
+	qsort(kid, count, sizeof(kid[0]), walk_node_cmp);
+    }
+    *count_p = count;
+    return kid;
+}
+
+
+/*
+ * walk_worker - worker thread of a parallel walk
+ *
+ * Pop directories from the walk_pool queue, read them, and queue the
+ * sub-directories found, until the walk_pool is done.
+ *
+ * given:
+ *	arg	    - pointer to a struct walk_pool
+ *
+ * returns:
+ *	NULL
+ *
+ * NOTE: This function does not return on an internal error.
+ */
+static void *
+walk_worker(void *arg)
+{
+    struct walk_pool *pool = (struct walk_pool *)arg;	/* our walk_pool */
+    struct walk_node *dir;		/* directory being read */
+    struct walk_node const *a;		/* ancestor being checked for pruning */
+    struct walk_node **kid;		/* kids of dir */
+    size_t count;			/* number of kids of dir */
+    bool dnr;				/* true ==> dir could not be read */
+    bool pruned;			/* true ==> dir, or one of its parents, was pruned */
+    size_t i;
+
+    /*
+     * firewall
+     */
+    if (pool == NULL) {
+	err(134, __func__, "called with NULL arg");
+	not_reached();
+    }
+
+    (void) pthread_mutex_lock(&pool->lock);
+    for (;;) {
+
+	/*
+	 * wait for a directory to read
+	 */
+	while (pool->done == false && pool->queue == NULL) {
+	    (void) pthread_cond_wait(&pool->work, &pool->lock);
+	}
+	if (pool->done) {
+	    break;
+	}
+	dir = pool->queue;
+	pool->queue = dir->next;
+	dir->next = NULL;
+
+	/*
+	 * do not read below a directory that the merge stage has pruned
+	 */
+	pruned = false;
+	for (a = dir; a != NULL; a = a->parent) {
+	    if (a->pruned) {
+		pruned = true;
+		break;
+	    }
+	}
+
+	/*
+	 * read the directory without holding the lock
+	 */
+	kid = NULL;
+	count = 0;
+	dnr = false;
+	if (pruned == false) {
+	    (void) pthread_mutex_unlock(&pool->lock);
+	    kid = read_walk_dir(pool, dir, &count, &dnr);
+	    (void) pthread_mutex_lock(&pool->lock);
+	}
+
+	/*
+	 * publish the kids and queue the sub-directories
+	 *
+	 * Sub-directories are pushed in reverse order so that the first sub-directory
+	 * in fts_cmp() order, the one the merge stage needs next, is popped first.
+	 */
+	dir->kid = kid;
+	dir->count = count;
+	dir->dnr = dnr;
+	dir->read = true;
+	for (i = count; i > 0; --i) {
+	    if (kid[i-1]->info == FTS_D) {
+		kid[i-1]->next = pool->queue;
+		pool->queue = kid[i-1];
+	    }
+	}
+	(void) pthread_cond_broadcast(&pool->ready);
+	if (pool->queue != NULL) {
+	    (void) pthread_cond_broadcast(&pool->work);
+	}
+    }
+    (void) pthread_mutex_unlock(&pool->lock);
+    return NULL;
+}
+
+
+/*
+ * merge_walk_dir - record the paths below a directory of a parallel walk
+ *
+ * Visit the kids of a directory, and recursively the directories below them,
+ * in the same pre-order, and in the same fts_cmp() order, as fts_walk() would
+ * with fts(3).  Each path is recorded just as fts_walk() records it.
+ *
+ * given:
+ *	wstat_p	    - pointer to a struct walk_stat
+ *	pool	    - pointer to a struct walk_pool
+ *	dir	    - pointer to a struct walk_node directory
+ *
+ * NOTE: This function does not return on an internal error.
+ */
+static void
+merge_walk_dir(struct walk_stat *wstat_p, struct walk_pool *pool, struct walk_node *dir)
+{
+    struct walk_node *k;	/* kid being recorded */
+    bool process = false;	/* false ==> prune walk below the path, true ==> continue to walk path */
+    size_t i;
+
+    /*
+     * firewall
+     */
+    if (wstat_p == NULL || pool == NULL || dir == NULL) {
+	err(135, __func__, "called with NULL arg(s)");
+	not_reached();
+    }
+
+    /*
+     * wait for a worker thread to read the directory
+     */
+    (void) pthread_mutex_lock(&pool->lock);
+    while (dir->read == false) {
+	(void) pthread_cond_wait(&pool->ready, &pool->lock);
+    }
+    (void) pthread_mutex_unlock(&pool->lock);
+
+    /*
+     * case: unreadable directory
+     *
+     * Like fts(3), an unreadable directory is reported after it was recorded
+     * as a directory.  As with fts_walk(), an unreadable topdir is silently skipped.
+     */
+    if (dir->dnr) {
+	if (dir->level > 0) {
+	    warn(__func__, "unreadable directory for: %s/%s", wstat_p->topdir, dir->path);
+	    record_fts_err(wstat_p, dir->path, dir->st_size, dir->st_mode, dir->level);
+	}
+	return;
+    }
+
+    /*
+     * record each kid
+     */
+    for (i = 0; i < dir->count; ++i) {
+	k = dir->kid[i];
+	dbg(DBG_V1_HIGH, "%s: path: %s info: %d depth: %d", __func__, k->path, k->info, k->level);
+
+	switch (k->info) {
+	case FTS_D:
+
+	    /* record the directory, then the paths below it unless it is pruned */
+	    process = record_step(wstat_p, k->path, k->st_size, k->st_mode, NULL, NULL);
+	    if (process) {
+		merge_walk_dir(wstat_p, pool, k);
+	    } else {
+		(void) pthread_mutex_lock(&pool->lock);
+		k->pruned = true;
+		(void) pthread_mutex_unlock(&pool->lock);
+	    }
+	    break;
+
+	case FTS_DC:
+
+	    /* record fts error */
+	    warn(__func__, "cycle causing directory for: %s/%s", wstat_p->topdir, k->path);
+	    record_fts_err(wstat_p, k->path, k->st_size, k->st_mode, k->level);
+	    break;
+
+	case FTS_NS:
+
+	    /* record fts error, size and mode are not valid */
+	    warn(__func__, "stat failed for: %s/%s", wstat_p->topdir, k->path);
+	    record_fts_err(wstat_p, k->path, 0, 0, k->level);
+	    break;
+
+	default:
+
+	    /* record walk step with sub-path below canonicalized wstat_p->topdir */
+	    (void) record_step(wstat_p, k->path, k->st_size, k->st_mode, NULL, NULL);
+	    break;
+	}
+    }
+    return;
+}
+
+
+/*
+ * fts_walk_parallel - walk a file system tree with WALK_THREADS worker threads
+ *
+ * Worker threads read directories, relative to a topdir file descriptor, into a
+ * tree of walk_nodes.  At the same time the calling thread merges that tree, in
+ * fts(3) order, into the struct walk_stat.  The result is the same as the fts(3)
+ * walk of fts_walk(), except that directory reads and stat calls overlap.
+ *
+ * given:
+ *	wstat_p		    - pointer to an initialized struct walk_stat
+ *
+ * return:
+ *	true ==> no errors found
+ *	false ==> some errors found
+ *
+ * NOTE: This function does not return on an internal error.
+ */
+static bool
+fts_walk_parallel(struct walk_stat *wstat_p)
+{
+    struct walk_pool pool;		/* worker threads and work queue */
+    pthread_t thread[WALK_THREADS];	/* worker threads */
+    struct walk_node *root = NULL;	/* topdir */
+    struct stat st;			/* stat of topdir */
+    int threads = 0;			/* number of worker threads started */
+    int ret;				/* pthread_create() return */
+    int i;
+
+    /*
+     * firewall
+     */
+    if (wstat_p == NULL || wstat_p->topdir == NULL) {
+	err(136, __func__, "called with NULL wstat_p or NULL wstat_p->topdir");
+	not_reached();
+    }
+
+    /*
+     * open topdir, following it if it is a symlink just as FTS_COMFOLLOW does
+     *
+     * Like fts_walk(), a topdir that does not exist is a walk error, whereas if topdir
+     * exists but is not a readable directory, there is nothing to record.
+     */
+    memset(&pool, 0, sizeof(pool));
+    errno = 0;	/* pre-clear errno for dbg() */
+    pool.topfd = open(wstat_p->topdir, O_RDONLY | O_DIRECTORY);
+    if (pool.topfd < 0) {
+	dbg(DBG_V1_HIGH, "%s: cannot open topdir: %s: %s", __func__, wstat_p->topdir, strerror(errno));
+	errno = 0;	/* pre-clear for warnp() */
+	if (stat(wstat_p->topdir, &st) != 0) {
+	    warnp(__func__, "failed to open for file hierarchy traversal: %s", wstat_p->topdir);
+	    return false;
+	}
+	return true;
+    }
+    if (fstat(pool.topfd, &st) != 0) {
+	warnp(__func__, "cannot fstat topdir: %s", wstat_p->topdir);
+	(void) close(pool.topfd);
+	return false;
+    }
+
+    /*
+     * form the topdir walk_node
+     */
+    errno = 0;	/* pre-clear for errp() */
+    root = calloc(1, sizeof(*root));
+    if (root == NULL) {
+	errp(137, __func__, "failed to calloc topdir walk_node");
+	not_reached();
+    }
+    errno = 0;	/* pre-clear for errp() */
+    root->path = strdup("");
+    if (root->path == NULL) {
+	errp(138, __func__, "failed to strdup topdir walk_node path");
+	not_reached();
+    }
+    root->name = root->path;
+    root->info = FTS_D;
+    root->st_size = st.st_size;
+    root->st_mode = st.st_mode;
+    root->st_dev = st.st_dev;
+    root->st_ino = st.st_ino;
+
+    /*
+     * queue topdir and start the worker threads
+     */
+    (void) pthread_mutex_init(&pool.lock, NULL);
+    (void) pthread_cond_init(&pool.work, NULL);
+    (void) pthread_cond_init(&pool.ready, NULL);
+    pool.queue = root;
+    for (i = 0; i < WALK_THREADS; ++i) {
+	ret = pthread_create(&thread[threads], NULL, walk_worker, &pool);
+	if (ret != 0) {
+	    dbg(DBG_MED, "%s: pthread_create() failed: %s", __func__, strerror(ret));
+	    break;
+	}
+	++threads;
+    }
+
+    /*
+     * merge the walk if there are worker threads, otherwise fall back to fts(3)
+     */
+    if (threads > 0) {
+	dbg(DBG_MED, "%s: walking %s with %d worker threads", __func__, wstat_p->topdir, threads);
+	merge_walk_dir(wstat_p, &pool, root);
+    }
+
+    /*
+     * stop and join the worker threads
+     */
+    (void) pthread_mutex_lock(&pool.lock);
+    pool.done = true;
+    (void) pthread_cond_broadcast(&pool.work);
+    (void) pthread_mutex_unlock(&pool.lock);
+    for (i = 0; i < threads; ++i) {
+	(void) pthread_join(thread[i], NULL);
+    }
+
+    /*
+     * free storage
+     */
+    (void) pthread_cond_destroy(&pool.ready);
+    (void) pthread_cond_destroy(&pool.work);
+    (void) pthread_mutex_destroy(&pool.lock);
+    (void) close(pool.topfd);
+    free_walk_node(root);
+    root = NULL;
+
+    /*
+     * fall back to fts(3) if no worker threads could be started
+     */
+    if (threads <= 0) {
+	warn(__func__, "unable to start worker threads, walking %s with fts(3) instead", wstat_p->topdir);
+	wstat_p->parallel_walk = false;
+	return fts_walk(wstat_p);
+    }
+
+    /*
+     * walk successful
+     */
+    return true;
+}
+
+
+/*
+ * path_in_item_array - determine if path already in a dynamic array of struct item pointers
+ *
+ * Given a dynamic array of struct items for a struct item with an fts_path that is
+ * the same as to c_path in a CASE INDEPENDENT way.
+ *
+ * IMPORTANT POINT about file case:
+ *
+ * Consider a compressed tarball for a submission that is created on a case dependent filesystem
+ * that contains BOTH the file "foo", and the file "Foo".  Assume that submission becomes a
+ * winning entry.  Now consider someone who downloads the winning entry tarball onto a filesystem
+ * that is case dependent.  When that the "Foo" file will overwrite the previously extracted "foo".
+ *
+ * On the other hand, we CANNOT canonicalize with the "lower_case" arg to canon_path() as true.
+ * Consider case dependent filesystem where a submission is being created.  Assume that submission
+ * as a "Makefile".  If the "lower_case" arg to canon_path() were true, then the copyfile() function
+ * would attempt to copy the lower case form of "makefile" and fail because the case dependent filesystem
+ * has "Makefile" instead.
+ *
+ * So we must canonicalize WITHOUT changing case. I.e., call canon_path() with the "lower_case" arg as false.
+ * However, we when we check for duplicate files, we MUST compare strings WITHOUT regards to case.
+ *
+ * NOTE: Because the functions such as record_step() work on canonicalized paths,
+ *	 the c_path should be called with a canonicalized path using canonicalize_path():
+ *
+ *	    struct walk_stat wstat;
+ *	    char const *c_path;
+ *	    chat *path;
+ *	    enum path_sanity sanity_p = PATH_ERR_UNSET;
+ *	    size_t path_len = 0;
+ *	    int_least32_t deep = -1;
+ *	    struct item *i_p;
+ *
+ *	    ... call init_walk_stat() as needed ...
+ *
+ *	    memset(&wstat, 0, sizeof(wstat));
+ *	    init_walk_stat(&wstat, ...);
+ *
+ *	    ... set path as needed ...
+ *
+ *	    c_path = canonicalize_path(&wstat, path, &sanity, &path_len, &deep);
+ *	    if (cpath == NULL) {
+ *		... report that canonicalize_path had an internal failure and returned NULL ...
+ *	    }
+ *
+ *	    ... look canonicalized path in the file dynamic array of struct item pointers ...
+ *
+ *	    i_p = path_in_item_array(c_path->file, c_path);
+ *	    if (i_p == NULL) {
+ *		.. process c_path NOT found in the file items dynamic array ..
+ *	    } else {
+ *		.. process c_path found in the file items dynamic array ..
+ *	    }
+ *
+ *	    if (c_path != NULL) {
+ *		free(c_path);
+ *		c_path = NULL;
+ *	    }
+ *
+ * given:
+ *	item_array	    - dynamic array of pointers to struct item
+ *	c_path		    - canonicalized path to search for on the struct walk_stat all dynamic array
+ *
+ * returns:
+ *	!= NULL ==> struct item pointer where fts_path matches path
+ *	NULL ==> path not found on the struct walk_stat all dynamic array, or internal error
+ *
+ * NOTE: This function does not return on an internal error.
+ */
+struct item *
+path_in_item_array(struct dyn_array *item_array, char const *c_path)
+{
+    struct item *i_p;	    /* pointer to an element in the dynamic array */
+    size_t c_path_len;	    /* length of c_path */
+    intmax_t len;	    /* number of elements in the dynamic array */
+    intmax_t i;
+
+    /*
+     * firewall
+     */
+    if (item_array == NULL) {
+	err(98, __func__, "item_array is NULL");
+	not_reached();
+    }
+    if (c_path == NULL) {
+	err(99, __func__, "c_path is NULL");
+	not_reached();
+    }
+    if (item_array->elm_size != sizeof(struct item *)) {
+	err(100, __func__, "item_array->elm_size: %zu != sizeof(struct item *): %zu",
+			  item_array->elm_size, sizeof(struct item *));
+	not_reached();
+    }
+
+    /*
+     * scan the all array
+     */
+    c_path_len = strlen(c_path);
+    len = dyn_array_tell(item_array);
+    for (i=0; i < len; ++i) {
+
+	/*
+	 * compare the fts_path of the current item
+	 */
+	i_p = dyn_array_value(item_array, struct item *, i);
+	if (i_p == NULL) {
+	    dbg(DBG_V1_HIGH, "%s: item_array[%zu] is NULL", __func__, i);
+	} else if (c_path_len == i_p->fts_pathlen && strcasecmp(c_path, i_p->fts_path) == 0) {
+	    /* report match found */
+	    dbg(DBG_V1_HIGH, "%s: item_array[%zu] matches: %s", __func__, i, c_path);
+	    return i_p;
+	}
+    }
+
+    /*
+     * report no match
+     */
+    dbg(DBG_V1_HIGH, "%s: c_path not found: %s", __func__, c_path);
+    return NULL;
+}
+
+
+/*
+ * path_in_walk_stat
+ *
+ * Given a struct walk_stat *wstat_p, search the wstat_p->all dynamic array of struct items
+ * for a struct item with an fts_path that is identical to c_path.  We can the wstat_p->all
+ * dynamic array because functions such as record_step() stores all valid items on this
+ * dynamic array, regardless of the type of path.
+ *
+ * Like path_in_item_array(), paths are compared without regard to case.  When
+ * wstat_p->all_index is non-NULL, it is used instead of scanning wstat_p->all.
+ *
+ * NOTE: Because the functions such as record_step() work on canonicalized paths,
+ *	 the c_path should be called with a canonicalized path using canonicalize_path():
+ *
+ *	    struct walk_stat wstat;
+ *	    char const *c_path;
+ *	    chat *path;
+ *	    enum path_sanity sanity_p = PATH_ERR_UNSET;
+ *	    size_t path_len = 0;
+ *	    int_least32_t deep = -1;
+ *
+ *	    ... call init_walk_stat() as needed ...
+ *
+ *	    memset(&wstat, 0, sizeof(wstat));
+ *	    init_walk_stat(&wstat, ...);
+ *
+ *	    ... set path as needed ...
+ *
+ *	    c_path = canonicalize_path(&wstat, path, &sanity, &path_len, &deep);
+ *	    if (cpath == NULL) {
+ *		... report that canonicalize_path had an internal failure and returned NULL ...
+ *	    }
+ *
+ *	Do not forget that c_path is a calloced canonicalized path, so when finished
+ *	calling this function, free c_path:
+ *
+ *	    struct item *i_p;
+ *
+ *	    ...
+ *
+ *	    i_p = path_in_walk_stat(&wstat, c_path);
+ *	    if (i_p == NULL) {
+ *		.. process c_path NOT found ..
+ *	    } else {
+ *		.. process c_path found ..
+ *	    }
+ *
+ *	    if (c_path != NULL) {
+ *		free(c_path);
+ *		c_path = NULL;
+ *	    }
+ *
+ * given:
+ *	wstat_p		    - pointer to a struct walk_stat to create
+ *	c_path		    - canonicalized path to search for on the struct walk_stat all dynamic array
+ *
+ * returns:
+ *	!= NULL ==> struct item pointer where fts_path matches path
+ *	NULL ==> path not found on the struct walk_stat all dynamic array, or internal error
+ *
+ * NOTE: This function does not return on an internal error.
+ */
+struct item *
+path_in_walk_stat(struct walk_stat *wstat_p, char const *c_path)
+{
+    struct item *i_p;	    /* pointer to an element in the dynamic array */
+
+    /*
+     * firewall
+     */
+    if (wstat_p == NULL) {
+	err(101, __func__, "wstat_p is NULL");
+	not_reached();
+    }
+    if (c_path == NULL) {
+	err(102, __func__, "c_path is NULL");
+	not_reached();
+    }
+
+    /*
+     * if walk_stat check fails, abort
+     *
+     * NOTE: Passing this check means that we do not have to do as much checking elsewhere
+     *       in this function.
+     */
+    if (! chk_walk_stat(wstat_p)) {
+	err(103, __func__, "wstat_p failed the chk_walk_stat function test suite");
+	not_reached();
+    }
+
+    /*
+     * look up the all index, or if there is none, scan the all array
+     */
+    if (wstat_p->all_index != NULL) {
+	i_p = path_index_find(wstat_p->all_index, c_path);
+    } else {
+	i_p = path_in_item_array(wstat_p->all, c_path);
+    }
+    if (i_p != NULL) {
+
+	/* report match found */
+	dbg(DBG_V1_HIGH, "%s: c_path found: %s", __func__, c_path);
+	return i_p;
+    }
+
+    /*
+     * report no match
+     */
+    dbg(DBG_V1_HIGH, "%s: c_path not found: %s", __func__, c_path);
+    return NULL;
+}
+
+
+/*
+ * path_in_walk_stat_exact
+ *
+ * Given a struct walk_stat *wstat_p, find a struct item recorded on the wstat_p->all
+ * dynamic array with an fts_path that is identical to c_path WITH regard to case.
+ *
+ * This is the case-sensitive form of path_in_walk_stat().  When wstat_p->all_exact
+ * is non-NULL, it is used instead of scanning wstat_p->all.
+ *
+ * given:
+ *	wstat_p		    - pointer to a struct walk_stat
+ *	c_path		    - canonicalized path to search for on the struct walk_stat all dynamic array
+ *
+ * returns:
+ *	!= NULL ==> struct item pointer where fts_path matches path
+ *	NULL ==> path not found on the struct walk_stat all dynamic array
+ *
+ * NOTE: This function does not return on an internal error.
+ */
+struct item *
+path_in_walk_stat_exact(struct walk_stat *wstat_p, char const *c_path)
+{
+    struct item *i_p;	    /* pointer to an element in the dynamic array */
+    size_t c_path_len;	    /* length of c_path */
+    intmax_t len;	    /* number of elements in the dynamic array */
+    intmax_t i;
+
+    /*
+     * firewall
+     */
+    if (wstat_p == NULL) {
+	err(104, __func__, "wstat_p is NULL");
+	not_reached();
+    }
+    if (c_path == NULL) {
+	err(105, __func__, "c_path is NULL");
+	not_reached();
+    }
+    if (! chk_walk_stat(wstat_p)) {
+	err(106, __func__, "wstat_p failed the chk_walk_stat function test suite");
+	not_reached();
+    }
+
+    /*
+     * look up the exact index
+     */
+    if (wstat_p->all_exact != NULL) {
+	return path_index_find(wstat_p->all_exact, c_path);
+    }
+
+    /*
+     * no exact index, scan the all array
+     */
+    c_path_len = strlen(c_path);
+    len = dyn_array_tell(wstat_p->all);
+    for (i=0; i < len; ++i) {
+	i_p = dyn_array_value(wstat_p->all, struct item *, i);
+	if (i_p != NULL && c_path_len == i_p->fts_pathlen && strcmp(c_path, i_p->fts_path) == 0) {
+	    return i_p;
+	}
+    }
+    return NULL;
+}
+
+
+/*
+ * path_in_walk_array - determine if path is in a dynamic array of struct item pointers of a walk_stat
+ *
+ * This function returns the same struct item as path_in_item_array(item_array, c_path).
+ * When item_array is the all or skip_set dynamic array of wstat_p, or the prune
+ * category from walk_view(), and it has a path index, the index is used instead
+ * of scanning item_array.
+ *
+ * given:
+ *	wstat_p		    - pointer to a struct walk_stat
+ *	item_array	    - dynamic array of pointers to struct item
+ *	c_path		    - canonicalized path to search for in item_array
+ *
+ * returns:
+ *	!= NULL ==> struct item pointer where fts_path matches path
+ *	NULL ==> path not found in item_array
+ *
+ * NOTE: This function does not return on an internal error.
+ */
+struct item *
+path_in_walk_array(struct walk_stat *wstat_p, struct dyn_array *item_array, char const *c_path)
+{
+    struct path_index *index = NULL;	/* path index of item_array or NULL */
+
+    /*
+     * firewall
+     */
+    if (wstat_p == NULL) {
+	err(107, __func__, "wstat_p is NULL");
+	not_reached();
+    }
+    if (item_array == NULL) {
+	err(108, __func__, "item_array is NULL");
+	not_reached();
+    }
+    if (c_path == NULL) {
+	err(109, __func__, "c_path is NULL");
 	not_reached();
     }
 
     /*
-     * if walk_stat check fails, abort
+     * find the index of item_array, if any
+     */
+    if (item_array == wstat_p->all) {
+	index = wstat_p->all_index;
+    } else if (item_array == wstat_p->view[WALK_CAT_PRUNE]) {
+	index = wstat_p->prune_index;
+    } else if (item_array == wstat_p->skip_set) {
+	index = wstat_p->skip_index;
+    }
+
+    /*
+     * use the index, or scan the dynamic array
+     */
+    if (index != NULL) {
+	return path_index_find(index, c_path);
+    }
+    return path_in_item_array(item_array, c_path);
+}
+
+
+/*
+ * path_hash - hash a path for a path index
+ *
+ * This is a 32-bit FNV-1a hash of the path.  When fold is true, ASCII upper
+ * case letters are hashed as if they were lower case, so that paths that are
+ * equal without regard to case (as per strcasecmp(3) in the C locale) have
+ * the same hash.
+ *
+ * given:
+ *	path	    - path to hash
+ *	len	    - length of path
+ *	fold	    - true ==> hash without regard to case
+ *
+ * returns:
+ *	hash of path
+ */
+static uint32_t
+path_hash(char const *path, size_t len, bool fold)
+{
+    uint32_t hash = 2166136261U;    /* FNV-1a 32-bit offset basis */
+    unsigned char c;
+    size_t i;
+
+    for (i=0; i < len; ++i) {
+	c = (unsigned char)path[i];
+	if (fold && c >= 'A' && c <= 'Z') {
+	    c = (unsigned char)(c - 'A' + 'a');
+	}
+	hash = (hash ^ c) * 16777619U;
+    }
+    return hash;
+}
+
+
+/*
+ * path_slot_find - find the path index slot of a path
+ *
+ * given:
+ *	index	    - pointer to a path index
+ *	path	    - path to look for
+ *	len	    - length of path
+ *	hash	    - path_hash() of path
+ *
+ * returns:
+ *	pointer to the slot holding an item with the path, or to the empty slot where it belongs
+ */
+static struct path_slot *
+path_slot_find(struct path_index *index, char const *path, size_t len, uint32_t hash)
+{
+    struct path_slot *slot;	/* slot being probed */
+    size_t i;
+
+    /*
+     * linear probe from the hashed slot
      *
-     * NOTE: Passing this check means that we do not have to do as much checking elsewhere
-     *       in this function.
+     * NOTE: path_index_add() keeps at least half of the slots empty.
      */
-    if (! chk_walk_stat(wstat_p)) {
-	err(103, __func__, "wstat_p failed the chk_walk_stat function test suite");
+    for (i = (size_t)hash & index->mask; ; i = (i+1) & index->mask) {
+	slot = &(index->slot[i]);
+	if (slot->i_p == NULL) {
+	    break;	/* empty slot */
+	}
+	if (slot->hash == hash && slot->i_p->fts_pathlen == len &&
+	    (index->fold ? strcasecmp(slot->i_p->fts_path, path) : strcmp(slot->i_p->fts_path, path)) == 0) {
+	    break;	/* path found */
+	}
+    }
+    return slot;
+}
+
+
+/*
+ * alloc_path_index - allocate an empty path index
+ *
+ * given:
+ *	fold	    - true ==> compare paths without regard to case, false ==> exact compare
+ *
+ * returns:
+ *	pointer to a malloced empty path index
+ *
+ * NOTE: This function does not return on an allocation failure.
+ */
+struct path_index *
+alloc_path_index(bool fold)
+{
+    struct path_index *index;	/* allocated path index */
+
+    errno = 0;			/* pre-clear errno for errp() */
+    index = calloc(1, sizeof(*index));
+    if (index == NULL) {
+	errp(110, __func__, "calloc of struct path_index failed");
 	not_reached();
     }
+    index->fold = fold;
+    index->count = 0;
+    index->mask = PATH_INDEX_MIN_SLOTS - 1;
+    errno = 0;			/* pre-clear errno for errp() */
+    index->slot = calloc(PATH_INDEX_MIN_SLOTS, sizeof(*(index->slot)));
+    if (index->slot == NULL) {
+	errp(111, __func__, "calloc of %d path index slots failed", PATH_INDEX_MIN_SLOTS);
+	not_reached();
+    }
+    return index;
+}
+
+
+/*
+ * free_path_index - free a path index
+ *
+ * The struct items in the index are not freed.
+ *
+ * given:
+ *	index	    - pointer to a path index from alloc_path_index(), or NULL
+ *
+ * NOTE: This function does nothing if index is NULL.
+ */
+void
+free_path_index(struct path_index *index)
+{
+    if (index == NULL) {
+	return;
+    }
+    if (index->slot != NULL) {
+	free(index->slot);
+	index->slot = NULL;
+    }
+    free(index);
+    return;
+}
+
+
+/*
+ * path_index_add - add a struct item to a path index
+ *
+ * If the index already holds an item with the same path, the index is
+ * not changed, so that path_index_find() finds the first item added.
+ *
+ * given:
+ *	index	    - pointer to a path index
+ *	i_p	    - pointer to a struct item with a non-NULL fts_path
+ *
+ * NOTE: This function does not return on an internal error.
+ */
+void
+path_index_add(struct path_index *index, struct item *i_p)
+{
+    struct path_slot *old_slot;	/* slots before growing */
+    struct path_slot *slot;	/* slot for i_p */
+    size_t old_count;		/* number of slots before growing */
+    uint32_t hash;		/* hash of i_p->fts_path */
+    size_t i;
 
     /*
-     * scan the all array
+     * firewall
      */
-    i_p = path_in_item_array(wstat_p->all, c_path);
-    if (i_p != NULL) {
+    if (index == NULL) {
+	err(112, __func__, "index is NULL");
+	not_reached();
+    }
+    if (i_p == NULL || i_p->fts_path == NULL) {
+	err(113, __func__, "i_p or i_p->fts_path is NULL");
+	not_reached();
+    }
 
-	/* report match found */
-	dbg(DBG_V1_HIGH, "%s: c_path found: %s", __func__, c_path);
-	return i_p;
+    /*
+     * keep the first item added for a given path
+     */
+    hash = path_hash(i_p->fts_path, i_p->fts_pathlen, index->fold);
+    slot = path_slot_find(index, i_p->fts_path, i_p->fts_pathlen, hash);
+    if (slot->i_p != NULL) {
+	return;
     }
 
     /*
-     * report no match
+     * grow the table so that at least half of the slots remain empty
      */
-    dbg(DBG_V1_HIGH, "%s: c_path not found: %s", __func__, c_path);
-    return NULL;
+    if ((index->count + 1) * 2 > index->mask + 1) {
+	old_slot = index->slot;
+	old_count = index->mask + 1;
+	errno = 0;			/* pre-clear errno for errp() */
+	index->slot = calloc(old_count * 2, sizeof(*(index->slot)));
+	if (index->slot == NULL) {
+	    errp(114, __func__, "calloc of %zu path index slots failed", old_count * 2);
+	    not_reached();
+	}
+	index->mask = (old_count * 2) - 1;
+	for (i=0; i < old_count; ++i) {
+	    if (old_slot[i].i_p != NULL) {
+		slot = path_slot_find(index, old_slot[i].i_p->fts_path, old_slot[i].i_p->fts_pathlen, old_slot[i].hash);
+		*slot = old_slot[i];
+	    }
+	}
+	free(old_slot);
+	slot = path_slot_find(index, i_p->fts_path, i_p->fts_pathlen, hash);
+    }
+
+    /*
+     * add the item
+     */
+    slot->hash = hash;
+    slot->i_p = i_p;
+    ++index->count;
+    return;
+}
+
+
+/*
+ * path_index_find - find a path in a path index
+ *
+ * given:
+ *	index	    - pointer to a path index
+ *	c_path	    - canonicalized path to search for
+ *
+ * returns:
+ *	!= NULL ==> first struct item added to the index whose fts_path matches c_path
+ *	NULL ==> c_path not found in the index
+ *
+ * NOTE: This function does not return on an internal error.
+ */
+struct item *
+path_index_find(struct path_index *index, char const *c_path)
+{
+    size_t len;		/* length of c_path */
+
+    /*
+     * firewall
+     */
+    if (index == NULL) {
+	err(115, __func__, "index is NULL");
+	not_reached();
+    }
+    if (c_path == NULL) {
+	err(116, __func__, "c_path is NULL");
+	not_reached();
+    }
+
+    len = strlen(c_path);
+    return path_slot_find(index, c_path, len, path_hash(c_path, len, index->fold))->i_p;
+}
+
+
+/*
+ * walk_cat_add - add an item to a walk_stat item category
+ *
+ * The category bit of the item is set and the category count is incremented.
+ * If walk_view() has already materialized the category, the item is also
+ * appended to its dynamic array.
+ *
+ * given:
+ *	wstat_p		    - pointer to a struct walk_stat
+ *	i_p		    - pointer to a struct item on the wstat_p->all dynamic array
+ *	cat		    - item category
+ *
+ * NOTE: This function does not return on an internal error.
+ */
+static void
+walk_cat_add(struct walk_stat *wstat_p, struct item *i_p, enum walk_cat cat)
+{
+    /*
+     * firewall
+     */
+    if (wstat_p == NULL || i_p == NULL) {
+	err(117, __func__, "wstat_p or i_p is NULL");
+	not_reached();
+    }
+    if ((int)cat < 0 || cat >= WALK_CAT_COUNT) {
+	err(118, __func__, "invalid item category: %d", (int)cat);
+	not_reached();
+    }
+
+    /*
+     * record the item category
+     */
+    i_p->category |= WALK_CAT_BIT(cat);
+    ++wstat_p->cat_count[cat];
+    if (wstat_p->view[cat] != NULL) {
+	(void) dyn_array_append_value(wstat_p->view[cat], &i_p);
+    }
+    return;
+}
+
+
+/*
+ * walk_view - return the dynamic array of items of a walk_stat item category
+ *
+ * The dynamic array is materialized, in the order of the wstat_p->all items, on
+ * first use.  Later walk steps append to it, and sort_walk_stat() or sort_walk_istat()
+ * sort it.  The dynamic array belongs to wstat_p and is freed by free_walk_stat().
+ *
+ * given:
+ *	wstat_p		    - pointer to a struct walk_stat
+ *	cat		    - item category
+ *
+ * returns:
+ *	pointer to the dynamic array of struct item pointers of the category
+ *
+ * NOTE: This function does not return on an internal error.
+ */
+struct dyn_array *
+walk_view(struct walk_stat *wstat_p, enum walk_cat cat)
+{
+    struct dyn_array *view;	/* materialized item category */
+    struct item *i_p;		/* pointer to an element in the all dynamic array */
+    uint64_t bit;		/* category bit */
+    intmax_t len;		/* number of elements in the all dynamic array */
+    intmax_t i;
+
+    /*
+     * firewall
+     */
+    if (wstat_p == NULL) {
+	err(119, __func__, "wstat_p is NULL");
+	not_reached();
+    }
+    if ((int)cat < 0 || cat >= WALK_CAT_COUNT) {
+	err(120, __func__, "invalid item category: %d", (int)cat);
+	not_reached();
+    }
+    if (! chk_walk_stat(wstat_p)) {
+	err(121, __func__, "wstat_p failed the chk_walk_stat function test suite");
+	not_reached();
+    }
+
+    /*
+     * materialize the category if needed
+     */
+    if (wstat_p->view[cat] == NULL) {
+	view = dyn_array_create(sizeof(struct item *), DEF_CHUNK,
+				(wstat_p->cat_count[cat] > DEF_CHUNK) ? wstat_p->cat_count[cat] : DEF_CHUNK, true);
+	bit = WALK_CAT_BIT(cat);
+	len = dyn_array_tell(wstat_p->all);
+	for (i=0; i < len; ++i) {
+	    i_p = dyn_array_value(wstat_p->all, struct item *, i);
+	    if (i_p != NULL && (i_p->category & bit) != 0) {
+		(void) dyn_array_append_value(view, &i_p);
+	    }
+	}
+	wstat_p->view[cat] = view;
+    }
+    return wstat_p->view[cat];
+}
+
+
+/*
+ * walk_count - return the number of items in a walk_stat item category
+ *
+ * Unlike dyn_array_tell(walk_view(wstat_p, cat)), this does not materialize the category.
+ *
+ * given:
+ *	wstat_p		    - pointer to a struct walk_stat
+ *	cat		    - item category
+ *
+ * returns:
+ *	number of items in the category
+ *
+ * NOTE: This function does not return on an internal error.
+ */
+intmax_t
+walk_count(struct walk_stat *wstat_p, enum walk_cat cat)
+{
+    /*
+     * firewall
+     */
+    if (wstat_p == NULL) {
+	err(122, __func__, "wstat_p is NULL");
+	not_reached();
+    }
+    if ((int)cat < 0 || cat >= WALK_CAT_COUNT) {
+	err(123, __func__, "invalid item category: %d", (int)cat);
+	not_reached();
+    }
+    return wstat_p->cat_count[cat];
+}
+
+
+/*
+ * walk_cat_name - return the name of a walk_stat item category
+ *
+ * given:
+ *	cat		    - item category
+ *
+ * returns:
+ *	name of the item category, or "((unknown))" if cat is not valid
+ */
+char const *
+walk_cat_name(enum walk_cat cat)
+{
+    static char const * const name[WALK_CAT_COUNT] = {
+	"file", "dir", "symlink",
+	"not_file", "not_dir", "not_symlink",
+	"filedir", "filesym", "dirsym", "filedirsym",
+	"not_filedir", "not_filesym", "not_dirsym", "not_filedirsym",
+	"top", "shallow", "too_deep", "below",
+	"any_level", "unknown_level",
+	"required", "optional",
+	"non_empty", "empty",
+	"free", "counted",
+	"counted_file", "counted_dir", "counted_sym", "counted_other",
+	"ignore", "not_ignore",
+	"prohibit", "not_prohibit",
+	"unmatched",
+	"unsafe", "absolute", "too_long_path", "too_long_name",
+	"fts_err", "safe",
+	"visit", "prune",
+    };
+
+    if ((int)cat < 0 || cat >= WALK_CAT_COUNT) {
+	return "((unknown))";
+    }
+    return name[cat];
 }
 
 
@@ -0,0 +1,637 @@
+/*
+ * bench_canon_path - compare canon_path() with canon_path_r() and canon_path_batch()
+ *
+ * "Because ../a/./b/../c is just a/c the long way around." :-)
+ *
+ * Copyright (c) 2025 by Landon Curt Noll and Cody Boone Ferguson.  All Rights
+ * Reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software and
+ * its documentation for any purpose and without fee is hereby granted,
+ * provided that the above copyright, this permission notice and text
+ * this comment, and the disclaimer below appear in all of the following:
+ *
+ *       supporting documentation
+ *       source copies
+ *       source works derived from this source
+ *       binaries derived from this source or from derived source
+ *
+ * THE AUTHORS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE, INCLUDING
+ * ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHORS BE LIABLE FOR ANY SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES OR ANY
+ * DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ *
+ * Share and enjoy! :-)
+ */
+
+
+/* special comments for the seqcexit tool */
+/* exit code out of numerical order - ignore in sequencing - ooo */
+/* exit code change of order - use new value in sequencing - coo */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <inttypes.h>
+#include <limits.h>
+#include <ctype.h>
+#include <regex.h>
+
+/*
+ * bench_util - common timing, option and report code for the bench_* tools
+ */
+#include "bench_util.h"
+
+/*
+ * cpath - canonicalize paths
+ */
+#include "../cpath/cpath.h"
+
+/*
+ * limit_ioccc - IOCCC size and rule related limitations
+ */
+#include "../soup/limit_ioccc.h"
+
+
+/*
+ * definitions
+ */
+#define BENCH_CANON_PATH_BASENAME "bench_canon_path"
+/**/
+#define DEF_PATHS (100000)	/* default number of synthetic paths to canonicalize */
+#define DEF_ROUNDS (5)		/* default number of times to canonicalize every path */
+#define DEF_SEED (1992)		/* default synthetic path seed */
+#define MAX_COMPONENTS (8)	/* most components of a synthetic path */
+#define MAX_COMPONENT_LEN (80)	/* longest synthetic path component */
+#define BATCH_BUFSIZ (64*1024)	/* canon_path_batch() buffer size */
+#define SAFE_REGEX "^[0-9a-z_][0-9a-z._-]*$"	/* safe component regex of the preg configuration */
+
+
+/*
+ * path components, mixed in with random names, that exercise canon_path()
+ */
+static char const * const component[] = {
+    ".", "..", "", "", "prog.c", "Makefile", "remarks.md", ".info.json", "UPPER.TXT", "MixedCase",
+    "a", "foo", "bar.d", "+plus", "-dash", "with space", "tab\there", "semi;colon", "caf\xc3\xa9",
+    "a_38_character_long_component_name_.txt", "a_39_character_long_component_name_.txt",
+    "a_very_long_component_name_that_is_well_over_any_reasonable_filename_limit",
+};
+
+/*
+ * canon_path() argument configurations
+ */
+struct config {
+    char const *name;			/* configuration name */
+    size_t max_path_len;		/* max canonicalized path length, 0 ==> no limit */
+    size_t max_filename_len;		/* max length of each component of path, 0 ==> no limit */
+    int_least32_t max_depth;		/* max depth of subdirectory path, 0 ==> no limit */
+    bool rel_only;			/* true ==> path from "/" (slash) NOT allowed */
+    bool lower_case;			/* true ==> convert UPPER CASE to lower case */
+    bool safe_chk;			/* true ==> test each canonical path component for safety */
+    bool dotdot_err;			/* true ==> .. (dot-dot) above the start of path is an error */
+    bool use_preg;			/* true ==> safe component check via SAFE_REGEX */
+};
+
+static struct config const config[] = {
+    /* as used by walk_util.c canonicalize_path_r() and entry_util.c test_extra_filename() */
+    { "walk", MAX_PATH_LEN, MAX_FILENAME_LEN, MAX_PATH_DEPTH, true, false, true, true, false },
+    /* as used by the cpath tool without options */
+    { "plain", 0, 0, 0, false, false, false, false, false },
+    /* lower case absolute and relative paths, keeping .. (dot-dot) above the start of path */
+    { "lower", 0, 0, 0, false, true, true, false, false },
+    /* safety via a compiled regular expression */
+    { "regex", 40, 16, 4, false, true, true, false, true },
+};
+
+
+/*
+ * globals
+ */
+static char *program = BENCH_CANON_PATH_BASENAME;	    /* our name */
+
+/*
+ * usage message
+ */
+static char const * const usage_msg =
+    "usage: %s [-h] [-v level] [-V] [-q] [-n paths] [-r rounds] [-s seed] [-f file]\n"
+    "\n"
+    BENCH_USAGE_STD_OPTS
+    "\n"
+    "\t-n paths\tnumber of synthetic paths to canonicalize (def: %d)\n"
+    "\t-r rounds\tnumber of times to canonicalize every path (def: %d)\n"
+    "\t-s seed\t\tseed for the synthetic paths (def: %d)\n"
+    "\t-f file\t\tcanonicalize the paths of file, one per line, instead of synthetic paths\n"
+    "\t\t\t    NOTE: empty lines, and lines that start with #, are ignored\n"
+    "\n"
+    "Exit codes:\n"
+    "     0   all is OK: canon_path(), canon_path_r() and canon_path_batch() agree for every path\n"
+    "     1   canon_path(), canon_path_r() or canon_path_batch() differ\n"
+    BENCH_USAGE_STD_EXIT
+    "\n"
+    "%s version: %s\n";
+
+
+/*
+ * static functions
+ */
+static void usage(int exitcode, char const *str) __attribute__((noreturn));
+static char *bench_path(void);
+static char **read_paths(char const *file, intmax_t *count_p);
+static bool same_result(char const *orig_path, struct config const *conf,
+			char const *path_a, enum path_sanity sanity_a, size_t len_a, int_least32_t depth_a,
+			char const *path_b, enum path_sanity sanity_b, size_t len_b, int_least32_t depth_b,
+			char const *how);
+
+
+int
+main(int argc, char *argv[])
+{
+    extern char *optarg;		/* option argument */
+    extern int optind;			/* argv index of the next arg */
+    intmax_t paths = DEF_PATHS;		/* number of paths */
+    intmax_t rounds = DEF_ROUNDS;	/* number of times to canonicalize every path */
+    unsigned int seed = DEF_SEED;	/* synthetic path seed */
+    char const *file = NULL;		/* != NULL ==> file of paths */
+    bool ok = true;			/* true ==> canon_path(), canon_path_r() and canon_path_batch() agree */
+    char **path = NULL;			/* paths to canonicalize */
+    size_t maxlen = 0;			/* length of the longest path */
+    char *buf = NULL;			/* canon_path_r() buffer */
+    char *batch_buf = NULL;		/* canon_path_batch() buffer */
+    char **batch_cpath = NULL;		/* canon_path_batch() canonical paths */
+    enum path_sanity *batch_sanity = NULL;  /* canon_path_batch() path_sanity errors */
+    size_t *batch_len = NULL;		/* canon_path_batch() canonical path lengths */
+    int_least32_t *batch_depth = NULL;	/* canon_path_batch() canonical depths */
+    regex_t preg;			/* compiled SAFE_REGEX */
+    regex_t const *preg_p;		/* preg or NULL */
+    struct config const *conf;		/* configuration being benchmarked */
+    char *cpath;			/* canon_path() canonical path */
+    char *rpath;			/* canon_path_r() canonical path */
+    enum path_sanity sanity;		/* canon_path() path_sanity error */
+    enum path_sanity r_sanity;		/* canon_path_r() path_sanity error */
+    size_t len;				/* canon_path() canonical path length */
+    size_t r_len;			/* canon_path_r() canonical path length */
+    int_least32_t depth;		/* canon_path() canonical depth */
+    int_least32_t r_depth;		/* canon_path_r() canonical depth */
+    intmax_t canon_ok;			/* number of paths that canonicalized to PATH_OK */
+    size_t done;			/* number of paths processed by canon_path_batch() */
+    size_t sum;				/* sum of canonical path lengths, so canonicalizing is not optimized away */
+    double start;			/* start of a timed loop */
+    double t_canon;			/* seconds for all canon_path() calls */
+    double t_canon_r;			/* seconds for all canon_path_r() calls */
+    double t_batch;			/* seconds for all canon_path_batch() calls */
+    double calls;			/* number of timed paths */
+    size_t c;
+    intmax_t n;
+    intmax_t r;
+    int i;
+
+    /* IOCCC requires use of C locale */
+    set_ioccc_locale();
+
+    /*
+     * parse args
+     */
+    program = argv[0];
+    while ((i = getopt(argc, argv, ":hv:Vqn:r:s:f:")) != -1) {
+	switch (i) {
+	case 'n':
+	    paths = bench_intmax_arg(optarg, 1, INTMAX_MAX, "invalid -n paths", usage);
+	    break;
+	case 'r':
+	    rounds = bench_intmax_arg(optarg, 1, INTMAX_MAX, "invalid -r rounds", usage);
+	    break;
+	case 's':
+	    seed = (unsigned int) bench_intmax_arg(optarg, 0, UINT_MAX, "invalid -s seed", usage);
+	    break;
+	case 'f':
+	    file = optarg;
+	    break;
+	default:    /* -h, -v level, -V, -q and invalid options */
+	    bench_std_opt(i, program, BENCH_CANON_PATH_BASENAME, BENCH_CANON_PATH_VERSION, usage);
+	    break;
+	}
+    }
+    if (argc - optind != 0) {
+	usage(3, "unexpected arguments"); /*ooo*/
+	not_reached();
+    }
+
+    /*
+     * case: canonicalize the paths of file
+     */
+    if (file != NULL) {
+	path = read_paths(file, &paths);
+	if (paths <= 0) {
+	    err(10, __func__, "no paths found in: %s", file);
+	    not_reached();
+	}
+
+    /*
+     * case: form synthetic paths
+     */
+    } else {
+	errno = 0;	/* pre-clear errno for errp() */
+	path = calloc((size_t)paths, sizeof(char *));
+	if (path == NULL) {
+	    errp(11, __func__, "calloc of %jd paths failed", paths);
+	    not_reached();
+	}
+	srandom(seed);
+	for (n = 0; n < paths; ++n) {
+	    path[n] = bench_path();
+	}
+    }
+    for (n = 0; n < paths; ++n) {
+	if (strlen(path[n]) > maxlen) {
+	    maxlen = strlen(path[n]);
+	}
+    }
+
+    /*
+     * allocate the canon_path_r() and canon_path_batch() buffers and results
+     */
+    errno = 0;	/* pre-clear errno for errp() */
+    buf = malloc(maxlen+1);
+    batch_buf = malloc(BATCH_BUFSIZ);
+    batch_cpath = calloc((size_t)paths, sizeof(char *));
+    batch_sanity = calloc((size_t)paths, sizeof(enum path_sanity));
+    batch_len = calloc((size_t)paths, sizeof(size_t));
+    batch_depth = calloc((size_t)paths, sizeof(int_least32_t));
+    if (buf == NULL || batch_buf == NULL || batch_cpath == NULL || batch_sanity == NULL ||
+	batch_len == NULL || batch_depth == NULL) {
+	errp(12, __func__, "malloc of buffers for %jd paths failed", paths);
+	not_reached();
+    }
+
+    /*
+     * compile the safe component regular expression
+     */
+    i = regcomp(&preg, SAFE_REGEX, REG_EXTENDED | REG_NOSUB);
+    if (i != 0) {
+	err(13, __func__, "regcomp of %s failed: %d", SAFE_REGEX, i);
+	not_reached();
+    }
+
+    /*
+     * benchmark each configuration
+     */
+    print("%s: paths: %jd longest: %zu rounds: %jd\n", BENCH_CANON_PATH_BASENAME, paths, maxlen, rounds);
+    calls = (double)paths * (double)rounds;
+    for (c = 0; c < sizeof(config)/sizeof(config[0]); ++c) {
+	conf = &config[c];
+	preg_p = conf->use_preg ? &preg : NULL;
+
+	/*
+	 * check that canon_path() and canon_path_r() agree
+	 */
+	canon_ok = 0;
+	for (n = 0; n < paths; ++n) {
+	    sanity = r_sanity = PATH_ERR_UNSET;
+	    len = r_len = 0;
+	    depth = r_depth = -1;
+	    cpath = canon_path(path[n], conf->max_path_len, conf->max_filename_len, conf->max_depth,
+			       &sanity, &len, &depth, conf->rel_only, conf->lower_case, conf->safe_chk,
+			       conf->dotdot_err, preg_p);
+	    rpath = canon_path_r(path[n], buf, maxlen+1, conf->max_path_len, conf->max_filename_len, conf->max_depth,
+				 &r_sanity, &r_len, &r_depth, conf->rel_only, conf->lower_case, conf->safe_chk,
+				 conf->dotdot_err, preg_p);
+	    if (! same_result(path[n], conf, cpath, sanity, len, depth, rpath, r_sanity, r_len, r_depth, "canon_path_r")) {
+		ok = false;
+	    }
+	    if (sanity == PATH_OK) {
+		++canon_ok;
+	    }
+	    if (cpath != NULL) {
+		free(cpath);
+		cpath = NULL;
+	    }
+	}
+
+	/*
+	 * check that canon_path_r() and canon_path_batch() agree
+	 */
+	for (n = 0; n < paths; n += (intmax_t)done) {
+	    done = canon_path_batch((char const * const *)path+n, (size_t)(paths-n), batch_buf, BATCH_BUFSIZ,
+				    batch_cpath+n, conf->max_path_len, conf->max_filename_len, conf->max_depth,
+				    batch_sanity+n, batch_len+n, batch_depth+n, conf->rel_only, conf->lower_case,
+				    conf->safe_chk, conf->dotdot_err, preg_p);
+	    if (done == 0) {
+		err(14, __func__, "%s: canon_path_batch made no progress at path: %jd", conf->name, n);
+		not_reached();
+	    }
+	    for (r = n; r < n+(intmax_t)done; ++r) {
+		r_sanity = PATH_ERR_UNSET;
+		r_len = 0;
+		r_depth = -1;
+		rpath = canon_path_r(path[r], buf, maxlen+1, conf->max_path_len, conf->max_filename_len, conf->max_depth,
+				     &r_sanity, &r_len, &r_depth, conf->rel_only, conf->lower_case, conf->safe_chk,
+				     conf->dotdot_err, preg_p);
+		if (! same_result(path[r], conf, rpath, r_sanity, r_len, r_depth,
+				  batch_cpath[r], batch_sanity[r], batch_len[r], batch_depth[r], "canon_path_batch")) {
+		    ok = false;
+		}
+	    }
+	}
+
+	/*
+	 * time canon_path()
+	 */
+	sum = 0;
+	start = bench_now();
+	for (r = 0; r < rounds; ++r) {
+	    for (n = 0; n < paths; ++n) {
+		cpath = canon_path(path[n], conf->max_path_len, conf->max_filename_len, conf->max_depth,
+				   NULL, &len, NULL, conf->rel_only, conf->lower_case, conf->safe_chk,
+				   conf->dotdot_err, preg_p);
+		if (cpath != NULL) {
+		    sum += len;
+		    free(cpath);
+		}
+	    }
+	}
+	t_canon = bench_now() - start;
+
+	/*
+	 * time canon_path_r()
+	 */
+	start = bench_now();
+	for (r = 0; r < rounds; ++r) {
+	    for (n = 0; n < paths; ++n) {
+		rpath = canon_path_r(path[n], buf, maxlen+1, conf->max_path_len, conf->max_filename_len, conf->max_depth,
+				     NULL, &r_len, NULL, conf->rel_only, conf->lower_case, conf->safe_chk,
+				     conf->dotdot_err, preg_p);
+		if (rpath != NULL) {
+		    sum -= r_len;
+		}
+	    }
+	}
+	t_canon_r = bench_now() - start;
+	if (sum != 0) {
+	    warn(__func__, "%s: canon_path and canon_path_r canonical path length sums differ", conf->name);
+	    ok = false;
+	}
+
+	/*
+	 * time canon_path_batch()
+	 */
+	start = bench_now();
+	for (r = 0; r < rounds; ++r) {
+	    for (n = 0; n < paths; n += (intmax_t)done) {
+		done = canon_path_batch((char const * const *)path+n, (size_t)(paths-n), batch_buf, BATCH_BUFSIZ,
+					batch_cpath+n, conf->max_path_len, conf->max_filename_len, conf->max_depth,
+					NULL, NULL, NULL, conf->rel_only, conf->lower_case,
+					conf->safe_chk, conf->dotdot_err, preg_p);
+	    }
+	}
+	t_batch = bench_now() - start;
+
+	/*
+	 * report
+	 */
+	print("%s: %s: PATH_OK: %jd canon_path paths/s: %.0f canon_path_r paths/s: %.0f (%.1fx) "
+	      "canon_path_batch paths/s: %.0f (%.1fx)\n",
+	      BENCH_CANON_PATH_BASENAME, conf->name, canon_ok,
+	      bench_ratio(calls, t_canon),
+	      bench_ratio(calls, t_canon_r),
+	      bench_ratio(t_canon, t_canon_r),
+	      bench_ratio(calls, t_batch),
+	      bench_ratio(t_canon, t_batch));
+    }
+
+    /*
+     * free storage
+     */
+    regfree(&preg);
+    for (n = 0; n < paths; ++n) {
+	free(path[n]);
+    }
+    free(path);
+    free(buf);
+    free(batch_buf);
+    free(batch_cpath);
+    free(batch_sanity);
+    free(batch_len);
+    free(batch_depth);
+
+    /*
+     * All Done!!! All Done!!! -- Jessica Noll, Age 2
+     */
+    exit(ok ? 0 : 1); /*ooo*/
+}
+
+
+/*
+ * usage - print usage to stderr
+ *
+ * Example:
+ *      usage(3, "missing required argument(s), run with -h for help");
+ *
+ * given:
+ *	exitcode        value to exit with
+ *	str		top level usage message
+ *
+ * NOTE: We warn with extra newlines to help internal fault messages stand out.
+ *       Normally one should NOT include newlines in warn messages.
+ *
+ * This function does not return.
+ */
+static void
+usage(int exitcode, char const *str)
+{
+    /*
+     * print the formatted usage stream
+     */
+    if (str != NULL && str[0] != '\0') {
+	(void) fprintf(stderr, "%s: %s\n", BENCH_CANON_PATH_BASENAME, str);
+    }
+    fprintf_usage(exitcode, stderr, usage_msg, BENCH_CANON_PATH_BASENAME,
+			    DEF_PATHS, DEF_ROUNDS, DEF_SEED,
+			    BENCH_CANON_PATH_BASENAME, BENCH_CANON_PATH_VERSION);
+    exit(exitcode); /*ooo*/
+    not_reached();
+}
+
+
+/*
+ * bench_path - form a synthetic path
+ *
+ * A path has 1 to MAX_COMPONENTS components, each either one that exercises
+ * canon_path(), such as . (dot), .. (dot-dot), empty, unsafe or too long, or
+ * a random name.  Some paths are absolute, some start with ./ and some end
+ * with a / (slash).
+ *
+ * returns:
+ *	malloced synthetic path
+ *
+ * NOTE: This function does not return on error.
+ */
+static char *
+bench_path(void)
+{
+    char path[MAX_COMPONENTS*(MAX_COMPONENT_LEN+1)+4];	/* synthetic path */
+    char name[32];			/* random name */
+    size_t len = 0;			/* length of path */
+    long r = random();			/* random choices */
+    long comps = 1 + r % MAX_COMPONENTS;	/* number of components */
+    long k;
+    char *ret;
+
+    /*
+     * start the path
+     */
+    switch ((r / MAX_COMPONENTS) % 10) {
+    case 0:
+	path[len++] = '/';
+	break;
+    case 1:
+	path[len++] = '.';
+	path[len++] = '/';
+	break;
+    default:
+	break;
+    }
+
+    /*
+     * add each component
+     */
+    for (k = 0; k < comps; ++k) {
+	r = random();
+	if (k > 0) {
+	    path[len++] = '/';
+	}
+	if (r % 2 == 0) {
+	    len += (size_t)snprintf(path+len, sizeof(path)-len, "%s",
+				    component[(size_t)(r / 2) % (sizeof(component)/sizeof(component[0]))]);
+	} else {
+	    (void) snprintf(name, sizeof(name), "%c%ld%s", (int)(((r / 2) % 2 == 0 ? 'a' : 'A') + (r / 4) % 26),
+			    (r / 128) % 100000, ((r / 16) % 3 == 0) ? ".c" : "");
+	    len += (size_t)snprintf(path+len, sizeof(path)-len, "%s", name);
+	}
+    }
+    if ((random() % 8) == 0) {
+	path[len++] = '/';
+    }
+    path[len] = '\0';
+
+    /*
+     * return a malloced copy
+     */
+    errno = 0;	/* pre-clear errno for errp() */
+    ret = strdup(path);
+    if (ret == NULL) {
+	errp(15, __func__, "strdup of %s failed", path);
+	not_reached();
+    }
+    return ret;
+}
+
+
+/*
+ * read_paths - read the paths of a file, one per line
+ *
+ * Empty lines, and lines that start with #, are ignored.
+ *
+ * given:
+ *	file	    - file to read
+ *	count_p	    - set to the number of paths read
+ *
+ * returns:
+ *	malloced array of malloced paths
+ *
+ * NOTE: This function does not return on error.
+ */
+static char **
+read_paths(char const *file, intmax_t *count_p)
+{
+    FILE *stream;			/* open file */
+    char *line = NULL;			/* line read */
+    size_t linecap = 0;			/* allocated size of line */
+    ssize_t linelen;			/* length of line */
+    char **path = NULL;			/* paths read */
+    intmax_t count = 0;			/* number of paths read */
+    intmax_t alloc = 0;			/* number of allocated paths */
+
+    /*
+     * open the file
+     */
+    errno = 0;	/* pre-clear errno for errp() */
+    stream = fopen(file, "r");
+    if (stream == NULL) {
+	errp(16, __func__, "cannot open: %s", file);
+	not_reached();
+    }
+
+    /*
+     * read each path
+     */
+    while ((linelen = getline(&line, &linecap, stream)) >= 0) {
+	if (linelen > 0 && line[linelen-1] == '\n') {
+	    line[--linelen] = '\0';
+	}
+	if (linelen == 0 || line[0] == '#') {
+	    continue;
+	}
+	if (count >= alloc) {
+	    alloc = (alloc > 0) ? alloc*2 : 1024;
+	    errno = 0;	/* pre-clear errno for errp() */
+	    path = realloc(path, (size_t)alloc * sizeof(char *));
+	    if (path == NULL) {
+		errp(17, __func__, "realloc of %jd paths failed", alloc);
+		not_reached();
+	    }
+	}
+	errno = 0;	/* pre-clear errno for errp() */
+	path[count] = strdup(line);
+	if (path[count] == NULL) {
+	    errp(18, __func__, "strdup of line failed");
+	    not_reached();
+	}
+	++count;
+    }
+    free(line);
+    (void) fclose(stream);
+    *count_p = count;
+    return path;
+}
+
+
+/*
+ * same_result - check that two canonicalizations of a path agree
+ *
+ * given:
+ *	orig_path	- path that was canonicalized
+ *	conf		- configuration used
+ *	path_a		- first canonical path, or NULL
+ *	sanity_a	- first path_sanity error
+ *	len_a		- first canonical path length
+ *	depth_a		- first canonical depth
+ *	path_b		- second canonical path, or NULL
+ *	sanity_b	- second path_sanity error
+ *	len_b		- second canonical path length
+ *	depth_b		- second canonical depth
+ *	how		- name of the function that formed the second canonicalization
+ *
+ * returns:
+ *	true ==> both canonicalizations agree,
+ *	false ==> they differ
+ */
+static bool
+same_result(char const *orig_path, struct config const *conf,
+	    char const *path_a, enum path_sanity sanity_a, size_t len_a, int_least32_t depth_a,
+	    char const *path_b, enum path_sanity sanity_b, size_t len_b, int_least32_t depth_b,
+	    char const *how)
+{
+    if (sanity_a != sanity_b || len_a != len_b || depth_a != depth_b ||
+	(path_a == NULL) != (path_b == NULL) || (path_a != NULL && strcmp(path_a, path_b) != 0)) {
+	warn(__func__, "%s: %s differs for <%s>: %s len: %zu depth: %jd <%s> != %s len: %zu depth: %jd <%s>",
+	     conf->name, how, orig_path,
+	     path_sanity_name(sanity_a), len_a, (intmax_t)depth_a, (path_a == NULL) ? "NULL" : path_a,
+	     path_sanity_name(sanity_b), len_b, (intmax_t)depth_b, (path_b == NULL) ? "NULL" : path_b);
+	return false;
+    }
+    return true;
+}
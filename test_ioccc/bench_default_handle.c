@@ -0,0 +1,280 @@
+/*
+ * bench_default_handle - time default_handle() over international author names
+ *
+ * "Because everyone deserves a handle, and deserves it quickly." :-)
+ *
+ * Copyright (c) 2025 by Landon Curt Noll and Cody Boone Ferguson.  All Rights
+ * Reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software and
+ * its documentation for any purpose and without fee is hereby granted,
+ * provided that the above copyright, this permission notice and text
+ * this comment, and the disclaimer below appear in all of the following:
+ *
+ *       supporting documentation
+ *       source copies
+ *       source works derived from this source
+ *       binaries derived from this source or from derived source
+ *
+ * THE AUTHORS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE, INCLUDING
+ * ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHORS BE LIABLE FOR ANY SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES OR ANY
+ * DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ *
+ * Share and enjoy! :-)
+ */
+
+
+/* special comments for the seqcexit tool */
+/* exit code out of numerical order - ignore in sequencing - ooo */
+/* exit code change of order - use new value in sequencing - coo */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <inttypes.h>
+
+/*
+ * bench_util - common timing, option and report code for the bench_* tools
+ */
+#include "bench_util.h"
+
+/*
+ * default_handle - translate UTF-8 into POSIX portable handle
+ */
+#include "../soup/default_handle.h"
+
+
+/*
+ * definitions
+ */
+#define BENCH_DEFAULT_HANDLE_BASENAME "bench_default_handle"
+/**/
+#define DEF_ROUNDS (200)	/* default number of times to translate the whole corpus */
+#define BENCH_NAME_LEN (256)	/* longest corpus name */
+
+/*
+ * FNV-1a hash of every default handle of the corpus, in corpus order, as
+ * computed by the default_handle() that scanned all of hmap[] at every byte
+ */
+#define EXPECTED_HASH (UINT32_C(0x7afa2d69))
+
+
+/*
+ * corpus of international given and family names
+ *
+ * Every given name is paired with every family name.  Some names use
+ * characters that are not in hmap[] (and so are ignored), some characters
+ * that map to _ (underscore) and some that map to the empty string.
+ */
+static char const * const given[] = {
+    "Zo\xc3\xab", "J\xc3\xbcrgen", "\xc3\x85sa", "S\xc3\xb8ren", "\xc5\x81ukasz",
+    "Fran\xc3\xa7ois", "Ren\xc3\xa9""e", "Bj\xc3\xb6rk", "\xc3\x89milie", "Jos\xc3\xa9",
+    "Mar\xc3\xad""a Jos\xc3\xa9", "\xc3\x9eorsteinn", "\xc3\x90\xc3\xb3ra", "\xc4\x8c""estm\xc3\xadr",
+    "\xc5\xa0imon", "\xc3\x87""a\xc4\x9flar", "\xc4\xb0lker", "\xce\x95\xce\xbb\xce\xad\xce\xbd\xce\xb7",
+    "\xd0\x94\xd0\xbc\xd0\xb8\xd1\x82\xd1\x80\xd0\xb8\xd0\xb9", "\xd5\x80\xd5\xa1\xd5\xb5\xd5\xaf",
+    "\xe6\x9d\x8e", "Nguy\xe1\xbb\x85n", "O'Brien", "Jean-Luc", "Anne_Marie",
+    "chongo", "Dr. Who?", "  Mary  Ann  ", "\xe2\x80\x94 Zed \xe2\x80\x94", "Ol\xc3\xa1h",
+};
+static char const * const family[] = {
+    "\xc3\x85ngstr\xc3\xb6m", "M\xc3\xbcller", "Kierkegaard", "\xc5\xbb\xc3\xb3\xc5\x82kiewski",
+    "Gu\xc3\xb0mundsd\xc3\xb3ttir", "Dvo\xc5\x99\xc3\xa1k", "\xc5\x9e""ahin", "Garc\xc3\xad""a M\xc3\xa1rquez",
+    "\xce\xa0\xce\xb1\xcf\x80\xce\xb1\xce\xb4\xce\xbf\xcf\x80\xce\xbf\xcf\x8d\xce\xbb\xce\xbf\xcf\x85",
+    "\xd0\xa8\xd0\xbe\xd1\x81\xd1\x82\xd0\xb0\xd0\xba\xd0\xbe\xd0\xb2\xd0\xb8\xd1\x87",
+    "\xd4\xbd\xd5\xa1\xd5\xb9\xd5\xa1\xd5\xbf\xd6\x80\xd5\xb5\xd5\xa1\xd5\xb6", "\xe5\xb0\x8f\xe9\xbe\x8d",
+    "V\xc4\x83n A", "de la Cr\xc3\xba""a", "van der Berg", "O'Connor-Smith", "Noll",
+    "\xc3\x98stergaard", "\xc3\x9f""e\xc3\x9f", "Le\xc3\xb3n", "\xc5\x92uvre", "N\xc3\xba\xc3\xb1""ez",
+    "\xe2\x84\xa2 Corp.", "", "Hern\xc3\xa1ndez", "\xc3\x9flu\xc3\x9f", "Fa\xc3\xa7""ade", "\xd0\xae\xd1\x80\xd0\xb8\xd0\xb9",
+    "\xc4\x90\xe1\xbb\x97", "Sm\xc3\xa1ri",
+};
+
+
+/*
+ * globals
+ */
+static char *program = BENCH_DEFAULT_HANDLE_BASENAME;	    /* our name */
+
+/*
+ * usage message
+ */
+static char const * const usage_msg =
+    "usage: %s [-h] [-v level] [-V] [-q] [-r rounds]\n"
+    "\n"
+    BENCH_USAGE_STD_OPTS
+    "\n"
+    "\t-r rounds\tnumber of times to translate the whole corpus (def: %d)\n"
+    "\n"
+    "Exit codes:\n"
+    "     0   all is OK: the default handles of the corpus are as expected\n"
+    "     1   the default handles of the corpus differ from what is expected\n"
+    BENCH_USAGE_STD_EXIT
+    "\n"
+    "%s version: %s\n";
+
+
+/*
+ * static functions
+ */
+static void usage(int exitcode, char const *str) __attribute__((noreturn));
+static uint32_t hash_str(uint32_t hash, char const *str);
+
+
+int
+main(int argc, char *argv[])
+{
+    extern char *optarg;		/* option argument */
+    extern int optind;			/* argv index of the next arg */
+    intmax_t rounds = DEF_ROUNDS;	/* number of times to translate the corpus */
+    bool ok = true;			/* true ==> default handles are as expected */
+    char name[BENCH_NAME_LEN+1];	/* corpus name */
+    char *handle;			/* default handle of name */
+    uint32_t hash;			/* FNV-1a hash of the default handles */
+    intmax_t names = 0;			/* number of names translated */
+    intmax_t bytes = 0;			/* number of name bytes translated */
+    double start;			/* start of the timed loop */
+    double t_handle;			/* seconds for all default_handle() calls */
+    size_t g;
+    size_t f;
+    intmax_t r;
+    int i;
+
+    /* IOCCC requires use of C locale */
+    set_ioccc_locale();
+
+    /*
+     * parse args
+     */
+    program = argv[0];
+    while ((i = getopt(argc, argv, ":hv:Vqr:")) != -1) {
+	switch (i) {
+	case 'r':
+	    rounds = bench_intmax_arg(optarg, 1, INTMAX_MAX, "invalid -r rounds", usage);
+	    break;
+	default:    /* -h, -v level, -V, -q and invalid options */
+	    bench_std_opt(i, program, BENCH_DEFAULT_HANDLE_BASENAME, BENCH_DEFAULT_HANDLE_VERSION, usage);
+	    break;
+	}
+    }
+    if (argc - optind != 0) {
+	usage(3, "unexpected arguments"); /*ooo*/
+	not_reached();
+    }
+
+    /*
+     * check the default handle of every corpus name
+     *
+     * NOTE: A name that translates to nothing gets a random handle, so such
+     *	     handles are not hashed.
+     */
+    hash = UINT32_C(2166136261);
+    for (g = 0; g < TBLLEN(given); ++g) {
+	for (f = 0; f < TBLLEN(family); ++f) {
+	    (void) snprintf(name, sizeof(name), "%s %s", given[g], family[f]);
+	    handle = default_handle(name);
+	    if (handle == NULL) {
+		err(10, __func__, "default_handle returned NULL for: %s", name);
+		not_reached();
+	    }
+	    dbg(DBG_LOW, "<%s> ==> <%s>", name, handle);
+	    if (strncmp(handle, "jrandom+", LITLEN("jrandom+")) != 0) {
+		hash = hash_str(hash, handle);
+	    }
+	    free(handle);
+	    handle = NULL;
+	}
+    }
+    if (hash != EXPECTED_HASH) {
+	warn(__func__, "default handle hash: 0x%08x != expected: 0x%08x", hash, EXPECTED_HASH);
+	ok = false;
+    }
+
+    /*
+     * time default_handle() over the corpus
+     */
+    start = bench_now();
+    for (r = 0; r < rounds; ++r) {
+	for (g = 0; g < TBLLEN(given); ++g) {
+	    for (f = 0; f < TBLLEN(family); ++f) {
+		(void) snprintf(name, sizeof(name), "%s %s", given[g], family[f]);
+		handle = default_handle(name);
+		bytes += (intmax_t)strlen(name);
+		++names;
+		free(handle);
+		handle = NULL;
+	    }
+	}
+    }
+    t_handle = bench_now() - start;
+
+    /*
+     * report
+     */
+    print("%s: names: %jd name bytes: %jd seconds: %.3f\n",
+	  BENCH_DEFAULT_HANDLE_BASENAME, names, bytes, t_handle);
+    print("%s: ns/name: %.1f ns/byte: %.2f handle hash: 0x%08x %s\n",
+	  BENCH_DEFAULT_HANDLE_BASENAME,
+	  bench_ns_per(t_handle, (double)names),
+	  bench_ns_per(t_handle, (double)bytes),
+	  hash, ok ? "OK" : "DIFFERS");
+
+    /*
+     * All Done!!! All Done!!! -- Jessica Noll, Age 2
+     */
+    exit(ok ? 0 : 1); /*ooo*/
+}
+
+
+/*
+ * usage - print usage to stderr
+ *
+ * Example:
+ *      usage(3, "missing required argument(s), run with -h for help");
+ *
+ * given:
+ *	exitcode        value to exit with
+ *	str		top level usage message
+ *
+ * NOTE: We warn with extra newlines to help internal fault messages stand out.
+ *       Normally one should NOT include newlines in warn messages.
+ *
+ * This function does not return.
+ */
+static void
+usage(int exitcode, char const *str)
+{
+    /*
+     * print the formatted usage stream
+     */
+    if (str != NULL && str[0] != '\0') {
+	(void) fprintf(stderr, "%s: %s\n", BENCH_DEFAULT_HANDLE_BASENAME, str);
+    }
+    fprintf_usage(exitcode, stderr, usage_msg, BENCH_DEFAULT_HANDLE_BASENAME, DEF_ROUNDS,
+			    BENCH_DEFAULT_HANDLE_BASENAME, BENCH_DEFAULT_HANDLE_VERSION);
+    exit(exitcode); /*ooo*/
+    not_reached();
+}
+
+
+/*
+ * hash_str - add a string, and its terminating NUL byte, to an FNV-1a hash
+ *
+ * given:
+ *	hash	    - FNV-1a hash so far
+ *	str	    - string to add to the hash
+ *
+ * returns:
+ *	FNV-1a hash including str
+ */
+static uint32_t
+hash_str(uint32_t hash, char const *str)
+{
+    do {
+	hash ^= (uint32_t)(unsigned char)*str;
+	hash *= UINT32_C(16777619);
+    } while (*str++ != '\0');
+    return hash;
+}
@@ -0,0 +1,671 @@
+/*
+ * bench_rule_count - compare the rule_count_stream() and rule_count_buf() engines
+ *		      and the linear scan and c_reserved() keyword lookups
+ *
+ * "Because every byte counts, and so does every nanosecond." :-)
+ *
+ * Copyright (c) 2025 by Landon Curt Noll and Cody Boone Ferguson.  All Rights
+ * Reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software and
+ * its documentation for any purpose and without fee is hereby granted,
+ * provided that the above copyright, this permission notice and text
+ * this comment, and the disclaimer below appear in all of the following:
+ *
+ *       supporting documentation
+ *       source copies
+ *       source works derived from this source
+ *       binaries derived from this source or from derived source
+ *
+ * THE AUTHORS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE, INCLUDING
+ * ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHORS BE LIABLE FOR ANY SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES OR ANY
+ * DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ *
+ * Share and enjoy! :-)
+ */
+
+
+/* special comments for the seqcexit tool */
+/* exit code out of numerical order - ignore in sequencing - ooo */
+/* exit code change of order - use new value in sequencing - coo */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <inttypes.h>
+#include <limits.h>
+#include <ctype.h>
+
+/*
+ * bench_util - common timing, option and report code for the bench_* tools
+ */
+#include "bench_util.h"
+
+/*
+ * iocccsize - IOCCC Source Size Tool
+ */
+#include "../iocccsize.h"
+
+/*
+ * c_reserved - C reserved words, plus a few #preprocessor tokens
+ */
+#include "../jparse/c_reserved.h"
+
+
+/*
+ * definitions
+ */
+#define BENCH_RULE_COUNT_BASENAME "bench_rule_count"
+/**/
+#define DEF_MEGABYTES (8)	/* default synthetic input size in MiB */
+#define DEF_ROUNDS (3)		/* default timing rounds per engine */
+#define DEF_SEED (1992)		/* default synthetic input seed */
+#define DEF_FUZZ (20000)	/* default number of differential fuzz buffers */
+#define FUZZ_MAX_LEN (256)	/* longest differential fuzz buffer */
+#define MODE_COUNT (RULE_COUNT_FAST_AVX2+1)	/* number of rule_count_buf_mode() modes */
+
+
+/*
+ * globals
+ */
+static char *program = BENCH_RULE_COUNT_BASENAME;	    /* our name */
+
+/*
+ * fragments of C-like source used to build the synthetic input
+ *
+ * The fragments deliberately exercise keywords, comments, strings,
+ * character constants, CR/CRLF line endings, backslash newlines,
+ * '{', ';' and '}' before whitespace and the occasional high-bit byte.
+ */
+static char const * const fragments[] = {
+    "int main(int argc, char **argv)\n{\n",
+    "    return 0;\n}\n",
+    "#" "include <stdio.h>\n",	/* split so that hostchk.sh does not see an include */
+    "# define X(a) ((a)+1)\n",
+    "#if defined(FOO)\n#elif BAR\n#else\n#endif\n",
+    "/* block comment with int and return inside */\n",
+    "// end of line comment: while (1) { }\n",
+    "char *s = \"string with \\\"escaped\\\" quote and /* no comment */\";\n",
+    "char c = '\\'';\n",
+    "static unsigned long long x_identifier_that_is_rather_long = 42;\r\n",
+    "for (i=0; i < n; ++i) { sum += a[i]; }\r\n",
+    "typedef struct { _Bool b; _Atomic int a; } foo_t;\n",
+    "#define LONG_MACRO(x) \\\n    do { x; } while (0)\n",
+    "if(a){b;}else{c;}\n",
+    "x = y ? z : w;\t\t\n",
+    "\xc3\xa9t\xc3\xa9 = 1;\n",
+    "  \n\n\r\r\n",
+    "sizeof(int) + alignof(long) + _Alignof(char);\n",
+};
+#define FRAGMENT_COUNT (sizeof(fragments)/sizeof(fragments[0]))
+
+/*
+ * rule_count_buf_mode() mode names
+ */
+static char const * const mode_name[MODE_COUNT] = {
+    "none",
+    "scalar",
+    "sse2",
+    "avx2",
+};
+
+/*
+ * reference list of C reserved words for the linear scan keyword lookup
+ *
+ * This is the list that rule_count() used to scan with strcmp() for every
+ * word before c_reserved() was introduced.  It serves as the "before"
+ * case of the keyword lookup benchmark and as an oracle for c_reserved().
+ */
+static char const * const linear_words[] = {
+    "#elif", "#elifdef", "#elifndef", "#else", "#embed", "#endif", "#error",
+    "#ident", "#if", "#ifdef", "#ifndef", "#include", "#line", "#pragma",
+    "#sccs", "#undef", "#warning", "_Alignas", "_Alignof", "_Atomic",
+    "_BitInt", "_Bool", "_Complex", "_Decimal128", "_Decimal32", "_Decimal64",
+    "_Generic", "_Imaginary", "_Noreturn", "_Pragma", "_Static_assert",
+    "_Thread_local", "alignas", "alignof", "and", "and_eq", "auto", "bitand",
+    "bitor", "bool", "break", "case", "char", "compl", "const", "constexpr",
+    "continue", "default", "do", "double", "else", "enum", "extern", "false",
+    "float", "for", "goto", "if", "inline", "int", "long", "noreturn", "not",
+    "not_eq", "nullptr", "or", "or_eq", "register", "restrict", "return",
+    "short", "signed", "sizeof", "static", "static_assert", "struct",
+    "switch", "thread_local", "true", "typedef", "typeof", "typeof_unequal",
+    "union", "unsigned", "void", "volatile", "while", "xor", "xor_eq",
+    NULL
+};
+
+/*
+ * usage message
+ */
+static char const * const usage_msg =
+    "usage: %s [-h] [-v level] [-V] [-q] [-m MiB] [-r rounds] [-s seed] [-f count] [file ...]\n"
+    "\n"
+    BENCH_USAGE_STD_OPTS
+    "\n"
+    "\t-m MiB\t\tsize of the synthetic input in MiB (def: %d)\n"
+    "\t-r rounds\ttiming rounds per engine (def: %d)\n"
+    "\t-s seed\t\tseed for the synthetic input and fuzz test (def: %d)\n"
+    "\t-f count\tnumber of differential fuzz test buffers, 0 ==> no fuzz test (def: %d)\n"
+    "\n"
+    "\tfile ...\tbenchmark these files instead of a synthetic input\n"
+    "\n"
+    "Exit codes:\n"
+    "     0   all is OK: both engines produced identical RuleCount results\n"
+    "     1   rule_count engine results differ, or c_reserved() is wrong\n"
+    BENCH_USAGE_STD_EXIT
+    "\n"
+    "%s version: %s\n";
+
+
+/*
+ * static functions
+ */
+static void usage(int exitcode, char const *str) __attribute__((noreturn));
+static bool same_count(RuleCount *a, RuleCount *b);
+static bool bench(char const *name, char *buf, size_t len, int rounds);
+static bool fuzz(long iterations, unsigned int seed);
+static bool linear_reserved(char const *string);
+static bool bench_keywords(char const *name, char *buf, size_t len, int rounds);
+
+
+int
+main(int argc, char *argv[])
+{
+    extern char *optarg;		/* option argument */
+    extern int optind;			/* argv index of the next arg */
+    size_t megabytes = DEF_MEGABYTES;	/* synthetic input size in MiB */
+    int rounds = DEF_ROUNDS;		/* timing rounds per engine */
+    unsigned int seed = DEF_SEED;	/* synthetic input seed */
+    long fuzz_count = DEF_FUZZ;		/* number of differential fuzz buffers */
+    bool ok = true;			/* true ==> all engines agree */
+    char *buf = NULL;			/* input to count */
+    size_t len = 0;			/* length of buf */
+    size_t frag_len;			/* length of a fragment */
+    int i;
+
+    /* IOCCC requires use of C locale */
+    set_ioccc_locale();
+
+    /*
+     * parse args
+     */
+    program = argv[0];
+    while ((i = getopt(argc, argv, ":hv:Vqm:r:s:f:")) != -1) {
+	switch (i) {
+	case 'm':
+	    megabytes = (size_t) bench_intmax_arg(optarg, 1, INTMAX_MAX / (1024 * 1024) - 1, "invalid -m MiB", usage);
+	    break;
+	case 'r':
+	    rounds = (int) bench_intmax_arg(optarg, 1, INT_MAX, "invalid -r rounds", usage);
+	    break;
+	case 's':
+	    seed = (unsigned int) bench_intmax_arg(optarg, 0, UINT_MAX, "invalid -s seed", usage);
+	    break;
+	case 'f':
+	    fuzz_count = (long) bench_intmax_arg(optarg, 0, LONG_MAX, "invalid -f count", usage);
+	    break;
+	default:    /* -h, -v level, -V, -q and invalid options */
+	    bench_std_opt(i, program, BENCH_RULE_COUNT_BASENAME, BENCH_RULE_COUNT_VERSION, usage);
+	    break;
+	}
+    }
+    argc -= optind;
+    argv += optind;
+
+    /*
+     * differential fuzz test of the bulk classifiers
+     */
+    if (fuzz_count > 0 && !fuzz(fuzz_count, seed)) {
+	ok = false;
+    }
+
+    /*
+     * case: benchmark the given files
+     */
+    if (argc > 0) {
+	for (i = 0; i < argc; ++i) {
+	    FILE *stream;
+
+	    errno = 0;		/* pre-clear errno for errp() */
+	    stream = fopen(argv[i], "r");
+	    if (stream == NULL) {
+		errp(10, __func__, "cannot open: %s", argv[i]);
+		not_reached();
+	    }
+	    buf = read_all(stream, &len);
+	    if (buf == NULL) {
+		err(11, __func__, "read_all failed for: %s", argv[i]);
+		not_reached();
+	    }
+	    (void) fclose(stream);
+	    if (!bench(argv[i], buf, len, rounds)) {
+		ok = false;
+	    }
+	    free(buf);
+	    buf = NULL;
+	}
+
+    /*
+     * case: benchmark a synthetic input
+     */
+    } else {
+	size_t size = megabytes * 1024 * 1024;
+
+	buf = malloc(size + 1);
+	if (buf == NULL) {
+	    errp(12, __func__, "cannot malloc %zu bytes", size + 1);
+	    not_reached();
+	}
+	srandom(seed);
+	while (len < size) {
+	    char const *frag = fragments[(size_t)random() % FRAGMENT_COUNT];
+
+	    frag_len = strlen(frag);
+	    if (len + frag_len > size) {
+		frag_len = size - len;
+	    }
+	    memcpy(buf + len, frag, frag_len);
+	    len += frag_len;
+	}
+	buf[len] = '\0';
+	if (!bench("synthetic", buf, len, rounds)) {
+	    ok = false;
+	}
+	free(buf);
+	buf = NULL;
+    }
+
+    /*
+     * All Done!!! All Done!!! -- Jessica Noll, Age 2
+     */
+    exit(ok ? 0 : 1); /*ooo*/
+}
+
+
+/*
+ * usage - print usage to stderr
+ *
+ * Example:
+ *      usage(3, "missing required argument(s), run with -h for help");
+ *
+ * given:
+ *	exitcode        value to exit with
+ *	str		top level usage message
+ *
+ * NOTE: We warn with extra newlines to help internal fault messages stand out.
+ *       Normally one should NOT include newlines in warn messages.
+ *
+ * This function does not return.
+ */
+static void
+usage(int exitcode, char const *str)
+{
+    /*
+     * print the formatted usage stream
+     */
+    if (str != NULL && str[0] != '\0') {
+	(void) fprintf(stderr, "%s: %s\n", BENCH_RULE_COUNT_BASENAME, str);
+    }
+    fprintf_usage(exitcode, stderr, usage_msg, BENCH_RULE_COUNT_BASENAME,
+			    DEF_MEGABYTES, DEF_ROUNDS, DEF_SEED, DEF_FUZZ,
+			    BENCH_RULE_COUNT_BASENAME, BENCH_RULE_COUNT_VERSION);
+    exit(exitcode); /*ooo*/
+    not_reached();
+}
+
+
+/*
+ * same_count - determine if two RuleCount results are identical
+ *
+ * given:
+ *	a	pointer to first RuleCount
+ *	b	pointer to second RuleCount
+ *
+ * returns:
+ *	true ==> every RuleCount field matches
+ *	false ==> some RuleCount field differs
+ */
+static bool
+same_count(RuleCount *a, RuleCount *b)
+{
+    return a->rule_2a_size == b->rule_2a_size &&
+	   a->rule_2b_size == b->rule_2b_size &&
+	   a->keywords == b->keywords &&
+	   a->char_warning == b->char_warning &&
+	   a->nul_warning == b->nul_warning &&
+	   a->trigraph_warning == b->trigraph_warning &&
+	   a->wordbuf_warning == b->wordbuf_warning &&
+	   a->ungetc_warning == b->ungetc_warning;
+}
+
+
+/*
+ * bench - time rule_count_stream() against rule_count_buf_mode() on a buffer
+ *
+ * The rule_count_stream() engine reads the buffer via a temporary file,
+ * the rule_count_buf_mode() engine counts the buffer in place with each
+ * of the bulk classifier modes.
+ *
+ * given:
+ *	name	name of the input for reporting
+ *	buf	input to count
+ *	len	length of buf
+ *	rounds	number of timing rounds per engine
+ *
+ * returns:
+ *	true ==> all engines produced identical RuleCount results
+ *	false ==> engines disagree
+ */
+static bool
+bench(char const *name, char *buf, size_t len, int rounds)
+{
+    FILE *tmp;			/* temporary file holding buf */
+    RuleCount stream_count;	/* rule_count_stream() results */
+    RuleCount buf_count[MODE_COUNT];	/* rule_count_buf_mode() results by mode */
+    double start;		/* start of timing */
+    double stream_time = 0.0;	/* best rule_count_stream() time */
+    double buf_time[MODE_COUNT];	/* best rule_count_buf_mode() time by mode */
+    double t;			/* time of a round */
+    double mib = (double)len / (1024.0 * 1024.0);
+    bool ok = true;		/* true ==> all engines agree */
+    int mode;
+    int r;
+
+    /*
+     * firewall
+     */
+    if (name == NULL || buf == NULL) {
+	err(13, __func__, "called with NULL arg(s)");
+	not_reached();
+    }
+
+    errno = 0;		/* pre-clear errno for errp() */
+    tmp = tmpfile();
+    if (tmp == NULL) {
+	errp(14, __func__, "tmpfile failed");
+	not_reached();
+    }
+    if (fwrite(buf, 1, len, tmp) != len || fflush(tmp) != 0) {
+	errp(15, __func__, "cannot write %zu bytes to tmpfile", len);
+	not_reached();
+    }
+
+    memset(&stream_count, 0, sizeof(stream_count));
+    memset(buf_count, 0, sizeof(buf_count));
+    memset(buf_time, 0, sizeof(buf_time));
+    for (r = 0; r < rounds; ++r) {
+	rewind(tmp);
+	start = bench_now();
+	stream_count = rule_count_stream(tmp);
+	t = bench_now() - start;
+	if (r == 0 || t < stream_time) {
+	    stream_time = t;
+	}
+
+	for (mode = 0; mode < MODE_COUNT; ++mode) {
+	    start = bench_now();
+	    buf_count[mode] = rule_count_buf_mode(buf, len, mode);
+	    t = bench_now() - start;
+	    if (r == 0 || t < buf_time[mode]) {
+		buf_time[mode] = t;
+	    }
+	}
+    }
+    (void) fclose(tmp);
+
+    print("%s: %zu bytes: rule_count_stream:    %.6f sec %.2f MiB/s: 2b %zu 2a %zu keywords %zu\n",
+	  name, len, stream_time, bench_ratio(mib, stream_time),
+	  stream_count.rule_2b_size, stream_count.rule_2a_size, stream_count.keywords);
+    for (mode = 0; mode < MODE_COUNT; ++mode) {
+	print("%s: %zu bytes: rule_count_buf %-6s: %.6f sec %.2f MiB/s: 2b %zu 2a %zu keywords %zu\n",
+	      name, len, mode_name[mode], buf_time[mode], bench_ratio(mib, buf_time[mode]),
+	      buf_count[mode].rule_2b_size, buf_count[mode].rule_2a_size, buf_count[mode].keywords);
+	if (!same_count(&stream_count, &buf_count[mode])) {
+	    warn(__func__, "%s: rule_count_stream and rule_count_buf %s results differ", name, mode_name[mode]);
+	    ok = false;
+	}
+    }
+    if (!ok) {
+	return false;
+    }
+    return bench_keywords(name, buf, len, rounds);
+}
+
+
+/*
+ * fuzz - differential fuzz test of the bulk classifiers against the state machine
+ *
+ * Random buffers are drawn from an alphabet that is dense in the bytes that
+ * matter to rule_count(): comment and string delimiters, escapes, CR, NUL,
+ * whitespace, '{', ';', '}', keyword letters and a non-ASCII byte.  Buffers
+ * are long enough to exercise the full SIMD blocks as well as their tails.
+ * Every bulk classifier mode must produce the same RuleCount as
+ * RULE_COUNT_FAST_NONE, and every 64th buffer is also checked against
+ * rule_count_stream().
+ *
+ * given:
+ *	iterations	number of random buffers to try
+ *	seed		random seed
+ *
+ * returns:
+ *	true ==> all engines agree on every buffer
+ *	false ==> some engine disagrees
+ */
+static bool
+fuzz(long iterations, unsigned int seed)
+{
+    static char const alphabet[] =
+	"  \t\n\n\v\f\r\\{;};;{}//**\"\"''?\?=<:%>#_intforwhile09xyzZ(),+-\xe9";
+    char buf[FUZZ_MAX_LEN];	/* random buffer */
+    RuleCount none;		/* RULE_COUNT_FAST_NONE results */
+    RuleCount other;		/* results of another engine */
+    FILE *tmp;			/* temporary file holding buf */
+    size_t len;
+    size_t j;
+    long it;
+    int mode;
+
+    srandom(seed);
+    for (it = 0; it < iterations; ++it) {
+	len = (size_t)random() % sizeof(buf);
+	for (j = 0; j < len; ++j) {
+	    /* mostly plain runs with the occasional interesting byte */
+	    if (random() % 4 == 0) {
+		buf[j] = alphabet[(size_t)random() % (sizeof(alphabet) - 1)];
+	    } else {
+		buf[j] = " a=(+)\t{;}*\n"[random() % 13];
+	    }
+	}
+	/* sometimes embed a NUL */
+	if (len > 0 && random() % 16 == 0) {
+	    buf[(size_t)random() % len] = '\0';
+	}
+
+	none = rule_count_buf_mode(buf, len, RULE_COUNT_FAST_NONE);
+	for (mode = RULE_COUNT_FAST_SCALAR; mode < MODE_COUNT; ++mode) {
+	    other = rule_count_buf_mode(buf, len, mode);
+	    if (!same_count(&none, &other)) {
+		warn(__func__, "iteration %ld: rule_count_buf %s differs from %s: 2b %zu != %zu 2a %zu != %zu",
+		     it, mode_name[mode], mode_name[RULE_COUNT_FAST_NONE],
+		     other.rule_2b_size, none.rule_2b_size, other.rule_2a_size, none.rule_2a_size);
+		return false;
+	    }
+	}
+
+	if (it % 64 == 0) {
+	    errno = 0;		/* pre-clear errno for errp() */
+	    tmp = tmpfile();
+	    if (tmp == NULL) {
+		errp(17, __func__, "tmpfile failed");
+		not_reached();
+	    }
+	    if (fwrite(buf, 1, len, tmp) != len || fflush(tmp) != 0) {
+		errp(18, __func__, "cannot write %zu bytes to tmpfile", len);
+		not_reached();
+	    }
+	    rewind(tmp);
+	    other = rule_count_stream(tmp);
+	    (void) fclose(tmp);
+	    if (!same_count(&none, &other)) {
+		warn(__func__, "iteration %ld: rule_count_stream differs from rule_count_buf %s",
+		     it, mode_name[RULE_COUNT_FAST_NONE]);
+		return false;
+	    }
+	}
+    }
+    print("fuzz: %ld random buffers: all rule_count engines agree\n", iterations);
+    return true;
+}
+
+
+/*
+ * linear_reserved - find a word in linear_words[] with a linear strcmp() scan
+ *
+ * given:
+ *	string	word to look for
+ *
+ * returns:
+ *	true ==> string is in linear_words[]
+ *	false ==> string is not in linear_words[]
+ */
+static bool
+linear_reserved(char const *string)
+{
+    char const * const *w;
+
+    for (w = linear_words; *w != NULL; ++w) {
+	if (strcmp(string, *w) == 0) {
+	    return true;
+	}
+    }
+    return false;
+}
+
+
+/*
+ * bench_keywords - time keyword lookup by linear scan against c_reserved()
+ *
+ * The buffer is split into words the way rule_count() collects them
+ * (runs of alphanumerics, '_' and '#') and each word is classified with both
+ * a linear_words[] scan and c_reserved().  Both must agree on every word.
+ *
+ * given:
+ *	name	name of the input for reporting
+ *	buf	input to tokenize
+ *	len	length of buf
+ *	rounds	number of timing rounds per lookup method
+ *
+ * returns:
+ *	true ==> linear scan and c_reserved() agree on every word
+ *	false ==> some word was classified differently
+ */
+static bool
+bench_keywords(char const *name, char *buf, size_t len, int rounds)
+{
+    char word[WORD_BUFFER_SIZE];	/* current word */
+    size_t wordi;			/* length of word */
+    size_t tokens;			/* words looked up per round */
+    size_t linear_found;		/* reserved words found by linear scan */
+    size_t hash_found;			/* reserved words found by c_reserved() */
+    double start;			/* start of timing */
+    double linear_time = 0.0;		/* best linear scan time */
+    double hash_time = 0.0;		/* best c_reserved() time */
+    double t;				/* time of a round */
+    bool linear;			/* linear scan result */
+    size_t i;
+    int r;
+    int pass;
+
+    /*
+     * firewall
+     */
+    if (name == NULL || buf == NULL) {
+	err(16, __func__, "called with NULL arg(s)");
+	not_reached();
+    }
+
+    /*
+     * every reference word must be reserved and no prefix of one may be
+     */
+    for (i = 0; linear_words[i] != NULL; ++i) {
+	size_t wlen = strlen(linear_words[i]);
+
+	if (!c_reserved(linear_words[i], wlen) || c_reserved(linear_words[i], wlen-1) ||
+	    !is_reserved(linear_words[i])) {
+	    warn(__func__, "c_reserved misclassifies: %s", linear_words[i]);
+	    return false;
+	}
+    }
+
+    /*
+     * pass 0: time the linear scan, pass 1: time c_reserved(), pass 2: compare
+     */
+    tokens = linear_found = hash_found = 0;
+    for (pass = 0; pass < 3; ++pass) {
+	for (r = 0; r < (pass < 2 ? rounds : 1); ++r) {
+	    start = bench_now();
+	    tokens = 0;
+	    wordi = 0;
+	    for (i = 0; i <= len; ++i) {
+		int ch = (i < len) ? (unsigned char)buf[i] : ' ';
+
+		if (isalnum(ch) || ch == '_' || ch == '#') {
+		    if (wordi < sizeof(word) - 1) {
+			word[wordi] = (char)ch;
+		    }
+		    ++wordi;
+		    continue;
+		}
+		if (wordi == 0) {
+		    continue;
+		}
+		if (wordi >= sizeof(word)) {
+		    /* word too long to be reserved, rule_count() resets it */
+		    wordi = 0;
+		    continue;
+		}
+		word[wordi] = '\0';
+		++tokens;
+		switch (pass) {
+		case 0:
+		    if (linear_reserved(word)) {
+			++linear_found;
+		    }
+		    break;
+		case 1:
+		    if (c_reserved(word, wordi)) {
+			++hash_found;
+		    }
+		    break;
+		default:
+		    linear = linear_reserved(word);
+		    if (linear != c_reserved(word, wordi)) {
+			warn(__func__, "%s: linear scan says %s but c_reserved says %s for: %s",
+			     name, booltostr(linear), booltostr(!linear), word);
+			return false;
+		    }
+		    break;
+		}
+		wordi = 0;
+	    }
+	    t = bench_now() - start;
+	    if (pass == 0 && (r == 0 || t < linear_time)) {
+		linear_time = t;
+	    } else if (pass == 1 && (r == 0 || t < hash_time)) {
+		hash_time = t;
+	    }
+	}
+    }
+
+    print("%s: %zu words: linear keyword scan: %.6f sec %.0f words/s: %zu reserved\n",
+	  name, tokens, linear_time, bench_ratio((double)tokens, linear_time),
+	  linear_found / (size_t)rounds);
+    print("%s: %zu words: c_reserved:          %.6f sec %.0f words/s: %zu reserved\n",
+	  name, tokens, hash_time, bench_ratio((double)tokens, hash_time),
+	  hash_found / (size_t)rounds);
+    return true;
+}
@@ -0,0 +1,198 @@
+/*
+ * bench_util - common timing, option and report code for the bench_* tools
+ *
+ * "Measure what is measurable, and make measurable what is not so."
+ *
+ *	-- attributed to Galileo Galilei
+ *
+ * Copyright (c) 2025 by Landon Curt Noll and Cody Boone Ferguson.  All Rights
+ * Reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software and
+ * its documentation for any purpose and without fee is hereby granted,
+ * provided that the above copyright, this permission notice and text
+ * this comment, and the disclaimer below appear in all of the following:
+ *
+ *       supporting documentation
+ *       source copies
+ *       source works derived from this source
+ *       binaries derived from this source or from derived source
+ *
+ * THE AUTHORS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE, INCLUDING
+ * ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHORS BE LIABLE FOR ANY SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES OR ANY
+ * DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ *
+ * Share and enjoy! :-)
+ */
+
+
+/* special comments for the seqcexit tool */
+/* exit code out of numerical order - ignore in sequencing - ooo */
+/* exit code change of order - use new value in sequencing - coo */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <time.h>
+
+/*
+ * bench_util - common timing, option and report code for the bench_* tools
+ */
+#include "bench_util.h"
+
+
+/*
+ * bench_now - return a monotonic time in seconds
+ *
+ * returns:
+ *	monotonic time in seconds
+ */
+double
+bench_now(void)
+{
+    struct timespec ts;		/* monotonic clock */
+
+    (void) clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + ((double)ts.tv_nsec / 1e9);
+}
+
+
+/*
+ * bench_std_opt - process a getopt() option common to all bench_* tools
+ *
+ * The -h, -v level, -V and -q options, as well as getopt() errors, are
+ * processed the same way by every bench_* tool.  A bench_* tool calls this
+ * function from the default case of its getopt() switch.
+ *
+ * given:
+ *	opt		getopt() return value
+ *	program		our name as given by argv[0]
+ *	name		tool basename
+ *	version		tool version string
+ *	usage		the usage() function of the tool
+ *
+ * NOTE: This function does not return if opt is -h, -V or an invalid option,
+ *	 or if the -v level is invalid.
+ */
+void
+bench_std_opt(int opt, char const *program, char const *name, char const *version, bench_usage_t usage)
+{
+    extern char *optarg;		/* option argument */
+    extern int optopt;			/* option character that caused a getopt() error */
+    bool opt_error = false;		/* fchk_inval_opt() return */
+
+    /*
+     * firewall
+     */
+    if (program == NULL || name == NULL || version == NULL || usage == NULL) {
+	err(10, __func__, "called with NULL arg(s)");
+	not_reached();
+    }
+
+    switch (opt) {
+    case 'h':	/* -h - print help to stderr and exit 0 */
+	usage(2, NULL);
+	not_reached();
+	break;
+    case 'v':	/* -v verbosity */
+	verbosity_level = parse_verbosity(optarg);
+	if (verbosity_level < 0) {
+	    usage(3, "invalid -v verbosity"); /*ooo*/
+	    not_reached();
+	}
+	break;
+    case 'V':	/* -V - print version and exit */
+	print("%s version: %s\n", name, version);
+	exit(2); /*ooo*/
+	not_reached();
+	break;
+    case 'q':
+	msg_warn_silent = true;
+	break;
+    case ':':   /* option requires an argument */
+    case '?':   /* illegal option */
+    default:    /* anything else but should not actually happen */
+	opt_error = fchk_inval_opt(stderr, program, opt, optopt);
+	if (opt_error) {
+	    usage(3, "invalid command line option"); /*ooo*/
+	    not_reached();
+	} else {
+	    fwarn(stderr, __func__, "getopt() return: %c optopt: %c", (char)opt, (char)optopt);
+	}
+	break;
+    }
+}
+
+
+/*
+ * bench_intmax_arg - convert a numeric option argument
+ *
+ * given:
+ *	arg		option argument
+ *	min		smallest allowed value
+ *	max		largest allowed value
+ *	what		usage message if arg is not a number in [min, max]
+ *	usage		the usage() function of the tool
+ *
+ * returns:
+ *	arg as an intmax_t
+ *
+ * NOTE: This function does not return if arg is not a number in [min, max].
+ */
+intmax_t
+bench_intmax_arg(char const *arg, intmax_t min, intmax_t max, char const *what, bench_usage_t usage)
+{
+    intmax_t num = 0;		/* converted arg */
+
+    /*
+     * firewall
+     */
+    if (arg == NULL || what == NULL || usage == NULL) {
+	err(11, __func__, "called with NULL arg(s)");
+	not_reached();
+    }
+
+    if (!string_to_intmax(arg, &num) || num < min || num > max) {
+	usage(3, what); /*ooo*/
+	not_reached();
+    }
+    return num;
+}
+
+
+/*
+ * bench_ratio - divide two measurements for a report
+ *
+ * given:
+ *	num	numerator, such as a count or a time
+ *	den	denominator, such as a time
+ *
+ * returns:
+ *	num / den, or 0.0 if den is not > 0.0
+ */
+double
+bench_ratio(double num, double den)
+{
+    return (den > 0.0) ? (num / den) : 0.0;
+}
+
+
+/*
+ * bench_ns_per - nanoseconds per operation for a report
+ *
+ * given:
+ *	seconds		time taken by count operations
+ *	count		number of operations
+ *
+ * returns:
+ *	nanoseconds per operation, or 0.0 if count is not > 0
+ */
+double
+bench_ns_per(double seconds, double count)
+{
+    return bench_ratio(seconds * 1e9, count);
+}
@@ -0,0 +1,95 @@
+/*
+ * bench_util - common timing, option and report code for the bench_* tools
+ *
+ * "Measure what is measurable, and make measurable what is not so."
+ *
+ *	-- attributed to Galileo Galilei
+ *
+ * Copyright (c) 2025 by Landon Curt Noll and Cody Boone Ferguson.  All Rights
+ * Reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software and
+ * its documentation for any purpose and without fee is hereby granted,
+ * provided that the above copyright, this permission notice and text
+ * this comment, and the disclaimer below appear in all of the following:
+ *
+ *       supporting documentation
+ *       source copies
+ *       source works derived from this source
+ *       binaries derived from this source or from derived source
+ *
+ * THE AUTHORS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE, INCLUDING
+ * ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHORS BE LIABLE FOR ANY SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES OR ANY
+ * DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ *
+ * Share and enjoy! :-)
+ */
+
+
+#if !defined(INCLUDE_BENCH_UTIL_H)
+#    define  INCLUDE_BENCH_UTIL_H
+
+
+#include <inttypes.h>
+
+/*
+ * dbg - info, debug, warning, error, and usage message facility
+ */
+#include "../dbg/dbg.h"
+
+/*
+ * pr - stdio helper library
+ */
+#include "../pr/pr.h"
+
+/*
+ * location - location/country codes and set the IOCCC locale
+ */
+#include "../soup/location.h"
+
+/*
+ * version - official IOCCC toolkit versions
+ */
+#include "../soup/version.h"
+
+
+/*
+ * usage message lines common to all bench_* tools
+ *
+ * BENCH_USAGE_STD_OPTS describes the -h, -v, -V and -q options that
+ * bench_std_opt() processes, BENCH_USAGE_STD_EXIT describes the exit
+ * codes >= 2 that every bench_* tool uses.
+ */
+#define BENCH_USAGE_STD_OPTS \
+    "\t-h\t\tPrint help message and exit\n" \
+    "\t-v level\tSet verbosity level: (def level: 0)\n" \
+    "\t-V\t\tPrint version string and exit\n" \
+    "\t-q\t\tQuiet mode: silence msg(), warn(), warnp() if -v 0 (def: loud :-) )\n"
+#define BENCH_USAGE_STD_EXIT \
+    "     2   -h and help string printed or -V and version string printed\n" \
+    "     3   invalid command line, invalid option or option missing an argument\n" \
+    " >= 10   internal error\n"
+
+
+/*
+ * bench_usage_t - the usage() function of a bench_* tool
+ */
+typedef void (*bench_usage_t)(int exitcode, char const *str);
+
+
+/*
+ * external function declarations
+ */
+extern double bench_now(void);
+extern void bench_std_opt(int opt, char const *program, char const *name, char const *version,
+			  bench_usage_t usage);
+extern intmax_t bench_intmax_arg(char const *arg, intmax_t min, intmax_t max, char const *what,
+				 bench_usage_t usage);
+extern double bench_ratio(double num, double den);
+extern double bench_ns_per(double seconds, double count);
+
+
+#endif /* INCLUDE_BENCH_UTIL_H */
@@ -0,0 +1,426 @@
+/*
+ * bench_walk - compare indexed and linear path lookups in a struct walk_stat
+ *
+ * Also reports the heap memory used while recording, and the time that
+ * free_walk_stat() takes and how much heap memory it gives back.
+ *
+ * "Because finding a path should not mean walking every path." :-)
+ *
+ * Copyright (c) 2025 by Landon Curt Noll and Cody Boone Ferguson.  All Rights
+ * Reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software and
+ * its documentation for any purpose and without fee is hereby granted,
+ * provided that the above copyright, this permission notice and text
+ * this comment, and the disclaimer below appear in all of the following:
+ *
+ *       supporting documentation
+ *       source copies
+ *       source works derived from this source
+ *       binaries derived from this source or from derived source
+ *
+ * THE AUTHORS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE, INCLUDING
+ * ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHORS BE LIABLE FOR ANY SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES OR ANY
+ * DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ *
+ * Share and enjoy! :-)
+ */
+
+
+/* special comments for the seqcexit tool */
+/* exit code out of numerical order - ignore in sequencing - ooo */
+/* exit code change of order - use new value in sequencing - coo */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <inttypes.h>
+#include <limits.h>
+#include <sys/stat.h>
+#include <sys/resource.h>
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+/*
+ * bench_util - common timing, option and report code for the bench_* tools
+ */
+#include "bench_util.h"
+
+/*
+ * limit_ioccc - IOCCC size and rule related limitations
+ */
+#include "../soup/limit_ioccc.h"
+
+/*
+ * walk - walk directory trees and tar listings
+ */
+#include "../soup/walk.h"
+
+
+/*
+ * definitions
+ */
+#define BENCH_WALK_BASENAME "bench_walk"
+/**/
+#define DEF_ENTRIES (100000)	/* default number of synthetic paths to record */
+#define DEF_SAMPLES (1000)	/* default number of linear scan lookups to sample */
+#define DEF_SEED (1992)		/* default lookup sample seed */
+#define FILES_PER_DIR (500)	/* synthetic files per synthetic subdirectory */
+#define DIRS_PER_TOP (20)	/* synthetic subdirectories per synthetic top level directory */
+#define BENCH_PATH_LEN (64)	/* longest synthetic path */
+/**/
+#if defined(__GLIBC__) && defined(__GLIBC_PREREQ)
+#if __GLIBC_PREREQ(2,33)
+#define HAVE_MALLINFO2		/* mallinfo2(3) reports the heap memory in use */
+#endif
+#endif
+
+
+/*
+ * globals
+ */
+static char *program = BENCH_WALK_BASENAME;	    /* our name */
+
+
+/*
+ * usage message
+ */
+static char const * const usage_msg =
+    "usage: %s [-h] [-v level] [-V] [-q] [-n entries] [-l samples] [-s seed] [-t topdir]\n"
+    "\n"
+    BENCH_USAGE_STD_OPTS
+    "\n"
+    "\t-n entries\tnumber of synthetic paths to record (def: %d)\n"
+    "\t-l samples\tnumber of paths to look up with a linear scan (def: %d)\n"
+    "\t-s seed\t\tseed for the lookup samples (def: %d)\n"
+    "\t-t topdir\tfts_walk() topdir instead of recording synthetic paths\n"
+    "\n"
+    "Exit codes:\n"
+    "     0   all is OK: indexed and linear lookups found the same items\n"
+    "     1   indexed and linear lookups differ\n"
+    BENCH_USAGE_STD_EXIT
+    "\n"
+    "%s version: %s\n";
+
+
+/*
+ * static functions
+ */
+static void usage(int exitcode, char const *str) __attribute__((noreturn));
+static long max_rss_kib(void);
+static void bench_path(char *buf, intmax_t n, bool upper);
+static void bench_free(struct walk_stat *wstat_p, intmax_t items);
+static size_t heap_bytes(void);
+
+
+int
+main(int argc, char *argv[])
+{
+    extern char *optarg;		/* option argument */
+    extern int optind;			/* argv index of the next arg */
+    intmax_t entries = DEF_ENTRIES;	/* number of synthetic paths to record */
+    intmax_t samples = DEF_SAMPLES;	/* number of linear scan lookups */
+    unsigned int seed = DEF_SEED;	/* lookup sample seed */
+    char const *topdir = NULL;		/* != NULL ==> fts_walk() topdir */
+    bool ok = true;			/* true ==> indexed and linear lookups agree */
+    struct walk_stat wstat;		/* walk_stat with synthetic paths */
+    char path[BENCH_PATH_LEN+1];	/* synthetic path */
+    char last_dir[BENCH_PATH_LEN+1];	/* last synthetic subdirectory recorded */
+    struct item *index_p;		/* item found by the path index */
+    struct item *linear_p;		/* item found by the linear scan */
+    bool dup = false;			/* true ==> record_step() found a duplicate */
+    intmax_t recorded;			/* number of items in the all dynamic array */
+    size_t record_heap;			/* heap bytes in use by recording */
+    double start;			/* start of a timed loop */
+    double t_record;			/* seconds to record all paths */
+    double t_index;			/* seconds for all indexed lookups */
+    double t_linear;			/* seconds for sampled linear lookups */
+    double per_index;			/* seconds per indexed lookup */
+    double per_linear;			/* seconds per linear lookup */
+    intmax_t n;
+    int i;
+
+    /* IOCCC requires use of C locale */
+    set_ioccc_locale();
+
+    /*
+     * parse args
+     */
+    program = argv[0];
+    while ((i = getopt(argc, argv, ":hv:Vqn:l:s:t:")) != -1) {
+	switch (i) {
+	case 'n':
+	    entries = bench_intmax_arg(optarg, 1, INTMAX_MAX, "invalid -n entries", usage);
+	    break;
+	case 'l':
+	    samples = bench_intmax_arg(optarg, 1, INTMAX_MAX, "invalid -l samples", usage);
+	    break;
+	case 's':
+	    seed = (unsigned int) bench_intmax_arg(optarg, 0, UINT_MAX, "invalid -s seed", usage);
+	    break;
+	case 't':
+	    topdir = optarg;
+	    break;
+	default:    /* -h, -v level, -V, -q and invalid options */
+	    bench_std_opt(i, program, BENCH_WALK_BASENAME, BENCH_WALK_VERSION, usage);
+	    break;
+	}
+    }
+    if (argc - optind != 0) {
+	usage(3, "unexpected arguments"); /*ooo*/
+	not_reached();
+    }
+
+    /*
+     * case: walk topdir
+     */
+    if (topdir != NULL) {
+	init_walk_stat(&wstat, topdir, &walk_anything, BENCH_WALK_BASENAME, 0, 0, 0, false, false);
+	record_heap = heap_bytes();
+	start = bench_now();
+	if (! fts_walk(&wstat)) {
+	    warn(__func__, "fts_walk found errors under: %s", topdir);
+	}
+	t_record = bench_now() - start;
+	record_heap = heap_bytes() - record_heap;
+	recorded = dyn_array_tell(wstat.all);
+	print("%s: topdir: %s recorded items: %jd walk seconds: %.3f max RSS KiB: %ld\n",
+	      BENCH_WALK_BASENAME, topdir, recorded, t_record, max_rss_kib());
+	if (heap_bytes() > 0) {
+	    print("%s: walk heap bytes: %zu per item: %.1f\n",
+		  BENCH_WALK_BASENAME, record_heap, (double)record_heap / (double)(recorded > 0 ? recorded : 1));
+	}
+	bench_free(&wstat, recorded);
+	exit(0); /*ooo*/
+    }
+
+    /*
+     * record the synthetic paths, checking each one for a duplicate as fts_walk() does
+     *
+     * NOTE: Each synthetic subdirectory is recorded before its first file.
+     */
+    init_walk_stat(&wstat, ".", &walk_anything, BENCH_WALK_BASENAME,
+		   BENCH_PATH_LEN, BENCH_PATH_LEN, MAX_PATH_DEPTH, false, false);
+    last_dir[0] = '\0';
+    record_heap = heap_bytes();
+    start = bench_now();
+    for (n = 0; n < entries; ++n) {
+	bench_path(path, n, false);
+	*strrchr(path, '/') = '\0';
+	if (strcmp(path, last_dir) != 0) {
+	    strcpy(last_dir, path);
+	    (void) record_step(&wstat, path, 0, S_IFDIR | 0755, &dup, NULL);
+	}
+	bench_path(path, n, false);
+	(void) record_step(&wstat, path, (off_t)n, S_IFREG | 0444, &dup, NULL);
+	if (dup) {
+	    err(10, __func__, "record_step found an unexpected duplicate: %s", path);
+	    not_reached();
+	}
+    }
+    t_record = bench_now() - start;
+    record_heap = heap_bytes() - record_heap;
+    recorded = dyn_array_tell(wstat.all);
+
+    /*
+     * time indexed lookups of every synthetic path, in upper case
+     */
+    start = bench_now();
+    for (n = 0; n < entries; ++n) {
+	bench_path(path, n, true);
+	if (path_in_walk_stat(&wstat, path) == NULL) {
+	    warn(__func__, "indexed lookup did not find: %s", path);
+	    ok = false;
+	}
+	if (path_in_walk_stat_exact(&wstat, path) != NULL) {
+	    warn(__func__, "exact indexed lookup found: %s", path);
+	    ok = false;
+	}
+    }
+    t_index = bench_now() - start;
+
+    /*
+     * time sampled linear lookups and check that they agree with the index
+     *
+     * Every other sample is a path that was not recorded.
+     */
+    srandom(seed);
+    start = bench_now();
+    for (n = 0; n < samples; ++n) {
+	if ((n & 1) == 0) {
+	    bench_path(path, (intmax_t)((uintmax_t)random() % (uintmax_t)entries), true);
+	} else {
+	    bench_path(path, entries + (intmax_t)((uintmax_t)random() % (uintmax_t)entries), false);
+	}
+	linear_p = path_in_item_array(wstat.all, path);
+	index_p = path_in_walk_stat(&wstat, path);
+	if (linear_p != index_p) {
+	    warn(__func__, "indexed and linear lookups differ for: %s", path);
+	    ok = false;
+	}
+    }
+    t_linear = bench_now() - start;
+
+    /*
+     * report
+     */
+    per_index = t_index / (double)(entries * 2);
+    per_linear = t_linear / (double)samples;
+    print("%s: entries: %jd recorded items: %jd record seconds: %.3f max RSS KiB: %ld\n",
+	  BENCH_WALK_BASENAME, entries, recorded, t_record, max_rss_kib());
+    print("%s: indexed lookups: %jd ns/lookup: %.1f\n",
+	  BENCH_WALK_BASENAME, entries * 2, bench_ns_per(t_index, (double)(entries * 2)));
+    print("%s: linear lookups: %jd ns/lookup: %.1f speedup: %.1fx\n",
+	  BENCH_WALK_BASENAME, samples, bench_ns_per(t_linear, (double)samples),
+	  bench_ratio(per_linear, per_index));
+    print("%s: estimated linear duplicate check seconds: %.3f\n",
+	  BENCH_WALK_BASENAME, per_linear * (double)recorded / 2.0);
+    if (heap_bytes() > 0) {
+	print("%s: record heap bytes: %zu per item: %.1f\n",
+	      BENCH_WALK_BASENAME, record_heap, (double)record_heap / (double)recorded);
+    }
+    bench_free(&wstat, recorded);
+
+    /*
+     * All Done!!! All Done!!! -- Jessica Noll, Age 2
+     */
+    exit(ok ? 0 : 1); /*ooo*/
+}
+
+
+/*
+ * usage - print usage to stderr
+ *
+ * Example:
+ *      usage(3, "missing required argument(s), run with -h for help");
+ *
+ * given:
+ *	exitcode        value to exit with
+ *	str		top level usage message
+ *
+ * NOTE: We warn with extra newlines to help internal fault messages stand out.
+ *       Normally one should NOT include newlines in warn messages.
+ *
+ * This function does not return.
+ */
+static void
+usage(int exitcode, char const *str)
+{
+    /*
+     * print the formatted usage stream
+     */
+    if (str != NULL && str[0] != '\0') {
+	(void) fprintf(stderr, "%s: %s\n", BENCH_WALK_BASENAME, str);
+    }
+    fprintf_usage(exitcode, stderr, usage_msg, BENCH_WALK_BASENAME,
+			    DEF_ENTRIES, DEF_SAMPLES, DEF_SEED,
+			    BENCH_WALK_BASENAME, BENCH_WALK_VERSION);
+    exit(exitcode); /*ooo*/
+    not_reached();
+}
+
+
+/*
+ * max_rss_kib - return the maximum resident set size of this process
+ *
+ * returns:
+ *	maximum resident set size in KiB, or -1 if unknown
+ */
+static long
+max_rss_kib(void)
+{
+    struct rusage ru;		/* resource usage of this process */
+
+    if (getrusage(RUSAGE_SELF, &ru) != 0) {
+	return -1;
+    }
+#if defined(__APPLE__)
+    return ru.ru_maxrss / 1024;	/* macOS reports bytes */
+#else
+    return ru.ru_maxrss;
+#endif
+}
+
+
+/*
+ * heap_bytes - return the heap memory in use by this process
+ *
+ * returns:
+ *	bytes of heap memory in use, or 0 if unknown
+ *
+ * NOTE: The heap is unknown without mallinfo2(3), and is not measured when the
+ *	 allocator in use is not the one that mallinfo2(3) reports on (as with
+ *	 -fsanitize=address).
+ */
+static size_t
+heap_bytes(void)
+{
+#if defined(HAVE_MALLINFO2)
+    struct mallinfo2 mi;	/* heap statistics */
+
+    mi = mallinfo2();
+    return mi.uordblks + mi.hblkhd;
+#else
+    return 0;
+#endif
+}
+
+
+/*
+ * bench_path - form the n-th synthetic path
+ *
+ * The synthetic tree has FILES_PER_DIR files in each subdirectory
+ * and DIRS_PER_TOP subdirectories in each top level directory.
+ *
+ * given:
+ *	buf	    - buffer of at least BENCH_PATH_LEN+1 bytes
+ *	n	    - synthetic path number
+ *	upper	    - true ==> form the path in upper case
+ */
+static void
+bench_path(char *buf, intmax_t n, bool upper)
+{
+    intmax_t dir = n / FILES_PER_DIR;	/* synthetic subdirectory number */
+
+    (void) snprintf(buf, BENCH_PATH_LEN+1, upper ? "T%04jd/S%02jd/F%07jd.C" : "t%04jd/s%02jd/f%07jd.c",
+		    dir / DIRS_PER_TOP, dir % DIRS_PER_TOP, n);
+    return;
+}
+
+
+/*
+ * bench_free - time free_walk_stat() and report the free(3) calls it makes
+ *
+ * given:
+ *	wstat_p	    - walk_stat to free
+ *	items	    - number of items in the walk_stat
+ */
+static void
+bench_free(struct walk_stat *wstat_p, intmax_t items)
+{
+    size_t before;		/* heap bytes in use before free_walk_stat() */
+    size_t after;		/* heap bytes in use after free_walk_stat() */
+    size_t chunks;		/* number of walk_arena chunks */
+    double start;		/* start of free_walk_stat() */
+    double t_free;		/* seconds to free the walk_stat */
+
+    chunks = wstat_p->arena.chunks;
+    before = heap_bytes();
+    start = bench_now();
+    free_walk_stat(wstat_p);
+    t_free = bench_now() - start;
+    after = heap_bytes();
+    print("%s: free_walk_stat items: %jd arena chunks: %zu seconds: %.4f\n",
+	  BENCH_WALK_BASENAME, items, chunks, t_free);
+    if (before > 0) {
+	print("%s: free_walk_stat heap bytes freed: %zu\n", BENCH_WALK_BASENAME,
+	      (before > after) ? (before - after) : 0);
+    }
+    return;
+}
@@ -0,0 +1,412 @@
+/*
+ * bench_walk_set - compare compiled and linear walk_set rule matching
+ *
+ * "Because a rule that is compiled once need not be read twice." :-)
+ *
+ * Copyright (c) 2025 by Landon Curt Noll and Cody Boone Ferguson.  All Rights
+ * Reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software and
+ * its documentation for any purpose and without fee is hereby granted,
+ * provided that the above copyright, this permission notice and text
+ * this comment, and the disclaimer below appear in all of the following:
+ *
+ *       supporting documentation
+ *       source copies
+ *       source works derived from this source
+ *       binaries derived from this source or from derived source
+ *
+ * THE AUTHORS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE, INCLUDING
+ * ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHORS BE LIABLE FOR ANY SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES OR ANY
+ * DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ *
+ * Share and enjoy! :-)
+ */
+
+
+/* special comments for the seqcexit tool */
+/* exit code out of numerical order - ignore in sequencing - ooo */
+/* exit code change of order - use new value in sequencing - coo */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <inttypes.h>
+#include <limits.h>
+#include <ctype.h>
+#include <sys/stat.h>
+
+/*
+ * bench_util - common timing, option and report code for the bench_* tools
+ */
+#include "bench_util.h"
+
+/*
+ * limit_ioccc - IOCCC size and rule related limitations
+ */
+#include "../soup/limit_ioccc.h"
+
+/*
+ * walk - walk directory trees and tar listings
+ */
+#include "../soup/walk.h"
+
+
+/*
+ * definitions
+ */
+#define BENCH_WALK_SET_BASENAME "bench_walk_set"
+/**/
+#define DEF_ENTRIES (100000)	/* default number of synthetic items to match */
+#define DEF_ROUNDS (5)		/* default number of times to match every item */
+#define DEF_SEED (1992)		/* default synthetic item seed */
+#define BENCH_NAME_LEN (64)	/* longest synthetic name */
+#define MAX_LEVEL (3)		/* deepest synthetic item */
+
+
+/*
+ * item names that walk_rule sets look for, mixed in with random names
+ */
+static char const * const known_name[] = {
+    "prog.c", "Makefile", "remarks.md", ".info.json", ".auth.json", "prog", "prog.orig.c",
+    "prog.alt.c", "try.sh", "try.alt.sh", "README.md", "index.html", "COPYING", "LICENSE",
+    ".git", ".DS_Store", ".gitignore", "CVS", ".num.sh", ".txz", "submit.1234-5678.1.1739000000.txz",
+    "1234_foo.tar.bz2", "foo.tar.bz2", "Makefile.orig", "prog.c.orig", "remarks.md.orig",
+    ".entry.json", "..", "a", "",
+};
+
+/*
+ * extensions of random item names
+ */
+static char const * const extension[] = {
+    ".c", ".h", ".sh", ".txt", ".md", ".json", ".html", ".png", ".o", ".orig", "",
+};
+
+/*
+ * walk_rule sets to benchmark
+ */
+static struct walk_set * const bench_set[] = {
+    &walk_mkiocccentry, &walk_txzchk, &walk_chkentry_s, &walk_chkentry_w,
+};
+
+
+/*
+ * globals
+ */
+static char *program = BENCH_WALK_SET_BASENAME;	    /* our name */
+
+/*
+ * usage message
+ */
+static char const * const usage_msg =
+    "usage: %s [-h] [-v level] [-V] [-q] [-n entries] [-r rounds] [-s seed] [-t topdir]\n"
+    "\n"
+    BENCH_USAGE_STD_OPTS
+    "\n"
+    "\t-n entries\tnumber of synthetic items to match (def: %d)\n"
+    "\t-r rounds\tnumber of times to match every item (def: %d)\n"
+    "\t-s seed\t\tseed for the synthetic items (def: %d)\n"
+    "\t-t topdir\tmatch the items of an fts_walk() of topdir instead of synthetic items\n"
+    "\n"
+    "Exit codes:\n"
+    "     0   all is OK: compiled and linear matching found the same walk_rule for every item\n"
+    "     1   compiled and linear matching differ\n"
+    BENCH_USAGE_STD_EXIT
+    "\n"
+    "%s version: %s\n";
+
+
+/*
+ * static functions
+ */
+static void usage(int exitcode, char const *str) __attribute__((noreturn));
+static void bench_item(struct item *i_p, intmax_t n);
+
+
+int
+main(int argc, char *argv[])
+{
+    extern char *optarg;		/* option argument */
+    extern int optind;			/* argv index of the next arg */
+    intmax_t entries = DEF_ENTRIES;	/* number of synthetic items */
+    intmax_t rounds = DEF_ROUNDS;	/* number of times to match every item */
+    unsigned int seed = DEF_SEED;	/* synthetic item seed */
+    char const *topdir = NULL;		/* != NULL ==> fts_walk() topdir */
+    bool ok = true;			/* true ==> compiled and linear matching agree */
+    struct walk_stat wstat;		/* walk_stat of topdir */
+    struct walk_stat set_wstat;		/* walk_stat that initializes a benchmarked walk_set */
+    struct walk_set *wset_p;		/* benchmarked walk_set */
+    struct item *item = NULL;		/* items to match */
+    struct item **item_p = NULL;	/* pointers to the items to match */
+    intmax_t matched;			/* number of items that matched a walk_rule */
+    intmax_t sum;			/* sum of matched walk_rule indexes, so matching is not optimized away */
+    double start;			/* start of a timed loop */
+    double t_linear;			/* seconds for all linear matches */
+    double t_compiled;			/* seconds for all compiled matches */
+    double matches;			/* number of timed matches */
+    size_t s;
+    intmax_t n;
+    intmax_t r;
+    int i;
+
+    /* IOCCC requires use of C locale */
+    set_ioccc_locale();
+
+    /*
+     * parse args
+     */
+    program = argv[0];
+    while ((i = getopt(argc, argv, ":hv:Vqn:r:s:t:")) != -1) {
+	switch (i) {
+	case 'n':
+	    entries = bench_intmax_arg(optarg, 1, INTMAX_MAX, "invalid -n entries", usage);
+	    break;
+	case 'r':
+	    rounds = bench_intmax_arg(optarg, 1, INTMAX_MAX, "invalid -r rounds", usage);
+	    break;
+	case 's':
+	    seed = (unsigned int) bench_intmax_arg(optarg, 0, UINT_MAX, "invalid -s seed", usage);
+	    break;
+	case 't':
+	    topdir = optarg;
+	    break;
+	default:    /* -h, -v level, -V, -q and invalid options */
+	    bench_std_opt(i, program, BENCH_WALK_SET_BASENAME, BENCH_WALK_SET_VERSION, usage);
+	    break;
+	}
+    }
+    if (argc - optind != 0) {
+	usage(3, "unexpected arguments"); /*ooo*/
+	not_reached();
+    }
+
+    /*
+     * case: match the items under topdir
+     */
+    if (topdir != NULL) {
+	init_walk_stat(&wstat, topdir, &walk_anything, BENCH_WALK_SET_BASENAME, 0, 0, 0, false, false);
+	if (! fts_walk(&wstat)) {
+	    warn(__func__, "fts_walk found errors under: %s", topdir);
+	}
+	entries = dyn_array_tell(wstat.all);
+	if (entries <= 0) {
+	    err(10, __func__, "no items found under: %s", topdir);
+	    not_reached();
+	}
+	errno = 0;	/* pre-clear errno for errp() */
+	item_p = calloc((size_t)entries, sizeof(struct item *));
+	if (item_p == NULL) {
+	    errp(11, __func__, "calloc of %jd item pointers failed", entries);
+	    not_reached();
+	}
+	for (n = 0; n < entries; ++n) {
+	    item_p[n] = dyn_array_value(wstat.all, struct item *, n);
+	}
+
+    /*
+     * case: form synthetic items
+     */
+    } else {
+	errno = 0;	/* pre-clear errno for errp() */
+	item = calloc((size_t)entries, sizeof(struct item));
+	item_p = calloc((size_t)entries, sizeof(struct item *));
+	if (item == NULL || item_p == NULL) {
+	    errp(12, __func__, "calloc of %jd items failed", entries);
+	    not_reached();
+	}
+	srandom(seed);
+	for (n = 0; n < entries; ++n) {
+	    bench_item(&item[n], n);
+	    item_p[n] = &item[n];
+	}
+    }
+
+    /*
+     * benchmark each walk_rule set
+     */
+    print("%s: items: %jd rounds: %jd\n", BENCH_WALK_SET_BASENAME, entries, rounds);
+    matches = (double)entries * (double)rounds;
+    for (s = 0; s < sizeof(bench_set)/sizeof(bench_set[0]); ++s) {
+
+	/*
+	 * initialize, and so compile, the walk_rule set
+	 */
+	init_walk_stat(&set_wstat, ".", bench_set[s], BENCH_WALK_SET_BASENAME, 0, 0, 0, false, false);
+	wset_p = set_wstat.set;
+
+	/*
+	 * check that compiled and linear matching agree
+	 */
+	matched = 0;
+	for (n = 0; n < entries; ++n) {
+	    i = match_walk_set(wset_p, item_p[n]);
+	    if (i != scan_walk_set(wset_p, item_p[n])) {
+		warn(__func__, "%s: compiled walk_rule: %d != linear walk_rule: %d for: %s",
+			       wset_p->name, i, scan_walk_set(wset_p, item_p[n]), item_p[n]->fts_path);
+		ok = false;
+	    }
+	    if (i < wset_p->count) {
+		++matched;
+	    }
+	}
+
+	/*
+	 * time linear matching
+	 */
+	sum = 0;
+	start = bench_now();
+	for (r = 0; r < rounds; ++r) {
+	    for (n = 0; n < entries; ++n) {
+		sum += scan_walk_set(wset_p, item_p[n]);
+	    }
+	}
+	t_linear = bench_now() - start;
+
+	/*
+	 * time compiled matching
+	 */
+	start = bench_now();
+	for (r = 0; r < rounds; ++r) {
+	    for (n = 0; n < entries; ++n) {
+		sum -= match_walk_set(wset_p, item_p[n]);
+	    }
+	}
+	t_compiled = bench_now() - start;
+	if (sum != 0) {
+	    warn(__func__, "%s: compiled and linear walk_rule index sums differ by: %jd", wset_p->name, sum);
+	    ok = false;
+	}
+
+	/*
+	 * report
+	 */
+	print("%s: %s: rules: %d matched items: %jd linear ns/item: %.1f compiled ns/item: %.1f speedup: %.1fx\n",
+	      BENCH_WALK_SET_BASENAME, wset_p->name, wset_p->count, matched,
+	      bench_ns_per(t_linear, matches), bench_ns_per(t_compiled, matches),
+	      bench_ratio(t_linear, t_compiled));
+	free_walk_stat(&set_wstat);
+    }
+
+    /*
+     * free the items
+     */
+    if (topdir != NULL) {
+	free_walk_stat(&wstat);
+    } else {
+	for (n = 0; n < entries; ++n) {
+	    free(item[n].fts_path);
+	}
+	free(item);
+    }
+    free(item_p);
+
+    /*
+     * All Done!!! All Done!!! -- Jessica Noll, Age 2
+     */
+    exit(ok ? 0 : 1); /*ooo*/
+}
+
+
+/*
+ * usage - print usage to stderr
+ *
+ * Example:
+ *      usage(3, "missing required argument(s), run with -h for help");
+ *
+ * given:
+ *	exitcode        value to exit with
+ *	str		top level usage message
+ *
+ * NOTE: We warn with extra newlines to help internal fault messages stand out.
+ *       Normally one should NOT include newlines in warn messages.
+ *
+ * This function does not return.
+ */
+static void
+usage(int exitcode, char const *str)
+{
+    /*
+     * print the formatted usage stream
+     */
+    if (str != NULL && str[0] != '\0') {
+	(void) fprintf(stderr, "%s: %s\n", BENCH_WALK_SET_BASENAME, str);
+    }
+    fprintf_usage(exitcode, stderr, usage_msg, BENCH_WALK_SET_BASENAME,
+			    DEF_ENTRIES, DEF_ROUNDS, DEF_SEED,
+			    BENCH_WALK_SET_BASENAME, BENCH_WALK_SET_VERSION);
+    exit(exitcode); /*ooo*/
+    not_reached();
+}
+
+
+/*
+ * bench_item - form the n-th synthetic item
+ *
+ * About a third of the items have a name that walk_rule sets look for, in
+ * random case.  The rest have a random name with a random extension.  Items
+ * are at a random level, of a random type, and some are empty.
+ *
+ * given:
+ *	i_p	    - item to form
+ *	n	    - synthetic item number
+ *
+ * NOTE: Only fts_path is malloced: fts_name points into it.
+ *
+ * NOTE: This function does not return on error.
+ */
+static void
+bench_item(struct item *i_p, intmax_t n)
+{
+    char name[BENCH_NAME_LEN+1];	/* synthetic name */
+    char path[BENCH_NAME_LEN*2+1];	/* synthetic path */
+    long r = random();			/* random choices */
+    size_t i;
+
+    /*
+     * form the name
+     */
+    if (r % 3 == 0) {
+	(void) snprintf(name, sizeof(name), "%s", known_name[(size_t)(r / 3) % (sizeof(known_name)/sizeof(known_name[0]))]);
+	if ((r / 64) % 4 == 0) {
+	    for (i = 0; name[i] != '\0'; ++i) {
+		name[i] = (char)toupper((unsigned char)name[i]);
+	    }
+	}
+    } else {
+	(void) snprintf(name, sizeof(name), "%c%jd%s", (int)('a' + (r / 3) % 26), n,
+			extension[(size_t)(r / 128) % (sizeof(extension)/sizeof(extension[0]))]);
+    }
+
+    /*
+     * form the item
+     */
+    i_p->fts_level = (int_least32_t)(1 + (r / 4096) % MAX_LEVEL);
+    (void) snprintf(path, sizeof(path), "%s%s", (i_p->fts_level == 1) ? "" : ((i_p->fts_level == 2) ? "d/" : "d/d/"), name);
+    errno = 0;	/* pre-clear errno for errp() */
+    i_p->fts_path = strdup(path);
+    if (i_p->fts_path == NULL) {
+	errp(13, __func__, "strdup of %s failed", path);
+	not_reached();
+    }
+    i_p->fts_pathlen = strlen(i_p->fts_path);
+    i_p->fts_namelen = strlen(name);
+    i_p->fts_name = i_p->fts_path + i_p->fts_pathlen - i_p->fts_namelen;
+    switch ((r / 16384) % 20) {
+    case 0: case 1: case 2:
+	i_p->st_mode = S_IFDIR | 0755;
+	break;
+    case 3:
+	i_p->st_mode = S_IFLNK | 0777;
+	break;
+    default:
+	i_p->st_mode = S_IFREG | 0444;
+	break;
+    }
+    i_p->st_size = ((r / 327680) % 8 == 0) ? 0 : (off_t)(n + 1);
+    return;
+}
@@ -54,7 +54,7 @@ export EXIT_CODE=0
 export INVALID_DIRECTORY_FOUND=""
 export WORKDIR="./test_ioccc/workdir"
 
-export CHKSUBMIT_TEST_VERSION="2.1.3 2025-11-08"
+export CHKSUBMIT_TEST_VERSION="2.1.4 2026-10-18"
 
 export USAGE="usage: $0 [-h] [-V] [-v level] [-D dbg_level] [-q] [-c chksubmit] [-C chkentry] [-d workdir]
 
@@ -445,6 +445,75 @@ while read -r dir; do
     run_bad_test "$CHKSUBMIT" "$CHKENTRY" "$DBG_LEVEL" "$Q_FLAG" "$dir"
 done < <(find "$BAD_TREE" -mindepth 1 -maxdepth 1 -type d -print)
 
+# run_parallel_test - check a set of directories with chkentry -j
+#
+# usage:
+#	run_parallel_test chkentry verdict directory ...
+#
+#	chkentry		path to the chkentry program
+#	verdict			ok ==> every directory must pass, fail ==> every directory must fail
+#	directory ...		directories to check
+#
+# The -j mode of chkentry checks each directory on a pool of threads and
+# prints ok: or fail: for each directory in command line order.
+#
+run_parallel_test()
+{
+    # parse args
+    #
+    if [[ $# -lt 3 ]]; then
+	echo "$0: ERROR: expected at least 3 args to run_parallel_test, found $#" 1>&2
+	exit 14
+    fi
+    declare chkentry="$1"
+    declare verdict="$2"
+    shift 2
+
+    # perform the test
+    #
+    echo "$0: about to run test: $chkentry -q -j 4 -- $* | tee -a -- ${LOGFILE}"
+    output=$("$chkentry" -q -j 4 -- "$@" 2>>"${LOGFILE}")
+    status="$?"
+    echo "$output" >> "${LOGFILE}"
+
+    # examine test result
+    #
+    if [[ $output != "$(printf "$verdict: %s\n" "$@")" ]]; then
+        echo "$0: test chkentry -j: expected $verdict for all $# directories" | tee -a -- "${LOGFILE}"
+        EXIT_CODE=1
+    elif [[ $verdict == ok && $status -ne 0 ]] || [[ $verdict == fail && $status -eq 0 ]]; then
+        echo "$0: test chkentry -j: unexpected exit code: $status" | tee -a -- "${LOGFILE}"
+        EXIT_CODE=1
+    else
+        echo "$0: test chkentry -j: all $# directories $verdict as expected" | tee -a -- "${LOGFILE}"
+    fi
+    echo >> "${LOGFILE}"
+
+    # return
+    #
+    return
+}
+
+# run chkentry -j on all good/ and all bad/ directories at once
+#
+if [[ $V_FLAG -ge 3 ]]; then
+    echo "$0: debug[3]: about to run chkentry -j tests" | tee -a -- "${LOGFILE}"
+fi
+GOOD_DIRS=()
+while read -r dir; do
+    GOOD_DIRS+=("$dir")
+done < <(find "$GOOD_TREE" -mindepth 1 -maxdepth 1 -type d -print | LC_ALL=C sort)
+BAD_DIRS=()
+while read -r dir; do
+    BAD_DIRS+=("$dir")
+done < <(find "$BAD_TREE" -mindepth 1 -maxdepth 1 -type d -print | LC_ALL=C sort)
+if [[ ${#GOOD_DIRS[@]} -gt 0 ]]; then
+    run_parallel_test "$CHKENTRY" ok "${GOOD_DIRS[@]}"
+fi
+if [[ ${#BAD_DIRS[@]} -gt 0 ]]; then
+    run_parallel_test "$CHKENTRY" fail "${BAD_DIRS[@]}"
+fi
+
 # determine exit code
 #
 if [[ $EXIT_CODE -ne 0 ]]; then
@@ -83,7 +83,7 @@ CC="$(type -P cc 2>/dev/null)"
 if [[ -z $CC ]]; then
     CC="/usr/bin/cc"
 fi
-export HOSTCHK_VERSION="2.0.2 2025-09-18"
+export HOSTCHK_VERSION="2.0.3 2026-10-18"
 export USAGE="usage: $0 [-h] [-V] [-v level] [-D dbg_level] [-c cc] [-w workdir] [-f] [-Z topdir]
 
     -h			    Print help and exit
@@ -274,10 +274,13 @@ if [[ -n $F_FLAG ]]; then
 
     # test compile
     #
+    # NOTE: <lzma.h> is only needed when txzchk is built with liblzma (see LZMA_FLAGS
+    #	    in the top level Makefile), so it is not a required system include file.
+    #
     printf "%s\\n%s\\n" "$(grep '#include.*<.*>' "$TOPDIR"/*.[hc] "$TOPDIR"/dbg/*.[hc] \
 	"$TOPDIR"/dyn_array/*.[hc] "$TOPDIR"/test_ioccc/*.[ch] "$TOPDIR"/soup/*.[hc] \
 	"$TOPDIR"/pr/*.[hc] "$TOPDIR"/jparse/*.[hcly] \
-	"$TOPDIR"/jparse/test_jparse/*.[hc]|grep -vE '<dbg\.h>|<dyn_array\.h>|<c_bool\.h>|<c_compat\.h>|<pr.h>' |cut -f 2- -d:|sort -u)" "int main(void) { return 0; }" |
+	"$TOPDIR"/jparse/test_jparse/*.[hc]|grep -vE '<dbg\.h>|<dyn_array\.h>|<c_bool\.h>|<c_compat\.h>|<pr.h>|<lzma\.h>' |cut -f 2- -d:|sort -u)" "int main(void) { return 0; }" |
 	    "${CC}" -x c - -o "$PROG_FILE"
     status="$?"
     if [[ $status -ne 0 ]]; then
@@ -317,6 +320,7 @@ elif [[ -n $RUN_INCLUDE_TEST ]]; then
 	"$TOPDIR"/jparse/*.[hcly] "$TOPDIR"/jparse/test_jparse/*.[hc] | \
 	grep -F -v '<dyn_array.h>' |
 	grep -F -v '<dbg.h>' |
+	grep -F -v '<lzma.h>' |
 	cut -f 2- -d:|sort -u| while read -r h; do
 
 	# form C prog
@@ -39,7 +39,7 @@
 
 # setup
 #
-export IOCCC_TEST_VERSION="2.1.2 2025-09-01"
+export IOCCC_TEST_VERSION="2.1.5 2026-10-18"
 
 
 # IOCCC requires use of C locale
@@ -658,6 +658,52 @@ else
     echo | tee -a -- "$LOGFILE"
 fi
 
+# run_bench - run a benchmark / self-check program and record its status
+#
+# usage:
+#	run_bench exit_code prog [arg ...]
+#
+# If prog exits non-zero, EXIT_CODE is set to exit_code and the failure
+# is added to FAILURE_SUMMARY.
+#
+run_bench()
+{
+    local code="$1"
+    shift
+    local prog="$1"
+    local status
+
+    echo | tee -a -- "$LOGFILE"
+    echo "RUNNING: $*" | tee -a -- "$LOGFILE"
+    echo | tee -a -- "$LOGFILE"
+    echo "$*" | tee -a -- "$LOGFILE"
+    "$@" | tee -a -- "$LOGFILE"
+    status="${PIPESTATUS[0]}"
+    if [[ $status -ne 0 ]]; then
+        echo "$0: ERROR: $prog non-zero exit code: $status" 1>&2 | tee -a -- "$LOGFILE"
+        FAILURE_SUMMARY="$FAILURE_SUMMARY
+    $prog non-zero exit code: $status"
+        EXIT_CODE="$code"
+        echo | tee -a -- "$LOGFILE"
+        echo "EXIT_CODE set to: $EXIT_CODE" | tee -a -- "$LOGFILE"
+        echo | tee -a -- "$LOGFILE"
+        echo "FAILED: $prog" | tee -a -- "$LOGFILE"
+    else
+        echo | tee -a -- "$LOGFILE"
+        echo "PASSED: $prog" | tee -a -- "$LOGFILE"
+        echo | tee -a -- "$LOGFILE"
+    fi
+}
+
+# benchmarks and self-checks
+#
+run_bench 30 test_ioccc/bench_rule_count -m 1 -r 1
+run_bench 31 test_ioccc/bench_walk -n 5000 -l 200
+run_bench 33 test_ioccc/bench_walk_set -n 5000 -r 1
+# try_fts_walk -c: compare the fts(3) and parallel walks
+run_bench 32 test_ioccc/try_fts_walk -c -s 7 -m 0 -M 0 -d 0 test_ioccc/test_JSON
+run_bench 34 test_ioccc/bench_canon_path -n 5000 -r 1
+
 # report overall status
 #
 if [[ $EXIT_CODE -ne 0 ]]; then
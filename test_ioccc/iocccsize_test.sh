@@ -23,7 +23,7 @@ export EXIT_CODE=0
 export IOCCCSIZE_ARGS="-v 1 --"
 export V_FLAG=0
 export TOPDIR=
-export TEST_IOCCCSIZE_VERSION="1.4.1 2025-03-14"
+export TEST_IOCCCSIZE_VERSION="1.5.0 2026-10-18"
 
 
 # IOCCC requires use of C locale
@@ -722,6 +722,60 @@ main(int argc, char **argv)
 EOF
 test_size hello-jp3.c "313 398 7"
 
+#######################################################################
+
+# Batch mode must agree with sizing one file at a time, in the same order,
+# whether the paths come from args or from a NUL-separated list on stdin.
+# Each file that cannot be read gets an error line instead, with exit code 5.
+#
+test_batch()
+{
+    declare expect		# iocccsize -v 1 output, one file at a time
+    declare batch_args		# iocccsize -B -v 1 output, paths as args
+    declare batch_list		# iocccsize -B -v 1 output, paths on stdin
+    declare file
+    declare status		# iocccsize -B exit code
+
+    expect=$(for file in "$WORKDIR"/*.c; do
+	echo "$("$IOCCCSIZE" -v 1 -- "$file" 2>/dev/null) $file"
+    done)
+    batch_args=$("$IOCCCSIZE" -v 1 -B -j 3 -- "$WORKDIR"/*.c 2>/dev/null)
+    batch_list=$(printf '%s\0' "$WORKDIR"/*.c | "$IOCCCSIZE" -v 1 -B -j 2 2>/dev/null)
+    if [[ $batch_args != "$expect" ]]; then
+	echo "$0: ERROR: FAIL: $IOCCCSIZE -B with file args differs from one file at a time" 1>&2
+	EXIT_CODE=1
+    elif [[ $batch_list != "$expect" ]]; then
+	echo "$0: ERROR: FAIL: $IOCCCSIZE -B with a NUL-separated list differs from one file at a time" 1>&2
+	EXIT_CODE=1
+    elif [[ $V_FLAG -ge 1 ]]; then
+	echo "$0: PASS: $IOCCCSIZE -B" 1>&2
+    fi
+
+    # a directory and a missing file each get an error line, in order, and exit 5
+    expect=$(printf '%s\n' "error: Is a directory: $WORKDIR" \
+			    "error: No such file or directory: $WORKDIR/no-such-file.c")
+    batch_args=$("$IOCCCSIZE" -B -j 2 -- "$WORKDIR" "$WORKDIR/no-such-file.c" 2>/dev/null)
+    status="$?"
+    if [[ $status -ne 5 ]]; then
+	echo "$0: ERROR: FAIL: $IOCCCSIZE -B with unreadable files exited $status, expected 5" 1>&2
+	EXIT_CODE=1
+    elif [[ $batch_args != "$expect" ]]; then
+	echo "$0: ERROR: FAIL: $IOCCCSIZE -B did not write an error line for each unreadable file" 1>&2
+	EXIT_CODE=1
+    elif [[ $V_FLAG -ge 1 ]]; then
+	echo "$0: PASS: $IOCCCSIZE -B with unreadable files" 1>&2
+    fi
+
+    # -j must be a number in range
+    if "$IOCCCSIZE" -B -j 2x -- "$WORKDIR"/*.c >/dev/null 2>&1; then
+	echo "$0: ERROR: FAIL: $IOCCCSIZE -B -j 2x was accepted" 1>&2
+	EXIT_CODE=1
+    elif [[ $V_FLAG -ge 1 ]]; then
+	echo "$0: PASS: $IOCCCSIZE -B -j 2x rejected" 1>&2
+    fi
+}
+test_batch
+
 
 # All Done!!! All Done!!! -- Jessica Noll, Age 2
 #
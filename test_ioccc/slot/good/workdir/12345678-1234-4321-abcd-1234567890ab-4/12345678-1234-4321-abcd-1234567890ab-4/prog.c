@@ -0,0 +1,2 @@
+#include <stdio.h>
+int main(void) { puts("Hello, World 4!"); }
@@ -283,6 +283,12 @@ test_dir_name(int test_num, char const *path, char const *expect)
 }
 
 
+/*
+ * length of the multi-chunk copyfile() test file
+ */
+#define BIG_COPY_LEN ((size_t)(3 * COPYFILE_BUFSIZ + 17))
+
+
 int
 main(int argc, char **argv)
 {
@@ -304,6 +310,8 @@ main(int argc, char **argv)
     bool dir_exists = false;            /* true ==> directory already exists (for testing modes) */
     off_t size1 = 0;			/* for checking size_if_file() */
     off_t size2 = 0;			/* for checking size_if_file() */
+    FILE *big_stream = NULL;		/* multi-chunk copyfile() test file */
+    size_t big_len = 0;			/* bytes written to, or read from, big_stream */
     struct json *tree = NULL;           /* check that the jparse.json file is valid JSON */
     int ret;
     int i;
@@ -1030,6 +1038,51 @@ main(int argc, char **argv)
         fdbg(stderr, DBG_MED, "/dev/null is NOT a character device");
     }
 
+    /*
+     * copy a file of several COPYFILE_BUFSIZ chunks plus a partial chunk
+     * so that the chunked verification of copyfile() crosses chunk boundaries
+     */
+    (void) unlink("test_file_util.big");
+    (void) unlink("test_file_util.big.copy");
+    errno = 0;      /* pre-clear errno for errp() */
+    big_stream = fopen("test_file_util.big", "wb");
+    if (big_stream == NULL) {
+        errp(45, __func__, "cannot create test_file_util.big");
+        not_reached();
+    }
+    for (big_len = 0; big_len < BIG_COPY_LEN; ++big_len) {
+        (void) fputc((int)((big_len * 31 + (big_len >> 12)) & 0xff), big_stream);
+    }
+    errno = 0;      /* pre-clear errno for errp() */
+    if (fclose(big_stream) != 0) {
+        errp(46, __func__, "fclose error for test_file_util.big");
+        not_reached();
+    }
+    bytes = copyfile("test_file_util.big", "test_file_util.big.copy", true, 0);
+    if (bytes != BIG_COPY_LEN || size_if_file("test_file_util.big.copy") != (off_t)BIG_COPY_LEN) {
+        err(47, __func__, "copyfile() of test_file_util.big copied %zu bytes != %zu", bytes, (size_t)BIG_COPY_LEN);
+        not_reached();
+    }
+    errno = 0;      /* pre-clear errno for errp() */
+    big_stream = fopen("test_file_util.big.copy", "rb");
+    if (big_stream == NULL) {
+        errp(48, __func__, "cannot open test_file_util.big.copy");
+        not_reached();
+    }
+    for (big_len = 0; big_len < BIG_COPY_LEN; ++big_len) {
+        if (fgetc(big_stream) != (int)((big_len * 31 + (big_len >> 12)) & 0xff)) {
+            err(49, __func__, "test_file_util.big.copy differs at offset %zu", big_len);
+            not_reached();
+        }
+    }
+    (void) fclose(big_stream);
+    errno = 0;      /* pre-clear errno for errp() */
+    if (unlink("test_file_util.big") != 0 || unlink("test_file_util.big.copy") != 0) {
+        errp(50, __func__, "unable to delete test_file_util.big or test_file_util.big.copy");
+        not_reached();
+    }
+    fdbg(stderr, DBG_MED, "copyfile() copied and verified %zu bytes of test_file_util.big", bytes);
+
     /*
      * All Done!!! All Done!!! -- Jessica Noll, Age 2
      */
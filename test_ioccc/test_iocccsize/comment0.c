@@ -0,0 +1,2 @@
+// comment one line "with a comment string" inside
+int x;
@@ -0,0 +1,2 @@
+/* comment block same line 'with a comment string' */
+int x;
@@ -0,0 +1 @@
+/*/ int if for /*/
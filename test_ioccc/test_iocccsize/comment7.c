@@ -0,0 +1,2 @@
+// comment with backslash newline \
+int a = 666;
@@ -0,0 +1,13 @@
+#include <stdlib.h>
+
+#define STRLEN(s)		(sizeof (s)-1)
+
+typedef struct {
+	size_t length;
+	const char *word;
+} Word;
+
+Word list[] = {
+	{ STRLEN("spaced  curly"), "spaced  curly"} ,
+	{ 0, NULL}
+} ;
@@ -0,0 +1,8 @@
+#include <stdio.h>
+
+int
+main(int argc, char **argv)
+{
+	(void) printf("こんにちは世界！\n");
+	return 0;
+}
@@ -0,0 +1,9 @@
+#include <stdio.h>
+
+int
+main(int argc, char **argv)
+{
+	char str_こんにちは世界！[] = "Kon'nichiwa sekai!\n";
+	(void) printf(str_こんにちは世界！);
+	return 0;
+}
@@ -0,0 +1,12 @@
+#include <stdio.h>
+
+int
+main(int argc, char **argv)
+{
+	/* Identifier with 4 ASCII + 20 hiragana, katakana, and kanji.
+	 * There is nothing wrong with this source code.
+	 */
+	char str_このソースコードには何も問題はありません[] = "Kono sōsukōdo ni wa nani mo mondai wa arimasen.\n";
+	(void) printf(str_このソースコードには何も問題はありません);
+	return 0;
+}
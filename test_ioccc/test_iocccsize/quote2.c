@@ -0,0 +1 @@
+char str[] = "'xor'";
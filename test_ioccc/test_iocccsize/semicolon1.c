@@ -0,0 +1,11 @@
+#include <stdio.h>
+
+int
+main(int argc, char **argv)
+{
+	int i;
+	for (i = 0; i < 3; i++) {
+		(void) printf("%d\n", i);
+	}
+	return 0;
+}
@@ -0,0 +1,3 @@
+#define FOO \
+    int a = 666;
+FOO;
@@ -104,7 +104,7 @@ static char *program = "try_walk_set";		    /* our name */
  * usage message
  */
 static char const * const usage_msg =
-    "usage: %s [-h] [-v level] [-V] [-q] [-T] [-o]\n"
+    "usage: %s [-h] [-v level] [-V] [-q] [-T] [-o] [-p] [-c]\n"
     "\t\t\t[-m max_path] [-M max_depth] [-d max_depth]\n"
     "\t\t\t[-F max_file] [-D max_dir] [-S max_sym] [-O max_other] [-s set] topdir\n"
     "\n"
@@ -115,6 +115,8 @@ static char const * const usage_msg =
     "\n"
     "\t-o\t\tkeep paths in original order (def: sort dynamic arrays by canonicalized path)\n"
     "\t-T\t\tprocess as a tarball listing\n"
+    "\t-p\t\twalk with %d worker threads (def: walk with fts(3))\n"
+    "\t-c\t\talso walk with the other walker, compare the two walks (a difference is a walk error)\n"
     "\n"
     "\t-m max_path\tmax canonicalized path length, 0 ==> no limit (def: %d)\n"
     "\t-M max_file\tmax length of any canonicalized path component, 0 ==> no limit (def: %d)\n"
@@ -159,7 +161,8 @@ static bool test_walk(FILE *out,
 		      char const *topdir, struct walk_set *set, char *context,
 		      size_t max_path_len, size_t max_filename_len, int_least32_t max_depth,
 		      int_least32_t max_file, int_least32_t max_dir, int_least32_t max_sym, int_least32_t max_other,
-		      bool sort_cpath);
+		      bool sort_cpath, bool parallel, bool compare);
+static bool same_walk_stat(struct walk_stat *a, struct walk_stat *b);
 
 
 int
@@ -174,6 +177,8 @@ main(int argc, char *argv[])
     size_t max_filename_len = MAX_FILENAME_LEN;	    /* max length of each component of path, 0 ==> no limit */
     int_least32_t max_depth = MAX_PATH_DEPTH;	    /* max canonicalized path depth where 0 is the topdir, 0 ==> no limit */
     bool sort_cpath = true;			    /* true ==> dynamic arrays by canonicalized path, false ==> do not sort */
+    bool parallel = false;			    /* true ==> walk with worker threads, false ==> walk with fts(3) */
+    bool compare = false;			    /* true ==> compare the fts(3) and worker thread walks */
     /**/
     int_least32_t max_file = MAX_EXTRA_FILE_COUNT;  /* max counted files, 0 ==> unlimited, -1 ==> none */
     int_least32_t max_dir = MAX_EXTRA_DIR_COUNT;    /* max counted directories, 0 ==> unlimited, -1 ==> none */
@@ -193,7 +198,7 @@ main(int argc, char *argv[])
      * parse args
      */
     program = argv[0];
-    while ((i = getopt(argc, argv, ":hv:VqoTm:M:d:s:F:D:S:O:")) != -1) {
+    while ((i = getopt(argc, argv, ":hv:VqoTpcm:M:d:s:F:D:S:O:")) != -1) {
 	switch (i) {
 	case 'h':	/* -h - print help to stderr and exit 0 */
 	    usage(2, NULL);
@@ -221,6 +226,12 @@ main(int argc, char *argv[])
 	case 'T':
 	    err(3, program, "-T used, however tarball list processing it NOT yet supported"); /*ooo*/
 	    break;
+	case 'p':
+	    parallel = true;
+	    break;
+	case 'c':
+	    compare = true;
+	    break;
 	case 'm':
 	    errno = 0;
 	    max_path_len = (size_t) strtoumax(optarg, NULL, 0);
@@ -363,7 +374,7 @@ main(int argc, char *argv[])
 			    topdir, &walk_mkiocccentry, "mkiocccentry",
 			    max_path_len, max_filename_len, max_depth,
 			    max_file, max_dir, max_sym, max_other,
-			    sort_cpath);
+			    sort_cpath, parallel, compare);
 	exit_code = (walk_ok == false) ? 1 : exit_code;
     }
 
@@ -377,7 +388,7 @@ main(int argc, char *argv[])
 			    topdir, &walk_txzchk, "txzchk",
 			    max_path_len, max_filename_len, max_depth,
 			    max_file, max_dir, max_sym, max_other,
-			    sort_cpath);
+			    sort_cpath, parallel, compare);
 	exit_code = (walk_ok == false) ? 1 : exit_code;
     }
 
@@ -391,7 +402,7 @@ main(int argc, char *argv[])
 			    topdir, &walk_chkentry_S, "chkentry -S",
 			    max_path_len, max_filename_len, max_depth,
 			    max_file, max_dir, max_sym, max_other,
-			    sort_cpath);
+			    sort_cpath, parallel, compare);
 	exit_code = (walk_ok == false) ? 1 : exit_code;
     }
 
@@ -405,7 +416,7 @@ main(int argc, char *argv[])
 			    topdir, &walk_chkentry_s, "chkentry -s",
 			    max_path_len, max_filename_len, max_depth,
 			    max_file, max_dir, max_sym, max_other,
-			    sort_cpath);
+			    sort_cpath, parallel, compare);
 	exit_code = (walk_ok == false) ? 1 : exit_code;
     }
 
@@ -419,7 +430,7 @@ main(int argc, char *argv[])
 			    topdir, &walk_chkentry_w, "chkentry -w",
 			    max_path_len, max_filename_len, max_depth,
 			    max_file, max_dir, max_sym, max_other,
-			    sort_cpath);
+			    sort_cpath, parallel, compare);
 	exit_code = (walk_ok == false) ? 1 : exit_code;
     }
 
@@ -433,7 +444,7 @@ main(int argc, char *argv[])
 			    topdir, &walk_anything, "anything goes",
 			    max_path_len, max_filename_len, max_depth,
 			    max_file, max_dir, ANY_COUNT, ANY_COUNT,
-			    sort_cpath);
+			    sort_cpath, parallel, compare);
 	exit_code = (walk_ok == false) ? 1 : exit_code;
     }
 
@@ -469,6 +480,7 @@ usage(int exitcode, char const *str)
 	(void) fprintf(stderr, "%s: %s\n", TRY_FTS_WALK_BASENAME, str);
     }
     fprintf_usage(exitcode, stderr, usage_msg, TRY_FTS_WALK_BASENAME,
+			    WALK_THREADS,
 			    MAX_PATH_LEN, MAX_FILENAME_LEN, MAX_PATH_DEPTH,
 			    ANY_COUNT, NO_COUNT, MAX_EXTRA_FILE_COUNT,
 			    ANY_COUNT, NO_COUNT, MAX_EXTRA_DIR_COUNT,
@@ -501,6 +513,8 @@ usage(int exitcode, char const *str)
  *	max_other	    - max counted non-file/dir/symlinks, 0 ==> unlimited, -1 ==> none
  *
  *      sort_cpath	    - true ==> dynamic arrays by canonicalized path, false ==> do not sort
+ *	parallel	    - true ==> walk with worker threads, false ==> walk with fts(3)
+ *	compare		    - true ==> also walk with the other walker, and compare the two walks
  *
  * returns:
  *	true ==> no walk errors found
@@ -511,9 +525,12 @@ test_walk(FILE *out,
 	  char const *topdir, struct walk_set *set, char *context,
 	  size_t max_path_len, size_t max_filename_len, int_least32_t max_depth,
 	  int_least32_t max_file, int_least32_t max_dir, int_least32_t max_sym, int_least32_t max_other,
-	  bool sort_cpath)
+	  bool sort_cpath, bool parallel, bool compare)
 {
     struct walk_stat wstat;	    /* walk_stat being processed */
+    struct walk_stat wstat2;	    /* walk_stat of the other walker when comparing */
+    struct walk_set *set2;	    /* copy of set for the other walker */
+    bool walk2_ok = true;	    /* true ==> no walk errors found by the other walker */
     bool walk_ok = true;	    /* true ==> no walk errors found, false ==> some walk errors found */
 
     /*
@@ -541,7 +558,7 @@ test_walk(FILE *out,
      */
     init_walk_stat(&wstat, topdir, set, context,
 		   max_path_len, max_filename_len, max_depth,
-		   false);
+		   false, parallel);
 
     /*
      * walk a file system tree, recording steps
@@ -552,6 +569,33 @@ test_walk(FILE *out,
 	return false;
     }
 
+    /*
+     * if -c, walk again with the other walker and compare the two walks, in the order they were recorded
+     */
+    if (compare) {
+	set2 = dup_walk_set(set);
+	init_walk_stat(&wstat2, topdir, set2, context,
+		       max_path_len, max_filename_len, max_depth,
+		       false, ! parallel);
+	walk2_ok = fts_walk(&wstat2);
+	if (walk2_ok == false) {
+	    warn(__func__, "%s: %s walk failed for: %s", context, parallel ? "fts(3)" : "parallel", topdir);
+	    walk_ok = false;
+	} else if (same_walk_stat(&wstat, &wstat2) == false) {
+	    warn(__func__, "%s: fts(3) and parallel walks differ for: %s", context, topdir);
+	    walk_ok = false;
+	} else {
+	    dbg(DBG_LOW, "%s: fts(3) and parallel walks are the same for: %s", context, topdir);
+	}
+	free_walk_stat(&wstat2);
+	free_dup_walk_set(set2);
+	set2 = NULL;
+	if (walk_ok == false) {
+	    free_walk_stat(&wstat);
+	    return false;
+	}
+    }
+
     /*
      * sort walk_stat arrays by canonicalized path in a case independent way unless -o
      */
@@ -587,3 +631,89 @@ test_walk(FILE *out,
     }
     return walk_ok;
 }
+
+/*
+ * same_walk_stat - determine if two walks recorded the same items in the same order
+ *
+ * given:
+ *	a	    - pointer to the 1st struct walk_stat
+ *	b	    - pointer to the 2nd struct walk_stat
+ *
+ * returns:
+ *	true ==> both walks recorded the same items, steps, counts and rule matches
+ *	false ==> the walks differ
+ */
+static bool
+same_walk_stat(struct walk_stat *a, struct walk_stat *b)
+{
+    struct item *ia;	    /* item of the 1st walk */
+    struct item *ib;	    /* item of the 2nd walk */
+    intmax_t len;	    /* number of items in all */
+    intmax_t j;
+    int cat;
+    int i;
+
+    /*
+     * firewall
+     */
+    if (a == NULL || b == NULL) {
+	err(8, __func__, "called with NULL arg(s)");
+	not_reached();
+    }
+    if (a->all == NULL || b->all == NULL || a->set == NULL || b->set == NULL) {
+	err(9, __func__, "called with a walk_stat that is not initialized");
+	not_reached();
+    }
+
+    /*
+     * compare walk totals
+     */
+    if (a->steps != b->steps) {
+	warn(__func__, "steps differ: %ju != %ju", a->steps, b->steps);
+	return false;
+    }
+    if (a->skip != b->skip) {
+	warn(__func__, "skip differs: %s != %s", booltostr(a->skip), booltostr(b->skip));
+	return false;
+    }
+    for (cat = 0; cat < WALK_CAT_COUNT; ++cat) {
+	if (a->cat_count[cat] != b->cat_count[cat]) {
+	    warn(__func__, "%s count differs: %jd != %jd", walk_cat_name((enum walk_cat)cat),
+			   a->cat_count[cat], b->cat_count[cat]);
+	    return false;
+	}
+    }
+
+    /*
+     * compare items in the order they were recorded
+     */
+    len = dyn_array_tell(a->all);
+    if (len != dyn_array_tell(b->all)) {
+	warn(__func__, "number of items differ: %jd != %jd", len, dyn_array_tell(b->all));
+	return false;
+    }
+    for (j = 0; j < len; ++j) {
+	ia = dyn_array_value(a->all, struct item *, j);
+	ib = dyn_array_value(b->all, struct item *, j);
+	if (strcmp(ia->fts_path, ib->fts_path) != 0 || strcmp(ia->orig_path, ib->orig_path) != 0) {
+	    warn(__func__, "item %jd path differs: %s != %s", j, ia->fts_path, ib->fts_path);
+	    return false;
+	}
+	if (ia->fts_level != ib->fts_level || ia->st_size != ib->st_size ||
+	    ia->st_mode != ib->st_mode || ia->category != ib->category) {
+	    warn(__func__, "item %jd differs for: %s", j, ia->fts_path);
+	    return false;
+	}
+    }
+
+    /*
+     * compare walk_rule match counts
+     */
+    for (i = 0; a->set->rule[i].pattern != NULL; ++i) {
+	if (a->set->rule[i].match_count != b->set->rule[i].match_count) {
+	    warn(__func__, "walk_rule %d: %s match count differs", i, a->set->rule[i].pattern);
+	    return false;
+	}
+    }
+    return true;
+}
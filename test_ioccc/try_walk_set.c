@@ -914,7 +914,7 @@ test_walk(int argc, char **argv, FILE *in, FILE *out,
      */
     init_walk_stat(&wstat, topdir, set, context,
 		   max_path_len, max_filename_len, max_depth,
-		   tar_listing);
+		   tar_listing, false);
     dbg(DBG_V2_HIGH, "%s: initialized walk_stat for context: %s", __func__, context);
     memset(&parsed, 0, sizeof(parsed));	/* paranoia */
 
@@ -93,7 +93,7 @@ TAR="$(type -P tar 2>/dev/null)"
 # but due to the reasons cited above we must rely on the more complicated form:
 [[ -z "$TAR" ]] && TAR="/usr/bin/tar"
 
-export TXZCHK_TEST_VERSION="2.0.2 2025-11-15"
+export TXZCHK_TEST_VERSION="2.1.1 2026-10-18"
 export FNAMCHK="./test_ioccc/fnamchk"
 export TXZCHK="./txzchk"
 export TXZCHK_TREE="./test_ioccc/test_txzchk"
@@ -655,6 +655,219 @@ while read -r file; do
     run_test fail "$file"
 done < <(find "$TXZCHK_BAD_TREE" -type f -name '*.txt' -print)
 
+# run_stress_test - run txzchk on a synthetic listing with many files
+#
+# usage:
+#	run_stress_test count
+#
+#	run_stress_test	    - our function name
+#	count		    - number of extra files in the listing
+#
+# The listing has the required files, count extra files and three duplicates:
+# an exact duplicate and two files that differ only in case from another file.
+# txzchk must fail and must report exactly the three duplicates, sorted by path.
+#
+run_stress_test()
+{
+    # parse args
+    #
+    if [[ $# -ne 1 ]]; then
+	echo "$0: ERROR: expected 1 arg to run_stress_test, found $#" 1>&2
+	exit 43
+    fi
+    declare count="$1"
+    declare stress_dir
+    declare stress_file
+    declare stress_err
+
+    stress_dir=$(mktemp -d .txzchk_test.stress.XXXXXXXXXX)
+    status="$?"
+    if [[ $status -ne 0 ]]; then
+	echo "$0: ERROR: mktemp -d .txzchk_test.stress.XXXXXXXXXX exit code: $status" 1>&2
+	EXIT_CODE=44
+	return
+    fi
+    stress_file="$stress_dir/submit.test-0.1234567890.txt"
+    stress_err="$stress_dir/stderr"
+
+    # form the listing
+    #
+    awk -v count="$count" 'BEGIN {
+	printf("drwxr-xr-x  0 1000   1000       0 Jun  3 07:41 test-0/\n");
+	split("Makefile prog.c remarks.md .info.json .auth.json", req, " ");
+	for (i = 1; i <= 5; ++i) {
+	    printf("-r--r--r--  0 1000   1000       4 Jun  3 07:41 test-0/%s\n", req[i]);
+	}
+	for (i = 0; i < count; ++i) {
+	    printf("-r--r--r--  0 1000   1000       1 Jun  3 07:41 test-0/f%05d\n", i);
+	}
+	printf("-r--r--r--  0 1000   1000       1 Jun  3 07:41 test-0/f%05d\n", int(count/4));
+	printf("-r--r--r--  0 1000   1000       1 Jun  3 07:41 test-0/F%05d\n", count-1);
+	printf("-r--r--r--  0 1000   1000       4 Jun  3 07:41 test-0/Prog.c\n");
+    }' > "$stress_file"
+    status="$?"
+    if [[ $status -ne 0 ]]; then
+	echo "$0: ERROR: unable to form stress test listing: $stress_file exit code: $status" 1>&2
+	EXIT_CODE=45
+	rm -rf "$stress_dir"
+	return
+    fi
+
+    if [[ $V_FLAG -ge 3 ]]; then
+	echo "$0: debug[3]: about to run: $TXZCHK -x -w -v 0 -F $FNAMCHK -T -E txt -- $stress_file 2>$stress_err" 1>&2
+    fi
+    "$TXZCHK" -x -w -v 0 -F "$FNAMCHK" -T -E txt -- "$stress_file" 2>"$stress_err"
+    status="$?"
+    if [[ $status -eq 0 ]]; then
+	echo "$0: Warning: in run_stress_test: FAIL: txzchk passed a listing with $count extra files and 3 duplicates" | tee -a -- "$LOGFILE" 1>&2
+	EXIT_CODE=1
+    fi
+
+    # the duplicates must be reported, sorted by path
+    #
+    if ! diff -u <(printf 'Warning: txzchk: file F%05d is a duplicate file: differs only in case from f%05d\n' \
+			  "$((count-1))" "$((count-1))";
+		  echo 'Warning: txzchk: file Prog.c is a duplicate file: differs only in case from prog.c';
+		  printf 'Warning: txzchk: file f%05d is a duplicate file\n' "$((count/4))") \
+		  <(grep 'is a duplicate file' "$stress_err") 1>&2; then
+	echo "$0: Warning: in run_stress_test: FAIL: duplicates not reported as expected for $count extra files" | tee -a -- "$LOGFILE" 1>&2
+	EXIT_CODE=1
+    elif [[ $V_FLAG -ge 5 ]]; then
+	echo "$0: debug[5]: in run_stress_test: PASS: $count extra files" 1>&2
+    fi
+
+    rm -rf "$stress_dir"
+    return
+}
+
+# run stress test
+#
+if [[ $V_FLAG -ge 3 ]]; then
+    echo "$0: debug[3]: about to run txzchk stress test" 1>&2
+fi
+run_stress_test 50000
+
+# run_lzma_cmp - run txzchk on a tarball with its own reader and with tar
+#
+# usage:
+#	run_lzma_cmp {same|fail} tarball
+#
+#	run_lzma_cmp	    - our function name
+#	same		    - both readers must give the same exit code and stderr
+#	fail		    - both readers must reject the tarball
+#	tarball		    - the tarball to give to txzchk
+#
+run_lzma_cmp()
+{
+    # parse args
+    #
+    if [[ $# -ne 2 ]]; then
+	echo "$0: ERROR: expected 2 args to run_lzma_cmp, found $#" 1>&2
+	exit 46
+    fi
+    declare same_fail="$1"
+    declare tarball="$2"
+    declare test_mode=""
+    declare lzma_status
+    declare tar_status
+
+    if [[ $(basename "$tarball") =~ ^submit.test- ]]; then
+	test_mode="-x"
+    fi
+
+    if [[ $V_FLAG -ge 5 ]]; then
+	echo "$0: debug[5]: in run_lzma_cmp: about to run: $TXZCHK $test_mode -w -v 0 -F $FNAMCHK [-t $TAR] -- $tarball" 1>&2
+    fi
+    # SC2086 (info): Double quote to prevent globbing and word splitting.
+    # https://www.shellcheck.net/wiki/SC2086
+    # shellcheck disable=SC2086
+    "$TXZCHK" $test_mode -w -v 0 -F "$FNAMCHK" -- "$tarball" >/dev/null 2>"$LZMA_STDERR"
+    lzma_status="$?"
+    # shellcheck disable=SC2086
+    "$TXZCHK" $test_mode -w -v 0 -F "$FNAMCHK" -t "$TAR" -- "$tarball" >/dev/null 2>"$TAR_STDERR"
+    tar_status="$?"
+
+    if [[ $same_fail = fail ]]; then
+	if [[ $lzma_status -eq 0 || $tar_status -eq 0 ]]; then
+	    echo "$0: Warning: in run_lzma_cmp: FAIL: $tarball accepted: without -t exit code: $lzma_status with -t $TAR exit code: $tar_status" | tee -a -- "$LOGFILE" 1>&2
+	    EXIT_CODE=1
+	    return
+	fi
+    elif [[ $lzma_status -ne $tar_status ]]; then
+	echo "$0: Warning: in run_lzma_cmp: FAIL: $tarball: without -t exit code: $lzma_status != with -t $TAR exit code: $tar_status" | tee -a -- "$LOGFILE" 1>&2
+	EXIT_CODE=1
+	return
+    elif ! cmp -s "$LZMA_STDERR" "$TAR_STDERR"; then
+	echo "$0: Warning: in run_lzma_cmp: FAIL: $tarball: warnings without -t differ from warnings with -t $TAR" | tee -a -- "$LOGFILE" 1>&2
+	if [[ $V_FLAG -ge 1 ]]; then
+	    diff -u "$TAR_STDERR" "$LZMA_STDERR" 1>&2
+	fi
+	EXIT_CODE=1
+	return
+    fi
+    if [[ $V_FLAG -ge 5 ]]; then
+	echo "$0: debug[5]: in run_lzma_cmp: PASS: $tarball exit code: $lzma_status" 1>&2
+    fi
+    return
+}
+
+# run liblzma test
+#
+# When txzchk is built with liblzma (see LZMA_FLAGS in the Makefile) it reads
+# a tarball itself unless -t tar is given.  Each tarball formed by make test
+# must get the same verdict and the same warnings from both readers, and a
+# truncated tarball and a tarball that is not xz compressed must be rejected
+# by both.
+#
+if "$TXZCHK" -V 2>/dev/null | grep -q '^liblzma version:'; then
+    if [[ $V_FLAG -ge 3 ]]; then
+	echo "$0: debug[3]: about to run txzchk liblzma test" 1>&2
+    fi
+    LZMA_DIR=$(mktemp -d .txzchk_test.lzma.XXXXXXXXXX)
+    status="$?"
+    if [[ $status -ne 0 ]]; then
+	echo "$0: ERROR: mktemp -d .txzchk_test.lzma.XXXXXXXXXX exit code: $status" 1>&2
+	EXIT_CODE=47
+    else
+	LZMA_STDERR="$LZMA_DIR/lzma.stderr"
+	TAR_STDERR="$LZMA_DIR/tar.stderr"
+
+	# tarballs formed by make test
+	#
+	while read -r file; do
+	    run_lzma_cmp same "$file"
+	done < <(find ./test_ioccc/workdir ./test_ioccc/slot -type f -name 'submit.*.txz' -print 2>/dev/null | sort)
+
+	# a truncated tarball and a tarball that is not xz compressed
+	#
+	mkdir -p "$LZMA_DIR/test-0" "$LZMA_DIR/truncated" "$LZMA_DIR/plain"
+	for file in Makefile prog.c remarks.md .info.json .auth.json; do
+	    date > "$LZMA_DIR/test-0/$file"
+	done
+	"$TAR" --format=v7 -cJf "$LZMA_DIR/submit.test-0.1234567890.txz" -C "$LZMA_DIR" test-0 2>"$LZMA_DIR/tar.err"
+	status="$?"
+	if [[ $status -ne 0 ]]; then
+	    echo "$0: ERROR: $TAR --format=v7 -cJf $LZMA_DIR/submit.test-0.1234567890.txz exit code: $status" 1>&2
+	    EXIT_CODE=48
+	else
+	    head -c "$(( $(wc -c < "$LZMA_DIR/submit.test-0.1234567890.txz") / 2 ))" \
+		"$LZMA_DIR/submit.test-0.1234567890.txz" > "$LZMA_DIR/truncated/submit.test-0.1234567890.txz"
+	    run_lzma_cmp fail "$LZMA_DIR/truncated/submit.test-0.1234567890.txz"
+	fi
+	"$TAR" --format=v7 -cf "$LZMA_DIR/plain/submit.test-0.1234567890.txz" -C "$LZMA_DIR" test-0 2>"$LZMA_DIR/tar.err"
+	status="$?"
+	if [[ $status -ne 0 ]]; then
+	    echo "$0: ERROR: $TAR --format=v7 -cf $LZMA_DIR/plain/submit.test-0.1234567890.txz exit code: $status" 1>&2
+	    EXIT_CODE=49
+	else
+	    run_lzma_cmp fail "$LZMA_DIR/plain/submit.test-0.1234567890.txz"
+	fi
+	rm -rf "$LZMA_DIR"
+    fi
+elif [[ $V_FLAG -ge 3 ]]; then
+    echo "$0: debug[3]: txzchk not built with liblzma, skipping txzchk liblzma test" 1>&2
+fi
+
 # explicitly delete the temporary files
 
 if [[ -z $K_FLAG ]]; then
@@ -75,6 +75,9 @@
 #include <stdint.h>
 #include <sys/wait.h>	/* for WEXITSTATUS() */
 #include <locale.h>
+#include <errno.h>
+#include <time.h>
+#include <inttypes.h>	/* strtoumax() */
 
 /*
  * txzchk - IOCCC tarball validation check tool
@@ -101,14 +104,15 @@ static bool show_warnings = false;	        /* true ==> show warnings even if -q
 static bool entertain = false;			/* true ==> show entertaining messages */
 static uintmax_t feathery = 3;			/* for entertain option */
 static bool test_mode = false;                  /* true ==> use -t in fnamchk */
+static bool use_tar = TXZCHK_USE_TAR;		/* true ==> list the tarball with tar -tJvf */
 
 
 /*
  * txzchk specific structs
  */
-static struct txz_line *txz_lines;		/* all of the read lines */
 static struct tarball tarball;			/* all the information collected from tarball */
-static struct txz_file *txz_files;		/* linked list of the files in the tarball */
+static struct walk_stat wstat;			/* every file recorded so far (see record_txz_file()) */
+static struct dyn_array *txz_dups;		/* struct txz_dup of each duplicate file found */
 
 /*
  * usage message
@@ -125,7 +129,8 @@ static const char * const usage_msg =
     "\t-f feathers\tdefine how many feathers is feathery (for -e)\n"
     "\t-w\t\talways show warning messages\n"
     "\t-V\t\tprint version string and exit\n"
-    "\t-t tar\t\tpath to tar executable that supports the -J (xz) option (def: %s)\n"
+    "\t-t tar\t\tlist tarball with tar executable that supports the -J (xz) option (def: %s)\n"
+    "\t\t\t    NOTE: without -t, txzchk reads the tarball itself if built with liblzma\n"
     "\t-F fnamchk\tpath to tool that checks if tarball_path is a valid compressed tarball\n"
     "\t\t\t    filename (def: %s)\n"
     "\t-T\t\tassume tarball_path is a text file with tar listing (for testing\n"
@@ -197,6 +202,9 @@ main(int argc, char **argv)
 	    print("jparse utils version: %s\n", JPARSE_UTILS_VERSION);
 	    print("jparse UTF-8 version: %s\n", JPARSE_UTF8_VERSION);
 	    print("jparse library version: %s\n", JPARSE_LIBRARY_VERSION);
+#if defined(TXZCHK_USE_LZMA)
+	    print("liblzma version: %s\n", lzma_version_string());
+#endif
 	    exit(2); /*ooo*/
 	    not_reached();
 	    break;
@@ -205,6 +213,7 @@ main(int argc, char **argv)
 	    break;
 	case 't': /* -t tar - specify path to tar (perhaps to tar and feather :-) ) */
 	    tar = optarg;
+	    use_tar = true;
 	    break;
 	case 'T': /* -T - text (test) file mode - don't rely on tar: just read file as if it was a text file */
 	    read_from_text_file = true;
@@ -287,7 +296,7 @@ main(int argc, char **argv)
      * moving historic critical applications, look to see if the alternate path works instead.
      */
 
-    if (!read_from_text_file) {
+    if (!read_from_text_file && use_tar) {
         /*
          * we need tar
          */
@@ -330,7 +339,7 @@ main(int argc, char **argv)
     /*
      * we need to free the paths to the tools
      */
-    if (tar != NULL && !read_from_text_file && found_tar) {
+    if (tar != NULL && found_tar) {
         free(tar);
         tar = NULL;
     }
@@ -454,15 +463,15 @@ txzchk_sanity_chks(char const *tar, char const *fnamchk)
     /*
      * firewall
      */
-    if ((tar == NULL && !read_from_text_file) || fnamchk == NULL || tarball_path == NULL) {
+    if ((tar == NULL && !read_from_text_file && use_tar) || fnamchk == NULL || tarball_path == NULL) {
 	err(12, __func__, "called with NULL arg(s)");
 	not_reached();
     }
 
     /*
-     * if text file flag not used tar must be executable
+     * if text file flag not used and we list the tarball with tar, tar must be executable
      */
-    if (!read_from_text_file)
+    if (!read_from_text_file && use_tar)
     {
 	if (!exists(tar)) {
 	    fpara(stderr,
@@ -627,98 +636,139 @@ txzchk_sanity_chks(char const *tar, char const *fnamchk)
 
 
 /*
- * check_all_txz_files - check txz_files list after parsing tarball (or text file)
+ * add_txz_dup - add a duplicate file to the txz_dups list
  *
- * This function does a few sanity checks but primarily it uses the walk code,
- * recording the step of each file and verifying everything is okay.
+ * given:
  *
- * Returns void. Ignores empty files (though these should not be in the list at
- * all).
+ *	path	    - canonicalized path of the duplicate file
+ *	first	    - canonicalized path of the file it duplicates
  *
- * This function does not return on NULL filenames or basenames (neither of
- * which should ever happen).
+ * This function does not return on error.
  */
 static void
-check_all_txz_files(void)
+add_txz_dup(char const *path, char const *first)
 {
-    struct txz_file *file;  /* to iterate through files list */
-    struct walk_stat wstat; /* record information and stats about a complete walk */
-    bool process = false;   /* true ==> process item, false ==> ignore item */
-    bool dup = false;       /* true ==> attempt to record a duplicate canonical path */
-    bool walk_ok = false;    /* true ==> no walk errors found, false ==> some walk errors found */
-    char const *path = NULL;    /* a path from a tarball line listing */
-    char const *cpath = NULL;       /* canonicalised path arg as a string */
-    enum path_sanity sanity = PATH_ERR_UNSET;       /* canonicalize_path() error code, or PATH_OK */
-    size_t path_len = 0;            /* canonicalised path length */
-    int_least32_t deep = -1;        /* canonicalised stack depth */
+    struct txz_dup dup;		/* duplicate file to add */
 
     /*
-     * init walk code
+     * firewall
      */
-    memset(&wstat, 0, sizeof(wstat));
-    init_walk_stat(&wstat, ".", &walk_txzchk, TXZCHK_BASENAME, MAX_PATH_LEN, MAX_FILENAME_LEN, MAX_PATH_DEPTH, true);
+    if (path == NULL || first == NULL || txz_dups == NULL) {
+	err(22, __func__, "called with NULL pointer(s)");
+	not_reached();
+    }
 
-    /*
-     * Now go through the files list to verify the required files are there and
-     * also to detect any additional feathers stuck in the tarball (or issues in
-     * the text file).
-     */
-    for (file = txz_files; file != NULL; file = file->next) {
-	if (file->basename == NULL) {
-	    err(22, __func__, "found NULL file->basename in txz_files list");
-	    not_reached();
-	} else if (file->filename == NULL) {
-	    err(23, __func__, "found NULL file->filename in txz_files list");
-	    not_reached();
-        }
+    memset(&dup, 0, sizeof(dup));
+    errno = 0;			/* pre-clear errno for errp() */
+    dup.path = strdup(path);
+    if (dup.path != NULL) {
+	dup.first = strdup(first);
+    }
+    if (dup.path == NULL || dup.first == NULL) {
+	errp(23, __func__, "unable to strdup duplicate path: %s", path);
+	not_reached();
+    }
+    dup.seq = (uintmax_t)dyn_array_tell(txz_dups);
+    (void) dyn_array_append_value(txz_dups, &dup);
+    return;
+}
 
-        /*
-         * now check empty basenames and filenames, in case any slipped through.
-         */
-        if (*(file->basename) == '\0') {
-            warn(TXZCHK_BASENAME, "found empty basename in txz_files list");
-            ++tarball.total_feathers;
-            continue;
-        }
-        if (*(file->filename) == '\0') {
-            warn(TXZCHK_BASENAME, "found empty filename in txz_files list");
-            ++tarball.total_feathers;
-            continue;
-        }
-        check_directory(file, file->dirname, tarball_path);
 
-        /*
-         * first find the first '/'. If NULL warn about it and skip file
-         */
-        path = strchr(file->filename, '/');
-        if (path == NULL) {
-            warn(TXZCHK_BASENAME, "no directory found in filename: %s", file->filename);
-            ++tarball.total_feathers;
-            continue;
-        } else {
-            /*
-             * first canonicalise the path
-             */
-            cpath = canonicalize_path(&wstat, path + 1, &sanity, &path_len, &deep);
-            if (cpath == NULL) {
-                warn(TXZCHK_BASENAME, "canonicalize_path had an internal failure and returned NULL");
-                ++tarball.total_feathers;
-                continue;
-            }
-        }
-        /* process the path, size, and st_mode from the tarball listing line */
-        process = record_step(&wstat, cpath, file->length, file->mode, &dup, NULL);
-        if (dup) {
-            warn(TXZCHK_BASENAME, "file %s is a duplicate file", cpath != NULL?cpath:file->filename);
-            ++tarball.total_feathers;
-        } else if (process) {
-            dbg(DBG_MED, "txzchk: file %s has been successfully processed", cpath!=NULL?cpath:file->filename);
-        }
-        if (cpath != NULL) {
-            free((void *)cpath);
-            cpath = NULL;
-        }
+/*
+ * txz_dup_cmp - compare two duplicate files for qsort(3)
+ *
+ * Duplicate files are sorted by path and, as the same path may be duplicated
+ * more than once, then by the order they were found in.
+ *
+ * given:
+ *
+ *	a	    - pointer to a struct txz_dup
+ *	b	    - pointer to a struct txz_dup
+ *
+ * returns:
+ *
+ *	< 0 ==> a sorts before b
+ *	0   ==> a and b are the same duplicate
+ *	> 0 ==> a sorts after b
+ */
+static int
+txz_dup_cmp(void const *a, void const *b)
+{
+    struct txz_dup const *x = (struct txz_dup const *)a;
+    struct txz_dup const *y = (struct txz_dup const *)b;
+    int ret;
+
+    ret = strcmp(x->path, y->path);
+    if (ret != 0) {
+	return ret;
+    }
+    return (x->seq > y->seq) - (x->seq < y->seq);
+}
+
+
+/*
+ * report_txz_dups - report, sorted by path, and free the duplicate files found
+ *
+ * A file that differs from the file it duplicates only in case is reported as
+ * such: it would overwrite that file when extracted on a case insensitive
+ * filesystem.
+ *
+ * This function returns void.
+ */
+static void
+report_txz_dups(void)
+{
+    struct txz_dup *dup;	/* duplicate file to report */
+    intmax_t len;		/* number of duplicate files */
+    intmax_t i;
+
+    if (txz_dups == NULL) {
+	return;
+    }
+
+    len = dyn_array_tell(txz_dups);
+    if (len > 1) {
+	dyn_array_qsort(txz_dups, txz_dup_cmp);
     }
+    for (i = 0; i < len; ++i) {
+	dup = dyn_array_addr(txz_dups, struct txz_dup, i);
+	if (strcmp(dup->path, dup->first) == 0) {
+	    warn(TXZCHK_BASENAME, "file %s is a duplicate file", dup->path);
+	} else {
+	    warn(TXZCHK_BASENAME, "file %s is a duplicate file: differs only in case from %s", dup->path, dup->first);
+	}
+	free(dup->path);
+	dup->path = NULL;
+	free(dup->first);
+	dup->first = NULL;
+    }
+    dyn_array_free(txz_dups);
+    txz_dups = NULL;
+    return;
+}
+
+
+/*
+ * check_txz_walk - check the tarball as a whole after every file was recorded
+ *
+ * Each file was already checked and recorded, as it was parsed, by
+ * record_txz_file().  Here the duplicate files it found are reported and the
+ * walk code verifies that the required files are
+ * there and that there are not too many other files and directories.
+ *
+ * This function also frees the walk_stat the files were recorded in.
+ *
+ * This function returns void.
+ */
+static void
+check_txz_walk(void)
+{
+    bool walk_ok = false;    /* true ==> no walk errors found, false ==> some walk errors found */
+
+    /*
+     * report any duplicate files
+     */
+    report_txz_dups();
 
     walk_ok = chk_walk(&wstat, stderr, MAX_EXTRA_FILE_COUNT, MAX_EXTRA_DIR_COUNT,
                        NO_COUNT, NO_COUNT, true);
@@ -737,6 +787,7 @@ check_all_txz_files(void)
      * free the walk_stat
      */
     free_walk_stat(&wstat);
+    memset(&wstat, 0, sizeof(wstat));
 
     if (tarball.total_size > MAX_SUM_FILELEN) {
         warn(TXZCHK_BASENAME, "total length of tarball contents is too long: %lld > limit: %lld", (long long)tarball.total_size,
@@ -853,12 +904,13 @@ count_and_sum(char const *tarball_path, intmax_t *sum, intmax_t *count, intmax_t
     }
     /* check for sum of total file lengths being too big */
     if (*sum > MAX_SUM_FILELEN) {
-        if (tarball.previous_files_size <= MAX_SUM_FILELEN) {
-            ++tarball.total_feathers;
-            ++tarball.files_size_too_big;
-        }
-	warn(TXZCHK_BASENAME, "%s: total file size too big: %jd > %jd", tarball_path,
-	    *sum, (intmax_t)MAX_SUM_FILELEN);
+	/* report only the line that first takes the total over the limit */
+	if (tarball.previous_files_size <= MAX_SUM_FILELEN) {
+	    ++tarball.total_feathers;
+	    ++tarball.files_size_too_big;
+	    warn(TXZCHK_BASENAME, "%s: total file size too big: %jd > %jd", tarball_path,
+		*sum, (intmax_t)MAX_SUM_FILELEN);
+	}
     }
     /* update the previous files size */
     tarball.previous_files_size = *sum;
@@ -892,7 +944,7 @@ count_and_sum(char const *tarball_path, intmax_t *sum, intmax_t *count, intmax_t
  *	isexec          - if executable bit (+x) found in permissions
  *
  * If everything goes okay the line will be completely parsed and the calling
- * function (parse_txz_line()) will return to its caller (parse_all_lines()) which
+ * function (parse_txz_line()) will return to its caller (check_tarball()) which
  * will in turn read the next line.
  *
  * This function does not return on error although the word error is used
@@ -1003,7 +1055,7 @@ parse_linux_txz_line(char *p, char *linep, char *line_dup, char const *dirname,
     /* checks on this specific file */
     check_txz_file(tarball_path, dirname, file);
 
-    add_txz_file_to_list(file);
+    record_txz_file(file);
     return;
 }
 
@@ -1027,7 +1079,7 @@ parse_linux_txz_line(char *p, char *linep, char *line_dup, char const *dirname,
  *	isexec          - executable bit found (+x)
  *
  * If everything goes okay the line will be completely parsed and the calling
- * function (parse_txz_line()) will return to its caller (parse_all_lines()) which
+ * function (parse_txz_line()) will return to its caller (check_tarball()) which
  * will in turn read the next line.
  *
  * This function does not return on error although the word error is used
@@ -1151,7 +1203,7 @@ parse_bsd_txz_line(char *p, char *linep, char *line_dup, char const *dirname, ch
     /* checks on this specific file */
     check_txz_file(tarball_path, dirname, file);
 
-    add_txz_file_to_list(file);
+    record_txz_file(file);
     return;
 }
 
@@ -1386,6 +1438,9 @@ check_tarball(char const *tar, char const *fnamchk)
     FILE *input_stream = NULL; /* pipe for tar output (or if -T specified read as a text file) */
     FILE *fnamchk_stream = NULL; /* pipe for fnamchk output */
     char *linep = NULL;		/* allocated line read from tar (or text file) */
+    char *line_dup = NULL;	/* strdup()d line for parse_txz_line() */
+    intmax_t sum = 0;		/* sum for sum_and_count() checks */
+    intmax_t count = 0;		/* count for sum_and_count() checks */
     char *dirname = NULL;	/* line read from fnamchk (directory name) */
     ssize_t readline_len;	/* readline return length */
     int ret;			/* libc function return */
@@ -1395,7 +1450,7 @@ check_tarball(char const *tar, char const *fnamchk)
     /*
      * firewall
      */
-    if ((!read_from_text_file && tar == NULL) || fnamchk == NULL || tarball_path == NULL)
+    if ((!read_from_text_file && use_tar && tar == NULL) || fnamchk == NULL || tarball_path == NULL)
     {
 	err(47, __func__, "called with NULL arg(s)");
 	not_reached();
@@ -1587,6 +1642,34 @@ check_tarball(char const *tar, char const *fnamchk)
     }
     dbg(DBG_MED, "txzchk: %s size in bytes: %lld", tarball_path, (long long)tarball.size);
 
+    /*
+     * init walk code: each file is recorded as soon as it is parsed
+     */
+    memset(&wstat, 0, sizeof(wstat));
+    init_walk_stat(&wstat, ".", &walk_txzchk, TXZCHK_BASENAME, MAX_PATH_LEN, MAX_FILENAME_LEN, MAX_PATH_DEPTH, true, false);
+    txz_dups = dyn_array_create(sizeof(struct txz_dup), TXZ_DUP_CHUNK, TXZ_DUP_CHUNK, true);
+
+#if defined(TXZCHK_USE_LZMA)
+    /*
+     * unless txzchk -T or -t tar, read the tarball ourselves
+     */
+    if (!read_from_text_file && !use_tar) {
+	read_txz(dirname, tarball_path);
+
+	/*
+	 * report any additional feathers stuck in the tarball
+	 */
+	check_txz_walk();
+
+	/* free the allocated memory */
+	if (dirname != NULL) {
+	    free(dirname);
+	    dirname = NULL;
+	}
+	return tarball.total_feathers;
+    }
+#endif
+
     /*
      * if txzchk -T we need to open it as a text file: for test mode
      */
@@ -1678,12 +1761,6 @@ check_tarball(char const *tar, char const *fnamchk)
 	}
 	dbg(DBG_VHIGH, "line %ju: %s", line_num, linep);
 
-	/*
-	 * add line to list (to parse once the list of files has been shown to
-	 * the user).
-	 */
-	add_txz_line(linep, line_num);
-
 	/*
 	 * if we're reading from a text file and verbosity level > 0 then we
 	 * print the line too.
@@ -1695,7 +1772,24 @@ check_tarball(char const *tar, char const *fnamchk)
 		warnp(TXZCHK_BASENAME, "in %s: unable to printf line from text file", __func__);
 	}
 
+	/*
+	 * parse and check the line now, reporting any feathers stuck in the
+	 * tarball that have to be detected while parsing
+	 *
+	 * NOTE: parse_txz_line() tokenises linep so it needs a copy of the line
+	 * for its warnings.
+	 */
+	errno = 0;		/* pre-clear errno for errp() */
+	line_dup = strdup(linep);
+	if (line_dup == NULL) {
+	    errp(56, __func__, "%s: duplicating line %ju failed", tarball_path, line_num);
+	    not_reached();
+	}
+	parse_txz_line(linep, line_dup, dirname, tarball_path, &sum, &count);
+
 	/* free the allocated memory */
+	free(line_dup);
+	line_dup = NULL;
 	if (linep != NULL) {
 	    free(linep);
 	    linep = NULL;
@@ -1719,21 +1813,9 @@ check_tarball(char const *tar, char const *fnamchk)
     input_stream = NULL;
 
     /*
-     * now parse the lines, reporting any feathers stuck in the tarball that
-     * have to be detected while parsing
+     * report any additional feathers stuck in the tarball
      */
-    parse_all_txz_lines(dirname, tarball_path);
-
-    /*
-     * check files list and report any additional feathers stuck in the tarball
-     */
-    check_all_txz_files();
-
-    /* free the files list */
-    free_txz_files_list();
-
-    /* free txz_lines list */
-    free_txz_lines();
+    check_txz_walk();
 
     /* free the allocated memory */
     if (dirname != NULL) {
@@ -1748,144 +1830,6 @@ check_tarball(char const *tar, char const *fnamchk)
 }
 
 
-/*
- * add_txz_line - add line to txz_lines list
- *
- * given:
- *
- *	str	    - line to add to the list
- *	line_num    - line number
- *
- * The purpose of this function is that we can show the tarball listing in one
- * go and then after that we can parse this so that any warnings are not
- * interspersed with the tarball list thus keeping the output cleaner.
- *
- * This function returns void.
- */
-static void
-add_txz_line(char const *str, uintmax_t line_num)
-{
-    struct txz_line *line;
-
-    /*
-     * firewall
-     */
-    if (str == NULL) {
-	err(56, __func__, "passed NULL str");
-	not_reached();
-    }
-
-    errno = 0;
-    line = calloc(1, sizeof *line);
-    if (line == NULL) {
-	errp(57, __func__, "unable to allocate struct txz_line *");
-	not_reached();
-    }
-
-    errno = 0;
-    line->line = strdup(str);
-    if (line->line == NULL) {
-	errp(58, __func__, "unable to strdup string '%s' for lines list", str);
-	not_reached();
-    }
-    line->line_num = line_num;
-
-    dbg(DBG_VHIGH, "adding line %s to lines list", line->line);
-    line->next = txz_lines;
-    txz_lines = line;
-    return;
-}
-
-
-/*
- * parse_all_txz_lines - parse all tar lines
- *
- * Parse the txz_lines list and report any feathers stuck in the tarball. After
- * all the lines have been parsed additional tests will be performed.
- *
- * given:
- *
- *	dirname	- directory name as reported by fnamchk (can be NULL if
- *			  fnamchk failed to validate directory)
- *	tarball_path	- the tarball that is being read
- *
- * This function returns void.
- *
- * This function does not return on error.
- */
-static void
-parse_all_txz_lines(char const *dirname, char const *tarball_path)
-{
-    struct txz_line *line = NULL;	/* for txz_lines list */
-    char *line_dup = NULL;	/* strdup()d line */
-    intmax_t sum = 0;		/* sum for sum_and_count() checks */
-    intmax_t count = 0;		/* count for sum_and_count() checks */
-
-    /*
-     * firewall
-     */
-    if (tarball_path == NULL) {
-	err(59, __func__, "passed NULL tarball_path");
-	not_reached();
-    }
-
-    for (line = txz_lines; line != NULL; line = line->next) {
-	if (line->line == NULL) {
-	    warn(TXZCHK_BASENAME, "encountered NULL string on line %ju", line->line_num);
-	    ++tarball.total_feathers;
-	    continue;
-	}
-
-	line_dup = strdup(line->line);
-	if (line_dup == NULL) {
-	    err(60, __func__, "%s: duplicating %s failed", tarball_path, line->line);
-	    not_reached();
-	}
-
-	parse_txz_line(line->line, line_dup, dirname, tarball_path, &sum, &count);
-	free(line_dup);
-	line_dup = NULL;
-    }
-    return;
-}
-
-
-/*
- * free_txz_lines - free txz_lines list
- *
- * The purpose of the txz_lines list is so that we can show the list of files in
- * the tarball together without interspersing it with any warnings. Thus we show
- * the files list, adding each line to the list in the process, and then after
- * that we can iterate through the lines and show any warnings. After that we
- * report any feathers stuck in the tarball that haven't been reported yet (some
- * warnings have to be issued while parsing the lines so those were already
- * reported).
- *
- * Once the lines are all parsed we must free the list.
- *
- * This function returns void.
- */
-static void
-free_txz_lines(void)
-{
-    struct txz_line *line, *next_line;
-
-    for (line = txz_lines; line != NULL; line = next_line) {
-	next_line = line->next;
-	if (line->line) {
-	    free(line->line);
-	    line->line = NULL;
-	}
-
-	free(line);
-	line = NULL;
-    }
-
-    txz_lines = NULL;
-    return;
-}
-
-
 /*
  * alloc_txz_file - allocate a struct txz_file *
  *
@@ -2162,33 +2106,101 @@ mode_t get_mode(struct txz_file *file)
 
 
 /*
- * add_txz_file_to_list - add a filename to the linked list
+ * record_txz_file - check a file as soon as it is parsed and record it
  *
  * given:
  *
  *	file		    - pointer to struct txz_file which should already have the name
  *
- * If the function finds this filename already in the list (full path!) it
- * increments the count and does not add it to the list; else it adds it to the
- * list with a count of 1.
+ * The directory of the file is checked and the canonicalized path is recorded
+ * in the walk_stat, whose path index is used to detect duplicate files (without
+ * regard to case).  Duplicate files are added to the txz_dups list to be
+ * reported by check_txz_walk().  The file itself is not kept: it is freed before returning,
+ * so that no more than the state of the walk is kept no matter how many lines
+ * the tarball listing has.
+ *
+ * Empty basenames and filenames, and filenames without a directory, are warned
+ * against (and not recorded).
  *
  * This function does not return on error.
  */
 static void
-add_txz_file_to_list(struct txz_file *txzfile)
+record_txz_file(struct txz_file *file)
 {
+    bool process = false;   /* true ==> process item, false ==> ignore item */
+    bool dup = false;       /* true ==> attempt to record a duplicate canonical path */
+    char const *path = NULL;    /* a path from a tarball line listing */
+    char const *cpath = NULL;       /* canonicalised path arg as a string */
+    enum path_sanity sanity = PATH_ERR_UNSET;       /* canonicalize_path() error code, or PATH_OK */
+    size_t path_len = 0;            /* canonicalised path length */
+    int_least32_t deep = -1;        /* canonicalised stack depth */
+    struct item *i_p = NULL;        /* file that cpath duplicates */
+
     /*
      * firewall
      */
-    if (txzfile == NULL || txzfile->filename == NULL || txzfile->basename == NULL) {
+    if (file == NULL || file->filename == NULL || file->basename == NULL) {
 	err(68, __func__, "called with NULL pointer(s)");
 	not_reached();
     }
+    dbg(DBG_VHIGH, "recording filename %s (basename %s)", file->filename, file->basename);
+
+    /*
+     * check empty basenames and filenames, in case any slipped through.
+     */
+    if (*(file->basename) == '\0') {
+	warn(TXZCHK_BASENAME, "found empty basename in tarball listing");
+	++tarball.total_feathers;
+	free_txz_file(&file);
+	return;
+    }
+    if (*(file->filename) == '\0') {
+	warn(TXZCHK_BASENAME, "found empty filename in tarball listing");
+	++tarball.total_feathers;
+	free_txz_file(&file);
+	return;
+    }
+    check_directory(file, file->dirname, tarball_path);
+
+    /*
+     * first find the first '/'. If NULL warn about it and skip file
+     */
+    path = strchr(file->filename, '/');
+    if (path == NULL) {
+	warn(TXZCHK_BASENAME, "no directory found in filename: %s", file->filename);
+	++tarball.total_feathers;
+	free_txz_file(&file);
+	return;
+    }
+
+    /*
+     * canonicalise the path
+     */
+    cpath = canonicalize_path(&wstat, path + 1, &sanity, &path_len, &deep);
+    if (cpath == NULL) {
+	warn(TXZCHK_BASENAME, "canonicalize_path had an internal failure and returned NULL");
+	++tarball.total_feathers;
+	free_txz_file(&file);
+	return;
+    }
 
-    /* lazily add to list */
-    dbg(DBG_VHIGH, "adding filename %s (basename %s) to list of files", txzfile->filename, txzfile->basename);
-    txzfile->next = txz_files;
-    txz_files = txzfile;
+    /* process the path, size, and st_mode from the tarball listing line */
+    process = record_step(&wstat, cpath, file->length, file->mode, &dup, NULL);
+    if (dup) {
+	/*
+	 * record_step() found cpath in the case-folded path index: find the
+	 * file it duplicates so that it can be reported with the others
+	 */
+	i_p = path_in_walk_stat(&wstat, cpath);
+	add_txz_dup(cpath, (i_p != NULL && i_p->fts_path != NULL) ? i_p->fts_path : cpath);
+	++tarball.total_feathers;
+    } else if (process) {
+	dbg(DBG_MED, "txzchk: file %s has been successfully processed", cpath);
+    }
+    free((void *)cpath);
+    cpath = NULL;
+    free_txz_file(&file);
+    return;
 }
 
 
@@ -2223,6 +2235,14 @@ free_txz_file(struct txz_file **file)
         free((*file)->basename);
         (*file)->basename = NULL;
     }
+    if ((*file)->dirname != NULL) {
+        free((*file)->dirname);
+        (*file)->dirname = NULL;
+    }
+    if ((*file)->top_dirname != NULL) {
+        free((*file)->top_dirname);
+        (*file)->top_dirname = NULL;
+    }
 
     if ((*file)->perms != NULL) {
         free((*file)->perms);
@@ -2238,21 +2258,622 @@ free_txz_file(struct txz_file **file)
 }
 
 
+#if defined(TXZCHK_USE_LZMA)
 /*
- * free_txz_files_list  - free the txz_files linked list
+ * read_txz - read the compressed tarball without tar
+ *
+ * given:
+ *
+ *	dirname		- directory name as reported by fnamchk (can be NULL if
+ *			  fnamchk failed to validate directory)
+ *	tarball_path	- the tarball that is being read
+ *
+ * The tarball is decompressed with liblzma and each tar(5) header is checked
+ * and recorded as it is read, just as parse_txz_line() does
+ * for a line of tar -tJvf output.  A GNU long name or pax extended header
+ * applies to the header that follows it.
+ *
+ * This function does not return on error.
  */
 static void
-free_txz_files_list(void)
+read_txz(char const *dirname, char const *tarball_path)
 {
-    struct txz_file *file, *next_file;
+    struct txz_reader *reader = NULL;	/* built-in tarball reader */
+    lzma_stream strm_init = LZMA_STREAM_INIT; /* initial .xz decoder state */
+    unsigned char block[TAR_BLOCK_LEN];	/* tar(5) header or data block */
+    char name[TAR_BLOCK_LEN];		/* [prefix/]name of the header */
+    char *ext_name = NULL;		/* GNU long name or pax path for the next header, or NULL */
+    char *ext = NULL;			/* GNU long name or pax extended header data */
+    char *p = NULL;			/* next pax extended header record */
+    char *q = NULL;			/* end of the pax record length */
+    uintmax_t ext_size = 0;		/* pax size for the next header */
+    bool has_ext_size = false;		/* true ==> ext_size applies to the next header */
+    uintmax_t size = 0;			/* size of the data after the header */
+    uintmax_t chksum = 0;		/* header checksum */
+    uintmax_t sum_of_bytes = 0;		/* sum of the header bytes */
+    uintmax_t blocks = 0;		/* number of data blocks after the header */
+    uintmax_t reclen = 0;		/* length of a pax extended header record */
+    uintmax_t i = 0;
+    intmax_t sum = 0;			/* sum for sum_and_count() checks */
+    intmax_t count = 0;			/* count for sum_and_count() checks */
+    unsigned char typeflag = '\0';	/* tar(5) header type */
+    lzma_ret lret;			/* liblzma return */
+    bool ok = false;			/* true ==> header field is valid */
 
-    for (file = txz_files; file != NULL; file = next_file)
-    {
-	next_file = file->next;
-        free_txz_file(&file);
-        file = NULL; /* redundant but it's safe */
+    /*
+     * firewall
+     */
+    if (tarball_path == NULL) {
+	err(70, __func__, "passed NULL tarball_path");
+	not_reached();
+    }
+
+    /*
+     * open the tarball and set up the .xz decoder
+     */
+    errno = 0;			/* pre-clear errno for errp() */
+    reader = calloc(1, sizeof(*reader));
+    if (reader == NULL) {
+	errp(71, __func__, "%s: unable to allocate a struct txz_reader", tarball_path);
+	not_reached();
+    }
+    errno = 0;			/* pre-clear errno for errp() */
+    reader->stream = fopen(tarball_path, "rb");
+    if (reader->stream == NULL) {
+	errp(72, __func__, "fopen of %s failed", tarball_path);
+	not_reached();
+    }
+    reader->strm = strm_init;
+    lret = lzma_stream_decoder(&reader->strm, UINT64_MAX, LZMA_CONCATENATED);
+    if (lret != LZMA_OK) {
+	err(73, __func__, "%s: lzma_stream_decoder failed: %d", tarball_path, (int)lret);
+	not_reached();
+    }
+
+    /*
+     * process each tar(5) header
+     */
+    while (read_tar_block(reader, block)) {
+
+	/*
+	 * a block of all zeros ends the archive
+	 */
+	for (i = 0; i < TAR_BLOCK_LEN && block[i] == '\0'; ++i) {
+	    ; /* look for a non-zero byte */
+	}
+	if (i == TAR_BLOCK_LEN) {
+	    dbg(DBG_HIGH, "reached end of archive of tarball %s", tarball_path);
+	    break;
+	}
+
+	/*
+	 * verify the header checksum: the sum of the header bytes with the
+	 * checksum field itself taken as spaces
+	 */
+	chksum = tar_number(block+148, 8, &ok);
+	sum_of_bytes = 0;
+	for (i = 0; i < TAR_BLOCK_LEN; ++i) {
+	    sum_of_bytes += (i >= 148 && i < 156) ? (uintmax_t)' ' : (uintmax_t)block[i];
+	}
+	if (!ok || chksum != sum_of_bytes) {
+	    err(74, __func__, "%s: invalid tar header checksum", tarball_path);
+	    not_reached();
+	}
+	size = tar_number(block+124, 12, &ok);
+	if (!ok) {
+	    err(75, __func__, "%s: invalid tar header size", tarball_path);
+	    not_reached();
+	}
+	blocks = size / TAR_BLOCK_LEN + ((size % TAR_BLOCK_LEN) != 0);
+	typeflag = block[156];
+
+	/*
+	 * case: GNU long name or link, or pax extended header: read its data
+	 */
+	if (typeflag == 'L' || typeflag == 'K' || typeflag == 'x' || typeflag == 'g') {
+	    if (size > TAR_MAX_EXT_LEN) {
+		err(76, __func__, "%s: tar extended header too large: %ju > %d", tarball_path, size, TAR_MAX_EXT_LEN);
+		not_reached();
+	    }
+	    errno = 0;		/* pre-clear errno for errp() */
+	    ext = calloc((size_t)blocks * TAR_BLOCK_LEN + 1, 1);
+	    if (ext == NULL) {
+		errp(77, __func__, "%s: unable to allocate %ju bytes of tar extended header", tarball_path, size);
+		not_reached();
+	    }
+	    for (i = 0; i < blocks; ++i) {
+		if (!read_tar_block(reader, (unsigned char *)ext + i*TAR_BLOCK_LEN)) {
+		    err(78, __func__, "%s: tarball ends inside a tar extended header", tarball_path);
+		    not_reached();
+		}
+	    }
+	    ext[size] = '\0';
+
+	    /*
+	     * a GNU long name is the name of the next header
+	     */
+	    if (typeflag == 'L') {
+		if (ext_name != NULL) {
+		    free(ext_name);
+		}
+		errno = 0;	/* pre-clear errno for errp() */
+		ext_name = strdup(ext);
+		if (ext_name == NULL) {
+		    errp(79, __func__, "%s: unable to strdup GNU long name", tarball_path);
+		    not_reached();
+		}
+
+	    /*
+	     * pax extended header records are: "length keyword=value\n"
+	     *
+	     * Only the path and size of the next header matter to us.
+	     */
+	    } else if (typeflag == 'x') {
+		for (p = ext; p < ext + size; p += reclen) {
+		    errno = 0;	/* pre-clear errno for strtoumax() */
+		    reclen = strtoumax(p, &q, 10);
+		    if (errno != 0 || q == p || *q != ' ' || reclen == 0 || reclen > (uintmax_t)(ext + size - p) ||
+			p[reclen-1] != '\n') {
+			err(80, __func__, "%s: invalid pax extended header record", tarball_path);
+			not_reached();
+		    }
+		    p[reclen-1] = '\0';
+		    if (strncmp(q+1, "path=", 5) == 0) {
+			if (ext_name != NULL) {
+			    free(ext_name);
+			}
+			errno = 0;	/* pre-clear errno for errp() */
+			ext_name = strdup(q+1+5);
+			if (ext_name == NULL) {
+			    errp(81, __func__, "%s: unable to strdup pax path", tarball_path);
+			    not_reached();
+			}
+		    } else if (strncmp(q+1, "size=", 5) == 0) {
+			if (!string_to_uintmax(q+1+5, &ext_size)) {
+			    err(82, __func__, "%s: invalid pax size: %s", tarball_path, q+1+5);
+			    not_reached();
+			}
+			has_ext_size = true;
+		    }
+		}
+	    }
+	    free(ext);
+	    ext = NULL;
+	    continue;
+	}
+
+	/*
+	 * a pax size overrides the size of the next header
+	 */
+	if (has_ext_size) {
+	    size = ext_size;
+	    blocks = size / TAR_BLOCK_LEN + ((size % TAR_BLOCK_LEN) != 0);
+	    has_ext_size = false;
+	}
+
+	/*
+	 * a ustar header may split a long name into a prefix and a name
+	 */
+	if (memcmp(block+257, "ustar", 5) == 0 && block[345] != '\0') {
+	    snprintf(name, sizeof(name), "%.155s/%.100s", (char const *)block+345, (char const *)block);
+	} else {
+	    snprintf(name, sizeof(name), "%.100s", (char const *)block);
+	}
+
+	/*
+	 * check the header and record it
+	 */
+	add_tar_entry(block, (ext_name != NULL) ? ext_name : name, size, dirname, tarball_path, &sum, &count);
+	if (ext_name != NULL) {
+	    free(ext_name);
+	    ext_name = NULL;
+	}
+
+	/*
+	 * skip the data, if any, of this header
+	 */
+	if (typeflag == '1' || typeflag == '2' || typeflag == '3' || typeflag == '4' || typeflag == '5' || typeflag == '6') {
+	    blocks = 0;	/* links, devices, directories and FIFOs have no data */
+	}
+	for (i = 0; i < blocks; ++i) {
+	    if (!read_tar_block(reader, block)) {
+		err(83, __func__, "%s: tarball ends inside the data of: %s", tarball_path, name);
+		not_reached();
+	    }
+	}
+    }
+
+    /*
+     * free storage
+     */
+    if (ext_name != NULL) {
+	free(ext_name);
+	ext_name = NULL;
+    }
+    lzma_end(&reader->strm);
+    errno = 0;			/* pre-clear errno for warnp() */
+    if (fclose(reader->stream) != 0) {
+	warnp(TXZCHK_BASENAME, "in %s: %s: fclose error on tarball", __func__, tarball_path);
+    }
+    free(reader);
+    reader = NULL;
+    return;
+}
+
+
+/*
+ * read_tar_block - read the next tar(5) block from the compressed tarball
+ *
+ * given:
+ *
+ *	reader	    - built-in tarball reader
+ *	block	    - where to place the TAR_BLOCK_LEN byte block
+ *
+ * returns:
+ *
+ *	true ==> block was filled,
+ *	false ==> end of the tarball
+ *
+ * This function does not return on error, including a corrupt or truncated
+ * .xz stream.
+ */
+static bool
+read_tar_block(struct txz_reader *reader, unsigned char *block)
+{
+    size_t have = 0;		/* bytes of block filled so far */
+    size_t len = 0;		/* bytes to copy into block */
+    size_t nread = 0;		/* bytes read from the tarball */
+    lzma_action action;		/* LZMA_FINISH ==> no more compressed input */
+    lzma_ret ret;		/* liblzma return */
+    char const *why = NULL;	/* why the tarball cannot be decompressed */
+
+    /*
+     * firewall
+     */
+    if (reader == NULL || reader->stream == NULL || block == NULL) {
+	err(84, __func__, "called with NULL arg(s)");
+	not_reached();
+    }
+
+    while (have < TAR_BLOCK_LEN) {
+
+	/*
+	 * hand out the decompressed bytes we already have
+	 */
+	if (reader->out_pos < reader->out_len) {
+	    len = reader->out_len - reader->out_pos;
+	    if (len > TAR_BLOCK_LEN - have) {
+		len = TAR_BLOCK_LEN - have;
+	    }
+	    memcpy(block + have, reader->out + reader->out_pos, len);
+	    have += len;
+	    reader->out_pos += len;
+	    continue;
+	}
+	if (reader->eof) {
+	    break;
+	}
+
+	/*
+	 * decompress more of the tarball
+	 */
+	reader->strm.next_out = reader->out;
+	reader->strm.avail_out = sizeof(reader->out);
+	do {
+	    if (reader->strm.avail_in == 0 && !feof(reader->stream)) {
+		errno = 0;		/* pre-clear errno for errp() */
+		nread = fread(reader->in, 1, sizeof(reader->in), reader->stream);
+		if (ferror(reader->stream)) {
+		    errp(85, __func__, "%s: error reading tarball", tarball_path);
+		    not_reached();
+		}
+		reader->strm.next_in = reader->in;
+		reader->strm.avail_in = nread;
+	    }
+	    action = (reader->strm.avail_in == 0 && feof(reader->stream)) ? LZMA_FINISH : LZMA_RUN;
+	    ret = lzma_code(&reader->strm, action);
+	    if (ret == LZMA_STREAM_END) {
+		reader->eof = true;
+	    } else if (ret != LZMA_OK) {
+		switch (ret) {
+		case LZMA_FORMAT_ERROR:
+		    why = "not in .xz format";
+		    break;
+		case LZMA_DATA_ERROR:
+		    why = "compressed data is corrupt";
+		    break;
+		case LZMA_BUF_ERROR:
+		    why = "compressed data is truncated";
+		    break;
+		case LZMA_MEM_ERROR:
+		    why = "out of memory";
+		    break;
+		default:
+		    why = "liblzma error";
+		    break;
+		}
+		err(86, __func__, "%s: cannot decompress tarball: %s", tarball_path, why);
+		not_reached();
+	    }
+	} while (reader->strm.avail_out == sizeof(reader->out) && !reader->eof);
+	reader->out_pos = 0;
+	reader->out_len = sizeof(reader->out) - reader->strm.avail_out;
+    }
+
+    /*
+     * report end of tarball or a partial block
+     */
+    if (have == 0) {
+	return false;
+    } else if (have < TAR_BLOCK_LEN) {
+	err(87, __func__, "%s: tarball ends inside a tar block", tarball_path);
+	not_reached();
+    }
+    return true;
+}
+
+
+/*
+ * tar_number - convert a tar(5) header number field
+ *
+ * given:
+ *
+ *	field	    - the header field
+ *	len	    - length of the field
+ *	ok	    - pointer to bool, set to true ==> field is valid
+ *
+ * returns:
+ *
+ *	the number, or 0 if the field is not valid
+ *
+ * A field is octal digits, perhaps after spaces and ending in spaces or NUL
+ * bytes, or for large numbers, the GNU base-256 form: 0x80 followed by the
+ * number in big-endian bytes.
+ *
+ * This function does not return on error.
+ */
+static uintmax_t
+tar_number(unsigned char const *field, size_t len, bool *ok)
+{
+    uintmax_t num = 0;		/* number of the field */
+    size_t i = 0;
+
+    /*
+     * firewall
+     */
+    if (field == NULL || ok == NULL) {
+	err(88, __func__, "called with NULL arg(s)");
+	not_reached();
+    }
+    *ok = false;
+
+    /*
+     * case: GNU base-256 (negative numbers are not valid)
+     */
+    if (len > 0 && (field[0] & 0x80) != 0) {
+	if (field[0] != 0x80) {
+	    return 0;
+	}
+	for (i = 1; i < len; ++i) {
+	    if (num > (UINTMAX_MAX >> 8)) {
+		return 0;
+	    }
+	    num = (num << 8) | field[i];
+	}
+	*ok = true;
+	return num;
+    }
+
+    /*
+     * case: octal
+     */
+    for (i = 0; i < len && field[i] == ' '; ++i) {
+	; /* skip leading spaces */
+    }
+    for ( ; i < len && field[i] >= '0' && field[i] <= '7'; ++i) {
+	if (num > (UINTMAX_MAX >> 3)) {
+	    return 0;
+	}
+	num = (num << 3) | (uintmax_t)(field[i] - '0');
+    }
+    for ( ; i < len; ++i) {
+	if (field[i] != ' ' && field[i] != '\0') {
+	    return 0;
+	}
     }
+    *ok = true;
+    return num;
+}
+
+
+/*
+ * add_tar_entry - check a tar(5) header and record it
+ *
+ * given:
+ *
+ *	block		- the tar(5) header block
+ *	name		- path of the header, after any GNU long name or pax path
+ *	size		- size of the data after the header, after any pax size
+ *	dirname		- directory name retrieved from fnamchk or NULL if it failed
+ *	tarball_path	- the tarball path
+ *	sum		- pointer to sum for sum_and_count() (which we use in count_and_sum())
+ *	count		- pointer to count for sum_and_count() (which we use in count_and_sum())
+ *
+ * If verbosity_level > 0 the file is listed much as tar -tJvf would list it.
+ *
+ * This function does not return on error although the word error is used
+ * loosely here.
+ */
+static void
+add_tar_entry(unsigned char const *block, char const *name, uintmax_t size, char const *dirname,
+	char const *tarball_path, intmax_t *sum, intmax_t *count)
+{
+    static char const rwx[] = "rwxrwxrwx"; /* permission characters in ls -l order */
+    char perms[sizeof("-rwxrwxrwx")];	/* ls -l style permissions of the header */
+    char when[sizeof("YYYY-MM-DD HH:MM")]; /* modification time of the header */
+    char *perms_dup = NULL;		/* allocated copy of perms for the txz_file */
+    struct txz_file *file = NULL;	/* allocated struct of file info */
+    struct tm *tm = NULL;		/* modification time as local time */
+    time_t mtime = 0;			/* modification time of the header */
+    uintmax_t mode = 0;			/* mode of the header */
+    uintmax_t uid = 0;			/* UID of the header */
+    uintmax_t gid = 0;			/* GID of the header */
+    intmax_t length = 0;		/* file size */
+    bool isfile = false;		/* true ==> normal file, check size and number of files */
+    bool isdir = false;			/* true ==> is a directory */
+    bool isexec = false;		/* true ==> executable bit (+x) found in permissions */
+    bool ok = false;			/* true ==> header field is valid */
+    size_t len = 0;			/* length of name */
+    int i;
+
+    /*
+     * firewall
+     */
+    if (block == NULL || name == NULL || tarball_path == NULL || sum == NULL || count == NULL) {
+	err(89, __func__, "called with NULL arg(s)");
+	not_reached();
+    }
+
+    /*
+     * get the mode, UID, GID and modification time
+     */
+    mode = tar_number(block+100, 8, &ok);
+    if (!ok) {
+	warn(TXZCHK_BASENAME, "%s: invalid mode in header of: %s", tarball_path, name);
+	++tarball.total_feathers;
+	mode = 0;
+    }
+    uid = tar_number(block+108, 8, &ok);
+    if (!ok) {
+	warn(TXZCHK_BASENAME, "found non-numerical UID in header of: %s", name);
+	++tarball.total_feathers;
+    }
+    gid = tar_number(block+116, 8, &ok);
+    if (!ok) {
+	warn(TXZCHK_BASENAME, "found non-numerical GID in header of: %s", name);
+	++tarball.total_feathers;
+    }
+    mtime = (time_t)tar_number(block+136, 12, &ok);
+
+    /*
+     * form the permission string, with the type of file first, as tar -tJvf does
+     */
+    len = strlen(name);
+    switch (block[156]) {
+    case '0':
+    case '\0':
+    case '7':
+	/* v7 tar marks a directory with a trailing / */
+	perms[0] = (len > 0 && name[len-1] == '/') ? 'd' : '-';
+	break;
+    case '1':
+	perms[0] = 'h';
+	break;
+    case '2':
+	perms[0] = 'l';
+	break;
+    case '3':
+	perms[0] = 'c';
+	break;
+    case '4':
+	perms[0] = 'b';
+	break;
+    case '5':
+	perms[0] = 'd';
+	break;
+    case '6':
+	perms[0] = 'p';
+	break;
+    default:
+	perms[0] = '?';
+	break;
+    }
+    for (i = 0; i < 9; ++i) {
+	perms[i+1] = (mode & (0400 >> i)) ? rwx[i] : '-';
+    }
+    if (mode & 04000) {
+	perms[3] = (mode & 0100) ? 's' : 'S';
+    }
+    if (mode & 02000) {
+	perms[6] = (mode & 0010) ? 's' : 'S';
+    }
+    if (mode & 01000) {
+	perms[9] = (mode & 0001) ? 't' : 'T';
+    }
+    perms[10] = '\0';
+
+    /*
+     * list the file
+     */
+    if (verbosity_level > 0) {
+	tm = localtime(&mtime);
+	if (tm == NULL || strftime(when, sizeof(when), "%Y-%m-%d %H:%M", tm) == 0) {
+	    strcpy(when, "?");
+	}
+	print("%s %ju/%ju %15ju %s %s\n", perms, uid, gid, size, when, name);
+    }
+
+    /*
+     * look for non-directory non-regular non-hard-linked items
+     */
+    if (perms[0] != '-' && perms[0] != 'd') {
+	warn(TXZCHK_BASENAME, "%s: found a non-directory non-regular non-hard-linked item: %s %s",
+	    tarball_path, perms, name);
+	++tarball.total_feathers;
+    } else if (perms[0] == 'd') {
+	isdir = true;
+    } else {
+	isfile = true; /* we have to count this as a normal file */
+    }
+
+    /*
+     * tar -tJvf would show the user and group names, not the UID and GID
+     */
+    if (memcmp(block+257, "ustar", 5) == 0) {
+	if (block[265] != '\0') {
+	    warn(TXZCHK_BASENAME, "found non-numerical UID in header of: %s", name);
+	    ++tarball.total_feathers;
+	}
+	if (block[297] != '\0') {
+	    warn(TXZCHK_BASENAME, "found non-numerical GID in header of: %s", name);
+	    ++tarball.total_feathers;
+	}
+    }
+
+    /*
+     * add to total number of files and total size if it's a normal file
+     */
+    if (size > (uintmax_t)INTMAX_MAX) {
+	warn(TXZCHK_BASENAME, "%s: size of %s too big: %ju", tarball_path, name, size);
+	++tarball.total_feathers;
+	length = INTMAX_MAX;
+    } else {
+	length = (intmax_t)size;
+    }
+    if (isfile) {
+	count_and_sum(tarball_path, sum, count, length);
+    }
+
+    /*
+     * check and record the file
+     */
+    isexec = (strchr(perms, 'x') != NULL);
+    errno = 0;			/* pre-clear errno for errp() */
+    perms_dup = strdup(perms);
+    if (perms_dup == NULL) {
+	errp(90, __func__, "txzchk: failed to strdup permissions string");
+	not_reached();
+    }
+    file = alloc_txz_file(name, dirname, perms_dup, isdir, isfile, isexec, length);
+    if (file == NULL) {
+	err(91, __func__, "alloc_txz_file() returned NULL");
+	not_reached();
+    }
+
+    /* checks on this specific file */
+    check_txz_file(tarball_path, dirname, file);
 
-    txz_files = NULL;
+    record_txz_file(file);
     return;
 }
+#endif
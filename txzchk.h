@@ -106,6 +106,13 @@
  */
 #include "soup/walk.h"
 
+/*
+ * liblzma - to read the tarball without tar
+ */
+#if defined(TXZCHK_USE_LZMA)
+#include <lzma.h>
+#endif
+
 
 /*
  * macros
@@ -116,6 +123,28 @@
  */
 #define TXZCHK_BASENAME "txzchk"
 
+/*
+ * duplicate files found, grown this many at a time
+ */
+#define TXZ_DUP_CHUNK (64)
+
+/*
+ * built-in tarball reader
+ *
+ * When compiled with -DTXZCHK_USE_LZMA (see LZMA_FLAGS in the Makefile) txzchk
+ * decompresses the tarball with liblzma and reads the tar(5) headers itself
+ * instead of running tar -tJvf.  The -t tar option still selects tar.
+ */
+#if defined(TXZCHK_USE_LZMA)
+#define TXZCHK_USE_TAR (false)		/* false ==> read the tarball without tar unless -t tar */
+#else
+#define TXZCHK_USE_TAR (true)		/* true ==> always list the tarball with tar -tJvf */
+#endif
+
+#define TAR_BLOCK_LEN (512)		/* size of a tar(5) header or data block */
+#define TXZ_READ_BUF (64*1024)		/* bytes of compressed or decompressed tarball buffered at a time */
+#define TAR_MAX_EXT_LEN (1024*1024)	/* maximum size of a GNU long name or pax extended header */
+
 
 /*
  * information about the tarball
@@ -138,14 +167,15 @@ struct tarball
 /*
  * txz_file - struct for each file
  *
- * This struct is for the txz_files linked list which is all the files the
- * tarball has (according to tar -tJvf or if -T specified what was read from
- * each line of the text file).
+ * This struct describes a file the tarball has (according to tar -tJvf, the
+ * built-in reader or, if -T specified, what was read from each line of the
+ * text file).
  *
- * Once the tar/text file output has been parsed we go through this list to
- * determine if the appropriate files exist, to check that only one of each file
- * exists, the correct directory is found (and no directory changes are there)
- * and check other conditions. See the function check_all_txz_files().
+ * Each struct is checked as soon as its line (or tar header) is parsed: its
+ * directory is checked and its path is recorded in the walk_stat, which is
+ * what detects duplicate files.  See the function record_txz_file().  The
+ * struct is then freed: only the walk_stat is kept until the whole tarball has
+ * been read, when check_txz_walk() checks that the appropriate files exist.
  */
 struct txz_file
 {
@@ -160,25 +190,42 @@ struct txz_file
     char *perms;                            /* permission bits */
     bool isexec;                            /* true ==> executable (+x) file */
     mode_t mode;                            /* perms -> mode_t */
-    struct txz_file *next;		    /* the next file in the txz_files list */
 };
 
 /*
- * struct txz_line - a line of output from tar -tJvf or the text file
+ * txz_dup - a duplicate file
+ *
+ * Duplicate files are found, as each file is recorded, by looking up the
+ * canonicalized path in the case-folded path index of the walk_stat.  They are
+ * reported, sorted by path, once the whole tarball has been read so that the
+ * report does not depend on the order of the files in the tarball.
+ */
+struct txz_dup
+{
+    char *path;				/* canonicalized path of the duplicate file */
+    char *first;			/* canonicalized path of the file it duplicates */
+    uintmax_t seq;			/* number of duplicates found before this one */
+};
+
+#if defined(TXZCHK_USE_LZMA)
+/*
+ * txz_reader - state of the built-in tarball reader
  *
- * This struct defines a line of output for the txz_lines linked list. After all
- * lines from tar or the text file are added to the list, we parse each line (by
- * calling parse_txz_line() which calls either parse_linux_txz_line() or
- * parse_bsd_txz_line() depending on the line format), doing various checks and
- * adds each file to the txz_files list for further checks after the initial
- * tests are complete.
+ * The compressed tarball is read and decompressed TXZ_READ_BUF bytes at a time
+ * and handed out a TAR_BLOCK_LEN block at a time.  No more than that is held
+ * in memory, no matter how big the tarball is.
  */
-struct txz_line
+struct txz_reader
 {
-    char *line;				/* copy of the line */
-    uintmax_t line_num;			/* line number */
-    struct txz_line *next;		/* pointer to the next line or NULL if last line */
+    FILE *stream;			/* compressed tarball being read */
+    lzma_stream strm;			/* liblzma .xz decoder */
+    uint8_t in[TXZ_READ_BUF];		/* compressed bytes read from stream */
+    uint8_t out[TXZ_READ_BUF];		/* decompressed bytes */
+    size_t out_pos;			/* next decompressed byte to hand out */
+    size_t out_len;			/* number of decompressed bytes in out */
+    bool eof;				/* true ==> end of the .xz stream */
 };
+#endif
 
 /*
  * function prototypes
@@ -191,20 +238,26 @@ static void parse_linux_txz_line(char *p, char *line, char *line_dup, char const
 	char const *tarball_path, char **saveptr, bool normal_file, intmax_t *sum, intmax_t *count, bool isdir,
         char *perms, bool isexec);
 static void show_tarball_info(char const *tarball_path);
-static void check_all_txz_files(void);
+static void add_txz_dup(char const *path, char const *first);
+static int txz_dup_cmp(void const *a, void const *b);
+static void report_txz_dups(void);
+static void check_txz_walk(void);
 static mode_t get_mode(struct txz_file *file);
-static void add_txz_line(char const *str, uintmax_t line_num);
-static void parse_all_txz_lines(char const *dirname, char const *tarball_path);
-static void free_txz_lines(void);
 static void check_txz_file(char const *tarball_path, char const *dirname, struct txz_file *file);
 static void check_directory(struct txz_file *file, char const *dirname, char const *tarball_path);
 static struct txz_file *alloc_txz_file(char const *path, char const *dirname, char *perms, bool isdir,
         bool isfile, bool isexec, intmax_t length);
 static void count_and_sum(char const *tarball_path, intmax_t *sum, intmax_t *count, intmax_t length);
 static bool has_special_bits(struct txz_file *file);
-static void add_txz_file_to_list(struct txz_file *file);
+static void record_txz_file(struct txz_file *file);
 static void free_txz_file(struct txz_file **file);
-static void free_txz_files_list(void);
+#if defined(TXZCHK_USE_LZMA)
+static void read_txz(char const *dirname, char const *tarball_path);
+static bool read_tar_block(struct txz_reader *reader, unsigned char *block);
+static uintmax_t tar_number(unsigned char const *field, size_t len, bool *ok);
+static void add_tar_entry(unsigned char const *block, char const *name, uintmax_t size, char const *dirname,
+        char const *tarball_path, intmax_t *sum, intmax_t *count);
+#endif
 
 
 #endif /* INCLUDE_TXZCHK_H */